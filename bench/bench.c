@@ -0,0 +1,125 @@
+/**
+ * @file bench.c
+ * @brief Medição e estatísticas dos micro-benchmarks.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "bench.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+#define BENCH_UNIT "ciclos"
+
+// SysTick contando ciclos de clk_sys: 24 bits, decrescente (uma amostra cabe em 2^24 ciclos)
+static void clock_init(void) {
+    systick_hw->csr = 0;
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5;  // Fonte: clock do processador; habilitado, sem interrupção
+}
+
+static inline uint32_t clock_now(void) {
+    return systick_hw->cvr;
+}
+
+static inline uint32_t clock_elapsed(uint32_t start) {
+    return (start - systick_hw->cvr) & 0x00FFFFFF;
+}
+#else
+#include <time.h>
+
+#define BENCH_UNIT "ns"
+
+static void clock_init(void) {
+}
+
+static inline uint32_t clock_now(void) {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t)(now.tv_sec * 1000000000ull + now.tv_nsec);
+}
+
+static inline uint32_t clock_elapsed(uint32_t start) {
+    return clock_now() - start;
+}
+#endif
+
+static uint32_t measure(bench_fn_t run, uint32_t iterations) {
+    uint32_t start = clock_now();
+    run(iterations);
+    return clock_elapsed(start);
+}
+
+static void sort(double *values, int count) {
+    for (int i = 1; i < count; i++) {
+        double value = values[i];
+        int j = i;
+        while (j > 0 && values[j - 1] > value) {
+            values[j] = values[j - 1];
+            j--;
+        }
+        values[j] = value;
+    }
+}
+
+static void run_case(const struct bench_case *c) {
+    double samples[BENCH_SAMPLES];
+    double deviations[BENCH_SAMPLES];
+
+    // Aquece caches e preditores e dobra as iterações até a amostra durar o alvo
+    uint32_t iterations = 1;
+    c->run(1);
+    while (iterations < (1u << 24) && measure(c->run, iterations) < BENCH_SAMPLE_TARGET / 2) {
+        iterations *= 2;
+    }
+
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        samples[i] = (double)measure(c->run, iterations) / iterations;
+    }
+    sort(samples, BENCH_SAMPLES);
+
+    double median = samples[BENCH_SAMPLES / 2];
+    for (int i = 0; i < BENCH_SAMPLES; i++) {
+        deviations[i] = fabs(samples[i] - median);
+    }
+    sort(deviations, BENCH_SAMPLES);
+    double mad = deviations[BENCH_SAMPLES / 2];
+
+    // Postos que cercam a mediana com 95% de confiança: (n - 1) / 2 -+ 1,96 * sqrt(n) / 2
+    double half_width = 1.96 * sqrt(BENCH_SAMPLES) / 2;
+    int low = (int)floor((BENCH_SAMPLES - 1) / 2.0 - half_width);
+    int high = (int)ceil((BENCH_SAMPLES - 1) / 2.0 + half_width);
+    low = low < 0 ? 0 : low;
+    high = high > BENCH_SAMPLES - 1 ? BENCH_SAMPLES - 1 : high;
+
+    printf("%-22s %10.1f %10.1f %10.1f %7.1f%% %10.1f %9u\n", c->name, median, samples[low], samples[high],
+           median > 0 ? 100 * mad / median : 0, samples[0], (unsigned)iterations);
+}
+
+void bench_run_all(const char *filter) {
+    clock_init();
+
+#if PICO_ON_DEVICE
+    printf("#bench begin: %s por operação, clk_sys %u MHz\n", BENCH_UNIT,
+           (unsigned)(clock_get_hz(clk_sys) / 1000000));
+#else
+    printf("#bench begin: %s por operação\n", BENCH_UNIT);
+#endif
+    printf("%-22s %10s %10s %10s %8s %10s %9s\n", "caso", "mediana", "ic95 inf", "ic95 sup", "mad", "mínimo",
+           "iterações");
+
+    for (size_t i = 0; i < bench_case_count; i++) {
+        if (filter == NULL || strstr(bench_cases[i].name, filter)) {
+            run_case(&bench_cases[i]);
+        }
+    }
+    printf("#bench end\n");
+}
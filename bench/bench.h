@@ -0,0 +1,50 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+/**
+ * @file bench.h
+ * @brief Micro-benchmarks dos trechos executados a cada alerta e a cada tela.
+ *
+ * O mesmo conjunto de casos roda no computador (tempo em ns, pelo relógio
+ * monotônico) e no RP2040 (ciclos de clk_sys, pelo SysTick), com o resultado
+ * enviado pela USB. Cada caso é repetido até uma amostra durar cerca de
+ * BENCH_SAMPLE_TARGET unidades; das BENCH_SAMPLES amostras são exibidos a
+ * mediana, o intervalo de confiança de 95% da mediana (estatísticas de
+ * ordem), a dispersão (desvio absoluto mediano) e o mínimo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define BENCH_SAMPLES 21                ///< Amostras por caso (ímpar: a mediana é uma amostra)
+#define BENCH_SAMPLE_TARGET 1000000     ///< Duração alvo de uma amostra (ns ou ciclos)
+
+/**
+ * @brief Executa @p iterations vezes a operação medida.
+ */
+typedef void (*bench_fn_t)(uint32_t iterations);
+
+struct bench_case {
+    const char *name;
+    bench_fn_t run;
+};
+
+extern const struct bench_case bench_cases[];
+extern const size_t bench_case_count;
+
+/**
+ * @brief Impede o compilador de descartar um resultado não usado.
+ */
+static inline void bench_keep(const void *p) {
+    __asm__ volatile("" : : "r"(p) : "memory");
+}
+
+/**
+ * @brief Mede e exibe os casos cujo nome contém @p filter (NULL = todos).
+ */
+void bench_run_all(const char *filter);
+
+#endif // BENCH_H
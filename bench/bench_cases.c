@@ -0,0 +1,183 @@
+/**
+ * @file bench_cases.c
+ * @brief Casos medidos: montagem e resposta da requisição, desenho no display, resumo da atualização e áudio.
+ *
+ * Os dados de entrada são os do uso real: a mensagem mais longa, a linha de
+ * status da API, o texto de uma tela de status e uma página de flash da
+ * imagem baixada pela atualização.
+ *
+ * A decodificação IMA-ADPCM é medida por buffer de AUDIO_BUFFER_SAMPLES
+ * amostras, o trabalho de cada interrupção de fim de buffer da reprodução.
+ *
+ * A montagem da requisição é medida de três formas, com a mesma saída: pelo
+ * modelo gerado na compilação (a mensagem de fábrica), pelo modelo dividido
+ * em tempo de execução (mensagem trocada pelo console) e pelo caminho
+ * anterior aos modelos, com os campos preenchidos por snprintf(), o texto
+ * codificado por url_encode() em um buffer à parte e a requisição montada
+ * por snprintf().
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include <stdio.h>
+
+#include "alert_template.h"
+#include "audio_pwm.h"
+#include "bench.h"
+#include "callmebot_whatsapp.h"
+#include "sha256.h"
+#include "ssd1306.h"
+
+#define BENCH_PHONE "+5500000000000"
+#define BENCH_APIKEY "0000000"
+
+static const char response_text[] =
+    "HTTP/1.1 200 OK\r\nContent-Type: text/html; charset=UTF-8\r\nConnection: close\r\n\r\n";
+
+static struct pbuf response = {
+    .payload = (void *)response_text,
+    .tot_len = sizeof(response_text) - 1,
+    .len = sizeof(response_text) - 1,
+};
+
+// Mensagem 1 com os campos já preenchidos, para o caminho com snprintf()
+#define BENCH_MESSAGE_FORMAT "Estou bem, mas gostaria de conversar. Me ligue por favor? (%02d:%02d, pedido %u)"
+
+static const struct alert_values values = {
+    .time_s = 14 * 3600 + 5 * 60,
+    .rssi = -58,
+    .attempt = 2,
+    .battery = 87,
+};
+
+static char encoded[512];
+static char message[256];
+static struct alert_segment custom_segments[ALERT_TEMPLATE_MAX_SEGMENTS];
+static char request[1024];
+static uint8_t frame[ssd1306_buffer_length];
+static uint8_t page[256];
+static struct sha256 hash;
+static uint8_t adpcm[AUDIO_BUFFER_SAMPLES / 2];
+static int16_t pcm[AUDIO_BUFFER_SAMPLES];
+
+static void bench_url_encode(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        url_encode(MESSAGE_1, encoded, sizeof(encoded));
+        bench_keep(encoded);
+    }
+}
+
+static void bench_build_request(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        whatsapp_build_request(request, sizeof(request), &alert_template_defaults[1], &values, BENCH_PHONE,
+                               BENCH_APIKEY);
+        bench_keep(request);
+    }
+}
+
+static void bench_build_request_custom(uint32_t iterations) {
+    struct alert_template custom = {.source = MESSAGE_1, .segments = custom_segments};
+    custom.count = (uint8_t)alert_template_split(MESSAGE_1, custom_segments, ALERT_TEMPLATE_MAX_SEGMENTS,
+                                                 &custom.fields);
+
+    for (uint32_t i = 0; i < iterations; i++) {
+        whatsapp_build_request(request, sizeof(request), &custom, &values, BENCH_PHONE, BENCH_APIKEY);
+        bench_keep(request);
+    }
+}
+
+static void bench_build_request_snprintf(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        snprintf(message, sizeof(message), BENCH_MESSAGE_FORMAT, (int)(values.time_s / 3600),
+                 (int)(values.time_s / 60 % 60), (unsigned)values.attempt);
+        url_encode(message, encoded, sizeof(encoded));
+        snprintf(request, sizeof(request),
+                 "GET /whatsapp.php?phone=%s&text=%s&apikey=%s HTTP/1.1\r\n"
+                 "Host: %s\r\n"
+                 "Connection: close\r\n"
+                 "User-Agent: Mozilla/5.0\r\n"
+                 "Accept: */*\r\n\r\n",
+                 BENCH_PHONE, encoded, BENCH_APIKEY, SERVER_HOSTNAME);
+        bench_keep(request);
+    }
+}
+
+static void bench_parse_status(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        volatile int code = whatsapp_parse_status(&response);
+        (void)code;
+    }
+}
+
+static void bench_draw_string(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        ssd1306_draw_string(frame, 8, 24, "AJUDA A CAMINHO");
+        bench_keep(frame);
+    }
+}
+
+static void bench_draw_char(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        ssd1306_draw_char(frame, (int16_t)(i & 0x78), 16, 'A' + (i & 15));
+        bench_keep(frame);
+    }
+}
+
+static void bench_set_pixel(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        ssd1306_set_pixel(frame, (int)(i & 127), (int)((i >> 7) & 63), i & 1);
+        bench_keep(frame);
+    }
+}
+
+static void bench_draw_line(uint32_t iterations) {
+    for (uint32_t i = 0; i < iterations; i++) {
+        ssd1306_draw_line(frame, 0, 0, ssd1306_width - 1, ssd1306_height - 1, true);
+        bench_keep(frame);
+    }
+}
+
+// Uma página de flash (FLASH_PAGE_SIZE) no resumo incremental do download
+static void bench_sha256_page(uint32_t iterations) {
+    sha256_init(&hash);
+    for (uint32_t i = 0; i < iterations; i++) {
+        page[0] = (uint8_t)i;
+        sha256_update(&hash, page, sizeof(page));
+        bench_keep(&hash);
+    }
+}
+
+// Um buffer da reprodução de áudio: o trabalho da interrupção de fim de buffer
+static void bench_adpcm_buffer(uint32_t iterations) {
+    struct audio_adpcm_state state = {0, 0};
+
+    for (uint i = 0; i < sizeof(adpcm); i++) {
+        adpcm[i] = (uint8_t)(i * 0x5B + 0x17); // Códigos variados
+    }
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint n = 0; n < AUDIO_BUFFER_SAMPLES; n++) {
+            uint8_t byte = adpcm[n >> 1];
+            pcm[n] = audio_adpcm_decode(&state, (n & 1) ? byte >> 4 : byte & 0x0F);
+        }
+        bench_keep(pcm);
+    }
+}
+
+const struct bench_case bench_cases[] = {
+    {"url_encode", bench_url_encode},
+    {"montagem_requisicao", bench_build_request},
+    {"montagem_modelo_console", bench_build_request_custom},
+    {"montagem_snprintf", bench_build_request_snprintf},
+    {"resposta_http", bench_parse_status},
+    {"draw_string", bench_draw_string},
+    {"draw_char", bench_draw_char},
+    {"set_pixel", bench_set_pixel},
+    {"draw_line", bench_draw_line},
+    {"sha256_pagina", bench_sha256_page},
+    {"decodificacao_adpcm", bench_adpcm_buffer},
+};
+
+const size_t bench_case_count = sizeof(bench_cases) / sizeof(bench_cases[0]);
@@ -0,0 +1,46 @@
+/**
+ * @file bench_main.c
+ * @brief Programa dos micro-benchmarks, no computador ou no RP2040.
+ *
+ * No computador, mede os casos uma vez e termina; um argumento opcional
+ * filtra os casos pelo nome. No RP2040, repete a medição a cada
+ * BENCH_PERIOD_MS enquanto o monitor serial USB estiver conectado.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "pico/stdlib.h"
+#include "bench.h"
+
+#if PICO_ON_DEVICE
+#include "pico/stdio_usb.h"
+
+#define BENCH_PERIOD_MS 10000
+
+int main(void) {
+    stdio_init_all();
+
+    while (true) {
+        if (stdio_usb_connected()) {
+            bench_run_all(NULL);
+        }
+        sleep_ms(BENCH_PERIOD_MS);
+    }
+}
+#else
+#include "sim.h"
+
+// A HAL simulada encerra a execução por aqui; os benchmarks não têm relatório a exibir
+void sim_finish(int status) {
+    exit(status);
+}
+
+int main(int argc, char **argv) {
+    bench_run_all(argc > 1 ? argv[1] : NULL);
+    return 0;
+}
+#endif
@@ -0,0 +1,209 @@
+/**
+ * @file bootloader.c
+ * @brief Carregador da atualização pela rede: troca os slots e desfaz imagens não aprovadas.
+ *
+ * Gravado no início da flash (OTA_BOOT_SIZE), no lugar do firmware. A cada
+ * partida lê o bloco de controle (inc/ota_slots.h) e:
+ *
+ * 1. com uma troca pedida, confere o SHA-256 do slot B, troca os slots setor a
+ *    setor e marca a imagem nova como em teste;
+ * 2. com a imagem em teste e sem aprovação, isto é, quando a imagem nova
+ *    reiniciou (watchdog, falha ou falta de energia) antes de ser aprovada
+ *    pelo firmware (inc/ota_update.h), desfaz a troca;
+ * 3. arma o watchdog, aponta o VTOR para a tabela de vetores do slot A e salta
+ *    para o firmware.
+ *
+ * O carregador não tem a chave da assinatura: o firmware só pede a troca
+ * depois de verificá-la, e o resumo conferido aqui protege o slot B contra
+ * uma gravação corrompida. O watchdog fica armado durante a troca, que é
+ * retomada de onde parou depois de um reset.
+ *
+ * Na simulação (host/) é chamado antes do firmware, sobre a mesma flash
+ * simulada, e retorna em vez de saltar.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/watchdog.h"
+#include "ota_slots.h"
+#include "sha256.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/structs/scb.h"
+#endif
+
+static uint8_t sector_buffer[FLASH_SECTOR_SIZE];  // Fonte das programações, na SRAM
+
+static const uint8_t *flash_at(uint32_t offset) {
+    return (const uint8_t *)(uintptr_t)(XIP_BASE + offset);
+}
+
+// Programa campos do bloco de controle, página a página
+static void program_control(const void *field, const void *data, size_t length) {
+    uint32_t offset = OTA_CONTROL_OFFSET + (uint32_t)((const uint8_t *)field - flash_at(OTA_CONTROL_OFFSET));
+    const uint8_t *src = data;
+
+    while (length) {
+        uint32_t page_offset = offset & ~(FLASH_PAGE_SIZE - 1u);
+        size_t start = offset - page_offset;
+        size_t count = length < FLASH_PAGE_SIZE - start ? length : FLASH_PAGE_SIZE - start;
+
+        memset(sector_buffer, 0xFF, FLASH_PAGE_SIZE);
+        memcpy(sector_buffer + start, src, count);
+        flash_range_program(page_offset, sector_buffer, FLASH_PAGE_SIZE);
+
+        offset += count;
+        src += count;
+        length -= count;
+    }
+}
+
+static void mark(const struct ota_control *control, enum ota_mark mark) {
+    static const uint32_t set = OTA_MARK_SET;
+    program_control(&control->marks[mark], &set, sizeof(set));
+}
+
+static bool step_done(const struct ota_control *control, int pass, uint32_t step) {
+    return !(control->progress[pass][step / 8] & 1u << step % 8);
+}
+
+// Alguma etapa da passagem concluída: a partir daí os slots já não são os do pedido
+static bool pass_started(const struct ota_control *control, int pass) {
+    for (uint32_t i = 0; i < OTA_PROGRESS_BYTES; i++) {
+        if (control->progress[pass][i] != 0xFF) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void step_mark(const struct ota_control *control, int pass, uint32_t step) {
+    uint8_t value = (uint8_t)~(1u << step % 8);
+    program_control(&control->progress[pass][step / 8], &value, 1);
+}
+
+// A flash não é lida durante a operação: a origem passa antes pela SRAM
+static void copy_sector(uint32_t to, uint32_t from) {
+    memcpy(sector_buffer, flash_at(from), FLASH_SECTOR_SIZE);
+    flash_range_erase(to, FLASH_SECTOR_SIZE);
+    for (uint32_t page = 0; page < FLASH_SECTOR_SIZE; page += FLASH_PAGE_SIZE) {
+        for (uint32_t i = 0; i < FLASH_PAGE_SIZE; i++) {
+            if (sector_buffer[page + i] != 0xFF) {
+                flash_range_program(to + page, sector_buffer + page, FLASH_PAGE_SIZE);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Troca os slots A e B, retomando pelo mapa de progresso da passagem.
+ *
+ * Um setor sem etapa concluída e igual nos dois slots é pulado: a decisão não
+ * muda entre partidas, porque nenhum dos dois foi tocado.
+ */
+static void swap(const struct ota_control *control, int pass) {
+    for (uint32_t sector = 0; sector < OTA_SLOT_SECTORS; sector++) {
+        uint32_t a = OTA_APP_OFFSET + sector * FLASH_SECTOR_SIZE;
+        uint32_t b = OTA_DOWNLOAD_OFFSET + sector * FLASH_SECTOR_SIZE;
+        uint32_t first = sector * OTA_STEP_COUNT;
+
+        if (!step_done(control, pass, first) && memcmp(flash_at(a), flash_at(b), FLASH_SECTOR_SIZE) == 0) {
+            continue;
+        }
+        for (uint32_t step = 0; step < OTA_STEP_COUNT; step++) {
+            if (step_done(control, pass, first + step)) {
+                continue;
+            }
+            if (step == OTA_STEP_SAVE) {
+                copy_sector(OTA_SCRATCH_OFFSET, a);
+            } else if (step == OTA_STEP_INSTALL) {
+                copy_sector(a, b);
+            } else {
+                copy_sector(b, OTA_SCRATCH_OFFSET);
+            }
+            step_mark(control, pass, first + step);
+            watchdog_update();
+        }
+    }
+}
+
+static bool image_valid(const struct ota_control *control) {
+    uint8_t digest[SHA256_SIZE];
+    struct sha256 ctx;
+
+    if (control->image_size == 0 || control->image_size > OTA_SLOT_SIZE) {
+        return false;
+    }
+    sha256_init(&ctx);
+    for (uint32_t offset = 0; offset < control->image_size; offset += FLASH_SECTOR_SIZE) {
+        uint32_t left = control->image_size - offset;
+        sha256_update(&ctx, flash_at(OTA_DOWNLOAD_OFFSET + offset), left < FLASH_SECTOR_SIZE ? left : FLASH_SECTOR_SIZE);
+        watchdog_update();
+    }
+    sha256_final(&ctx, digest);
+    return memcmp(digest, control->digest, SHA256_SIZE) == 0;
+}
+
+static void update(const struct ota_control *control) {
+    if (!ota_control_marked(control, OTA_MARK_SWAPPED)) {
+        // Depois da primeira etapa, de qualquer setor (os iguais nos dois slots são
+        // pulados), o slot B já tem parte da imagem anterior
+        if (!pass_started(control, 0) && !image_valid(control)) {
+            mark(control, OTA_MARK_REJECTED);
+            return;
+        }
+        swap(control, 0);
+        mark(control, OTA_MARK_SWAPPED);
+    }
+
+    if (!ota_control_marked(control, OTA_MARK_TRIAL)) {
+        mark(control, OTA_MARK_TRIAL);
+        return;
+    }
+
+    // Partida com a imagem em teste sem aprovação: volta à anterior
+    if (!ota_control_marked(control, OTA_MARK_REVERTING)) {
+        mark(control, OTA_MARK_REVERTING);
+    }
+    swap(control, 1);
+    mark(control, OTA_MARK_REVERTED);
+}
+
+#if PICO_ON_DEVICE
+static void __attribute__((noreturn)) start_app(void) {
+    const uint32_t *vectors = (const uint32_t *)(uintptr_t)(XIP_BASE + OTA_APP_OFFSET + OTA_VECTOR_OFFSET);
+
+    scb_hw->vtor = (uintptr_t)vectors;
+    __asm volatile(
+        "msr msp, %0\n"
+        "bx %1\n"
+        :
+        : "r"(vectors[0]), "r"(vectors[1]));
+    __builtin_unreachable();
+}
+#endif
+
+int main(void) {
+    const struct ota_control *control = ota_control_get();
+
+    // Até o firmware assumir o watchdog (supervisor_init), uma imagem travada reinicia aqui
+    watchdog_enable(OTA_BOOT_WATCHDOG_MS, true);
+
+    if (control->magic == OTA_CONTROL_MAGIC && !ota_control_marked(control, OTA_MARK_CONFIRMED) &&
+        !ota_control_marked(control, OTA_MARK_REVERTED) && !ota_control_marked(control, OTA_MARK_REJECTED)) {
+        update(control);
+    }
+    watchdog_update();
+
+#if PICO_ON_DEVICE
+    start_app();
+#else
+    return 0;
+#endif
+}
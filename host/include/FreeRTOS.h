@@ -0,0 +1,40 @@
+#ifndef SIM_FREERTOS_H
+#define SIM_FREERTOS_H
+
+/**
+ * @file FreeRTOS.h
+ * @brief HAL simulada: tipos e macros do FreeRTOS usados pela variante FreeRTOS.
+ *
+ * Não há kernel: as tarefas e as filas são simuladas em sim_freertos.c sobre
+ * o relógio virtual e os dois núcleos da simulação. A configuração é a mesma
+ * do firmware (inc/FreeRTOSConfig.h).
+ */
+
+#include <stdint.h>
+
+#include "FreeRTOSConfig.h"
+
+typedef long BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdFALSE ((BaseType_t)0)
+#define pdTRUE  ((BaseType_t)1)
+#define pdPASS  pdTRUE
+#define pdFAIL  pdFALSE
+
+#define portMAX_DELAY ((TickType_t)0xFFFFFFFFu)
+#define pdMS_TO_TICKS(ms) ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000u))
+
+/**
+ * @brief Código em uma "interrupção": um evento da simulação em execução.
+ */
+BaseType_t sim_freertos_in_isr(void);
+
+#define portCHECK_IF_IN_ISR() sim_freertos_in_isr()
+
+// A troca de tarefa pedida pela interrupção acontece quando o núcleo volta a executar
+#define portYIELD_FROM_ISR(woken) ((void)(woken))
+
+#endif // SIM_FREERTOS_H
@@ -0,0 +1,15 @@
+#ifndef CREDENTIALS_H
+#define CREDENTIALS_H
+
+/**
+ * @file credentials.h
+ * @brief Credenciais fictícias da simulação, usadas quando inc/credentials.h não existe.
+ */
+
+#define SSID "rede_simulada"
+#define PASSWORD "senha_simulada"
+#define PHONE_NUMBER "+5500000000000"
+#define API_KEY "0000000"
+#define OTA_KEY "chave_simulada"
+
+#endif // CREDENTIALS_H
@@ -0,0 +1,16 @@
+#ifndef SIM_HARDWARE_ADC_H
+#define SIM_HARDWARE_ADC_H
+
+/**
+ * @file hardware/adc.h
+ * @brief HAL simulada: ADC de 12 bits, só com a entrada do VSYS (--vsys).
+ */
+
+#include "pico/stdlib.h"
+
+void adc_init(void);
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+uint16_t adc_read(void);
+
+#endif // SIM_HARDWARE_ADC_H
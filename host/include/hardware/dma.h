@@ -0,0 +1,50 @@
+#ifndef SIM_HARDWARE_DMA_H
+#define SIM_HARDWARE_DMA_H
+
+/**
+ * @file hardware/dma.h
+ * @brief HAL simulada: os canais são reservados, mas nenhuma transferência ocorre.
+ *
+ * A simulação é compilada com trechos de áudio vazios, então audio_play()
+ * nunca inicia o PWM-DAC.
+ */
+
+#include "pico/stdlib.h"
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2
+};
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+typedef struct {
+    volatile uint32_t ints0;
+    volatile uint32_t ints1;
+} dma_hw_t;
+
+extern dma_hw_t sim_dma_hw;
+#define dma_hw (&sim_dma_hw)
+
+int dma_claim_unused_channel(bool required);
+int dma_claim_unused_timer(bool required);
+uint dma_get_timer_dreq(uint timer_num);
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to);
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger);
+void dma_channel_set_irq1_enabled(uint channel, bool enabled);
+void dma_channel_start(uint channel);
+void dma_channel_abort(uint channel);
+
+#endif // SIM_HARDWARE_DMA_H
@@ -0,0 +1,26 @@
+#ifndef SIM_HARDWARE_FLASH_H
+#define SIM_HARDWARE_FLASH_H
+
+/**
+ * @file hardware/flash.h
+ * @brief HAL simulada: flash QSPI de 2 MB, lida pelo XIP.
+ *
+ * O XIP é um vetor na memória do computador; programar só leva bits de 1 a
+ * 0 e apagar devolve o setor a 0xFF, como no chip. As operações consomem
+ * tempo virtual e podem ser interrompidas por uma queda de energia simulada
+ * (sim_main.c, --power-cut).
+ */
+
+#include "pico/stdlib.h"
+
+#define FLASH_PAGE_SIZE       (1u << 8)
+#define FLASH_SECTOR_SIZE     (1u << 12)
+#define PICO_FLASH_SIZE_BYTES (2 * 1024 * 1024)
+
+extern uint8_t sim_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)sim_flash)
+
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+
+#endif // SIM_HARDWARE_FLASH_H
@@ -0,0 +1,24 @@
+#ifndef SIM_HARDWARE_I2C_H
+#define SIM_HARDWARE_I2C_H
+
+/**
+ * @file hardware/i2c.h
+ * @brief HAL simulada: as escritas no endereço do SSD1306 alimentam um display virtual.
+ */
+
+#include "pico/stdlib.h"
+
+typedef struct i2c_inst {
+    uint index;
+} i2c_inst_t;
+
+extern i2c_inst_t sim_i2c0_inst;
+extern i2c_inst_t sim_i2c1_inst;
+#define i2c0 (&sim_i2c0_inst)
+#define i2c1 (&sim_i2c1_inst)
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+
+#endif // SIM_HARDWARE_I2C_H
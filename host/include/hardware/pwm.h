@@ -0,0 +1,46 @@
+#ifndef SIM_HARDWARE_PWM_H
+#define SIM_HARDWARE_PWM_H
+
+/**
+ * @file hardware/pwm.h
+ * @brief HAL simulada: PWM dos buzzers (nível e período registrados por pino).
+ */
+
+#include "pico/stdlib.h"
+
+enum pwm_chan {
+    PWM_CHAN_A = 0,
+    PWM_CHAN_B = 1
+};
+
+typedef struct {
+    uint32_t csr;
+    uint32_t div;
+    uint32_t top;
+} pwm_config;
+
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t div;
+    volatile uint32_t ctr;
+    volatile uint32_t cc;
+    volatile uint32_t top;
+} pwm_slice_hw_t;
+
+typedef struct {
+    pwm_slice_hw_t slice[8];
+} pwm_hw_t;
+
+extern pwm_hw_t sim_pwm_hw;
+#define pwm_hw (&sim_pwm_hw)
+
+static inline uint pwm_gpio_to_slice_num(uint gpio) { return (gpio >> 1) & 7u; }
+static inline uint pwm_gpio_to_channel(uint gpio) { return gpio & 1u; }
+
+pwm_config pwm_get_default_config(void);
+void pwm_init(uint slice_num, pwm_config *c, bool start);
+void pwm_set_gpio_level(uint gpio, uint16_t level);
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract);
+void pwm_set_wrap(uint slice_num, uint16_t wrap);
+
+#endif // SIM_HARDWARE_PWM_H
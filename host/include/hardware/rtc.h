@@ -0,0 +1,25 @@
+#ifndef SIM_HARDWARE_RTC_H
+#define SIM_HARDWARE_RTC_H
+
+/**
+ * @file hardware/rtc.h
+ * @brief HAL simulada: RTC contado pelo temporizador do chip, parado no dormant como o real.
+ */
+
+#include "pico/stdlib.h"
+
+typedef struct {
+    int16_t year;
+    int8_t month;
+    int8_t day;
+    int8_t dotw;
+    int8_t hour;
+    int8_t min;
+    int8_t sec;
+} datetime_t;
+
+void rtc_init(void);
+bool rtc_set_datetime(datetime_t *t);
+bool rtc_get_datetime(datetime_t *t);
+
+#endif // SIM_HARDWARE_RTC_H
@@ -0,0 +1,21 @@
+#ifndef SIM_HARDWARE_STRUCTS_IOBANK0_H
+#define SIM_HARDWARE_STRUCTS_IOBANK0_H
+
+/**
+ * @file hardware/structs/iobank0.h
+ * @brief HAL simulada: bordas brutas dos pinos (INTR0..INTR3).
+ *
+ * Quatro bits por pino, como no RP2040; as bordas são registradas por
+ * sim_gpio_set_input() e apagadas por gpio_acknowledge_irq().
+ */
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t intr[4];
+} iobank0_hw_t;
+
+extern iobank0_hw_t sim_iobank0_hw;
+#define iobank0_hw (&sim_iobank0_hw)
+
+#endif // SIM_HARDWARE_STRUCTS_IOBANK0_H
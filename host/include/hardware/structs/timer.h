@@ -0,0 +1,27 @@
+#ifndef SIM_HARDWARE_STRUCTS_TIMER_H
+#define SIM_HARDWARE_STRUCTS_TIMER_H
+
+/**
+ * @file hardware/structs/timer.h
+ * @brief HAL simulada: registradores brutos do temporizador.
+ *
+ * Atualizados pelo relógio virtual sempre que ele avança.
+ */
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t timehw;
+    volatile uint32_t timelw;
+    volatile uint32_t timehr;
+    volatile uint32_t timelr;
+    volatile uint32_t alarm[4];
+    volatile uint32_t armed;
+    volatile uint32_t timerawh;
+    volatile uint32_t timerawl;
+} timer_hw_t;
+
+extern timer_hw_t sim_timer_hw;
+#define timer_hw (&sim_timer_hw)
+
+#endif // SIM_HARDWARE_STRUCTS_TIMER_H
@@ -0,0 +1,11 @@
+#ifndef SIM_HARDWARE_TIMER_H
+#define SIM_HARDWARE_TIMER_H
+
+/**
+ * @file hardware/timer.h
+ * @brief HAL simulada: o temporizador é o relógio virtual (pico/stdlib.h).
+ */
+
+#include "pico/stdlib.h"
+
+#endif // SIM_HARDWARE_TIMER_H
@@ -0,0 +1,31 @@
+#ifndef SIM_HARDWARE_WATCHDOG_H
+#define SIM_HARDWARE_WATCHDOG_H
+
+/**
+ * @file hardware/watchdog.h
+ * @brief HAL simulada: um watchdog que expira no relógio virtual encerra a simulação.
+ *
+ * O reinício pedido pelo firmware (watchdog_reboot) também a encerra; uma
+ * nova execução com o mesmo --flash é a partida seguinte.
+ */
+
+#include "pico/stdlib.h"
+
+typedef struct {
+    volatile uint32_t ctrl;
+    volatile uint32_t load;
+    volatile uint32_t reason;
+    volatile uint32_t scratch[8];
+    volatile uint32_t tick;
+} watchdog_hw_t;
+
+extern watchdog_hw_t sim_watchdog_hw;
+#define watchdog_hw (&sim_watchdog_hw)
+
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug);
+void watchdog_update(void);
+void watchdog_reboot(uint32_t pc, uint32_t sp, uint32_t delay_ms);
+bool watchdog_caused_reboot(void);
+bool watchdog_enable_caused_reboot(void);
+
+#endif // SIM_HARDWARE_WATCHDOG_H
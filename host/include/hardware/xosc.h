@@ -0,0 +1,16 @@
+#ifndef SIM_HARDWARE_XOSC_H
+#define SIM_HARDWARE_XOSC_H
+
+/**
+ * @file hardware/xosc.h
+ * @brief HAL simulada: modo dormant do oscilador a cristal.
+ *
+ * xosc_dormant() para o temporizador do chip e só retorna com uma borda em um
+ * pino habilitado por gpio_set_dormant_irq_enabled().
+ */
+
+#include "pico/stdlib.h"
+
+void xosc_dormant(void);
+
+#endif // SIM_HARDWARE_XOSC_H
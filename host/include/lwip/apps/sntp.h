@@ -0,0 +1,22 @@
+#ifndef SIM_LWIP_APPS_SNTP_H
+#define SIM_LWIP_APPS_SNTP_H
+
+/**
+ * @file lwip/apps/sntp.h
+ * @brief lwIP simulado: cliente SNTP no modo de consulta.
+ *
+ * A resposta do servidor chega pelo gancho do firmware, time_sync_set(), como
+ * SNTP_SET_SYSTEM_TIME no lwIP real.
+ */
+
+#include "lwip/err.h"
+
+#define SNTP_OPMODE_POLL 0
+
+void sntp_setoperatingmode(u8_t operating_mode);
+void sntp_setservername(u8_t idx, const char *server);
+void sntp_init(void);
+void sntp_stop(void);
+u8_t sntp_enabled(void);
+
+#endif // SIM_LWIP_APPS_SNTP_H
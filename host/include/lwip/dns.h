@@ -0,0 +1,17 @@
+#ifndef SIM_LWIP_DNS_H
+#define SIM_LWIP_DNS_H
+
+/**
+ * @file lwip/dns.h
+ * @brief lwIP simulado: resolução de nomes atendida por sim_net.c.
+ */
+
+#include "lwip/err.h"
+#include "lwip/ip_addr.h"
+
+typedef void (*dns_found_callback)(const char *name, const ip_addr_t *ipaddr, void *callback_arg);
+
+void dns_setserver(u8_t numdns, const ip_addr_t *dnsserver);
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg);
+
+#endif // SIM_LWIP_DNS_H
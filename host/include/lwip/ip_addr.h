@@ -0,0 +1,26 @@
+#ifndef SIM_LWIP_IP_ADDR_H
+#define SIM_LWIP_IP_ADDR_H
+
+/**
+ * @file lwip/ip_addr.h
+ * @brief lwIP simulado: endereços IPv4 (LWIP_IPV6 desabilitado, como em lwipopts.h).
+ */
+
+#include "lwip/err.h"
+
+typedef struct ip4_addr {
+    u32_t addr;  // Ordem de rede
+} ip4_addr_t;
+
+typedef ip4_addr_t ip_addr_t;
+
+#define IP4_ADDR(ipaddr, a, b, c, d) \
+    ((ipaddr)->addr = (u32_t)(a) | (u32_t)(b) << 8 | (u32_t)(c) << 16 | (u32_t)(d) << 24)
+#define ip4_addr1(ipaddr) ((u8_t)((ipaddr)->addr))
+#define ip4_addr2(ipaddr) ((u8_t)((ipaddr)->addr >> 8))
+#define ip4_addr3(ipaddr) ((u8_t)((ipaddr)->addr >> 16))
+#define ip4_addr4(ipaddr) ((u8_t)((ipaddr)->addr >> 24))
+
+char *ip4addr_ntoa(const ip4_addr_t *addr);
+
+#endif // SIM_LWIP_IP_ADDR_H
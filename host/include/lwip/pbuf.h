@@ -0,0 +1,26 @@
+#ifndef SIM_LWIP_PBUF_H
+#define SIM_LWIP_PBUF_H
+
+/**
+ * @file lwip/pbuf.h
+ * @brief lwIP simulado: buffers de um segmento, encadeáveis como os do lwIP.
+ */
+
+#include <stdbool.h>
+
+#include "lwip/err.h"
+
+struct pbuf {
+    struct pbuf *next;
+    void *payload;
+    u16_t tot_len;
+    u16_t len;
+    bool pooled;  ///< Segmento do servidor da atualização, devolvido ao conjunto por pbuf_free
+};
+
+u16_t pbuf_copy_partial(const struct pbuf *p, void *dataptr, u16_t len, u16_t offset);
+u8_t pbuf_free(struct pbuf *p);
+void pbuf_cat(struct pbuf *head, struct pbuf *tail);
+struct pbuf *pbuf_free_header(struct pbuf *q, u16_t size);
+
+#endif // SIM_LWIP_PBUF_H
@@ -0,0 +1,14 @@
+#ifndef SIM_PICO_BINARY_INFO_H
+#define SIM_PICO_BINARY_INFO_H
+
+/**
+ * @file pico/binary_info.h
+ * @brief HAL simulada: as declarações de binary_info não geram nada.
+ */
+
+#define bi_decl(...)
+#define bi_decl_if_func_used(...)
+#define bi_2pins_with_func(...)
+#define bi_program_description(...)
+
+#endif // SIM_PICO_BINARY_INFO_H
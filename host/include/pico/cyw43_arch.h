@@ -0,0 +1,73 @@
+#ifndef SIM_PICO_CYW43_ARCH_H
+#define SIM_PICO_CYW43_ARCH_H
+
+/**
+ * @file pico/cyw43_arch.h
+ * @brief HAL simulada: chip Wi-Fi CYW43 com a pilha de rede em segundo plano.
+ *
+ * Como em pico_cyw43_arch_lwip_threadsafe_background, os callbacks do lwIP
+ * rodam em "interrupção" no núcleo 0; cyw43_arch_lwip_begin/end não travam,
+ * pois a simulação só troca de contexto em WFE.
+ */
+
+#include "pico/stdlib.h"
+#include "lwip/dns.h"
+#include "lwip/tcp.h"
+
+#define CYW43_ITF_STA 0
+#define CYW43_ITF_AP  1
+
+#define CYW43_LINK_DOWN    0
+#define CYW43_LINK_JOIN    1
+#define CYW43_LINK_NOIP    2
+#define CYW43_LINK_UP      3
+#define CYW43_LINK_FAIL    -1
+#define CYW43_LINK_NONET   -2
+#define CYW43_LINK_BADAUTH -3
+
+#define CYW43_CHANNEL_NONE      0xffffffffu
+#define CYW43_IOCTL_GET_CHANNEL 0x3a
+
+#define CYW43_NO_POWERSAVE_MODE  0
+#define CYW43_PM1_POWERSAVE_MODE 1
+#define CYW43_PM2_POWERSAVE_MODE 2
+
+#define cyw43_pm_value(pm_mode, pm2_sleep_ret_ms, li_beacon_period, li_dtim_period, li_assoc) \
+    ((li_assoc) << 20 | (li_dtim_period) << 16 | (li_beacon_period) << 12 | ((pm2_sleep_ret_ms) / 10) << 4 | (pm_mode))
+
+#define CYW43_DEFAULT_PM     cyw43_pm_value(CYW43_PM2_POWERSAVE_MODE, 200, 1, 1, 10)
+#define CYW43_AGGRESSIVE_PM  cyw43_pm_value(CYW43_PM2_POWERSAVE_MODE, 2000, 1, 1, 10)
+#define CYW43_PERFORMANCE_PM cyw43_pm_value(CYW43_PM2_POWERSAVE_MODE, 20, 1, 1, 1)
+
+#define CYW43_AUTH_OPEN           0
+#define CYW43_AUTH_WPA_TKIP_PSK   0x00200002
+#define CYW43_AUTH_WPA2_AES_PSK   0x00400004
+#define CYW43_AUTH_WPA2_MIXED_PSK 0x00400006
+
+typedef struct _cyw43_t {
+    int itf_state;
+} cyw43_t;
+
+extern cyw43_t cyw43_state;
+
+int cyw43_arch_init(void);
+void cyw43_arch_deinit(void);
+void cyw43_arch_enable_sta_mode(void);
+int cyw43_arch_wifi_connect_async(const char *ssid, const char *pw, uint32_t auth);
+void cyw43_arch_poll(void);
+int cyw43_tcpip_link_status(cyw43_t *self, int itf);
+int cyw43_wifi_get_rssi(cyw43_t *self, int32_t *rssi);
+int cyw43_wifi_get_bssid(cyw43_t *self, uint8_t bssid[6]);
+int cyw43_wifi_join(cyw43_t *self, size_t ssid_len, const uint8_t *ssid, size_t key_len, const uint8_t *key,
+                    uint32_t auth_type, const uint8_t *bssid, uint32_t channel);
+int cyw43_ioctl(cyw43_t *self, uint32_t cmd, size_t len, uint8_t *buf, uint32_t iface);
+int cyw43_wifi_pm(cyw43_t *self, uint32_t pm);
+
+bool cyw43_arch_gpio_get(uint wl_gpio);
+
+static inline void cyw43_arch_lwip_begin(void) {}
+static inline void cyw43_arch_lwip_end(void) {}
+static inline void cyw43_thread_enter(void) {}
+static inline void cyw43_thread_exit(void) {}
+
+#endif // SIM_PICO_CYW43_ARCH_H
@@ -0,0 +1,13 @@
+#ifndef SIM_PICO_MULTICORE_H
+#define SIM_PICO_MULTICORE_H
+
+/**
+ * @file pico/multicore.h
+ * @brief HAL simulada: lançamento do núcleo 1 em uma thread do sistema.
+ */
+
+#include "pico/stdlib.h"
+
+void multicore_launch_core1(void (*entry)(void));
+
+#endif // SIM_PICO_MULTICORE_H
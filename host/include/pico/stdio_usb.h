@@ -0,0 +1,13 @@
+#ifndef SIM_PICO_STDIO_USB_H
+#define SIM_PICO_STDIO_USB_H
+
+/**
+ * @file pico/stdio_usb.h
+ * @brief HAL simulada: o terminal USB é a saída padrão e está sempre conectado.
+ */
+
+#include "pico/stdlib.h"
+
+bool stdio_usb_connected(void);
+
+#endif // SIM_PICO_STDIO_USB_H
@@ -0,0 +1,136 @@
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+/**
+ * @file pico/stdlib.h
+ * @brief HAL simulada: subconjunto do Pico SDK usado pelo firmware.
+ *
+ * As funções seguem as assinaturas do SDK 1.5.1 e são implementadas em
+ * host/sim sobre um relógio virtual (sim_core.c). Só o que o firmware usa
+ * está declarado; um uso novo do SDK falha na compilação da simulação em vez
+ * de ser ignorado em silêncio.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+typedef unsigned int uint;
+
+#define _u(x) x ## u
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+#define PICO_OK             0
+#define PICO_ERROR_TIMEOUT  -1
+
+// Plataforma
+#define hard_assert(x) assert(x)
+void panic(const char *format, ...) __attribute__((noreturn));
+uint get_core_num(void);
+void tight_loop_contents(void);
+void __wfe(void);
+void __wfi(void);
+void __sev(void);
+static inline void __dmb(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+// Sem flash nem SRAM distintas: as funções ficam onde o compilador as puser
+#define __not_in_flash_func(name) name
+#define __time_critical_func(name) name
+
+// Tempo
+typedef uint64_t absolute_time_t;
+#define nil_time ((absolute_time_t)0)
+#define at_the_end_of_time ((absolute_time_t)INT64_MAX)
+
+uint64_t time_us_64(void);
+static inline uint32_t time_us_32(void) { return (uint32_t)time_us_64(); }
+static inline absolute_time_t get_absolute_time(void) { return time_us_64(); }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline uint32_t to_ms_since_boot(absolute_time_t t) { return (uint32_t)(t / 1000); }
+static inline absolute_time_t delayed_by_us(absolute_time_t t, uint64_t us) { return t + us; }
+static inline absolute_time_t delayed_by_ms(absolute_time_t t, uint32_t ms) { return t + (uint64_t)ms * 1000; }
+static inline absolute_time_t make_timeout_time_us(uint64_t us) { return delayed_by_us(get_absolute_time(), us); }
+static inline absolute_time_t make_timeout_time_ms(uint32_t ms) { return delayed_by_ms(get_absolute_time(), ms); }
+static inline int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to) { return (int64_t)(to - from); }
+static inline bool is_nil_time(absolute_time_t t) { return t == nil_time; }
+bool best_effort_wfe_or_timeout(absolute_time_t timeout);
+void sleep_us(uint64_t us);
+void sleep_ms(uint32_t ms);
+void busy_wait_us(uint64_t us);
+
+// Alarmes e temporizadores repetitivos
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+typedef struct alarm_pool alarm_pool_t;
+
+struct repeating_timer;
+typedef bool (*repeating_timer_callback_t)(struct repeating_timer *rt);
+
+struct repeating_timer {
+    int64_t delay_us;
+    alarm_pool_t *pool;
+    alarm_id_t alarm_id;
+    repeating_timer_callback_t callback;
+    void *user_data;
+};
+
+alarm_pool_t *alarm_pool_create_with_unused_hardware_alarm(uint max_timers);
+alarm_pool_t *alarm_pool_get_default(void);
+alarm_id_t alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback,
+                                      void *user_data, bool fire_if_past);
+alarm_id_t alarm_pool_add_alarm_in_ms(alarm_pool_t *pool, uint32_t ms, alarm_callback_t callback,
+                                      void *user_data, bool fire_if_past);
+bool alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t alarm_id);
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback, void *user_data,
+                            struct repeating_timer *out);
+bool cancel_repeating_timer(struct repeating_timer *timer);
+
+// Placa (boards/pico_w.h): VSYS no ADC3, compartilhado com o chip Wi-Fi; VBUS no CYW43
+#define PICO_VSYS_PIN          29
+#define CYW43_USES_VSYS_PIN    1
+#define CYW43_WL_GPIO_VBUS_PIN 2
+
+// GPIO
+#define GPIO_IN  false
+#define GPIO_OUT true
+
+enum gpio_function {
+    GPIO_FUNC_XIP = 0,
+    GPIO_FUNC_SPI = 1,
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_I2C = 3,
+    GPIO_FUNC_PWM = 4,
+    GPIO_FUNC_SIO = 5,
+    GPIO_FUNC_NULL = 0x1f,
+};
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_set_function(uint gpio, enum gpio_function fn);
+void gpio_pull_up(uint gpio);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+
+enum gpio_irq_level {
+    GPIO_IRQ_LEVEL_LOW = 0x1u,
+    GPIO_IRQ_LEVEL_HIGH = 0x2u,
+    GPIO_IRQ_EDGE_FALL = 0x4u,
+    GPIO_IRQ_EDGE_RISE = 0x8u,
+};
+
+void gpio_set_dormant_irq_enabled(uint gpio, uint32_t event_mask, bool enabled);
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask);
+
+// Entrada e saída padrão
+bool stdio_init_all(void);
+int getchar_timeout_us(uint32_t timeout_us);
+void stdio_set_chars_available_callback(void (*fn)(void *), void *param);
+
+#endif // SIM_PICO_STDLIB_H
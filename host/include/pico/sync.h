@@ -0,0 +1,29 @@
+#ifndef SIM_PICO_SYNC_H
+#define SIM_PICO_SYNC_H
+
+/**
+ * @file pico/sync.h
+ * @brief HAL simulada: travas de hardware.
+ *
+ * Só um núcleo simulado executa por vez e a troca ocorre apenas em WFE, então
+ * as travas nunca disputam; apenas mantêm a interface do SDK.
+ */
+
+#include "pico/stdlib.h"
+
+typedef volatile uint32_t spin_lock_t;
+
+spin_lock_t *spin_lock_init(uint lock_num);
+uint spin_lock_claim_unused(bool required);
+
+static inline uint32_t spin_lock_blocking(spin_lock_t *lock) {
+    (void)lock;
+    return save_and_disable_interrupts();
+}
+
+static inline void spin_unlock(spin_lock_t *lock, uint32_t status) {
+    (void)lock;
+    restore_interrupts(status);
+}
+
+#endif // SIM_PICO_SYNC_H
@@ -0,0 +1,18 @@
+#ifndef SIM_QUEUE_H
+#define SIM_QUEUE_H
+
+/**
+ * @file queue.h
+ * @brief HAL simulada: filas do FreeRTOS (sim_freertos.c).
+ */
+
+#include "FreeRTOS.h"
+
+typedef struct sim_queue *QueueHandle_t;
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue);
+
+#endif // SIM_QUEUE_H
@@ -0,0 +1,30 @@
+#ifndef SIM_TASK_H
+#define SIM_TASK_H
+
+/**
+ * @file task.h
+ * @brief HAL simulada: tarefas e notificações do FreeRTOS (sim_freertos.c).
+ */
+
+#include "FreeRTOS.h"
+
+typedef struct sim_task *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *params);
+
+BaseType_t xTaskCreateAffinitySet(TaskFunction_t code, const char *name, configSTACK_DEPTH_TYPE stack_words,
+                                  void *params, UBaseType_t priority, UBaseType_t affinity, TaskHandle_t *created);
+void vTaskStartScheduler(void);
+
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t increment);
+TickType_t xTaskGetTickCount(void);
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+char *pcTaskGetName(TaskHandle_t task);
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken);
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks);
+
+#endif // SIM_TASK_H
@@ -0,0 +1,167 @@
+#ifndef SIM_H
+#define SIM_H
+
+/**
+ * @file sim.h
+ * @brief Núcleo da simulação do firmware no computador.
+ *
+ * O relógio é virtual: o código do firmware executa em tempo zero e o relógio
+ * só avança quando os dois núcleos simulados estão parados em WFE, saltando
+ * direto para o próximo prazo ou evento. Cada núcleo roda em uma thread do
+ * sistema, mas apenas um executa por vez, e a troca acontece somente em WFE
+ * (ou nas esperas ativas), sempre na mesma ordem: a execução é determinística
+ * e muito mais rápida que o tempo real.
+ *
+ * Eventos agendados em um núcleo fazem o papel das interrupções: rodam no
+ * contexto desse núcleo no instante marcado e acordam o seu WFE. Eventos sem
+ * núcleo (SIM_NO_CORE) representam o mundo externo, como um botão pressionado.
+ *
+ * Os instantes passados a sim_event_at() e devolvidos por time_us_64() são os
+ * do temporizador do chip, que para no modo dormant; sim_now_us() é o relógio
+ * do mundo externo, que nunca para.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define SIM_NO_CORE -1  ///< Evento externo, que não acorda nenhum núcleo
+#define SIM_CHIP    -2  ///< Evento do RP2040 fora dos núcleos (watchdog), parado no dormant
+
+typedef void (*sim_handler_t)(void *arg);
+
+/**
+ * @brief Agenda um evento no relógio virtual.
+ *
+ * @param time_us Instante do evento (eventos no passado rodam na próxima troca).
+ * @param core Núcleo em cuja "interrupção" o evento roda, ou SIM_NO_CORE.
+ * @return Identificador do evento, para sim_event_cancel().
+ */
+uint32_t sim_event_at(uint64_t time_us, int core, sim_handler_t handler, void *arg);
+
+/**
+ * @brief Cancela um evento ainda não executado.
+ */
+bool sim_event_cancel(uint32_t id);
+
+/**
+ * @brief Executa @p entry como núcleo 0 até o fim da simulação. Não retorna.
+ */
+void sim_run(void (*entry)(void)) __attribute__((noreturn));
+
+/**
+ * @brief Encerra a simulação: relatórios, captura do display e código de saída.
+ */
+void sim_finish(int status) __attribute__((noreturn));
+
+/**
+ * @brief Instante do mundo externo, que continua correndo no modo dormant.
+ */
+uint64_t sim_now_us(void);
+
+/**
+ * @brief Núcleo 0 em dormant: retorna quando sim_dormant_wake() for chamada.
+ */
+void sim_dormant(void);
+
+/**
+ * @brief Encerra o dormant (borda em um pino habilitado); sem efeito fora dele.
+ */
+void sim_dormant_wake(void);
+
+/**
+ * @brief Tempo total em dormant e quantidade de entradas.
+ */
+uint64_t sim_dormant_us(uint32_t *count);
+
+/**
+ * @brief Chamada a cada retorno de um núcleo à execução, depois de um WFE ou
+ * de uma espera ativa; usada pelo escalonador das tarefas (sim_freertos.c).
+ */
+void sim_set_resume_hook(void (*hook)(uint core));
+
+/**
+ * @brief Indica se o código em execução é um evento de núcleo ("interrupção").
+ */
+bool sim_in_interrupt(void);
+
+/**
+ * @brief Mensagem da simulação, marcada com o instante virtual.
+ */
+void sim_log(const char *format, ...) __attribute__((format(printf, 1, 2)));
+
+// HAL (sim_hal.c)
+void sim_gpio_set_input(uint gpio, bool level);
+void sim_console_input(const char *line);
+void sim_hal_report(void);
+void sim_hal_observe(void);  ///< Chamada a cada avanço do relógio virtual
+void sim_power_report(void);
+uint64_t sim_i2c_busy_us(void);  ///< Tempo com o barramento I2C ocupado, pela taxa efetiva
+uint32_t sim_i2c_hz(void);       ///< Taxa efetiva do I2C com o divisor em vigor
+uint32_t sim_tone_hz(uint gpio); ///< Tom de um buzzer com os divisores em vigor, ou 0 em silêncio
+uint32_t sim_dma_timer_hz(void); ///< Taxa do temporizador de DMA com a fração em vigor
+extern uint32_t sim_vsys_mv;  ///< Tensão do VSYS lida pelo ADC
+extern bool sim_vbus;         ///< Dispositivo alimentado pela USB
+extern bool sim_watchdog_reset;  ///< A partida atual veio de um reset do watchdog (rascunho preservado)
+
+// Display SSD1306 virtual (sim_display.c)
+void sim_display_i2c_write(const uint8_t *src, size_t len);
+uint32_t sim_display_transfers(void);           ///< Transferências I2C desde o início
+uint64_t sim_display_bytes(void);               ///< Bytes escritos no barramento I2C desde o início
+const uint8_t *sim_display_page(uint index);     ///< Colunas de uma página da memória do display
+void sim_display_set_frames_dir(const char *dir);
+bool sim_display_save(const char *path);
+void sim_display_report(void);
+
+// Flash (sim_flash.c)
+bool sim_flash_open(const char *path);         ///< Imagem persistente: carregada e atualizada a cada operação
+void sim_flash_power_cut(uint32_t operation);  ///< Queda de energia no meio da operação N (a partir de 1)
+void sim_flash_report(void);
+
+/**
+ * @brief Comportamento da rede simulada (sim_net.c).
+ */
+struct sim_net_config {
+    uint32_t wifi_init_ms;   ///< Carga do firmware do chip em cyw43_arch_init()
+    uint32_t wifi_ms;        ///< Tempo até o enlace subir
+    uint32_t rejoin_ms;      ///< Idem, com BSSID e canal conhecidos (sem varredura)
+    uint32_t beacon_tu;      ///< Período de beacon do ponto de acesso, em TU de 1024 us
+    uint32_t dtim;           ///< Beacons por DTIM
+    bool wifi_fail;          ///< A associação falha (senha incorreta)
+    uint32_t dns_ms;         ///< Tempo de resposta do DNS
+    bool dns_fail;           ///< O DNS não resolve o servidor
+    uint32_t connect_ms;     ///< Tempo até a conexão TCP ser estabelecida
+    bool connect_fail;       ///< O servidor recusa a conexão
+    uint32_t response_ms;    ///< Tempo entre a requisição e a resposta HTTP
+    int http_status;         ///< Código da resposta HTTP
+    uint32_t image_kbps;     ///< Vazão do servidor da atualização, em KB/s
+    uint32_t image_drop;     ///< Bytes da imagem por conexão antes de o servidor derrubá-la (0 = nunca)
+    uint32_t image_drop_max; ///< Conexões derrubadas antes de a imagem ser entregue inteira (0 = todas)
+    bool image_no_range;     ///< O servidor da atualização ignora o Range e responde 200
+    uint32_t sntp_ms;        ///< Tempo de resposta do servidor NTP, depois do DNS
+    bool sntp_fail;          ///< O servidor NTP não responde
+    int64_t sntp_epoch;      ///< Hora UTC no início da simulação, em segundos desde 1970
+};
+
+extern struct sim_net_config sim_net;
+
+/**
+ * @brief Contadores do servidor da atualização (sim_net.c).
+ */
+struct sim_net_image_stats {
+    uint32_t requests;  ///< GET da imagem
+    uint32_t ranges;    ///< Respondidos com 206, a partir do Range
+    uint32_t drops;     ///< Conexões derrubadas
+    uint32_t stalls;    ///< Paradas com a janela cheia
+    uint64_t bytes;     ///< Bytes da imagem enviados, contando os repetidos
+};
+
+void sim_net_report(void);
+bool sim_net_load_image(const char *path);  ///< Imagem servida pelo servidor da atualização
+void sim_net_wake(void);          ///< Borda que encerrou um dormant: início da latência até o alerta
+uint64_t sim_net_radio_us(void);  ///< Tempo com o chip Wi-Fi ligado
+uint64_t sim_net_response_us(void);  ///< Instante (time_us_64()) da última resposta do CallMeBot
+struct sim_net_image_stats sim_net_image_stats(void);
+
+#endif // SIM_H
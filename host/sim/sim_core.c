@@ -0,0 +1,527 @@
+/**
+ * @file sim_core.c
+ * @brief Relógio virtual, eventos, escalonamento dos dois núcleos e alarmes.
+ *
+ * Cada núcleo simulado tem o estado de um ARMv6-M em WFE: parado ou não, o
+ * prazo do WFE com tempo limite e o registrador de evento, ligado por SEV ou
+ * por uma interrupção. Ao parar, o núcleo passa a vez para o outro, se este
+ * puder executar; quando nenhum pode, o relógio salta para o próximo prazo ou
+ * evento. A vez é passada por uma variável protegida por mutex, então só uma
+ * thread executa código do firmware em cada instante.
+ *
+ * No modo dormant o temporizador do RP2040 para, como no chip: time_us_64()
+ * fica congelado e os eventos dos núcleos e do chip (alarmes e watchdog)
+ * esperam, enquanto o relógio virtual e os eventos externos continuam. No
+ * despertar os eventos congelados são adiados pelo tempo em dormant.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdlib.h>
+
+#include "hardware/structs/timer.h"
+#include "pico/multicore.h"
+#include "sim.h"
+
+#define SIM_FOREVER UINT64_MAX
+#define SIM_MAX_ALARMS 32
+#define SIM_MAX_EVENTS 128
+
+// Evento agendado, em lista ordenada pelo instante (e pela ordem de criação)
+struct sim_event {
+    uint64_t time_us;
+    uint32_t id;
+    int core;
+    sim_handler_t handler;
+    void *arg;
+    struct sim_event *next;
+};
+
+// Estado de um núcleo simulado
+struct sim_core {
+    bool started;
+    bool waiting;        // Parado em WFE
+    bool event;          // Registrador de evento do WFE
+    uint64_t deadline;   // Fim da espera (SIM_FOREVER = só evento)
+};
+
+// Alarme de um grupo (alarm_pool_t) ou temporizador repetitivo
+struct sim_alarm {
+    alarm_id_t id;       // 0 = livre
+    uint32_t event;
+    alarm_pool_t *pool;
+    uint64_t target_us;
+    alarm_callback_t callback;
+    void *user_data;
+};
+
+struct alarm_pool {
+    uint core;
+};
+
+timer_hw_t sim_timer_hw;
+
+static uint64_t now_us = 0;      // Relógio do mundo externo
+static uint64_t frozen_us = 0;   // Tempo total com o temporizador do chip parado
+static bool dormant = false;
+static uint64_t dormant_since_us;
+static uint32_t dormant_count = 0;
+static struct sim_event *events = NULL;
+static struct sim_event event_pool[SIM_MAX_EVENTS];
+static struct sim_event *free_events = NULL;
+static bool event_pool_ready = false;
+static uint32_t next_event_id = 1;
+static struct sim_core cores[2];
+static uint current_core = 0;   // Núcleo cujo código está executando (inclusive em "interrupção")
+static uint running_core = 0;   // Thread que detém a vez
+static pthread_mutex_t baton_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t baton_cond = PTHREAD_COND_INITIALIZER;
+static void (*core1_entry)(void);
+static uint interrupt_depth = 0;  // Eventos de núcleo em execução
+static void (*resume_hook)(uint core);
+
+static struct alarm_pool default_pool = {0};
+static struct alarm_pool pools[2];
+static struct sim_alarm alarms[SIM_MAX_ALARMS];
+static alarm_id_t next_alarm_id = 1;
+
+static void set_time(uint64_t time_us) {
+    if (time_us > now_us) {
+        sim_hal_observe(); // Estado dos periféricos durante o intervalo que termina agora
+    }
+    now_us = time_us;
+    sim_timer_hw.timerawl = (uint32_t)time_us_64();
+    sim_timer_hw.timerawh = (uint32_t)(time_us_64() >> 32);
+}
+
+void sim_log(const char *format, ...) {
+    va_list args;
+    printf("[sim %9.3f] ", now_us / 1e6);
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+// Eventos em um pool fixo, como no firmware: a simulação também roda no modo sem heap
+static struct sim_event *event_alloc(void) {
+    if (!event_pool_ready) {
+        for (int i = 0; i < SIM_MAX_EVENTS; i++) {
+            event_pool[i].next = free_events;
+            free_events = &event_pool[i];
+        }
+        event_pool_ready = true;
+    }
+    if (free_events == NULL) {
+        fprintf(stderr, "simulação: mais de %d eventos pendentes\n", SIM_MAX_EVENTS);
+        abort();
+    }
+    struct sim_event *event = free_events;
+    free_events = event->next;
+    return event;
+}
+
+static void event_free(struct sim_event *event) {
+    event->next = free_events;
+    free_events = event;
+}
+
+static void event_insert(struct sim_event *event) {
+    struct sim_event **link = &events;
+    while (*link && (*link)->time_us <= event->time_us) {
+        link = &(*link)->next;
+    }
+    event->next = *link;
+    *link = event;
+}
+
+uint32_t sim_event_at(uint64_t time_us, int core, sim_handler_t handler, void *arg) {
+    struct sim_event *event = event_alloc();
+    event->time_us = time_us + (now_us - time_us_64());  // Do temporizador do chip para o relógio externo
+    event->id = next_event_id++;
+    event->core = core;
+    event->handler = handler;
+    event->arg = arg;
+    event_insert(event);
+    return event->id;
+}
+
+bool sim_event_cancel(uint32_t id) {
+    for (struct sim_event **link = &events; *link; link = &(*link)->next) {
+        if ((*link)->id == id) {
+            struct sim_event *event = *link;
+            *link = event->next;
+            event_free(event);
+            return true;
+        }
+    }
+    return false;
+}
+
+// Eventos do chip não ocorrem com o temporizador parado
+static bool frozen(const struct sim_event *event) {
+    return dormant && event->core != SIM_NO_CORE;
+}
+
+// Primeiro evento que pode ocorrer, ou NULL
+static struct sim_event **next_event(void) {
+    struct sim_event **link = &events;
+    while (*link && frozen(*link)) {
+        link = &(*link)->next;
+    }
+    return *link ? link : NULL;
+}
+
+// Executa os eventos vencidos no contexto dos respectivos núcleos
+static void run_due_events(void) {
+    struct sim_event **link;
+    while ((link = next_event()) && (*link)->time_us <= now_us) {
+        struct sim_event *event = *link;
+        *link = event->next;
+
+        uint saved = current_core;
+        if (event->core >= 0) {
+            current_core = (uint)event->core;
+            interrupt_depth++;
+        }
+        event->handler(event->arg);
+        if (event->core >= 0) {
+            interrupt_depth--;
+        }
+        current_core = saved;
+
+        if (event->core >= 0) {
+            cores[event->core].event = true;  // Uma interrupção encerra o WFE
+        }
+        event_free(event);
+    }
+}
+
+static bool runnable(uint core) {
+    const struct sim_core *c = &cores[core];
+    return c->started && (!c->waiting || c->event || now_us >= c->deadline);
+}
+
+// Entrega a vez a outro núcleo e espera recebê-la de volta
+static void switch_to(uint self, uint next) {
+    if (next != self) {
+        pthread_mutex_lock(&baton_lock);
+        running_core = next;
+        pthread_cond_broadcast(&baton_cond);
+        while (running_core != self) {
+            pthread_cond_wait(&baton_cond, &baton_lock);
+        }
+        pthread_mutex_unlock(&baton_lock);
+    }
+    current_core = self;
+}
+
+// Escolhe o próximo núcleo a executar, avançando o relógio se nenhum puder
+static void reschedule(uint self) {
+    uint next;
+
+    while (true) {
+        run_due_events();
+
+        // O outro núcleo tem a preferência, para alternar de forma justa
+        if (runnable(self ^ 1)) {
+            next = self ^ 1;
+            break;
+        }
+        if (runnable(self)) {
+            next = self;
+            break;
+        }
+
+        struct sim_event **next = next_event();
+        uint64_t wake = next ? (*next)->time_us : SIM_FOREVER;
+        for (uint i = 0; i < 2; i++) {
+            if (cores[i].started && cores[i].waiting && cores[i].deadline < wake) {
+                wake = cores[i].deadline;
+            }
+        }
+        if (wake == SIM_FOREVER) {
+            sim_log("nenhum evento pendente e os dois núcleos em WFE sem prazo");
+            sim_finish(1);
+        }
+        set_time(wake);
+    }
+
+    if (cores[next].waiting) {
+        cores[next].waiting = false;
+        cores[next].event = false;  // O WFE consome o evento que o encerrou
+    }
+    switch_to(self, next);
+}
+
+// WFE com prazo opcional do núcleo que detém a vez
+static void wait_event(uint64_t deadline) {
+    uint self = running_core;
+    cores[self].waiting = true;
+    cores[self].deadline = deadline;
+    reschedule(self);
+    if (resume_hook) {
+        resume_hook(self);
+    }
+}
+
+static void *core1_thread(void *arg) {
+    pthread_mutex_lock(&baton_lock);
+    while (running_core != 1) {
+        pthread_cond_wait(&baton_cond, &baton_lock);
+    }
+    pthread_mutex_unlock(&baton_lock);
+    current_core = 1;
+
+    core1_entry();
+
+    // O núcleo 1 retornou: nunca mais é escolhido
+    cores[1].started = false;
+    reschedule(1);
+    return NULL;
+}
+
+void sim_run(void (*entry)(void)) {
+    set_time(0);
+    cores[0].started = true;
+    running_core = current_core = 0;
+    entry();
+    sim_log("main() retornou");
+    sim_finish(0);
+}
+
+void multicore_launch_core1(void (*entry)(void)) {
+    pthread_t thread;
+    core1_entry = entry;
+    cores[1] = (struct sim_core){.started = true};
+    pthread_create(&thread, NULL, core1_thread, NULL);
+    pthread_detach(thread);
+}
+
+void sim_set_resume_hook(void (*hook)(uint core)) {
+    resume_hook = hook;
+}
+
+bool sim_in_interrupt(void) {
+    return interrupt_depth > 0;
+}
+
+uint get_core_num(void) {
+    return current_core;
+}
+
+uint64_t time_us_64(void) {
+    return (dormant ? dormant_since_us : now_us) - frozen_us;
+}
+
+void sim_dormant(void) {
+    dormant = true;
+    dormant_since_us = now_us;
+    dormant_count++;
+    while (dormant) {
+        wait_event(SIM_FOREVER);
+    }
+}
+
+void sim_dormant_wake(void) {
+    if (!dormant) {
+        return;
+    }
+
+    // Os eventos do chip são adiados pelo tempo em que o temporizador ficou parado
+    uint64_t elapsed = now_us - dormant_since_us;
+    struct sim_event *chip = NULL, **tail = &chip;
+    for (struct sim_event **link = &events; *link;) {
+        struct sim_event *event = *link;
+        if (frozen(event)) {
+            *link = event->next;
+            event->next = NULL;
+            *tail = event;
+            tail = &event->next;
+        } else {
+            link = &event->next;
+        }
+    }
+    while (chip) {
+        struct sim_event *event = chip;
+        chip = event->next;
+        event->time_us += elapsed;
+        event_insert(event);
+    }
+
+    frozen_us += elapsed;
+    dormant = false;
+    cores[0].event = true;  // O núcleo que entrou em dormant volta a executar
+}
+
+uint64_t sim_dormant_us(uint32_t *count) {
+    *count = dormant_count;
+    return frozen_us + (dormant ? now_us - dormant_since_us : 0);
+}
+
+uint64_t sim_now_us(void) {
+    return now_us;
+}
+
+void __wfe(void) {
+    wait_event(SIM_FOREVER);
+}
+
+void __wfi(void) {
+    wait_event(SIM_FOREVER);
+}
+
+void __sev(void) {
+    cores[0].event = true;
+    cores[1].event = true;
+}
+
+bool best_effort_wfe_or_timeout(absolute_time_t timeout) {
+    if (time_us_64() >= timeout) {
+        return true;
+    }
+    wait_event(timeout + (now_us - time_us_64()));  // Prazo do chip no relógio externo
+    return time_us_64() >= timeout;
+}
+
+// Esperas ativas consomem tempo virtual e deixam o outro núcleo executar
+void busy_wait_us(uint64_t us) {
+    uint64_t deadline = now_us + us;
+    while (now_us < deadline) {
+        wait_event(deadline);
+    }
+}
+
+void sleep_us(uint64_t us) {
+    busy_wait_us(us);
+}
+
+void sleep_ms(uint32_t ms) {
+    busy_wait_us((uint64_t)ms * 1000);
+}
+
+void tight_loop_contents(void) {
+    wait_event(now_us + 1);
+}
+
+uint32_t save_and_disable_interrupts(void) {
+    return 0;  // As "interrupções" só rodam nas trocas de núcleo
+}
+
+void restore_interrupts(uint32_t status) {
+    (void)status;
+}
+
+void panic(const char *format, ...) {
+    va_list args;
+    printf("[sim %9.3f] panic: ", now_us / 1e6);
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+    sim_finish(2);
+}
+
+// Alarmes
+
+static struct sim_alarm *find_alarm(alarm_id_t id) {
+    for (int i = 0; i < SIM_MAX_ALARMS; i++) {
+        if (alarms[i].id == id) {
+            return &alarms[i];
+        }
+    }
+    return NULL;
+}
+
+static void alarm_fire(void *arg) {
+    struct sim_alarm *alarm = arg;
+    alarm_id_t id = alarm->id;
+
+    int64_t next = alarm->callback(id, alarm->user_data);
+    if (alarm->id != id) {
+        return;  // Cancelado pelo próprio callback
+    }
+
+    if (next == 0) {
+        alarm->id = 0;
+        return;
+    }
+
+    // Positivo: a partir do disparo previsto; negativo: a partir de agora
+    alarm->target_us = next > 0 ? alarm->target_us + (uint64_t)next : time_us_64() + (uint64_t)-next;
+    if (alarm->target_us < time_us_64()) {
+        alarm->target_us = time_us_64();
+    }
+    alarm->event = sim_event_at(alarm->target_us, (int)alarm->pool->core, alarm_fire, alarm);
+}
+
+alarm_pool_t *alarm_pool_create_with_unused_hardware_alarm(uint max_timers) {
+    (void)max_timers;
+    alarm_pool_t *pool = &pools[get_core_num()];
+    pool->core = get_core_num();
+    return pool;
+}
+
+alarm_pool_t *alarm_pool_get_default(void) {
+    return &default_pool;
+}
+
+alarm_id_t alarm_pool_add_alarm_in_us(alarm_pool_t *pool, uint64_t us, alarm_callback_t callback,
+                                      void *user_data, bool fire_if_past) {
+    (void)fire_if_past;
+    struct sim_alarm *alarm = find_alarm(0);
+    if (alarm == NULL) {
+        return -1;
+    }
+
+    alarm->id = next_alarm_id++;
+    alarm->pool = pool;
+    alarm->target_us = time_us_64() + us;
+    alarm->callback = callback;
+    alarm->user_data = user_data;
+    alarm->event = sim_event_at(alarm->target_us, (int)pool->core, alarm_fire, alarm);
+    return alarm->id;
+}
+
+alarm_id_t alarm_pool_add_alarm_in_ms(alarm_pool_t *pool, uint32_t ms, alarm_callback_t callback,
+                                      void *user_data, bool fire_if_past) {
+    return alarm_pool_add_alarm_in_us(pool, (uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool alarm_pool_cancel_alarm(alarm_pool_t *pool, alarm_id_t alarm_id) {
+    (void)pool;
+    struct sim_alarm *alarm = alarm_id > 0 ? find_alarm(alarm_id) : NULL;
+    if (alarm == NULL) {
+        return false;
+    }
+    sim_event_cancel(alarm->event);
+    alarm->id = 0;
+    return true;
+}
+
+static int64_t repeating_timer_callback(alarm_id_t id, void *user_data) {
+    struct repeating_timer *rt = user_data;
+    if (!rt->callback(rt)) {
+        return 0;
+    }
+    return rt->delay_us < 0 ? -rt->delay_us : rt->delay_us;
+}
+
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback, void *user_data,
+                            struct repeating_timer *out) {
+    out->delay_us = (int64_t)delay_ms * 1000;
+    out->pool = alarm_pool_get_default();
+    out->callback = callback;
+    out->user_data = user_data;
+
+    uint64_t first = out->delay_us < 0 ? (uint64_t)-out->delay_us : (uint64_t)out->delay_us;
+    out->alarm_id = alarm_pool_add_alarm_in_us(out->pool, first, repeating_timer_callback, out, true);
+    return out->alarm_id > 0;
+}
+
+bool cancel_repeating_timer(struct repeating_timer *timer) {
+    return alarm_pool_cancel_alarm(timer->pool, timer->alarm_id);
+}
@@ -0,0 +1,209 @@
+/**
+ * @file sim_display.c
+ * @brief Display SSD1306 virtual, alimentado pelas escritas I2C do firmware.
+ *
+ * Interpreta o protocolo do controlador (byte de controle, comandos com
+ * argumentos, endereçamento horizontal por janela de colunas e páginas) e
+ * mantém a memória de 128x64 pixels. Cada quadro diferente do anterior pode
+ * ser gravado em PBM com --frames, e o último com --screenshot. Os pixels
+ * acesos aparecem em preto. O relatório traz o tempo do painel aceso,
+ * escurecido (contraste abaixo de SIM_DIM_CONTRAST) e apagado, medido pelo
+ * relógio do mundo externo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "sim.h"
+
+#define SIM_WIDTH 128
+#define SIM_PAGES 8
+#define SIM_DIM_CONTRAST 0x80
+
+enum {
+    PANEL_OFF,
+    PANEL_DIM,
+    PANEL_LIT,
+    PANEL_STATES
+};
+
+static uint8_t ram[SIM_PAGES][SIM_WIDTH];
+static uint8_t saved[SIM_PAGES][SIM_WIDTH];
+static uint col_start = 0, col_end = SIM_WIDTH - 1, page_start = 0, page_end = SIM_PAGES - 1;
+static uint col = 0, page = 0;
+static bool display_on = false;
+static uint8_t contrast = 0x7F;  // Valor após o reset do controlador
+static uint64_t panel_us[PANEL_STATES];
+static uint64_t panel_since_us;
+
+// Comando em andamento e argumentos que ainda faltam
+static uint8_t command;
+static uint8_t args[6];
+static uint args_needed, args_received;
+
+static const char *frames_dir;
+static uint32_t frames_written;
+static uint32_t transfers;
+static uint64_t bytes;
+
+// Acumula o tempo no estado do painel até agora, antes de uma mudança
+static void panel_account(void) {
+    uint state = !display_on ? PANEL_OFF : contrast < SIM_DIM_CONTRAST ? PANEL_DIM : PANEL_LIT;
+    uint64_t now = sim_now_us();
+    panel_us[state] += now - panel_since_us;
+    panel_since_us = now;
+}
+
+static uint command_args(uint8_t cmd) {
+    switch (cmd) {
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB:
+        return 1;
+    case 0x21: case 0x22: case 0xA3:
+        return 2;
+    case 0x29: case 0x2A:
+        return 5;
+    case 0x26: case 0x27:
+        return 6;
+    default:
+        return 0;
+    }
+}
+
+static void execute(void) {
+    switch (command) {
+    case 0x81:
+        panel_account();
+        contrast = args[0];
+        break;
+    case 0x21:
+        col_start = args[0] & 0x7F;
+        col_end = args[1] & 0x7F;
+        col = col_start;
+        break;
+    case 0x22:
+        page_start = args[0] & 0x07;
+        page_end = args[1] & 0x07;
+        page = page_start;
+        break;
+    case 0xAE:
+        panel_account();
+        display_on = false;
+        break;
+    case 0xAF:
+        panel_account();
+        display_on = true;
+        break;
+    }
+}
+
+static void write_command(uint8_t byte) {
+    if (args_received < args_needed) {
+        args[args_received++] = byte;
+    } else {
+        command = byte;
+        args_needed = command_args(byte);
+        args_received = 0;
+    }
+    if (args_received == args_needed) {
+        execute();
+    }
+}
+
+static void write_data(uint8_t byte) {
+    ram[page][col] = byte;
+    if (++col > col_end) {
+        col = col_start;
+        if (++page > page_end) {
+            page = page_start;
+        }
+    }
+}
+
+static bool write_pbm(const char *path) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL) {
+        return false;
+    }
+
+    fprintf(file, "P4\n%d %d\n", SIM_WIDTH, SIM_PAGES * 8);
+    for (int y = 0; y < SIM_PAGES * 8; y++) {
+        for (int x = 0; x < SIM_WIDTH; x += 8) {
+            uint8_t packed = 0;
+            for (int bit = 0; bit < 8; bit++) {
+                if (display_on && ram[y / 8][x + bit] & (1 << (y % 8))) {
+                    packed |= 0x80 >> bit;
+                }
+            }
+            fputc(packed, file);
+        }
+    }
+    fclose(file);
+    return true;
+}
+
+void sim_display_i2c_write(const uint8_t *src, size_t len) {
+    size_t i = 0;
+    bool data = false;
+
+    // Com Co = 1 o byte de controle vale para um único byte; com Co = 0, para o resto
+    while (i < len) {
+        uint8_t control = src[i++];
+        size_t count = control & 0x80 ? 1 : len - i;
+        for (size_t n = 0; n < count && i < len; n++) {
+            if (control & 0x40) {
+                write_data(src[i++]);
+                data = true;
+            } else {
+                write_command(src[i++]);
+            }
+        }
+    }
+
+    transfers++;
+    bytes += len;
+    if (data && frames_dir && memcmp(ram, saved, sizeof(ram)) != 0) {
+        char path[512];
+        snprintf(path, sizeof(path), "%s/frame_%04u_%09llu.pbm", frames_dir, (unsigned)frames_written,
+                 (unsigned long long)time_us_64());
+        if (write_pbm(path)) {
+            frames_written++;
+        }
+        memcpy(saved, ram, sizeof(ram));
+    }
+}
+
+uint32_t sim_display_transfers(void) {
+    return transfers;
+}
+
+uint64_t sim_display_bytes(void) {
+    return bytes;
+}
+
+const uint8_t *sim_display_page(uint index) {
+    return ram[index];
+}
+
+void sim_display_set_frames_dir(const char *dir) {
+    frames_dir = dir;
+}
+
+bool sim_display_save(const char *path) {
+    return write_pbm(path);
+}
+
+void sim_display_report(void) {
+    printf("Display: %s, %u transferências I2C, %llu bytes", display_on ? "ligado" : "desligado",
+           (unsigned)transfers, (unsigned long long)bytes);
+    if (frames_dir) {
+        printf(", %u quadros gravados em %s", (unsigned)frames_written, frames_dir);
+    }
+    printf("\n");
+
+    panel_account();
+    printf("Painel: aceso %.1f s, escurecido %.1f s, apagado %.1f s\n", panel_us[PANEL_LIT] / 1e6,
+           panel_us[PANEL_DIM] / 1e6, panel_us[PANEL_OFF] / 1e6);
+}
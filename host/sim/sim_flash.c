@@ -0,0 +1,121 @@
+/**
+ * @file sim_flash.c
+ * @brief Flash simulada: apagamento e programação com tempo e queda de energia.
+ *
+ * A flash começa apagada, ou com a imagem do arquivo de --flash, que recebe
+ * cada operação logo depois dela: uma nova execução com o mesmo arquivo é a
+ * partida seguinte do dispositivo. Com --power-cut N, a N-ésima operação
+ * fica pela metade (a primeira metade do setor apagada, ou só a primeira
+ * metade dos bytes que mudam programada) e a simulação termina ali, sem
+ * relatórios.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "sim.h"
+
+#define SIM_FLASH_ERASE_US    45000  // Apagamento de um setor (W25Q16JV, típico)
+#define SIM_FLASH_PROGRAM_US  400    // Programação de uma página
+
+uint8_t sim_flash[PICO_FLASH_SIZE_BYTES];
+
+static FILE *image;
+static uint32_t operations = 0;
+static uint32_t cut_at = 0;          // Operação interrompida pela queda de energia, ou 0
+static uint32_t erases = 0, programs = 0;
+
+static void persist(uint32_t offset, size_t count) {
+    if (image == NULL) {
+        return;
+    }
+    fseek(image, offset, SEEK_SET);
+    fwrite(sim_flash + offset, 1, count, image);
+    fflush(image);
+}
+
+// Conta a operação; true se é a interrompida pela queda de energia
+static bool interrupted(const char *name, uint32_t offset) {
+    if (++operations != cut_at) {
+        return false;
+    }
+    sim_log("queda de energia durante a operação %u da flash (%s em 0x%06x)", (unsigned)operations, name,
+            (unsigned)offset);
+    return true;
+}
+
+static void power_cut(uint32_t offset, size_t count) {
+    persist(offset, count);
+    fflush(stdout);
+    exit(0);
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count) {
+    hard_assert(flash_offs % FLASH_SECTOR_SIZE == 0 && count % FLASH_SECTOR_SIZE == 0);
+    hard_assert(flash_offs + count <= PICO_FLASH_SIZE_BYTES);
+
+    bool cut = interrupted("apagamento", flash_offs);
+    busy_wait_us(SIM_FLASH_ERASE_US * (count / FLASH_SECTOR_SIZE));
+    memset(sim_flash + flash_offs, 0xFF, cut ? count / 2 : count);
+    if (cut) {
+        power_cut(flash_offs, count);
+    }
+    erases += count / FLASH_SECTOR_SIZE;
+    persist(flash_offs, count);
+}
+
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count) {
+    hard_assert(flash_offs % FLASH_PAGE_SIZE == 0 && count % FLASH_PAGE_SIZE == 0);
+    hard_assert(flash_offs + count <= PICO_FLASH_SIZE_BYTES);
+
+    bool cut = interrupted("programação", flash_offs);
+    size_t changing = 0;
+    for (size_t i = 0; i < count; i++) {
+        changing += data[i] != 0xFF;
+    }
+
+    busy_wait_us(SIM_FLASH_PROGRAM_US * (count / FLASH_PAGE_SIZE));
+    size_t left = cut ? changing / 2 : changing;
+    for (size_t i = 0; i < count && left; i++) {
+        if (data[i] != 0xFF) {
+            sim_flash[flash_offs + i] &= data[i];  // Só bits de 1 a 0
+            left--;
+        }
+    }
+    if (cut) {
+        power_cut(flash_offs, count);
+    }
+    programs += count / FLASH_PAGE_SIZE;
+    persist(flash_offs, count);
+}
+
+bool sim_flash_open(const char *path) {
+    memset(sim_flash, 0xFF, sizeof(sim_flash));
+
+    image = fopen(path, "r+b");
+    if (image) {
+        size_t read = fread(sim_flash, 1, sizeof(sim_flash), image);
+        (void)read;  // Um arquivo menor tem o restante apagado
+        persist(0, sizeof(sim_flash));
+        return true;
+    }
+    image = fopen(path, "w+b");
+    if (image == NULL) {
+        return false;
+    }
+    persist(0, sizeof(sim_flash));
+    return true;
+}
+
+void sim_flash_power_cut(uint32_t operation) {
+    cut_at = operation;
+}
+
+void sim_flash_report(void) {
+    printf("Flash: %u setores apagados, %u páginas programadas\n", (unsigned)erases, (unsigned)programs);
+}
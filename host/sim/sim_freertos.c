@@ -0,0 +1,404 @@
+/**
+ * @file sim_freertos.c
+ * @brief Tarefas, notificações e filas do FreeRTOS sobre os núcleos simulados.
+ *
+ * Simula o subconjunto do FreeRTOS SMP usado pela variante FreeRTOS
+ * (main_freertos.c e EVENT_LOOP_FREERTOS), no relógio virtual, para que o
+ * grafo de tarefas e a latência dos alertas possam ser testados no
+ * computador. O kernel não é incluído: o port POSIX executa as tarefas no
+ * relógio real, sem os dois núcleos da simulação.
+ *
+ * Cada tarefa é uma thread fixada em um núcleo, e só a tarefa corrente de cada
+ * núcleo executa, como os núcleos em sim_core.c. O escalonamento é o do
+ * FreeRTOS com prioridades fixas: a tarefa pronta de maior prioridade do
+ * núcleo executa, e a ociosa (a thread do núcleo) quando nenhuma está pronta.
+ * A troca acontece quando a tarefa bloqueia, quando ela acorda outra de maior
+ * prioridade no mesmo núcleo e sempre que o núcleo volta de um WFE ou de uma
+ * espera ativa, o que inclui as "interrupções" e o tique. O tique não é
+ * periódico: cada espera com prazo agenda um evento do núcleo no tique em que
+ * termina. Não há divisão de tempo entre tarefas de mesma prioridade, que a
+ * aplicação não usa.
+ *
+ * As filas e as pilhas vêm de áreas estáticas, como o heap_4 do firmware; a
+ * folga informada por uxTaskGetStackHighWaterMark() é a da pilha da thread
+ * (SIM_TASK_STACK_BYTES), não a do RP2040.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "pico/multicore.h"
+#include "queue.h"
+#include "sim.h"
+#include "task.h"
+
+#define SIM_MAX_TASKS        8
+#define SIM_TASK_STACK_BYTES (64 * 1024)  // Pilha de cada tarefa no computador
+#define SIM_TASK_NAME_LENGTH 16
+#define SIM_STACK_FILL       0xA5         // Padrão da parte ainda não usada das pilhas
+#define SIM_STACK_GUARD      64           // Bytes do fundo conferidos a cada troca
+#define SIM_MAX_QUEUES       8
+#define SIM_QUEUE_BYTES      (16 * 1024)  // Área de todas as filas
+#define SIM_FOREVER          UINT64_MAX
+#define SIM_TICK_US          (1000000u / configTICK_RATE_HZ)
+
+struct sim_task {
+    char name[SIM_TASK_NAME_LENGTH];
+    TaskFunction_t code;
+    void *params;
+    int priority;             // -1 na tarefa ociosa
+    uint core;
+    bool blocked;
+    bool woken;               // Acordada antes do prazo
+    const void *waiting_on;   // Fila, a própria tarefa (notificação) ou NULL (atraso)
+    uint64_t deadline;        // Fim da espera, no temporizador do chip
+    uint32_t notify;
+    uint8_t *stack;           // NULL na tarefa ociosa
+};
+
+struct sim_queue {
+    uint8_t *storage;
+    size_t item_size;
+    uint length;
+    uint head;
+    uint count;
+};
+
+void vApplicationMallocFailedHook(void);
+void vApplicationStackOverflowHook(TaskHandle_t task, char *name);
+
+static struct sim_task tasks[SIM_MAX_TASKS];
+static uint task_count = 0;
+static uint8_t stacks[SIM_MAX_TASKS][SIM_TASK_STACK_BYTES] __attribute__((aligned(16)));
+static struct sim_task idle[2] = {
+    {.name = "IDLE0", .priority = -1, .core = 0},
+    {.name = "IDLE1", .priority = -1, .core = 1},
+};
+static struct sim_task *running[2] = {&idle[0], &idle[1]};
+static bool started = false;
+static pthread_mutex_t task_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t task_cond = PTHREAD_COND_INITIALIZER;
+
+static struct sim_queue queues[SIM_MAX_QUEUES];
+static uint queue_count = 0;
+static uint8_t queue_area[SIM_QUEUE_BYTES];
+static size_t queue_used = 0;
+
+static bool ready(const struct sim_task *task) {
+    return !task->blocked || task->woken || time_us_64() >= task->deadline;
+}
+
+// Tarefa pronta de maior prioridade do núcleo; a corrente fica em caso de empate
+static struct sim_task *highest_ready(uint core) {
+    struct sim_task *best = ready(running[core]) ? running[core] : &idle[core];
+    for (uint i = 0; i < task_count; i++) {
+        if (tasks[i].core == core && tasks[i].priority > best->priority && ready(&tasks[i])) {
+            best = &tasks[i];
+        }
+    }
+    return best;
+}
+
+// configCHECK_FOR_STACK_OVERFLOW 2: o fundo da pilha deve manter o padrão
+static void check_stack(struct sim_task *task) {
+    if (task->stack == NULL) {
+        return;
+    }
+    for (uint i = 0; i < SIM_STACK_GUARD; i++) {
+        if (task->stack[i] != SIM_STACK_FILL) {
+            vApplicationStackOverflowHook(task, task->name);
+        }
+    }
+}
+
+// Entrega o núcleo à tarefa @p next e espera recebê-lo de volta
+static void switch_task(uint core, struct sim_task *next) {
+    struct sim_task *self = running[core];
+    if (next == self) {
+        return;
+    }
+
+    check_stack(self);
+    pthread_mutex_lock(&task_lock);
+    running[core] = next;
+    pthread_cond_broadcast(&task_cond);
+    while (running[core] != self) {
+        pthread_cond_wait(&task_cond, &task_lock);
+    }
+    pthread_mutex_unlock(&task_lock);
+}
+
+static void dispatch(uint core) {
+    switch_task(core, highest_ready(core));
+}
+
+// Preempção no retorno do núcleo: depois de interrupções, do tique ou de SEV
+static void core_resumed(uint core) {
+    if (!sim_in_interrupt()) {
+        dispatch(core);
+    }
+}
+
+// Preempção pela tarefa corrente, depois de acordar outra
+static void preempt(void) {
+    if (started && !sim_in_interrupt()) {
+        dispatch(get_core_num());
+    }
+}
+
+// Tique em que termina uma espera; o evento só acorda o núcleo
+static void tick_handler(void *arg) {
+    (void)arg;
+}
+
+static uint64_t tick_deadline(TickType_t ticks) {
+    if (ticks == portMAX_DELAY) {
+        return SIM_FOREVER;
+    }
+    return (time_us_64() / SIM_TICK_US + ticks) * SIM_TICK_US;
+}
+
+// Bloqueia a tarefa corrente até ser acordada por @p waiting_on ou até o prazo
+static void block(const void *waiting_on, uint64_t deadline) {
+    struct sim_task *self = running[get_core_num()];
+    uint32_t tick = 0;
+
+    self->blocked = true;
+    self->woken = false;
+    self->waiting_on = waiting_on;
+    self->deadline = deadline;
+    if (deadline != SIM_FOREVER) {
+        tick = sim_event_at(deadline, (int)self->core, tick_handler, NULL);
+    }
+
+    dispatch(self->core);
+
+    self->blocked = false;
+    self->waiting_on = NULL;
+    if (tick) {
+        sim_event_cancel(tick);
+    }
+}
+
+static void wake(struct sim_task *task) {
+    task->woken = true;
+    if (task->core != get_core_num() || sim_in_interrupt()) {
+        __sev();  // O núcleo da tarefa pode estar em WFE
+    }
+}
+
+static void wake_waiters(const struct sim_queue *queue) {
+    for (uint i = 0; i < task_count; i++) {
+        if (tasks[i].blocked && tasks[i].waiting_on == queue) {
+            wake(&tasks[i]);
+        }
+    }
+}
+
+static void *task_thread(void *arg) {
+    struct sim_task *task = arg;
+
+    pthread_mutex_lock(&task_lock);
+    while (running[task->core] != task) {
+        pthread_cond_wait(&task_cond, &task_lock);
+    }
+    pthread_mutex_unlock(&task_lock);
+
+    task->code(task->params);
+    panic("FreeRTOS: a tarefa %s retornou", task->name);
+    return NULL;
+}
+
+// Tarefa ociosa: a thread do núcleo, em WFE enquanto nenhuma tarefa está pronta
+static void idle_task(void) {
+    while (true) {
+        dispatch(get_core_num());
+        __wfe();
+    }
+}
+
+BaseType_t xTaskCreateAffinitySet(TaskFunction_t code, const char *name, configSTACK_DEPTH_TYPE stack_words,
+                                  void *params, UBaseType_t priority, UBaseType_t affinity, TaskHandle_t *created) {
+    (void)stack_words;
+    if (task_count == SIM_MAX_TASKS) {
+        vApplicationMallocFailedHook();
+        return pdFAIL;
+    }
+
+    struct sim_task *task = &tasks[task_count];
+    snprintf(task->name, sizeof(task->name), "%s", name);
+    task->code = code;
+    task->params = params;
+    task->priority = (int)priority;
+    task->core = (affinity & (1 << 0)) ? 0 : 1;
+    task->stack = stacks[task_count];
+    memset(task->stack, SIM_STACK_FILL, SIM_TASK_STACK_BYTES);
+
+    pthread_t thread;
+    pthread_attr_t attr;
+    pthread_attr_init(&attr);
+    pthread_attr_setstack(&attr, task->stack, SIM_TASK_STACK_BYTES);
+    if (pthread_create(&thread, &attr, task_thread, task) != 0) {
+        panic("FreeRTOS: não foi possível criar a tarefa %s", name);
+    }
+    pthread_attr_destroy(&attr);
+    pthread_detach(thread);
+
+    task_count++;
+    if (created) {
+        *created = task;
+    }
+
+    // Pronta desde já: no outro núcleo ou, se tiver prioridade maior, no lugar da corrente
+    if (started) {
+        if (task->core != get_core_num()) {
+            __sev();
+        }
+        preempt();
+    }
+    return pdPASS;
+}
+
+void vTaskStartScheduler(void) {
+    started = true;
+    sim_set_resume_hook(core_resumed);
+    multicore_launch_core1(idle_task);
+    idle_task();
+}
+
+void vTaskDelay(TickType_t ticks) {
+    if (ticks > 0) {
+        block(NULL, tick_deadline(ticks));
+    }
+}
+
+void vTaskDelayUntil(TickType_t *previous_wake, TickType_t increment) {
+    TickType_t now = xTaskGetTickCount();
+    TickType_t wake_tick = *previous_wake + increment;
+
+    *previous_wake = wake_tick;
+    if ((int32_t)(wake_tick - now) > 0) {
+        block(NULL, tick_deadline(wake_tick - now));
+    }
+}
+
+TickType_t xTaskGetTickCount(void) {
+    return (TickType_t)(time_us_64() / SIM_TICK_US);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    struct sim_task *task = running[get_core_num()];
+    return task->stack ? task : NULL;
+}
+
+char *pcTaskGetName(TaskHandle_t task) {
+    return (task ? task : running[get_core_num()])->name;
+}
+
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) {
+    const uint8_t *stack = (task ? task : running[get_core_num()])->stack;
+    size_t unused = 0;
+
+    while (stack && unused < SIM_TASK_STACK_BYTES && stack[unused] == SIM_STACK_FILL) {
+        unused++;
+    }
+    return unused / sizeof(StackType_t);
+}
+
+BaseType_t sim_freertos_in_isr(void) {
+    return sim_in_interrupt() ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    task->notify++;
+    if (task->blocked && task->waiting_on == task) {
+        wake(task);
+        preempt();
+    }
+    return pdPASS;
+}
+
+void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t *higher_priority_woken) {
+    task->notify++;
+    if (task->blocked && task->waiting_on == task) {
+        wake(task);
+        if (higher_priority_woken && task->priority > running[task->core]->priority) {
+            *higher_priority_woken = pdTRUE;
+        }
+    }
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks) {
+    struct sim_task *self = running[get_core_num()];
+
+    if (self->notify == 0 && ticks > 0) {
+        block(self, tick_deadline(ticks));
+    }
+
+    uint32_t value = self->notify;
+    if (value) {
+        self->notify = clear_on_exit ? 0 : value - 1;
+    }
+    return value;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    size_t bytes = (size_t)length * item_size;
+    if (queue_count == SIM_MAX_QUEUES || queue_used + bytes > SIM_QUEUE_BYTES) {
+        vApplicationMallocFailedHook();
+        return NULL;
+    }
+
+    struct sim_queue *queue = &queues[queue_count++];
+    queue->storage = queue_area + queue_used;
+    queue->item_size = item_size;
+    queue->length = (uint)length;
+    queue->head = queue->count = 0;
+    queue_used += (bytes + 7) & ~(size_t)7;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks) {
+    uint64_t deadline = tick_deadline(ticks);
+
+    while (queue->count == queue->length) {
+        if (ticks == 0 || sim_in_interrupt() || time_us_64() >= deadline) {
+            return pdFALSE;
+        }
+        block(queue, deadline);
+    }
+
+    uint tail = (queue->head + queue->count) % queue->length;
+    memcpy(queue->storage + tail * queue->item_size, item, queue->item_size);
+    queue->count++;
+    wake_waiters(queue);
+    preempt();
+    return pdTRUE;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *item, TickType_t ticks) {
+    uint64_t deadline = tick_deadline(ticks);
+
+    while (queue->count == 0) {
+        if (ticks == 0 || sim_in_interrupt() || time_us_64() >= deadline) {
+            return pdFALSE;
+        }
+        block(queue, deadline);
+    }
+
+    memcpy(item, queue->storage + queue->head * queue->item_size, queue->item_size);
+    queue->head = (queue->head + 1) % queue->length;
+    queue->count--;
+    wake_waiters(queue);
+    preempt();
+    return pdTRUE;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue) {
+    return queue->count;
+}
@@ -0,0 +1,592 @@
+/**
+ * @file sim_hal.c
+ * @brief Periféricos simulados: GPIO, PWM, DMA, I2C, ADC, RTC, relógios, watchdog e stdio.
+ *
+ * Os pinos dos botões são as saídas do receptor RF, que as aciona em nível
+ * alto; por isso o resistor de pull-up não altera o nível lido, que só muda
+ * com sim_gpio_set_input(). LEDs e buzzers têm as transições contadas para o
+ * resumo do fim da simulação.
+ *
+ * O clk_sys (e o clk_peri, que o acompanha) pode ser trocado pelo firmware.
+ * A cada avanço do relógio virtual, os tons dos buzzers e a taxa do I2C são
+ * calculados com os divisores em vigor e o clk_sys atual: um divisor que não
+ * foi refeito após uma troca aparece no resumo como um tom ou uma taxa errada.
+ *
+ * As bordas dos pinos ficam registradas em INTR, como no RP2040; uma borda
+ * habilitada com gpio_set_dormant_irq_enabled() encerra o xosc_dormant().
+ * O ADC lê só o VSYS, na tensão de --vsys; o RTC conta pelo temporizador do
+ * chip e, como o real, não avança no dormant. O resumo termina com o orçamento de corrente estimado pelos modelos de
+ * inc/clock_governor.h e inc/low_power.h.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+#include <time.h>
+
+#include "buzzer_led.h"
+#include "clock_governor.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "hardware/rtc.h"
+#include "hardware/structs/iobank0.h"
+#include "hardware/watchdog.h"
+#include "hardware/xosc.h"
+#include "low_power.h"
+#include "pico/cyw43_arch.h"
+#include "pico/stdio_usb.h"
+#include "pico/sync.h"
+#include "sim.h"
+#include "wifi_power.h"
+
+#define SIM_GPIO_COUNT 30
+#define SIM_CONSOLE_SIZE 512
+
+pwm_hw_t sim_pwm_hw;
+dma_hw_t sim_dma_hw;
+watchdog_hw_t sim_watchdog_hw;
+iobank0_hw_t sim_iobank0_hw;
+i2c_inst_t sim_i2c0_inst = {0};
+i2c_inst_t sim_i2c1_inst = {1};
+
+static bool gpio_level[SIM_GPIO_COUNT];
+static uint32_t gpio_rises[SIM_GPIO_COUNT];
+static uint32_t dormant_wake[SIM_GPIO_COUNT];  // Bordas que encerram o dormant
+static uint32_t pwm_starts[SIM_GPIO_COUNT];
+static uint16_t pwm_level[SIM_GPIO_COUNT];
+
+// Relógios: o clk_peri acompanha o clk_sys, como em set_sys_clock_khz() do SDK
+#define SIM_MAX_TONES 16
+static uint32_t sys_hz = 125000000;
+static uint32_t clock_switches = 0;
+static uint32_t i2c_baudrate = 0;     // Taxa pedida na última configuração
+static uint32_t i2c_peri_hz = 0;      // clk_peri na última configuração
+static uint32_t i2c_max_hz = 0;       // Maior taxa efetiva observada
+static uint64_t i2c_busy_ns = 0;      // Tempo com o barramento ocupado
+static uint32_t tones_heard[SIM_MAX_TONES];
+static uint tone_count = 0;
+
+static uint16_t dma_timer_num, dma_timer_den;  // Fração do clk_sys do temporizador de DMA
+
+static uint32_t watchdog_event;
+static uint32_t watchdog_timeout_us;
+static uint32_t watchdog_feeds;
+bool sim_watchdog_reset = false;
+
+static char console[SIM_CONSOLE_SIZE];
+static size_t console_head, console_tail;
+static void (*console_callback)(void *);
+static void *console_param;
+
+static uint32_t spin_locks_claimed;
+static spin_lock_t spin_locks[32];
+static int dma_channels_claimed;
+
+// GPIO
+
+void gpio_init(uint gpio) {
+    gpio_level[gpio] = false;
+}
+
+void gpio_set_dir(uint gpio, bool out) {
+    (void)gpio;
+    (void)out;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn) {
+    (void)gpio;
+    (void)fn;
+}
+
+void gpio_pull_up(uint gpio) {
+    (void)gpio;
+}
+
+void gpio_put(uint gpio, bool value) {
+    if (value && !gpio_level[gpio]) {
+        gpio_rises[gpio]++;
+    }
+    gpio_level[gpio] = value;
+}
+
+bool gpio_get(uint gpio) {
+    return gpio_level[gpio];
+}
+
+void sim_gpio_set_input(uint gpio, bool level) {
+    uint32_t edge = level == gpio_level[gpio] ? 0 : level ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    gpio_level[gpio] = level;
+    sim_iobank0_hw.intr[gpio / 8] |= edge << 4 * (gpio % 8);
+
+    if (edge & dormant_wake[gpio]) {
+        if (edge == GPIO_IRQ_EDGE_RISE) {
+            sim_net_wake();
+        }
+        sim_dormant_wake();
+    }
+}
+
+void gpio_set_dormant_irq_enabled(uint gpio, uint32_t event_mask, bool enabled) {
+    if (enabled) {
+        dormant_wake[gpio] |= event_mask;
+    } else {
+        dormant_wake[gpio] &= ~event_mask;
+    }
+}
+
+void gpio_acknowledge_irq(uint gpio, uint32_t event_mask) {
+    sim_iobank0_hw.intr[gpio / 8] &= ~(event_mask << 4 * (gpio % 8));
+}
+
+// Uma borda já registrada e habilitada impede a entrada, como no RP2040
+void xosc_dormant(void) {
+    for (uint gpio = 0; gpio < SIM_GPIO_COUNT; gpio++) {
+        if (dormant_wake[gpio] & sim_iobank0_hw.intr[gpio / 8] >> 4 * (gpio % 8)) {
+            return;
+        }
+    }
+    sim_log("RP2040 em dormant");
+    sim_dormant();
+    sim_log("RP2040 desperto");
+}
+
+// PWM: um nível diferente de zero é um tom (ou amostra) em andamento
+
+pwm_config pwm_get_default_config(void) {
+    return (pwm_config){.div = 1 << 4, .top = 0xFFFF};
+}
+
+void pwm_init(uint slice_num, pwm_config *c, bool start) {
+    sim_pwm_hw.slice[slice_num].div = c->div;
+    sim_pwm_hw.slice[slice_num].top = c->top;
+    sim_pwm_hw.slice[slice_num].csr = start;
+}
+
+void pwm_set_gpio_level(uint gpio, uint16_t level) {
+    if (level && !pwm_level[gpio]) {
+        pwm_starts[gpio]++;
+    }
+    pwm_level[gpio] = level;
+}
+
+void pwm_set_clkdiv_int_frac(uint slice_num, uint8_t integer, uint8_t fract) {
+    sim_pwm_hw.slice[slice_num].div = (uint32_t)integer << 4 | fract;
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+    sim_pwm_hw.slice[slice_num].top = wrap;
+}
+
+// DMA: só a reserva de canais; com os trechos de áudio vazios nada é transferido
+
+int dma_claim_unused_channel(bool required) {
+    (void)required;
+    return dma_channels_claimed++;
+}
+
+int dma_claim_unused_timer(bool required) {
+    (void)required;
+    return 0;
+}
+
+uint dma_get_timer_dreq(uint timer_num) {
+    return 0x3B + timer_num;
+}
+
+void dma_timer_set_fraction(uint timer, uint16_t numerator, uint16_t denominator) {
+    (void)timer;
+    dma_timer_num = numerator;
+    dma_timer_den = denominator;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    return (dma_channel_config){0};
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) {
+    (void)c;
+    (void)size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr) {
+    (void)c;
+    (void)incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr) {
+    (void)c;
+    (void)incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq) {
+    (void)c;
+    (void)dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to) {
+    (void)c;
+    (void)chain_to;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    (void)channel;
+    (void)config;
+    (void)write_addr;
+    (void)read_addr;
+    (void)transfer_count;
+    (void)trigger;
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger) {
+    (void)channel;
+    (void)read_addr;
+    (void)trigger;
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count, bool trigger) {
+    (void)channel;
+    (void)trans_count;
+    (void)trigger;
+}
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled) {
+    (void)channel;
+    (void)enabled;
+}
+
+void dma_channel_start(uint channel) {
+    (void)channel;
+}
+
+void dma_channel_abort(uint channel) {
+    (void)channel;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)num;
+    (void)handler;
+    (void)order_priority;
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+    (void)num;
+    (void)enabled;
+}
+
+// I2C: só o display SSD1306 está no barramento
+
+// Taxa efetiva: o divisor foi calculado sobre o clk_peri da configuração
+static uint32_t i2c_hz(void) {
+    return i2c_peri_hz ? (uint32_t)((uint64_t)i2c_baudrate * sys_hz / i2c_peri_hz) : 0;
+}
+
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate) {
+    (void)i2c;
+    i2c_baudrate = baudrate;
+    i2c_peri_hz = sys_hz;
+    return baudrate;
+}
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    return i2c_set_baudrate(i2c, baudrate);
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)i2c;
+    (void)nostop;
+    if (addr == 0x3C) {
+        sim_display_i2c_write(src, len);
+    }
+
+    // Endereço e dados com o ACK, 9 bits cada, mais as condições de início e de parada
+    uint32_t hz = i2c_hz();
+    if (hz) {
+        i2c_busy_ns += ((len + 1) * 9 + 2) * 1000000000ull / hz;
+    }
+    return (int)len;
+}
+
+// Relógios: clk_sys e clk_peri variáveis, os demais nas frequências padrão do SDK
+
+bool set_sys_clock_khz(uint32_t freq_khz, bool required) {
+    (void)required;
+    sys_hz = freq_khz * 1000;
+    clock_switches++;
+    return true;
+}
+
+void set_sys_clock_48mhz(void) {
+    set_sys_clock_khz(48000, true);
+}
+
+// ADC: só a entrada do VSYS (divisor de 1/3, referência de 3,3 V)
+
+uint32_t sim_vsys_mv = 3900;
+bool sim_vbus = false;
+static uint adc_input;
+static uint32_t adc_reads;
+
+void adc_init(void) {
+}
+
+void adc_gpio_init(uint gpio) {
+    (void)gpio;
+}
+
+void adc_select_input(uint input) {
+    adc_input = input;
+}
+
+uint16_t adc_read(void) {
+    adc_reads++;
+    return adc_input == 3 ? (uint16_t)(sim_vsys_mv * 4096 / (3 * 3300)) : 0;
+}
+
+bool cyw43_arch_gpio_get(uint wl_gpio) {
+    return wl_gpio == CYW43_WL_GPIO_VBUS_PIN && sim_vbus;
+}
+
+// RTC: a data gravada mais o tempo do temporizador do chip desde a gravação
+
+static bool rtc_set = false;
+static time_t rtc_base;
+static uint64_t rtc_base_us;
+
+void rtc_init(void) {
+    rtc_set = false;
+}
+
+bool rtc_set_datetime(datetime_t *t) {
+    struct tm tm = {
+        .tm_year = t->year - 1900,
+        .tm_mon = t->month - 1,
+        .tm_mday = t->day,
+        .tm_hour = t->hour,
+        .tm_min = t->min,
+        .tm_sec = t->sec,
+    };
+    rtc_base = timegm(&tm);
+    rtc_base_us = time_us_64();
+    rtc_set = true;
+    return true;
+}
+
+bool rtc_get_datetime(datetime_t *t) {
+    if (!rtc_set) {
+        return false;
+    }
+    time_t now = rtc_base + (time_t)((time_us_64() - rtc_base_us) / 1000000);
+    struct tm tm;
+    gmtime_r(&now, &tm);
+    *t = (datetime_t){(int16_t)(tm.tm_year + 1900), (int8_t)(tm.tm_mon + 1), (int8_t)tm.tm_mday,
+                      (int8_t)tm.tm_wday, (int8_t)tm.tm_hour, (int8_t)tm.tm_min, (int8_t)tm.tm_sec};
+    return true;
+}
+
+// Relógios da partida do SDK: clk_sys a 125 MHz
+void clocks_init(void) {
+    set_sys_clock_khz(125000, true);
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    switch (clk_index) {
+    case clk_sys:
+    case clk_peri:
+        return sys_hz;
+    case clk_usb:
+    case clk_adc:
+        return 48000000;
+    case clk_rtc:
+        return 46875;
+    default:
+        return 12000000;
+    }
+}
+
+// Travas de hardware
+
+spin_lock_t *spin_lock_init(uint lock_num) {
+    return &spin_locks[lock_num];
+}
+
+uint spin_lock_claim_unused(bool required) {
+    (void)required;
+    return 16 + spin_locks_claimed++;
+}
+
+// Watchdog: a expiração é o reinício do dispositivo, que encerra a simulação
+
+static void watchdog_expired(void *arg) {
+    (void)arg;
+    watchdog_event = 0;
+    sim_log("watchdog expirou após %u alimentações: o dispositivo reiniciaria", (unsigned)watchdog_feeds);
+    sim_finish(3);
+}
+
+void watchdog_enable(uint32_t delay_ms, bool pause_on_debug) {
+    (void)pause_on_debug;
+    watchdog_timeout_us = delay_ms * 1000;
+    watchdog_update();
+}
+
+void watchdog_update(void) {
+    if (watchdog_event) {
+        sim_event_cancel(watchdog_event);
+    }
+    watchdog_feeds++;
+    watchdog_event = sim_event_at(time_us_64() + watchdog_timeout_us, SIM_CHIP, watchdog_expired, NULL);
+}
+
+static void reboot_expired(void *arg) {
+    (void)arg;
+    sim_log("reinício pedido pelo firmware");
+    sim_finish(0);
+}
+
+void watchdog_reboot(uint32_t pc, uint32_t sp, uint32_t delay_ms) {
+    (void)pc;
+    (void)sp;
+    sim_event_at(time_us_64() + delay_ms * 1000ull, SIM_CHIP, reboot_expired, NULL);
+}
+
+bool watchdog_caused_reboot(void) {
+    return sim_watchdog_reset;
+}
+
+bool watchdog_enable_caused_reboot(void) {
+    return sim_watchdog_reset;
+}
+
+// Entrada e saída padrão: a saída é o terminal; a entrada vem de --command
+
+bool stdio_init_all(void) {
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    return true;
+}
+
+bool stdio_usb_connected(void) {
+    return true;
+}
+
+int getchar_timeout_us(uint32_t timeout_us) {
+    (void)timeout_us;
+    if (console_tail == console_head) {
+        return PICO_ERROR_TIMEOUT;
+    }
+    return (unsigned char)console[console_tail++ % SIM_CONSOLE_SIZE];
+}
+
+void stdio_set_chars_available_callback(void (*fn)(void *), void *param) {
+    console_callback = fn;
+    console_param = param;
+}
+
+void sim_console_input(const char *line) {
+    sim_log("console: %s", line);
+    for (const char *c = line; *c; c++) {
+        console[console_head++ % SIM_CONSOLE_SIZE] = *c;
+    }
+    console[console_head++ % SIM_CONSOLE_SIZE] = '\n';
+
+    if (console_callback) {
+        console_callback(console_param);
+    }
+}
+
+// Tom de um buzzer com os divisores em vigor, em Hz
+static uint32_t tone_hz(uint gpio) {
+    const pwm_slice_hw_t *slice = &sim_pwm_hw.slice[pwm_gpio_to_slice_num(gpio)];
+    return (uint32_t)(((uint64_t)sys_hz * 16 + slice->div * (slice->top + 1) / 2) / (slice->div * (slice->top + 1)));
+}
+
+static void tone_heard(uint32_t hz) {
+    for (uint i = 0; i < tone_count; i++) {
+        if (tones_heard[i] == hz) {
+            return;
+        }
+    }
+    if (tone_count < SIM_MAX_TONES) {
+        tones_heard[tone_count++] = hz;
+    }
+}
+
+void sim_hal_observe(void) {
+    const uint buzzers[] = {BUZZER1_PIN, BUZZER2_PIN};
+    for (uint i = 0; i < count_of(buzzers); i++) {
+        if (pwm_level[buzzers[i]]) {
+            tone_heard(tone_hz(buzzers[i]));
+        }
+    }
+
+    uint32_t hz = i2c_hz();
+    if (hz > i2c_max_hz) {
+        i2c_max_hz = hz;
+    }
+}
+
+void sim_hal_report(void) {
+    printf("LED verde: %u acionamentos, LED vermelho: %u acionamentos\n",
+           (unsigned)gpio_rises[LED_GREEN], (unsigned)gpio_rises[LED_RED]);
+    printf("Buzzer 1: %u tons, buzzer 2: %u tons\n",
+           (unsigned)pwm_starts[BUZZER1_PIN], (unsigned)pwm_starts[BUZZER2_PIN]);
+    printf("Watchdog: %u alimentações\n", (unsigned)watchdog_feeds);
+    printf("ADC: %u leituras do VSYS a %u mV%s\n", (unsigned)adc_reads, (unsigned)sim_vsys_mv,
+           sim_vbus ? ", na USB" : "");
+    printf("Relógio: %u trocas, clk_sys final %u MHz, I2C até %u kHz, tons ouvidos (Hz):",
+           (unsigned)clock_switches, (unsigned)(sys_hz / 1000000), (unsigned)(i2c_max_hz / 1000));
+    for (uint i = 0; i < tone_count; i++) {
+        printf(" %u", (unsigned)tones_heard[i]);
+    }
+    printf("\n");
+
+    uint64_t total_us = sim_now_us();
+    printf("I2C: barramento ocupado %.1f ms de %u s (%.4f%%)\n", i2c_busy_ns / 1e6, (unsigned)(total_us / 1000000),
+           total_us ? i2c_busy_ns / 10.0 / total_us : 0.0);
+}
+
+uint64_t sim_i2c_busy_us(void) {
+    return i2c_busy_ns / 1000;
+}
+
+uint32_t sim_i2c_hz(void) {
+    return i2c_hz();
+}
+
+uint32_t sim_tone_hz(uint gpio) {
+    return pwm_level[gpio] ? tone_hz(gpio) : 0;
+}
+
+uint32_t sim_dma_timer_hz(void) {
+    return dma_timer_den ? (uint32_t)(((uint64_t)sys_hz * dma_timer_num + dma_timer_den / 2) / dma_timer_den) : 0;
+}
+
+// Carga em uA·s ao longo de @p us a @p ua
+static uint64_t charge_uas(uint64_t us, uint32_t ua) {
+    return us / 1000 * ua / 1000;
+}
+
+void sim_power_report(void) {
+    uint32_t sleeps;
+    uint64_t total_us = sim_now_us();
+    uint64_t dormant_us = sim_dormant_us(&sleeps);
+    uint64_t radio_us = sim_net_radio_us();
+
+    // Modelos do firmware para o RP2040 acordado e o rádio; o dormant vem de inc/low_power.h
+    uint64_t charge = clock_governor_charge_uas() + wifi_power_charge_uas() +
+                      charge_uas(dormant_us, LOW_POWER_DORMANT_UA);
+    uint64_t average_ua = total_us >= 1000000 ? charge * 1000000 / total_us : 0;
+
+    printf("Energia (estimada): %u entradas em dormant, %u s de %u s em dormant, rádio ligado %u s\n",
+           (unsigned)sleeps, (unsigned)(dormant_us / 1000000), (unsigned)(total_us / 1000000),
+           (unsigned)(radio_us / 1000000));
+    printf("Corrente média %u uA; com %u mAh, autonomia de %u dias\n", (unsigned)average_ua,
+           (unsigned)LOW_POWER_BATTERY_MAH,
+           (unsigned)(average_ua ? (uint64_t)LOW_POWER_BATTERY_MAH * 1000 / average_ua / 24 : 0));
+}
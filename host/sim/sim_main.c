@@ -0,0 +1,313 @@
+/**
+ * @file sim_main.c
+ * @brief Ponto de entrada da simulação: cenário pela linha de comando.
+ *
+ * O cenário descreve quando os botões do controle são pressionados, os
+ * comandos digitados no console USB e o comportamento da rede. Ao final são
+ * exibidos os relatórios do firmware (laços de eventos e filas) e um resumo
+ * dos periféricos simulados, com a corrente média estimada e, com LOW_POWER,
+ * o tempo em dormant e a latência do despertar.
+ *
+ * Com OTA_UPDATE, o carregador (bootloader/) roda antes do firmware, sobre a
+ * mesma flash, como em cada partida do dispositivo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "button_handler.h"
+#include "event_loop.h"
+#include "heap_trap.h"
+#include "low_power.h"
+#include "ota_update.h"
+#include "sim.h"
+#include "time_sync.h"
+#include "ui_core.h"
+#include "usb_console.h"
+
+#define SIM_MAX_SCENARIO 16
+#define SIM_CLOCK_DAY 1748736000  // 2025-06-01 00:00 UTC, dia das horas de --clock
+
+int firmware_main(void);
+int bootloader_main(void);
+
+struct press {
+    uint pin;
+    char name;
+    uint32_t at_ms;
+};
+
+struct command {
+    char text[USB_CONSOLE_LINE_LENGTH + 1];
+    uint32_t at_ms;
+};
+
+static struct press presses[SIM_MAX_SCENARIO];
+static struct command commands[SIM_MAX_SCENARIO];
+static int press_count, command_count;
+static uint64_t duration_ms = 30000;
+static uint32_t hold_ms = 300;
+static uint32_t repeat_ms = 0;
+static const char *screenshot;
+static struct timespec wall_start;
+
+static const char usage[] =
+    "Uso: seguranca_senior_sim [opções]\n"
+    "  --duration MS        duração da simulação (padrão 30000)\n"
+    "  --press B@MS         pressiona o botão B (A, B, C ou D) no instante MS\n"
+    "  --hold MS            tempo com o botão pressionado (padrão 300)\n"
+    "  --command TEXTO@MS   digita TEXTO no console USB no instante MS\n"
+    "  --repeat MS          repete os botões e comandos a cada MS até o fim\n"
+    "  --wifi-ms MS         tempo até o enlace Wi-Fi subir (padrão 1500)\n"
+    "  --wifi-fail          a rede recusa a senha\n"
+    "  --wifi-init-ms MS    tempo de carga do firmware do chip Wi-Fi (padrão 300)\n"
+    "  --rejoin-ms MS       tempo da reassociação pelo BSSID guardado (padrão 500)\n"
+    "  --dtim N             beacons por DTIM do ponto de acesso (padrão 1)\n"
+    "  --dns-ms MS          tempo de resposta do DNS (padrão 40)\n"
+    "  --dns-fail           o DNS não resolve o servidor\n"
+    "  --connect-ms MS      tempo da conexão TCP (padrão 80)\n"
+    "  --connect-fail       o servidor recusa a conexão\n"
+    "  --response-ms MS     tempo até a resposta HTTP (padrão 300)\n"
+    "  --http-status N      código da resposta HTTP (padrão 200)\n"
+    "  --clock HH:MM        hora local respondida pelo servidor NTP no início (padrão 09:00)\n"
+    "  --sntp-fail          o servidor NTP não responde\n"
+    "  --vsys MV            tensão do VSYS lida pelo ADC, em mV (padrão 3900)\n"
+    "  --usb                dispositivo alimentado pela USB\n"
+    "  --flash ARQ          imagem da flash, mantida entre execuções\n"
+    "  --power-cut N        queda de energia no meio da N-ésima operação da flash\n"
+    "  --ota-image ARQ      imagem servida pelo servidor da atualização (tools/ota_pack.py)\n"
+    "  --ota-kbps N         vazão do servidor da atualização, em KB/s (padrão 400)\n"
+    "  --ota-drop BYTES     o servidor da atualização derruba cada conexão após BYTES\n"
+    "  --ota-drop-max N     derruba só as N primeiras conexões (padrão: todas)\n"
+    "  --ota-no-range       o servidor da atualização ignora o Range (sempre HTTP 200)\n"
+    "  --frames DIR         grava em DIR cada quadro novo do display (PBM)\n"
+    "  --screenshot ARQ     grava o último quadro do display (PBM)\n";
+
+static void release_handler(void *arg);
+
+static void press_handler(void *arg) {
+    struct press *press = arg;
+    if (repeat_ms == 0) {
+        sim_log("botão %c pressionado", press->name);
+    }
+    sim_gpio_set_input(press->pin, true);
+
+    sim_event_at(time_us_64() + hold_ms * 1000ull, SIM_NO_CORE, release_handler, press);
+    if (repeat_ms) {
+        sim_event_at(time_us_64() + repeat_ms * 1000ull, SIM_NO_CORE, press_handler, press);
+    }
+}
+
+static void release_handler(void *arg) {
+    struct press *press = arg;
+    sim_gpio_set_input(press->pin, false);
+}
+
+static void command_handler(void *arg) {
+    struct command *command = arg;
+    sim_console_input(command->text);
+    if (repeat_ms) {
+        sim_event_at(time_us_64() + repeat_ms * 1000ull, 0, command_handler, command);
+    }
+}
+
+static void end_handler(void *arg) {
+    (void)arg;
+    sim_finish(0);
+}
+
+void sim_finish(int status) {
+    struct timespec wall_end;
+    clock_gettime(CLOCK_MONOTONIC, &wall_end);
+    double wall_ms = (wall_end.tv_sec - wall_start.tv_sec) * 1e3 + (wall_end.tv_nsec - wall_start.tv_nsec) / 1e6;
+
+    sim_log("fim da simulação (%.0f ms de execução)", wall_ms);
+    event_loop_print_stats(0);
+    event_loop_print_stats(1);
+    ui_print_queue_stats();
+    sim_hal_report();
+    sim_net_report();
+    sim_flash_report();
+    sim_power_report();
+#if LOW_POWER
+    low_power_print();
+#endif
+    sim_display_report();
+#if NO_HEAP
+    // Qualquer alocação encerra a simulação com panic(), que termina com o código 2
+    if (status == 0) {
+        printf("Heap: nenhuma alocação (NO_HEAP)\n");
+    }
+#endif
+
+    if (screenshot && !sim_display_save(screenshot)) {
+        fprintf(stderr, "não foi possível gravar %s\n", screenshot);
+        status = status ? status : 1;
+    }
+    fflush(stdout);
+    exit(status);
+}
+
+// Separa "VALOR@MS"; devolve o instante ou -1
+static long split_at(char *text) {
+    char *at = strrchr(text, '@');
+    if (at == NULL) {
+        return -1;
+    }
+    *at = '\0';
+    return strtol(at + 1, NULL, 10);
+}
+
+static bool add_press(char *arg) {
+    static const struct {
+        char name;
+        uint pin;
+    } pins[] = {{'A', BUTTON_A}, {'B', BUTTON_B}, {'C', BUTTON_C}, {'D', BUTTON_D}};
+
+    long at = split_at(arg);
+    if (at < 0 || strlen(arg) != 1 || press_count == SIM_MAX_SCENARIO) {
+        return false;
+    }
+    for (size_t i = 0; i < count_of(pins); i++) {
+        if (pins[i].name == (arg[0] & ~0x20)) {
+            presses[press_count++] = (struct press){pins[i].pin, pins[i].name, (uint32_t)at};
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool add_command(char *arg) {
+    long at = split_at(arg);
+    if (at < 0 || command_count == SIM_MAX_SCENARIO) {
+        return false;
+    }
+    snprintf(commands[command_count].text, sizeof(commands[command_count].text), "%s", arg);
+    commands[command_count++].at_ms = (uint32_t)at;
+    return true;
+}
+
+static bool parse(int argc, char **argv) {
+    for (int i = 1; i < argc; i++) {
+        const char *opt = argv[i];
+        char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        bool takes_value = true;
+
+        if (strcmp(opt, "--wifi-fail") == 0) {
+            sim_net.wifi_fail = true;
+            takes_value = false;
+        } else if (strcmp(opt, "--dns-fail") == 0) {
+            sim_net.dns_fail = true;
+            takes_value = false;
+        } else if (strcmp(opt, "--connect-fail") == 0) {
+            sim_net.connect_fail = true;
+            takes_value = false;
+        } else if (strcmp(opt, "--ota-no-range") == 0) {
+            sim_net.image_no_range = true;
+            takes_value = false;
+        } else if (strcmp(opt, "--sntp-fail") == 0) {
+            sim_net.sntp_fail = true;
+            takes_value = false;
+        } else if (strcmp(opt, "--usb") == 0) {
+            sim_vbus = true;
+            takes_value = false;
+        } else if (value == NULL) {
+            return false;
+        } else if (strcmp(opt, "--duration") == 0) {
+            duration_ms = strtoull(value, NULL, 10);
+        } else if (strcmp(opt, "--press") == 0) {
+            if (!add_press(value)) {
+                return false;
+            }
+        } else if (strcmp(opt, "--hold") == 0) {
+            hold_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--repeat") == 0) {
+            repeat_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--command") == 0) {
+            if (!add_command(value)) {
+                return false;
+            }
+        } else if (strcmp(opt, "--wifi-ms") == 0) {
+            sim_net.wifi_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--wifi-init-ms") == 0) {
+            sim_net.wifi_init_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--rejoin-ms") == 0) {
+            sim_net.rejoin_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--dtim") == 0) {
+            sim_net.dtim = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--dns-ms") == 0) {
+            sim_net.dns_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--connect-ms") == 0) {
+            sim_net.connect_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--response-ms") == 0) {
+            sim_net.response_ms = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--http-status") == 0) {
+            sim_net.http_status = atoi(value);
+        } else if (strcmp(opt, "--clock") == 0) {
+            unsigned hour, minute;
+            if (sscanf(value, "%u:%u", &hour, &minute) != 2 || hour > 23 || minute > 59) {
+                return false;
+            }
+            sim_net.sntp_epoch = SIM_CLOCK_DAY + hour * 3600 + minute * 60 - TIME_SYNC_UTC_OFFSET_S;
+        } else if (strcmp(opt, "--vsys") == 0) {
+            sim_vsys_mv = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--flash") == 0) {
+            if (!sim_flash_open(value)) {
+                return false;
+            }
+        } else if (strcmp(opt, "--power-cut") == 0) {
+            sim_flash_power_cut((uint32_t)strtoul(value, NULL, 10));
+        } else if (strcmp(opt, "--ota-image") == 0) {
+            if (!sim_net_load_image(value)) {
+                return false;
+            }
+        } else if (strcmp(opt, "--ota-kbps") == 0) {
+            sim_net.image_kbps = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--ota-drop") == 0) {
+            sim_net.image_drop = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--ota-drop-max") == 0) {
+            sim_net.image_drop_max = (uint32_t)strtoul(value, NULL, 10);
+        } else if (strcmp(opt, "--frames") == 0) {
+            sim_display_set_frames_dir(value);
+        } else if (strcmp(opt, "--screenshot") == 0) {
+            screenshot = value;
+        } else {
+            return false;
+        }
+
+        if (takes_value) {
+            i++;
+        }
+    }
+    return true;
+}
+
+static void start(void) {
+#if OTA_ENABLED
+    bootloader_main();
+#endif
+    firmware_main();
+}
+
+int main(int argc, char **argv) {
+    if (!parse(argc, argv)) {
+        fputs(usage, stderr);
+        return 1;
+    }
+
+    for (int i = 0; i < press_count; i++) {
+        sim_event_at(presses[i].at_ms * 1000ull, SIM_NO_CORE, press_handler, &presses[i]);
+    }
+    // O console USB chega por interrupção no núcleo 0
+    for (int i = 0; i < command_count; i++) {
+        sim_event_at(commands[i].at_ms * 1000ull, 0, command_handler, &commands[i]);
+    }
+    sim_event_at(duration_ms * 1000ull, SIM_NO_CORE, end_handler, NULL);
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_start);
+    sim_run(start);
+}
@@ -0,0 +1,840 @@
+/**
+ * @file sim_net.c
+ * @brief Rede simulada: chip CYW43, DNS, TCP e SNTP do lwIP, o servidor CallMeBot e o da atualização.
+ *
+ * Substitui o lwIP em vez de usá-lo com um driver de rede do sistema: cada
+ * etapa (associação, resposta do DNS, conexão, resposta HTTP, fechamento)
+ * é um evento no núcleo 0 com a demora configurada em sim_net, assim como os
+ * callbacks do lwIP rodam em interrupção no núcleo 0 do firmware. O cenário
+ * é reproduzível e não depende de acesso à internet.
+ *
+ * O modo de economia do chip (cyw43_wifi_pm) atrasa a recepção: em PM1/PM2 o
+ * rádio fica acordado por pm2_sleep_ret após cada pacote enviado ou recebido;
+ * fora dessa janela, o ponto de acesso retém o pacote até o próximo
+ * intervalo de escuta (li_dtim DTIMs, ou li_beacon beacons).
+ *
+ * Requisições que não são para o CallMeBot vão ao servidor da atualização
+ * (inc/ota_update.h), que entrega a imagem de --ota-image em segmentos de
+ * SIM_MSS bytes na vazão configurada, respeitando a janela: com SIM_WINDOW
+ * bytes entregues e ainda não liberados por tcp_recved, o envio para. O
+ * cabeçalho Range é atendido com 206, e a conexão pode ser derrubada a cada
+ * tantos bytes para medir a retomada.
+ *
+ * O servidor NTP responde com a hora de sim_net.sntp_epoch mais o tempo do
+ * mundo externo, que corre também no dormant; o cliente repete a consulta
+ * como o do lwIP, a cada hora ou, sem resposta, a cada 15 s.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "lwip/apps/sntp.h"
+#include "sim.h"
+#include "time_sync.h"
+#include "wifi_power.h"
+
+#define SIM_PCBS 4
+#define SIM_REQUEST_SIZE 1024
+#define SIM_RESPONSE_SIZE 256
+#define SIM_DNS_QUERIES 4
+#define SIM_MSS 1460                 // TCP_MSS de inc/lwipopts.h
+#define SIM_WINDOW (8 * SIM_MSS)     // TCP_WND de inc/lwipopts.h
+#define SIM_SEGMENTS 10              // Janela cheia, com folga para o cabeçalho HTTP
+#define SIM_IMAGE_SIZE (1024 * 1024)
+#define SIM_SNTP_UPDATE_MS 3600000   // SNTP_UPDATE_DELAY do lwIP
+#define SIM_SNTP_RETRY_MS 15000      // SNTP_RETRY_TIMEOUT do lwIP
+
+struct sim_net_config sim_net = {
+    .wifi_init_ms = 300,
+    .wifi_ms = 1500,
+    .rejoin_ms = 500,
+    .beacon_tu = 100,
+    .dtim = 1,
+    .dns_ms = 40,
+    .connect_ms = 80,
+    .response_ms = 300,
+    .http_status = 200,
+    .image_kbps = 400,
+    .sntp_ms = 60,
+    .sntp_epoch = 1748779200,  // 2025-06-01 12:00 UTC
+};
+
+struct tcp_pcb {
+    bool used;
+    void *arg;
+    tcp_recv_fn recv;
+    tcp_err_fn err;
+    tcp_connected_fn connected;
+    char request[SIM_REQUEST_SIZE];
+    size_t request_len;
+    struct pbuf response;                 // Resposta entregue ao recv, do próprio pcb
+    char response_data[SIM_RESPONSE_SIZE];
+    uint32_t events[3];   // Eventos pendentes, cancelados ao liberar o pcb
+
+    // Servidor da atualização
+    bool image;           // Conexão com o servidor da atualização
+    bool stalled;         // Envio parado pela janela cheia
+    char header[SIM_RESPONSE_SIZE];
+    size_t header_len;    // Cabeçalho HTTP ainda não enviado
+    uint32_t next, end;   // Próximo byte da imagem a enviar e fim do trecho pedido
+    uint32_t sent;        // Bytes enviados nesta conexão
+    uint32_t unacked;     // Bytes entregues e ainda não liberados por tcp_recved
+    uint32_t stream_event;
+};
+
+// Segmento do servidor da atualização, em uso até o pbuf_free do firmware
+struct segment {
+    struct pbuf pbuf;
+    bool used;
+    uint8_t data[SIM_MSS];
+};
+
+cyw43_t cyw43_state;
+
+static int link_status = CYW43_LINK_DOWN;
+static struct tcp_pcb pcbs[SIM_PCBS];
+static ip_addr_t server_ip;
+static bool dns_cached = false;
+
+// Consultas de DNS em andamento, cada uma com o seu callback
+struct dns_query {
+    bool used;
+    dns_found_callback found;
+    void *arg;
+    char name[64];
+};
+
+static struct dns_query queries[SIM_DNS_QUERIES];
+
+static uint32_t requests;
+static uint32_t responses;
+static uint64_t last_response_us;  // No temporizador do chip
+
+// Servidor da atualização
+static uint8_t image[SIM_IMAGE_SIZE];
+static size_t image_size;
+static struct segment segments[SIM_SEGMENTS];
+static struct sim_net_image_stats image_stats;
+
+// Rádio ligado (entre cyw43_arch_init e cyw43_arch_deinit), no relógio externo
+static bool radio_on = false;
+static uint64_t radio_since_us;
+static uint64_t radio_total_us;
+static uint32_t link_event;
+
+// Modo de economia, no relógio externo
+static uint32_t pm;
+static uint64_t awake_until_us;
+static uint32_t pm_switches;
+static uint32_t rx_held;            // Pacotes retidos pelo ponto de acesso
+static uint64_t rx_held_total_us;
+static uint64_t rx_held_max_us;
+
+// Do despertar pelo botão até a resposta do primeiro alerta, no relógio externo
+static uint64_t wake_edge_us;
+static bool wake_pending = false;
+static uint32_t wake_alerts;
+static uint64_t wake_latency_total_us;
+static uint64_t wake_latency_max_us;
+
+// SNTP
+static bool sntp_running = false;
+static uint32_t sntp_event;
+static uint32_t sntp_queries, sntp_answers;
+
+// CYW43
+
+static void link_changed(void *arg) {
+    (void)arg;
+    link_event = 0;
+    link_status = sim_net.wifi_fail ? CYW43_LINK_BADAUTH : CYW43_LINK_UP;
+    sim_log(sim_net.wifi_fail ? "Wi-Fi: autenticação recusada" : "Wi-Fi: enlace ativo");
+}
+
+// A carga do firmware do chip bloqueia o núcleo 0, como no SDK
+int cyw43_arch_init(void) {
+    radio_on = true;
+    radio_since_us = sim_now_us();
+    pm = CYW43_DEFAULT_PM;
+    busy_wait_us(sim_net.wifi_init_ms * 1000ull);
+    awake_until_us = sim_now_us();
+    return 0;
+}
+
+void cyw43_arch_deinit(void) {
+    if (radio_on) {
+        radio_total_us += sim_now_us() - radio_since_us;
+        radio_on = false;
+        sim_log("Wi-Fi: chip desligado");
+    }
+    if (link_event) {
+        sim_event_cancel(link_event);
+        link_event = 0;
+    }
+    link_status = CYW43_LINK_DOWN;
+}
+
+void cyw43_arch_enable_sta_mode(void) {
+}
+
+static void start_join(uint32_t delay_ms) {
+    link_status = CYW43_LINK_JOIN;
+    link_event = sim_event_at(time_us_64() + delay_ms * 1000ull, 0, link_changed, NULL);
+}
+
+int cyw43_arch_wifi_connect_async(const char *ssid, const char *pw, uint32_t auth) {
+    (void)pw;
+    (void)auth;
+    sim_log("Wi-Fi: associando à rede \"%s\"", ssid);
+    start_join(sim_net.wifi_ms);
+    return 0;
+}
+
+// Com BSSID e canal conhecidos não há varredura: só autenticação, 4-way handshake e DHCP
+int cyw43_wifi_join(cyw43_t *self, size_t ssid_len, const uint8_t *ssid, size_t key_len, const uint8_t *key,
+                    uint32_t auth_type, const uint8_t *bssid, uint32_t channel) {
+    (void)self;
+    (void)key_len;
+    (void)key;
+    (void)auth_type;
+    bool cached = bssid != NULL && channel != CYW43_CHANNEL_NONE;
+    sim_log("Wi-Fi: associando à rede \"%.*s\"%s", (int)ssid_len, (const char *)ssid,
+            cached ? " pelo BSSID e canal guardados" : "");
+    start_join(cached ? sim_net.rejoin_ms : sim_net.wifi_ms);
+    return 0;
+}
+
+int cyw43_wifi_get_bssid(cyw43_t *self, uint8_t bssid[6]) {
+    (void)self;
+    static const uint8_t ap[6] = {0x02, 0x5E, 0x6E, 0x10, 0x20, 0x30};
+    if (link_status != CYW43_LINK_UP) {
+        return -1;
+    }
+    memcpy(bssid, ap, sizeof(ap));
+    return 0;
+}
+
+// Os valores do ponto de acesso só existem com o enlace ativo
+int cyw43_ioctl(cyw43_t *self, uint32_t cmd, size_t len, uint8_t *buf, uint32_t iface) {
+    (void)self;
+    (void)iface;
+    uint32_t value;
+    if (cmd == CYW43_IOCTL_GET_CHANNEL) {
+        value = 6;
+    } else if (cmd == WIFI_POWER_IOCTL_GET_BCNPRD) {
+        value = sim_net.beacon_tu;
+    } else if (cmd == WIFI_POWER_IOCTL_GET_DTIMPRD) {
+        value = sim_net.dtim;
+    } else {
+        return -1;
+    }
+    if (len < 4 || link_status != CYW43_LINK_UP) {
+        return -1;
+    }
+    memcpy(buf, &value, sizeof(value));
+    return 0;
+}
+
+// Os iovars do modo passam pelo barramento SPI: cerca de 1 ms
+int cyw43_wifi_pm(cyw43_t *self, uint32_t value) {
+    (void)self;
+    busy_wait_us(1000);
+    pm = value;
+    pm_switches++;
+    awake_until_us = sim_now_us() + (pm >> 4 & 0xff) * 10000ull;
+    if ((pm & 0xf) == CYW43_NO_POWERSAVE_MODE) {
+        sim_log("Wi-Fi: economia desligada");
+    } else {
+        sim_log("Wi-Fi: economia PM%u, acordado %u ms após o tráfego, escuta a cada %u beacons",
+                (unsigned)(pm & 0xf), (unsigned)(pm >> 4 & 0xff) * 10,
+                (unsigned)(pm >> 16 & 0xf ? (pm >> 16 & 0xf) * sim_net.dtim : pm >> 12 & 0xf));
+    }
+    return 0;
+}
+
+// Pacote enviado: o rádio fica acordado por pm2_sleep_ret
+static void radio_tx(void) {
+    uint64_t until = sim_now_us() + (pm >> 4 & 0xff) * 10000ull;
+    if (until > awake_until_us) {
+        awake_until_us = until;
+    }
+}
+
+// Instante, no temporizador do chip, em que chega um pacote enviado daqui a delay_us
+static uint64_t radio_rx_at_us(uint64_t delay_us) {
+    uint64_t sent = sim_now_us() + delay_us;
+    uint64_t arrival = sent;
+
+    if ((pm & 0xf) != CYW43_NO_POWERSAVE_MODE && sent > awake_until_us) {
+        uint32_t beacons = pm >> 16 & 0xf ? (pm >> 16 & 0xf) * sim_net.dtim : pm >> 12 & 0xf;
+        uint64_t listen_us = (uint64_t)(beacons ? beacons : 1) * sim_net.beacon_tu * 1024;
+        arrival = (sent + listen_us - 1) / listen_us * listen_us;
+        rx_held++;
+        rx_held_total_us += arrival - sent;
+        if (arrival - sent > rx_held_max_us) {
+            rx_held_max_us = arrival - sent;
+        }
+    }
+    awake_until_us = arrival + (pm >> 4 & 0xff) * 10000ull;
+    return time_us_64() + (arrival - sim_now_us());
+}
+
+static uint64_t radio_rx_at(uint32_t delay_ms) {
+    return radio_rx_at_us(delay_ms * 1000ull);
+}
+
+void cyw43_arch_poll(void) {
+}
+
+int cyw43_tcpip_link_status(cyw43_t *self, int itf) {
+    (void)self;
+    (void)itf;
+    return link_status;
+}
+
+int cyw43_wifi_get_rssi(cyw43_t *self, int32_t *rssi) {
+    (void)self;
+    *rssi = -58;
+    return 0;
+}
+
+char *ip4addr_ntoa(const ip4_addr_t *addr) {
+    static char text[16];
+    snprintf(text, sizeof(text), "%u.%u.%u.%u", ip4_addr1(addr), ip4_addr2(addr), ip4_addr3(addr),
+             ip4_addr4(addr));
+    return text;
+}
+
+// DNS: a primeira consulta demora dns_ms; as seguintes vêm do cache, como no lwIP
+
+void dns_setserver(u8_t numdns, const ip_addr_t *dnsserver) {
+    (void)numdns;
+    (void)dnsserver;
+}
+
+static void dns_answer(void *arg) {
+    struct dns_query *query = arg;
+    if (sim_net.dns_fail || link_status != CYW43_LINK_UP) {
+        sim_log("DNS: %s não encontrado", query->name);
+        query->found(query->name, NULL, query->arg);
+    } else {
+        IP4_ADDR(&server_ip, 172, 67, 180, 123);
+        dns_cached = true;
+        query->found(query->name, &server_ip, query->arg);
+    }
+    query->used = false;
+}
+
+err_t dns_gethostbyname(const char *hostname, ip_addr_t *addr, dns_found_callback found, void *callback_arg) {
+    if (dns_cached) {
+        *addr = server_ip;
+        return ERR_OK;
+    }
+
+    // Tabela cheia: ERR_MEM, como no lwIP com DNS_TABLE_SIZE consultas pendentes
+    struct dns_query *query = NULL;
+    for (int i = 0; i < SIM_DNS_QUERIES && query == NULL; i++) {
+        if (!queries[i].used) {
+            query = &queries[i];
+        }
+    }
+    if (query == NULL) {
+        return ERR_MEM;
+    }
+
+    query->used = true;
+    snprintf(query->name, sizeof(query->name), "%s", hostname);
+    query->found = found;
+    query->arg = callback_arg;
+    radio_tx();
+    sim_event_at(radio_rx_at(sim_net.dns_ms), 0, dns_answer, query);
+    return ERR_INPROGRESS;
+}
+
+// SNTP: consulta imediata no sntp_init(); a resposta chega depois do DNS do servidor
+
+static void sntp_query(void *arg);
+
+static void sntp_answer(void *arg) {
+    (void)arg;
+    if (sim_net.sntp_fail || link_status != CYW43_LINK_UP) {
+        sim_log("SNTP: sem resposta");
+        sntp_event = sim_event_at(time_us_64() + SIM_SNTP_RETRY_MS * 1000ull, 0, sntp_query, NULL);
+        return;
+    }
+    sntp_answers++;
+    time_sync_set((uint32_t)(sim_net.sntp_epoch + (int64_t)(sim_now_us() / 1000000)));
+    sntp_event = sim_event_at(time_us_64() + SIM_SNTP_UPDATE_MS * 1000ull, 0, sntp_query, NULL);
+}
+
+static void sntp_query(void *arg) {
+    (void)arg;
+    sntp_queries++;
+    radio_tx();
+    sntp_event = sim_event_at(radio_rx_at(sim_net.dns_ms + sim_net.sntp_ms), 0, sntp_answer, NULL);
+}
+
+void sntp_setoperatingmode(u8_t operating_mode) {
+    (void)operating_mode;
+}
+
+void sntp_setservername(u8_t idx, const char *server) {
+    (void)idx;
+    (void)server;
+}
+
+void sntp_init(void) {
+    sntp_running = true;
+    sntp_query(NULL);
+}
+
+void sntp_stop(void) {
+    if (sntp_running) {
+        sim_event_cancel(sntp_event);
+        sntp_running = false;
+    }
+}
+
+u8_t sntp_enabled(void) {
+    return sntp_running;
+}
+
+// TCP
+
+// Resposta do servidor daqui a delay_ms, sujeita ao modo de economia
+static void pcb_schedule(struct tcp_pcb *pcb, uint32_t delay_ms, sim_handler_t handler) {
+    for (int i = 0; i < 3; i++) {
+        if (pcb->events[i] == 0) {
+            pcb->events[i] = sim_event_at(radio_rx_at(delay_ms), 0, handler, pcb);
+            return;
+        }
+    }
+}
+
+// Chamado no início de cada evento do pcb, que deixa de estar pendente
+static void pcb_fired(struct tcp_pcb *pcb) {
+    for (int i = 0; i < 3; i++) {
+        pcb->events[i] = 0;
+    }
+}
+
+static void pcb_free(struct tcp_pcb *pcb) {
+    for (int i = 0; i < 3; i++) {
+        if (pcb->events[i]) {
+            sim_event_cancel(pcb->events[i]);
+        }
+    }
+    if (pcb->stream_event) {
+        sim_event_cancel(pcb->stream_event);
+    }
+    pcb->used = false;
+}
+
+struct tcp_pcb *tcp_new(void) {
+    for (int i = 0; i < SIM_PCBS; i++) {
+        if (!pcbs[i].used) {
+            memset(&pcbs[i], 0, sizeof(pcbs[i]));
+            pcbs[i].used = true;
+            return &pcbs[i];
+        }
+    }
+    return NULL;
+}
+
+void tcp_arg(struct tcp_pcb *pcb, void *arg) {
+    pcb->arg = arg;
+}
+
+void tcp_recv(struct tcp_pcb *pcb, tcp_recv_fn recv) {
+    pcb->recv = recv;
+}
+
+void tcp_err(struct tcp_pcb *pcb, tcp_err_fn err) {
+    pcb->err = err;
+}
+
+static void connect_done(void *arg) {
+    struct tcp_pcb *pcb = arg;
+    pcb_fired(pcb);
+
+    if (sim_net.connect_fail) {
+        // O lwIP libera o pcb antes de avisar o erro
+        tcp_err_fn err = pcb->err;
+        void *err_arg = pcb->arg;
+        sim_log("TCP: conexão recusada pelo servidor");
+        pcb_free(pcb);
+        if (err) {
+            err(err_arg, ERR_RST);
+        }
+        return;
+    }
+
+    pcb->connected(pcb->arg, pcb, ERR_OK);
+}
+
+err_t tcp_connect(struct tcp_pcb *pcb, const ip_addr_t *ipaddr, u16_t port, tcp_connected_fn connected) {
+    (void)ipaddr;
+    (void)port;
+    if (link_status != CYW43_LINK_UP) {
+        return ERR_RTE;  // Sem interface de rede ativa, não há rota
+    }
+    pcb->connected = connected;
+    radio_tx();
+    pcb_schedule(pcb, sim_net.connect_ms, connect_done);
+    return ERR_OK;
+}
+
+err_t tcp_write(struct tcp_pcb *pcb, const void *dataptr, u16_t len, u8_t apiflags) {
+    (void)apiflags;
+    if (pcb->request_len + len >= SIM_REQUEST_SIZE) {
+        return ERR_MEM;
+    }
+    memcpy(&pcb->request[pcb->request_len], dataptr, len);
+    pcb->request_len += len;
+    pcb->request[pcb->request_len] = '\0';
+    return ERR_OK;
+}
+
+// Copia o parâmetro da query string, decodificando o URL-encoding
+static void query_param(const char *request, const char *name, char *out, size_t size) {
+    const char *query = strchr(request, '?');
+    const char *end = strchr(request, ' ') ? strchr(strchr(request, ' ') + 1, ' ') : NULL;
+    size_t name_len = strlen(name);
+    size_t n = 0;
+
+    out[0] = '\0';
+    for (const char *p = query; p && p < end; p = strchr(p + 1, '&')) {
+        if (strncmp(p + 1, name, name_len) != 0 || p[1 + name_len] != '=') {
+            continue;
+        }
+        for (const char *c = p + 2 + name_len; c < end && *c != '&' && n + 1 < size; c++) {
+            if (*c == '%' && isxdigit((unsigned char)c[1]) && isxdigit((unsigned char)c[2])) {
+                char hex[3] = {c[1], c[2], '\0'};
+                out[n++] = (char)strtol(hex, NULL, 16);
+                c += 2;
+            } else {
+                out[n++] = *c == '+' ? ' ' : *c;
+            }
+        }
+        out[n] = '\0';
+        return;
+    }
+}
+
+static void deliver(struct tcp_pcb *pcb, const char *text) {
+    struct pbuf *p = &pcb->response;
+    size_t len = strlen(text);
+    if (len > sizeof(pcb->response_data)) {
+        len = sizeof(pcb->response_data);
+    }
+    p->next = NULL;
+    p->payload = pcb->response_data;
+    memcpy(p->payload, text, len);
+    p->len = p->tot_len = (u16_t)len;
+    pcb->recv(pcb->arg, pcb, p, ERR_OK);
+}
+
+static void server_close(void *arg) {
+    struct tcp_pcb *pcb = arg;
+    pcb_fired(pcb);
+    pcb->recv(pcb->arg, pcb, NULL, ERR_OK);
+}
+
+static void server_respond(void *arg) {
+    struct tcp_pcb *pcb = arg;
+    char phone[32], text[256], response[256];
+    pcb_fired(pcb);
+
+    query_param(pcb->request, "phone", phone, sizeof(phone));
+    query_param(pcb->request, "text", text, sizeof(text));
+    sim_log("CallMeBot: \"%s\" para %s -> HTTP %d", text, phone, sim_net.http_status);
+
+    responses++;
+    last_response_us = time_us_64();
+    if (wake_pending) {
+        uint64_t latency = sim_now_us() - wake_edge_us;
+        wake_pending = false;
+        wake_alerts++;
+        wake_latency_total_us += latency;
+        if (latency > wake_latency_max_us) {
+            wake_latency_max_us = latency;
+        }
+        sim_log("alerta entregue %.0f ms após a borda que despertou o dispositivo", latency / 1e3);
+    }
+    snprintf(response, sizeof(response),
+             "HTTP/1.1 %d %s\r\nContent-Type: text/html\r\nConnection: close\r\n\r\n"
+             "<p>Message queued.</p>\n",
+             sim_net.http_status, sim_net.http_status == 200 ? "OK" : "Error");
+    deliver(pcb, response);
+
+    // O recv pode ter fechado o pcb; senão o servidor encerra a conexão
+    if (pcb->used) {
+        pcb_schedule(pcb, 1, server_close);
+    }
+}
+
+// Servidor da atualização
+
+static struct pbuf *segment_alloc(void) {
+    for (int i = 0; i < SIM_SEGMENTS; i++) {
+        if (!segments[i].used) {
+            segments[i].used = true;
+            segments[i].pbuf = (struct pbuf){NULL, segments[i].data, 0, 0, true};
+            return &segments[i].pbuf;
+        }
+    }
+    return NULL;
+}
+
+// Tempo de transmissão de count bytes na vazão do servidor
+static uint64_t image_send_us(uint32_t count) {
+    uint32_t kbps = sim_net.image_kbps ? sim_net.image_kbps : 1;
+    return (uint64_t)count * 1000000 / (kbps * 1024ull);
+}
+
+static void image_send(void *arg);
+
+// A conexão atual ainda será derrubada em sim_net.image_drop bytes
+static bool image_drop(void) {
+    return sim_net.image_drop && (sim_net.image_drop_max == 0 || image_stats.drops < sim_net.image_drop_max);
+}
+
+static void image_schedule(struct tcp_pcb *pcb, uint64_t delay_us) {
+    pcb->stalled = false;
+    pcb->stream_event = sim_event_at(radio_rx_at_us(delay_us), 0, image_send, pcb);
+}
+
+// Um segmento: o cabeçalho HTTP, ou o próximo trecho da imagem que cabe na janela
+static void image_send(void *arg) {
+    struct tcp_pcb *pcb = arg;
+    pcb->stream_event = 0;
+
+    if (image_drop() && pcb->sent >= sim_net.image_drop && pcb->next < pcb->end) {
+        tcp_err_fn err = pcb->err;
+        void *err_arg = pcb->arg;
+        image_stats.drops++;
+        sim_log("Atualização: servidor derrubou a conexão no byte %u", (unsigned)pcb->next);
+        pcb_free(pcb);
+        if (err) {
+            err(err_arg, ERR_RST);
+        }
+        return;
+    }
+    if (pcb->header_len == 0 && pcb->next == pcb->end) {
+        pcb->recv(pcb->arg, pcb, NULL, ERR_OK);
+        return;
+    }
+
+    uint32_t count = pcb->header_len ? (uint32_t)pcb->header_len : pcb->end - pcb->next;
+    if (count > SIM_MSS) {
+        count = SIM_MSS;
+    }
+    if (count > SIM_WINDOW - pcb->unacked) {
+        count = SIM_WINDOW - pcb->unacked;
+    }
+    if (image_drop() && pcb->header_len == 0 && count > sim_net.image_drop - pcb->sent) {
+        count = sim_net.image_drop - pcb->sent;
+    }
+    struct pbuf *p = count ? segment_alloc() : NULL;
+    if (p == NULL) {
+        image_stats.stalls++;
+        pcb->stalled = true;  // Retomado por tcp_recved
+        return;
+    }
+
+    if (pcb->header_len) {
+        memcpy(p->payload, pcb->header, count);
+        memmove(pcb->header, pcb->header + count, pcb->header_len - count);
+        pcb->header_len -= count;
+    } else {
+        memcpy(p->payload, image + pcb->next, count);
+        pcb->next += count;
+        pcb->sent += count;
+        image_stats.bytes += count;
+    }
+    p->len = p->tot_len = (u16_t)count;
+    pcb->unacked += count;
+    pcb->recv(pcb->arg, pcb, p, ERR_OK);
+
+    if (pcb->used) {
+        image_schedule(pcb, image_send_us(count));
+    }
+}
+
+static void image_respond(void *arg) {
+    struct tcp_pcb *pcb = arg;
+    pcb_fired(pcb);
+
+    static const char range_header[] = "\r\nRange: bytes=";
+    const char *range = strstr(pcb->request, range_header);
+    uint32_t start = range ? (uint32_t)strtoul(range + strlen(range_header), NULL, 10) : 0;
+    image_stats.requests++;
+    pcb->image = true;
+
+    if (image_size == 0) {
+        sim_log("Atualização: nenhuma imagem no servidor (--ota-image) -> HTTP 404");
+        pcb->header_len = (size_t)snprintf(pcb->header, sizeof(pcb->header),
+                                           "HTTP/1.1 404 Not Found\r\nConnection: close\r\n\r\n");
+    } else if (range && !sim_net.image_no_range && start < image_size) {
+        image_stats.ranges++;
+        sim_log("Atualização: GET com Range a partir do byte %u -> HTTP 206", (unsigned)start);
+        pcb->next = start;
+        pcb->end = (uint32_t)image_size;
+        pcb->header_len = (size_t)snprintf(pcb->header, sizeof(pcb->header),
+                                           "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes %u-%u/%u\r\n"
+                                           "Content-Length: %u\r\nConnection: close\r\n\r\n",
+                                           (unsigned)start, (unsigned)image_size - 1, (unsigned)image_size,
+                                           (unsigned)(image_size - start));
+    } else {
+        sim_log("Atualização: GET da imagem (%u bytes) -> HTTP 200", (unsigned)image_size);
+        pcb->next = 0;
+        pcb->end = (uint32_t)image_size;
+        pcb->header_len = (size_t)snprintf(pcb->header, sizeof(pcb->header),
+                                           "HTTP/1.1 200 OK\r\nContent-Length: %u\r\nConnection: close\r\n\r\n",
+                                           (unsigned)image_size);
+    }
+    image_send(pcb);
+}
+
+err_t tcp_output(struct tcp_pcb *pcb) {
+    if (strstr(pcb->request, "\r\n\r\n")) {
+        radio_tx();
+        if (strncmp(pcb->request, "GET /whatsapp.php", 17) == 0) {
+            requests++;
+            pcb_schedule(pcb, sim_net.response_ms, server_respond);
+        } else {
+            pcb_schedule(pcb, sim_net.response_ms, image_respond);
+        }
+    }
+    return ERR_OK;
+}
+
+// A janela reaberta retoma o envio parado
+void tcp_recved(struct tcp_pcb *pcb, u16_t len) {
+    if (!pcb->image) {
+        return;
+    }
+    pcb->unacked = len < pcb->unacked ? pcb->unacked - len : 0;
+    if (pcb->stalled) {
+        image_schedule(pcb, 0);
+    }
+}
+
+err_t tcp_close(struct tcp_pcb *pcb) {
+    pcb_free(pcb);
+    return ERR_OK;
+}
+
+void tcp_abort(struct tcp_pcb *pcb) {
+    tcp_err_fn err = pcb->err;
+    void *err_arg = pcb->arg;
+    pcb_free(pcb);
+    if (err) {
+        err(err_arg, ERR_ABRT);
+    }
+}
+
+u16_t pbuf_copy_partial(const struct pbuf *p, void *dataptr, u16_t len, u16_t offset) {
+    u16_t copied = 0;
+    for (; p && copied < len; p = p->next) {
+        if (offset >= p->len) {
+            offset -= p->len;
+            continue;
+        }
+        u16_t count = p->len - offset < len - copied ? p->len - offset : len - copied;
+        memcpy((char *)dataptr + copied, (const char *)p->payload + offset, count);
+        copied += count;
+        offset = 0;
+    }
+    return copied;
+}
+
+// As respostas do CallMeBot pertencem ao pcb e são reaproveitadas; os
+// segmentos do servidor da atualização voltam ao conjunto
+u8_t pbuf_free(struct pbuf *p) {
+    u8_t count = 0;
+    while (p) {
+        struct pbuf *next = p->next;
+        if (p->pooled) {
+            ((struct segment *)p)->used = false;
+        }
+        count++;
+        p = next;
+    }
+    return count;
+}
+
+void pbuf_cat(struct pbuf *head, struct pbuf *tail) {
+    for (; head->next; head = head->next) {
+        head->tot_len += tail->tot_len;
+    }
+    head->tot_len += tail->tot_len;
+    head->next = tail;
+}
+
+struct pbuf *pbuf_free_header(struct pbuf *q, u16_t size) {
+    while (q && size >= q->len) {
+        struct pbuf *next = q->next;
+        size -= q->len;
+        q->next = NULL;
+        pbuf_free(q);
+        q = next;
+    }
+    if (q && size) {
+        q->payload = (char *)q->payload + size;
+        q->len -= size;
+        q->tot_len -= size;
+    }
+    return q;
+}
+
+bool sim_net_load_image(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        return false;
+    }
+    image_size = fread(image, 1, sizeof(image), file);
+    fclose(file);
+    return image_size > 0;
+}
+
+void sim_net_wake(void) {
+    wake_edge_us = sim_now_us();
+    wake_pending = true;
+}
+
+uint64_t sim_net_response_us(void) {
+    return last_response_us;
+}
+
+struct sim_net_image_stats sim_net_image_stats(void) {
+    return image_stats;
+}
+
+uint64_t sim_net_radio_us(void) {
+    return radio_total_us + (radio_on ? sim_now_us() - radio_since_us : 0);
+}
+
+void sim_net_report(void) {
+    printf("CallMeBot: %u requisições, %u respostas\n", (unsigned)requests, (unsigned)responses);
+    printf("SNTP: %u consultas, %u respostas\n", (unsigned)sntp_queries, (unsigned)sntp_answers);
+    printf("Wi-Fi: %u trocas de modo, %u pacotes retidos pelo ponto de acesso (média %u ms, máxima %u ms)\n",
+           (unsigned)pm_switches, (unsigned)rx_held,
+           (unsigned)(rx_held ? rx_held_total_us / rx_held / 1000 : 0), (unsigned)(rx_held_max_us / 1000));
+    if (image_stats.requests) {
+        printf("Servidor da atualização: %u requisições (%u com Range), %llu bytes enviados, %u conexões "
+               "derrubadas, %u paradas pela janela cheia\n",
+               (unsigned)image_stats.requests, (unsigned)image_stats.ranges, (unsigned long long)image_stats.bytes,
+               (unsigned)image_stats.drops, (unsigned)image_stats.stalls);
+    }
+    if (wake_alerts) {
+        printf("Despertar até o alerta entregue: %u alertas, média %u ms, máxima %u ms\n", (unsigned)wake_alerts,
+               (unsigned)(wake_latency_total_us / wake_alerts / 1000), (unsigned)(wake_latency_max_us / 1000));
+    }
+}
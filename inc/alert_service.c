@@ -0,0 +1,219 @@
+/**
+ * @file alert_service.c
+ * @brief Implementação da entrega das mensagens de alerta.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/cyw43_arch.h"
+#include "alert_service.h"
+#include "battery.h"
+#include "boot_profile.h"
+#include "callmebot_whatsapp.h"
+#include "clock_governor.h"
+#include "config_store.h"
+#include "display_text.h"
+#include "event_loop.h"
+#include "log.h"
+#include "low_power.h"
+#include "status_bar.h"
+#include "supervisor.h"
+#include "time_sync.h"
+#include "trace.h"
+#include "ui_core.h"
+#include "wifi_power.h"
+#include "xip_profile.h"
+
+static struct event_timer ready_timer;   // Fim da tela "pronto para uso"
+static bool alert_in_progress = true;    // Uma mensagem por vez; os pedidos aguardam a mensagem inicial
+static bool held = false;                // Rede sendo religada após o modo de baixo consumo
+static uint32_t latency_max_us = 0;      // Maior atraso entre o botão e o início do envio
+static uint32_t alert_origin_us = 0;     // Borda do botão que originou a mensagem em envio
+static struct alert_values values[ALERT_MESSAGE_COUNT];  // Campos do último envio de cada mensagem
+static uint32_t last_origin_us[ALERT_MESSAGE_COUNT];     // Borda do último pedido de cada mensagem
+
+/**
+ * @brief Informa à interface o resultado da mensagem inicial, após a tela "pronto para uso".
+ */
+static void ready_shown(void *arg)
+{
+    ui_alert_result(0, true, alert_origin_us, &values[0]);
+    alert_in_progress = false;
+}
+
+/**
+ * @brief Tratador do fim do envio de uma mensagem.
+ *
+ * @param sent true se a mensagem foi entregue.
+ * @param arg Número da mensagem (0 = mensagem inicial).
+ */
+static void alert_done(bool sent, void *arg)
+{
+    uint8_t message = (uint8_t)(uintptr_t)arg;
+
+    clock_governor_boost(false);
+    wifi_power_busy(false);
+    if (message > 0)
+    {
+        clock_governor_record_alert(time_us_32() - alert_origin_us);
+        low_power_alert_done(sent);
+    }
+
+    if (message == 0)
+    {
+        boot_profile_mark(BOOT_STAGE_INIT_MESSAGE);
+        boot_profile_dump();
+        supervisor_print_reset();
+    }
+
+    if (sent)
+    {
+        LOG("Mensagem %u enviada com sucesso!\n", message);
+    }
+    else
+    {
+        LOG("Falha ao enviar mensagem %u!\n", message);
+    }
+
+    if (message == 0 && sent)
+    {
+        ui_show(&ready_to_use);
+        event_timer_start(&ready_timer, ALERT_READY_SCREEN_MS, 0, ready_shown, NULL);
+        return;
+    }
+
+    ui_alert_result(message, sent, alert_origin_us, &values[message]);
+    alert_in_progress = false;
+    if (message > 0)
+    {
+        ui_print_queue_stats(); // Latência entre interface e rede, para acompanhamento no monitor serial
+    }
+}
+
+/**
+ * @brief Lê os valores dos campos de um envio.
+ *
+ * @param message Número da mensagem.
+ * @param origin_us Instante da borda do botão.
+ * @param fields Campos presentes no modelo; a bateria só é medida se usada.
+ */
+static const struct alert_values *collect_values(uint8_t message, uint32_t origin_us, uint8_t fields)
+{
+    struct alert_values *current = &values[message];
+
+    if (current->attempt > 0 && origin_us - last_origin_us[message] < ALERT_REPEAT_WINDOW_MS * 1000u)
+    {
+        current->attempt++;
+    }
+    else
+    {
+        current->attempt = 1;
+    }
+    last_origin_us[message] = origin_us;
+
+    current->time_s = time_sync_seconds_of_day(time_us_32() - origin_us);
+    // Logo após a associação a barra de status ainda não leu o sinal: consulta o chip,
+    // com a trava da pilha, pois o driver do cyw43 pode estar em uso pelo lwIP
+    int32_t rssi = status_bar_rssi();
+    if (rssi == 0 && (fields & (1u << ALERT_FIELD_RSSI)))
+    {
+        cyw43_arch_lwip_begin();
+        if (cyw43_wifi_get_rssi(&cyw43_state, &rssi) != 0)
+        {
+            rssi = 0;
+        }
+        cyw43_arch_lwip_end();
+    }
+    current->rssi = (int16_t)rssi;
+    current->battery = ALERT_BATTERY_UNKNOWN;
+    if (fields & (1u << ALERT_FIELD_BATERIA))
+    {
+        current->battery = battery_on_usb() ? ALERT_BATTERY_USB : (int8_t)battery_percent();
+    }
+    return current;
+}
+
+/**
+ * @brief Inicia o envio de uma mensagem.
+ *
+ * @param message Número da mensagem (0 = mensagem inicial).
+ * @param origin_us Instante da borda do botão (ou do pedido da mensagem inicial).
+ */
+static void send_alert(uint8_t message, uint32_t origin_us)
+{
+    alert_in_progress = true;
+    alert_origin_us = origin_us;
+    clock_governor_boost(true); // Montagem da requisição e pilha TCP/IP no ponto mais rápido
+    wifi_power_busy(true);      // Receptor ligado antes do primeiro pacote
+    trace_set_alert_origin(origin_us);
+    const struct alert_template *template = alert_template_get(message);
+    if (!send_whatsapp_message(template, collect_values(message, origin_us, template->fields),
+                               config_get(CONFIG_PHONE), config_get(CONFIG_API_KEY), alert_done,
+                               (void *)(uintptr_t)message))
+    {
+        alert_done(false, (void *)(uintptr_t)message);
+    }
+}
+
+/**
+ * @brief Inicia o envio do próximo pedido dos botões, se não houver outro em andamento.
+ */
+static bool alert_poll(void *arg)
+{
+    struct app_event event;
+
+    if (alert_in_progress || held || !ui_next_request(&event))
+    {
+        return false;
+    }
+
+    uint32_t latency = time_us_32() - event.timestamp_us;
+    if (latency > latency_max_us)
+    {
+        latency_max_us = latency;
+    }
+
+    struct xip_window xip;
+    xip_profile_begin(&xip);
+    trace_mark(TRACE_DEQUEUE, event.origin_us);
+    send_alert(event.message, event.origin_us);
+    xip_profile_end(XIP_SUBSYSTEM_ALERT, &xip);
+    return true;
+}
+
+void alert_service_init(void)
+{
+    event_loop_add_poll(alert_poll, NULL);
+}
+
+void alert_service_start(void)
+{
+    // Após um reset do supervisor os pedidos retidos são atendidos imediatamente
+    if (supervisor_recovered())
+    {
+        boot_profile_mark(BOOT_STAGE_INIT_MESSAGE);
+        boot_profile_dump();
+        supervisor_print_reset();
+        LOG("Recuperação após falha: mensagem inicial omitida.\n");
+        alert_in_progress = false;
+        return;
+    }
+
+    send_alert(0, time_us_32());
+}
+
+void alert_service_hold(bool hold)
+{
+    held = hold;
+}
+
+bool alert_service_is_idle(void)
+{
+    return !alert_in_progress && !held;
+}
+
+uint32_t alert_service_latency_max_us(void)
+{
+    return latency_max_us;
+}
@@ -0,0 +1,60 @@
+#ifndef ALERT_SERVICE_H
+#define ALERT_SERVICE_H
+
+/**
+ * @file alert_service.h
+ * @brief Entrega das mensagens de alerta pedidas pelos botões.
+ *
+ * Consome, em ordem e uma por vez, os pedidos vindos da interface
+ * (ui_next_request), envia cada mensagem pelo CallMeBot e devolve o resultado
+ * à interface (ui_alert_result), com uma cópia dos campos usados no envio.
+ * Os campos dos modelos das mensagens (inc/alert_template.h) são lidos no
+ * início de cada envio; {tentativa} conta os pedidos da mesma mensagem com
+ * menos de ALERT_REPEAT_WINDOW_MS entre um e outro, entregues ou não.
+ *
+ * Roda no laço de eventos de quem o inicializa: o núcleo 0 na versão sem
+ * sistema operacional e a tarefa de alertas na versão FreeRTOS.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "alert_template.h"
+
+#define ALERT_READY_SCREEN_MS  2000    ///< Tempo de exibição da tela "pronto para uso"
+#define ALERT_REPEAT_WINDOW_MS 600000  ///< Pedido da mesma mensagem neste intervalo é nova tentativa
+
+/**
+ * @brief Registra o consumo dos pedidos no laço de eventos do núcleo atual.
+ */
+void alert_service_init(void);
+
+/**
+ * @brief Envia a mensagem inicial indicando que o dispositivo está pronto.
+ *
+ * Deve ser chamada quando a conexão Wi-Fi terminar. Até lá os pedidos dos
+ * botões ficam retidos na fila; eles só são atendidos depois do resultado
+ * desta mensagem. Após um reset do supervisor a mensagem é omitida e os
+ * pedidos são atendidos imediatamente.
+ */
+void alert_service_start(void);
+
+/**
+ * @brief Retém (true) ou libera (false) os pedidos enquanto a rede é religada.
+ *
+ * Os pedidos continuam na fila e são atendidos em ordem depois da liberação.
+ */
+void alert_service_hold(bool hold);
+
+/**
+ * @brief Informa se não há mensagem em envio nem pedidos retidos.
+ */
+bool alert_service_is_idle(void);
+
+/**
+ * @brief Maior tempo entre o pedido de um botão e o início do seu envio, em microssegundos.
+ */
+uint32_t alert_service_latency_max_us(void);
+
+#endif // ALERT_SERVICE_H
@@ -0,0 +1,244 @@
+/**
+ * @file alert_template.c
+ * @brief Implementação dos modelos das mensagens de alerta.
+ *
+ * A saída avança por um cursor limitado ao fim do buffer; um caractere
+ * codificado que não cabe encerra a escrita, sem deixar "%" pela metade.
+ * Os números são escritos dígito a dígito, do divisor maior ao menor.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <ctype.h>
+#include <string.h>
+
+#include "alert_template.h"
+#include "config_store.h"
+
+// Cursor de escrita; end aponta para o lugar do terminador
+struct writer {
+    char *next;
+    char *end;
+};
+
+static const char *const field_names[ALERT_FIELD_COUNT] = ALERT_TEMPLATE_FIELDS;
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// Mensagens trocadas pelo console, divididas no primeiro envio
+static struct alert_segment custom_segments[ALERT_MESSAGE_COUNT][ALERT_TEMPLATE_MAX_SEGMENTS];
+static struct alert_template custom_templates[ALERT_MESSAGE_COUNT];
+static const struct alert_template *current[ALERT_MESSAGE_COUNT];
+static const char *resolved[ALERT_MESSAGE_COUNT];  // Texto de config_get() que originou current
+
+// Campo aberto pelo '{' em text, ou ALERT_FIELD_TEXT; *length recebe o tamanho com as chaves
+static uint match_field(const char *text, size_t *length) {
+    for (uint field = ALERT_FIELD_TEXT + 1; field < ALERT_FIELD_COUNT; field++) {
+        size_t name_length = strlen(field_names[field]);
+        if (strncmp(text + 1, field_names[field], name_length) == 0 && text[name_length + 1] == '}') {
+            *length = name_length + 2;
+            return field;
+        }
+    }
+    return ALERT_FIELD_TEXT;
+}
+
+static void put_char(struct writer *out, char c, bool url) {
+    unsigned char byte = (unsigned char)c;
+
+    if (!url || isalnum(byte) || c == '-' || c == '_' || c == '.' || c == '~') {
+        if (out->next < out->end) {
+            *out->next++ = c;
+        }
+    }
+    else if (c == ' ') {
+        if (out->next < out->end) {
+            *out->next++ = '+';
+        }
+    }
+    else if (out->end - out->next >= 3) {
+        out->next[0] = '%';
+        out->next[1] = hex_digits[byte >> 4];
+        out->next[2] = hex_digits[byte & 0x0f];
+        out->next += 3;
+    }
+    else {
+        out->end = out->next; // Não cabe inteiro: nada mais é escrito
+    }
+}
+
+static void put_string(struct writer *out, const char *text, bool url) {
+    while (*text) {
+        put_char(out, *text++, url);
+    }
+}
+
+// Texto já codificado: cópia direta, recuando um '%' cortado no fim do buffer
+static void put_encoded(struct writer *out, const char *text, size_t length) {
+    size_t room = (size_t)(out->end - out->next);
+    if (length > room) {
+        length = room;
+        for (size_t i = length > 2 ? length - 2 : 0; i < length; i++) {
+            if (text[i] == '%') {
+                length = i;
+                break;
+            }
+        }
+        out->end = out->next + length;
+    }
+    memcpy(out->next, text, length);
+    out->next += length;
+}
+
+static void put_number(struct writer *out, uint32_t value, uint min_digits) {
+    uint32_t divisor = 1;
+    uint digits = 1;
+
+    while (value / divisor >= 10) {
+        divisor *= 10;
+        digits++;
+    }
+    for (; min_digits > digits; min_digits--) {
+        put_char(out, '0', false);
+    }
+    for (; divisor > 0; divisor /= 10) {
+        put_char(out, (char)('0' + value / divisor % 10), false);
+    }
+}
+
+static void put_field(struct writer *out, uint field, const struct alert_values *values, bool url) {
+    switch (field) {
+    case ALERT_FIELD_HORA:
+        if (values->time_s < 0) {
+            put_string(out, "--:--", url);
+            break;
+        }
+        put_number(out, (uint32_t)values->time_s / 3600, 2);
+        put_char(out, ':', url);
+        put_number(out, (uint32_t)values->time_s / 60 % 60, 2);
+        break;
+    case ALERT_FIELD_RSSI:
+        if (values->rssi >= 0) {
+            put_string(out, "--", url);
+            break;
+        }
+        put_char(out, '-', url);
+        put_number(out, (uint32_t)-values->rssi, 1);
+        break;
+    case ALERT_FIELD_TENTATIVA:
+        put_number(out, values->attempt, 1);
+        break;
+    case ALERT_FIELD_BATERIA:
+        if (values->battery == ALERT_BATTERY_USB) {
+            put_string(out, "USB", url);
+        }
+        else if (values->battery < 0) {
+            put_string(out, "--", url);
+        }
+        else {
+            put_number(out, (uint32_t)values->battery, 1);
+            put_char(out, '%', url);
+        }
+        break;
+    }
+}
+
+uint alert_template_split(const char *text, struct alert_segment *segments, uint max_segments, uint8_t *fields) {
+    const char *literal = text;
+    uint count = 0;
+
+    *fields = 0;
+    for (const char *p = text;;) {
+        uint field = ALERT_FIELD_TEXT;
+        size_t length = 0;
+
+        // Um campo ocupa até dois segmentos; sobra um para o texto final
+        if (*p == '{' && count + 3 <= max_segments) {
+            field = match_field(p, &length);
+        }
+        if (*p != '\0' && field == ALERT_FIELD_TEXT) {
+            p++;
+            continue;
+        }
+
+        if (p > literal) {
+            segments[count++] = (struct alert_segment){ALERT_FIELD_TEXT, (uint8_t)(p - literal), literal};
+        }
+        if (*p == '\0') {
+            return count;
+        }
+        segments[count++] = (struct alert_segment){(uint8_t)field, 0, NULL};
+        *fields |= 1u << field;
+        p += length;
+        literal = p;
+    }
+}
+
+size_t alert_template_render(const struct alert_template *template, const struct alert_values *values, bool url,
+                             char *output, size_t output_size) {
+    if (output_size == 0) {
+        return 0;
+    }
+    if (template->encoded && !url) {
+        return alert_template_format(template->source, values, output, output_size);
+    }
+
+    struct writer out = {output, output + output_size - 1};
+    for (uint i = 0; i < template->count; i++) {
+        const struct alert_segment *segment = &template->segments[i];
+        if (segment->field != ALERT_FIELD_TEXT) {
+            put_field(&out, segment->field, values, url);
+        }
+        else if (template->encoded) {
+            put_encoded(&out, segment->text, segment->length);
+        }
+        else {
+            for (uint j = 0; j < segment->length; j++) {
+                put_char(&out, segment->text[j], url);
+            }
+        }
+    }
+    *out.next = '\0';
+    return (size_t)(out.next - output);
+}
+
+size_t alert_template_format(const char *text, const struct alert_values *values, char *output, size_t output_size) {
+    if (output_size == 0) {
+        return 0;
+    }
+
+    struct writer out = {output, output + output_size - 1};
+    while (*text) {
+        size_t length;
+        uint field = *text == '{' ? match_field(text, &length) : ALERT_FIELD_TEXT;
+        if (field == ALERT_FIELD_TEXT) {
+            put_char(&out, *text++, false);
+            continue;
+        }
+        put_field(&out, field, values, false);
+        text += length;
+    }
+    *out.next = '\0';
+    return (size_t)(out.next - output);
+}
+
+const struct alert_template *alert_template_get(uint message) {
+    const char *text = config_get(CONFIG_MESSAGE + message);
+
+    if (text != resolved[message]) {
+        resolved[message] = text;
+        if (strcmp(text, alert_template_defaults[message].source) == 0) {
+            current[message] = &alert_template_defaults[message];
+        }
+        else {
+            struct alert_template *custom = &custom_templates[message];
+            custom->source = text;
+            custom->segments = custom_segments[message];
+            custom->count = (uint8_t)alert_template_split(text, custom_segments[message], ALERT_TEMPLATE_MAX_SEGMENTS,
+                                                          &custom->fields);
+            custom->encoded = false;
+            current[message] = custom;
+        }
+    }
+    return current[message];
+}
@@ -0,0 +1,126 @@
+#ifndef ALERT_TEMPLATE_H
+#define ALERT_TEMPLATE_H
+
+/**
+ * @file alert_template.h
+ * @brief Modelos das mensagens de alerta, com campos preenchidos no envio.
+ *
+ * O texto de uma mensagem pode conter os campos:
+ *
+ * | Campo       | Valor                                                    | Exemplo |
+ * |-------------|----------------------------------------------------------|---------|
+ * | {hora}      | hora local da borda do botão (inc/time_sync.h)           | 14:05   |
+ * | {rssi}      | sinal do Wi-Fi, em dBm (inc/status_bar.h)                | -58     |
+ * | {tentativa} | pedidos seguidos da mesma mensagem (inc/alert_service.h) | 2       |
+ * | {bateria}   | carga estimada pela tensão do VSYS (inc/battery.h)       | 87%     |
+ *
+ * Sem a informação (hora antes do SNTP, sinal antes do enlace) o campo vira
+ * "--"; com o dispositivo na USB, {bateria} vira "USB". Um '{' que não abre
+ * um campo conhecido é texto.
+ *
+ * Cada modelo é uma sequência de segmentos de texto fixo e de campo. Os das
+ * mensagens de fábrica são gerados na compilação por
+ * tools/gen_alert_templates.py, com o texto fixo já codificado no formato
+ * URL; uma mensagem trocada pelo console (inc/config_store.h) é dividida uma
+ * vez, no primeiro envio depois da troca. alert_template_render() escreve a
+ * mensagem direto no buffer da requisição HTTP, em uma única passagem, sem
+ * snprintf() e sem buffer intermediário.
+ *
+ * alert_template_get() roda no núcleo 0 (envio); alert_template_format() não
+ * guarda estado e serve ao núcleo 1 (tela).
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "callmebot_whatsapp.h"
+
+#define ALERT_TEMPLATE_MAX_SEGMENTS 16  ///< Segmentos de uma mensagem trocada pelo console; o excesso vira texto
+
+#define ALERT_BATTERY_UNKNOWN (-1)      ///< alert_values.battery sem leitura
+#define ALERT_BATTERY_USB     (-2)      ///< alert_values.battery com o dispositivo na USB
+
+/**
+ * @brief Tipo de um segmento; os campos seguem a ordem de ALERT_TEMPLATE_FIELDS.
+ */
+enum alert_field {
+    ALERT_FIELD_TEXT,       ///< Texto fixo
+    ALERT_FIELD_HORA,
+    ALERT_FIELD_RSSI,
+    ALERT_FIELD_TENTATIVA,
+    ALERT_FIELD_BATERIA,
+    ALERT_FIELD_COUNT
+};
+
+/// Nomes dos campos, na ordem de enum alert_field (lidos também pelo gerador)
+#define ALERT_TEMPLATE_FIELDS {"", "hora", "rssi", "tentativa", "bateria"}
+
+/**
+ * @brief Segmento de um modelo.
+ */
+struct alert_segment {
+    uint8_t field;       ///< enum alert_field
+    uint8_t length;      ///< Bytes de text (só texto fixo)
+    const char *text;    ///< Texto fixo, sem terminador próprio
+};
+
+/**
+ * @brief Mensagem dividida em segmentos.
+ */
+struct alert_template {
+    const char *source;                     ///< Texto de origem
+    const struct alert_segment *segments;
+    uint8_t count;                          ///< Número de segmentos
+    uint8_t fields;                         ///< Campos presentes, bit (1 << enum alert_field)
+    bool encoded;                           ///< Texto fixo já codificado no formato URL
+};
+
+/**
+ * @brief Valores dos campos de um envio.
+ */
+struct alert_values {
+    int32_t time_s;      ///< Hora local em segundos desde a meia-noite, ou -1
+    int16_t rssi;        ///< dBm, ou 0 se desconhecido
+    uint16_t attempt;    ///< 1 no primeiro pedido
+    int8_t battery;      ///< Carga em %, ALERT_BATTERY_UNKNOWN ou ALERT_BATTERY_USB
+};
+
+/// Modelos das mensagens de fábrica, na ordem de CONFIG_MESSAGE (gerado na compilação)
+extern const struct alert_template alert_template_defaults[ALERT_MESSAGE_COUNT];
+
+/**
+ * @brief Modelo vigente da mensagem @p message (0 = mensagem inicial).
+ *
+ * Usa o modelo gerado enquanto o texto configurado for o de fábrica.
+ * Chamada só no núcleo 0.
+ */
+const struct alert_template *alert_template_get(uint message);
+
+/**
+ * @brief Divide @p text (até 255 bytes) em segmentos, que apontam para dentro de @p text.
+ *
+ * @param fields Recebe os campos presentes, bit (1 << enum alert_field).
+ * @return Número de segmentos.
+ */
+uint alert_template_split(const char *text, struct alert_segment *segments, uint max_segments, uint8_t *fields);
+
+/**
+ * @brief Escreve a mensagem em @p output, codificada no formato URL se @p url.
+ *
+ * Escreve no máximo @p output_size - 1 bytes, sem cortar um caractere
+ * codificado, e termina em '\0'.
+ *
+ * @return Bytes escritos, sem o terminador.
+ */
+size_t alert_template_render(const struct alert_template *template, const struct alert_values *values, bool url,
+                             char *output, size_t output_size);
+
+/**
+ * @brief Preenche os campos de @p text, sem codificação, para a tela.
+ *
+ * @return Bytes escritos, sem o terminador.
+ */
+size_t alert_template_format(const char *text, const struct alert_values *values, char *output, size_t output_size);
+
+#endif // ALERT_TEMPLATE_H
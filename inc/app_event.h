@@ -0,0 +1,42 @@
+#ifndef APP_EVENT_H
+#define APP_EVENT_H
+
+/**
+ * @file app_event.h
+ * @brief Eventos e comandos trocados entre os núcleos do RP2040.
+ *
+ * O núcleo 0 cuida do Wi-Fi e do envio das mensagens; o núcleo 1 cuida dos
+ * botões, do display, dos buzzers e do áudio. Os dois se comunicam apenas
+ * por estes eventos, transportados por filas SPSC sem travas (spsc_queue.h).
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "alert_template.h"
+
+struct display_screen;
+
+// Tipos de evento
+enum app_event_type {
+    APP_EVENT_BUTTON,        ///< Núcleo 1 -> 0: botão pressionado, enviar a mensagem indicada
+    APP_EVENT_ALERT_RESULT,  ///< Núcleo 0 -> 1: resultado do envio de uma mensagem
+    APP_EVENT_SHOW_SCREEN,   ///< Núcleo 0 -> 1: exibir uma tela de status
+    APP_EVENT_SIGNAL_FAIL,   ///< Núcleo 0 -> 1: sinal sonoro e visual de falha
+};
+
+/**
+ * @brief Evento trocado entre os núcleos.
+ */
+struct app_event {
+    uint8_t type;                          ///< Um dos valores de app_event_type
+    uint8_t message;                       ///< Número da mensagem (0 = mensagem inicial)
+    bool ok;                               ///< Resultado do envio (APP_EVENT_ALERT_RESULT)
+    uint32_t timestamp_us;                 ///< Instante da publicação, usado para medir latência
+    uint32_t origin_us;                    ///< Instante da borda do botão que originou o alerta (trace.h)
+    const struct display_screen *screen;   ///< Tela a exibir (APP_EVENT_SHOW_SCREEN)
+    struct alert_values values;            ///< Campos do envio, copiados para o núcleo 1 (APP_EVENT_ALERT_RESULT)
+};
+
+#endif // APP_EVENT_H
@@ -0,0 +1,21 @@
+#ifndef AUDIO_CLIPS_H
+#define AUDIO_CLIPS_H
+
+/**
+ * @file audio_clips.h
+ * @brief Trechos de áudio de confirmação falada.
+ *
+ * Os trechos são gerados durante a compilação por tools/gen_audio_clips.py a
+ * partir dos arquivos WAV do diretório "audio". Um trecho cujo arquivo não
+ * existe fica vazio e audio_play() retorna false, mantendo apenas os bipes.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "audio_pwm.h"
+
+extern const struct audio_clip audio_clip_ajuda_a_caminho;   ///< "Ajuda a caminho"
+extern const struct audio_clip audio_clip_mensagem_enviada;  ///< "Mensagem enviada"
+
+#endif // AUDIO_CLIPS_H
@@ -0,0 +1,227 @@
+/**
+ * @file audio_pwm.c
+ * @brief Implementação da reprodução de áudio IMA-ADPCM via PWM-DAC.
+ *
+ * O PWM do pino de áudio opera com período de 256 contagens na frequência do
+ * clk_sys (portadora bem acima da faixa audível) e o nível de cada amostra é
+ * escrito no registrador CC da fatia por DMA. Dois canais encadeados alternam
+ * entre dois buffers; quando um termina, a interrupção decodifica o próximo
+ * bloco nele enquanto o outro canal toca.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/pwm.h"
+#include "audio_pwm.h"
+#include "clock_governor.h"
+
+// Tabelas padrão do IMA-ADPCM
+static const int16_t step_table[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767
+};
+
+static const int8_t index_table[16] = {
+    -1, -1, -1, -1, 2, 4, 6, 8,
+    -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+// Recursos de hardware reservados em audio_pwm_init()
+static int dma_channels[2] = {-1, -1};
+static int dma_timer = -1;
+static uint pwm_slice;
+static uint level_shift;  // 0 para o canal A da fatia, 16 para o canal B
+
+// Buffers ping-pong: cada palavra é escrita inteira no registrador CC
+static uint32_t buffers[2][AUDIO_BUFFER_SAMPLES];
+
+// Estado da reprodução
+static const struct audio_clip *current_clip = NULL;
+static struct audio_adpcm_state decoder;
+static uint32_t position = 0;
+static uint8_t silent_buffers = 0;
+static volatile bool playing = false;
+
+int16_t audio_adpcm_decode(struct audio_adpcm_state *state, uint8_t nibble) {
+    int step = step_table[state->index];
+    int diff = step >> 3;
+
+    if (nibble & 4) diff += step;
+    if (nibble & 2) diff += step >> 1;
+    if (nibble & 1) diff += step >> 2;
+
+    int predictor = state->predictor + ((nibble & 8) ? -diff : diff);
+    if (predictor > 32767) predictor = 32767;
+    if (predictor < -32768) predictor = -32768;
+
+    int index = state->index + index_table[nibble & 0x0F];
+    if (index < 0) index = 0;
+    if (index > 88) index = 88;
+
+    state->predictor = (int16_t)predictor;
+    state->index = (uint8_t)index;
+    return state->predictor;
+}
+
+// Decodifica o próximo bloco do trecho em um buffer, completando com silêncio no fim
+static void fill_buffer(uint32_t *buffer) {
+    const uint32_t silence = (uint32_t)((AUDIO_PWM_WRAP + 1) / 2) << level_shift;
+    int i = 0;
+
+    for (; i < AUDIO_BUFFER_SAMPLES && position < current_clip->samples; i++, position++) {
+        uint8_t byte = current_clip->data[position >> 1];
+        uint8_t nibble = (position & 1) ? byte >> 4 : byte & 0x0F;
+        int16_t sample = audio_adpcm_decode(&decoder, nibble);
+        buffer[i] = (uint32_t)((sample + 32768) >> 8) << level_shift;
+    }
+
+    if (i == 0) {
+        silent_buffers++;
+    }
+    for (; i < AUDIO_BUFFER_SAMPLES; i++) {
+        buffer[i] = silence;
+    }
+}
+
+// Rearma o canal que acabou de terminar com um novo bloco decodificado
+static void audio_dma_irq_handler(void) {
+    for (int i = 0; i < 2; i++) {
+        uint channel = dma_channels[i];
+        if (!playing || !(dma_hw->ints1 & (1u << channel))) {
+            continue;
+        }
+        dma_hw->ints1 = 1u << channel;
+
+        // Os dois buffers já foram preenchidos com silêncio: o trecho acabou
+        if (silent_buffers >= 2) {
+            audio_stop();
+            return;
+        }
+
+        fill_buffer(buffers[i]);
+        dma_channel_set_read_addr(channel, buffers[i], false);
+        dma_channel_set_trans_count(channel, AUDIO_BUFFER_SAMPLES, false);
+    }
+}
+
+// Ajusta o temporizador de DMA para a taxa de amostragem com o menor erro
+static void set_sample_rate(uint32_t sample_rate) {
+    uint32_t clock = clock_get_hz(clk_sys);
+    uint32_t best_num = 1, best_den = 0xFFFF;
+    uint64_t best_error = UINT64_MAX;
+
+    for (uint32_t num = 1; num <= 16; num++) {
+        uint64_t den = ((uint64_t)clock * num + sample_rate / 2) / sample_rate;
+        if (den == 0 || den > 0xFFFF) {
+            continue;
+        }
+
+        uint64_t actual = (uint64_t)clock * num * 1000 / den;
+        uint64_t wanted = (uint64_t)sample_rate * 1000;
+        uint64_t error = actual > wanted ? actual - wanted : wanted - actual;
+        if (error < best_error) {
+            best_error = error;
+            best_num = num;
+            best_den = (uint32_t)den;
+        }
+    }
+
+    dma_timer_set_fraction(dma_timer, best_num, best_den);
+}
+
+// O temporizador de DMA divide o clk_sys: a taxa de amostragem é refeita a cada troca
+static void clock_changed(uint32_t sys_hz) {
+    if (playing) {
+        set_sample_rate(current_clip->sample_rate);
+    }
+}
+
+void audio_pwm_init(void) {
+    pwm_slice = pwm_gpio_to_slice_num(AUDIO_PWM_PIN);
+    level_shift = pwm_gpio_to_channel(AUDIO_PWM_PIN) == PWM_CHAN_B ? 16 : 0;
+
+    dma_timer = dma_claim_unused_timer(true);
+    dma_channels[0] = dma_claim_unused_channel(true);
+    dma_channels[1] = dma_claim_unused_channel(true);
+
+    // Cada canal escreve um buffer no CC da fatia e, ao terminar, dispara o outro
+    for (int i = 0; i < 2; i++) {
+        dma_channel_config config = dma_channel_get_default_config(dma_channels[i]);
+        channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+        channel_config_set_read_increment(&config, true);
+        channel_config_set_write_increment(&config, false);
+        channel_config_set_dreq(&config, dma_get_timer_dreq(dma_timer));
+        channel_config_set_chain_to(&config, dma_channels[i ^ 1]);
+
+        dma_channel_configure(dma_channels[i], &config, &pwm_hw->slice[pwm_slice].cc,
+                              buffers[i], AUDIO_BUFFER_SAMPLES, false);
+    }
+
+    irq_add_shared_handler(DMA_IRQ_1, audio_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
+    clock_governor_on_change(clock_changed);
+}
+
+bool audio_play(const struct audio_clip *clip) {
+    if (dma_timer < 0 || clip->samples == 0 ||
+        clip->sample_rate < AUDIO_MIN_SAMPLE_RATE || clip->sample_rate > AUDIO_MAX_SAMPLE_RATE) {
+        return false;
+    }
+
+    audio_stop();
+
+    current_clip = clip;
+    decoder.predictor = 0;
+    decoder.index = 0;
+    position = 0;
+    silent_buffers = 0;
+
+    // PWM-DAC de 8 bits: divisor 1 e período de 256 contagens
+    pwm_set_clkdiv_int_frac(pwm_slice, 1, 0);
+    pwm_set_wrap(pwm_slice, AUDIO_PWM_WRAP);
+    set_sample_rate(clip->sample_rate);
+
+    for (int i = 0; i < 2; i++) {
+        fill_buffer(buffers[i]);
+        dma_channel_set_read_addr(dma_channels[i], buffers[i], false);
+        dma_channel_set_trans_count(dma_channels[i], AUDIO_BUFFER_SAMPLES, false);
+        dma_channel_set_irq1_enabled(dma_channels[i], true);
+    }
+
+    playing = true;
+    dma_channel_start(dma_channels[0]);
+    return true;
+}
+
+void audio_stop(void) {
+    if (!playing) {
+        return;
+    }
+    playing = false;
+
+    // Desabilita as interrupções antes de abortar, conforme a errata RP2040-E13
+    for (int i = 0; i < 2; i++) {
+        dma_channel_set_irq1_enabled(dma_channels[i], false);
+    }
+    dma_channel_abort(dma_channels[0]);
+    dma_channel_abort(dma_channels[1]);
+    dma_hw->ints1 = (1u << dma_channels[0]) | (1u << dma_channels[1]);
+
+    // Devolve a fatia à configuração usada pelos tons
+    pwm_set_gpio_level(AUDIO_PWM_PIN, 0);
+    pwm_config config = pwm_get_default_config();
+    pwm_init(pwm_slice, &config, true);
+}
+
+bool audio_is_playing(void) {
+    return playing;
+}
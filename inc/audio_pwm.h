@@ -0,0 +1,82 @@
+#ifndef AUDIO_PWM_H
+#define AUDIO_PWM_H
+
+/**
+ * @file audio_pwm.h
+ * @brief Reprodução de áudio gravado no buzzer via PWM-DAC.
+ *
+ * Os trechos de áudio ficam na flash codificados em IMA-ADPCM (4 bits por
+ * amostra). Durante a reprodução, dois buffers em RAM são alternados por dois
+ * canais de DMA encadeados que escrevem as amostras no nível PWM do pino
+ * BUZZER1_PIN, no ritmo de um temporizador de DMA. A interrupção de fim de
+ * buffer decodifica o próximo bloco, sem bloquear o laço principal.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "buzzer_led.h"
+
+#define AUDIO_PWM_PIN            BUZZER1_PIN  ///< Pino de saída do áudio
+#define AUDIO_PWM_WRAP           255          ///< Resolução do PWM-DAC (8 bits)
+#define AUDIO_BUFFER_SAMPLES     256          ///< Amostras por buffer do esquema ping-pong
+#define AUDIO_MIN_SAMPLE_RATE    8000         ///< Menor taxa de amostragem aceita
+#define AUDIO_MAX_SAMPLE_RATE    16000        ///< Maior taxa de amostragem aceita
+
+/**
+ * @brief Trecho de áudio IMA-ADPCM armazenado na flash.
+ *
+ * As amostras são codificadas em um único bloco, com o preditor e o índice
+ * iniciando em zero e o nibble menos significativo de cada byte primeiro.
+ */
+struct audio_clip {
+    const uint8_t *data;   ///< Amostras codificadas (2 por byte)
+    uint32_t samples;      ///< Número de amostras (0 se o trecho não foi gravado)
+    uint16_t sample_rate;  ///< Taxa de amostragem em Hz
+};
+
+/**
+ * @brief Estado do decodificador IMA-ADPCM.
+ */
+struct audio_adpcm_state {
+    int16_t predictor;  ///< Última amostra decodificada
+    uint8_t index;      ///< Índice atual na tabela de passos
+};
+
+/**
+ * @brief Reserva os canais de DMA e o temporizador usados pela reprodução.
+ */
+void audio_pwm_init(void);
+
+/**
+ * @brief Inicia a reprodução de um trecho em segundo plano.
+ *
+ * Interrompe o trecho em reprodução, se houver. Enquanto o áudio toca, o
+ * sequenciador de padrões não altera o pino BUZZER1_PIN.
+ *
+ * @param clip Trecho a ser reproduzido.
+ * @return true se a reprodução começou, false se o trecho está vazio.
+ */
+bool audio_play(const struct audio_clip *clip);
+
+/**
+ * @brief Interrompe a reprodução e devolve o pino ao modo de tons.
+ */
+void audio_stop(void);
+
+/**
+ * @brief Informa se há áudio em reprodução.
+ */
+bool audio_is_playing(void);
+
+/**
+ * @brief Decodifica uma amostra IMA-ADPCM.
+ *
+ * @param state Estado do decodificador, atualizado a cada amostra.
+ * @param nibble Código de 4 bits da amostra.
+ * @return Amostra PCM de 16 bits.
+ */
+int16_t audio_adpcm_decode(struct audio_adpcm_state *state, uint8_t nibble);
+
+#endif // AUDIO_PWM_H
@@ -0,0 +1,68 @@
+/**
+ * @file battery.c
+ * @brief Implementação da leitura do VSYS e da estimativa de carga.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "hardware/adc.h"
+#include "pico/cyw43_arch.h"
+#include "battery.h"
+
+#define ADC_REFERENCE_MV 3300
+#define VSYS_DIVIDER     3
+#define VSYS_ADC_INPUT   3  // PICO_VSYS_PIN (GPIO29)
+
+bool battery_on_usb(void) {
+#if defined CYW43_WL_GPIO_VBUS_PIN
+    return cyw43_arch_gpio_get(CYW43_WL_GPIO_VBUS_PIN);
+#else
+    return false;
+#endif
+}
+
+uint32_t battery_voltage_mv(void) {
+#ifndef PICO_VSYS_PIN
+    return 0;
+#else
+    static bool adc_started = false;
+    if (!adc_started) {
+        adc_init();
+        adc_started = true;
+    }
+
+#if CYW43_USES_VSYS_PIN
+    cyw43_thread_enter();
+    cyw43_arch_gpio_get(CYW43_WL_GPIO_VBUS_PIN); // Garante o chip acordado antes de tomar o pino
+#endif
+    adc_gpio_init(PICO_VSYS_PIN);
+    adc_select_input(VSYS_ADC_INPUT);
+    for (uint i = 0; i < BATTERY_SAMPLES; i++) {
+        (void)adc_read(); // As primeiras leituras após tomar o pino saem baixas
+    }
+    uint32_t sum = 0;
+    for (uint i = 0; i < BATTERY_SAMPLES; i++) {
+        sum += adc_read();
+    }
+#if CYW43_USES_VSYS_PIN
+    cyw43_thread_exit();
+#endif
+
+    return sum * VSYS_DIVIDER * ADC_REFERENCE_MV / (BATTERY_SAMPLES << 12);
+#endif
+}
+
+int battery_percent(void) {
+    uint32_t mv = battery_voltage_mv();
+    if (mv == 0) {
+        return -1;
+    }
+    if (mv <= BATTERY_EMPTY_MV) {
+        return 0;
+    }
+    if (mv >= BATTERY_FULL_MV) {
+        return 100;
+    }
+    return (int)((mv - BATTERY_EMPTY_MV) * 100 / (BATTERY_FULL_MV - BATTERY_EMPTY_MV));
+}
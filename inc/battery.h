@@ -0,0 +1,42 @@
+#ifndef BATTERY_H
+#define BATTERY_H
+
+/**
+ * @file battery.h
+ * @brief Carga estimada da bateria pela tensão do VSYS.
+ *
+ * No Pico W o VSYS chega ao ADC3 por um divisor de 1/3, no pino GPIO29,
+ * compartilhado com o clock SPI do chip Wi-Fi: a leitura é feita com o chip
+ * travado (cyw43_thread_enter) e o driver refaz o pino na próxima transação.
+ * A presença da USB vem do pino VBUS do CYW43. A carga é interpolada
+ * linearmente entre BATTERY_EMPTY_MV e BATTERY_FULL_MV, curva grosseira de
+ * uma célula de lítio sob carga leve.
+ *
+ * Roda no núcleo 0, dono do chip Wi-Fi.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define BATTERY_EMPTY_MV 3300  ///< VSYS da bateria vazia
+#define BATTERY_FULL_MV  4200  ///< VSYS da bateria cheia
+#define BATTERY_SAMPLES  8     ///< Leituras do ADC por medida (as primeiras são descartadas)
+
+/**
+ * @brief Informa se o dispositivo está alimentado pela USB.
+ */
+bool battery_on_usb(void);
+
+/**
+ * @brief Tensão do VSYS, em milivolts, ou 0 se a placa não a expõe.
+ */
+uint32_t battery_voltage_mv(void);
+
+/**
+ * @brief Carga estimada, de 0 a 100 %, ou -1 se a placa não expõe o VSYS.
+ */
+int battery_percent(void);
+
+#endif // BATTERY_H
@@ -0,0 +1,60 @@
+/**
+ * @file boot_profile.c
+ * @brief Implementação do registro das etapas da inicialização.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "boot_profile.h"
+
+static volatile uint32_t stage_times[BOOT_STAGE_COUNT];
+
+static const char *const stage_names[BOOT_STAGE_COUNT] = {
+    [BOOT_STAGE_MAIN]         = "main",
+    [BOOT_STAGE_STDIO]        = "monitor serial",
+    [BOOT_STAGE_INPUT_ARMED]  = "botões monitorados",
+    [BOOT_STAGE_BUZZER]       = "buzzers e leds",
+    [BOOT_STAGE_AUDIO]        = "áudio",
+    [BOOT_STAGE_DISPLAY]      = "display",
+    [BOOT_STAGE_STATUS_BAR]   = "barra de status",
+    [BOOT_STAGE_WIFI_CHIP]    = "chip wi-fi",
+    [BOOT_STAGE_WIFI_LINK]    = "wi-fi conectado",
+    [BOOT_STAGE_ALERTS_READY] = "alertas prontos",
+    [BOOT_STAGE_DNS]          = "dns resolvido",
+    [BOOT_STAGE_INIT_MESSAGE] = "mensagem inicial",
+};
+
+void boot_profile_mark(enum boot_stage stage) {
+    if (stage_times[stage] == 0) {
+        uint32_t now = time_us_32();
+        stage_times[stage] = now ? now : 1;
+    }
+}
+
+uint32_t boot_profile_time_us(enum boot_stage stage) {
+    return stage_times[stage];
+}
+
+void boot_profile_dump(void) {
+    printf("Perfil de inicialização (ms desde o reset):\n");
+    for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+        if (stage_times[i]) {
+            printf("  %-20s %6u.%03u\n", stage_names[i],
+                   (unsigned)(stage_times[i] / 1000), (unsigned)(stage_times[i] % 1000));
+        }
+        else {
+            printf("  %-20s      -\n", stage_names[i]);
+        }
+    }
+
+    printf("Tempo até os botões monitorados: %u ms\n", (unsigned)(stage_times[BOOT_STAGE_INPUT_ARMED] / 1000));
+    if (stage_times[BOOT_STAGE_ALERTS_READY]) {
+        printf("Tempo até o primeiro alerta entregável: %u ms\n", (unsigned)(stage_times[BOOT_STAGE_ALERTS_READY] / 1000));
+    }
+    else {
+        printf("Tempo até o primeiro alerta entregável: rede indisponível\n");
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef BOOT_PROFILE_H
+#define BOOT_PROFILE_H
+
+/**
+ * @file boot_profile.h
+ * @brief Registro dos instantes de cada etapa da inicialização.
+ *
+ * Cada etapa guarda o instante, em microssegundos desde o reset, em que foi
+ * concluída pela primeira vez. As etapas são marcadas pelos dois núcleos
+ * (cada etapa sempre pelo mesmo núcleo) e o relatório é enviado pela USB
+ * quando a mensagem inicial termina.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+// Etapas da inicialização, na ordem esperada
+enum boot_stage {
+    BOOT_STAGE_MAIN,            ///< Entrada em main()
+    BOOT_STAGE_STDIO,           ///< Monitor serial inicializado
+    BOOT_STAGE_INPUT_ARMED,     ///< Botões monitorados (núcleo 1)
+    BOOT_STAGE_BUZZER,          ///< Buzzers e LEDs prontos (núcleo 1)
+    BOOT_STAGE_AUDIO,           ///< PWM-DAC pronto (núcleo 1)
+    BOOT_STAGE_DISPLAY,         ///< Display inicializado (núcleo 1)
+    BOOT_STAGE_STATUS_BAR,      ///< Barra de status desenhada (núcleo 1)
+    BOOT_STAGE_WIFI_CHIP,       ///< Chip CYW43 inicializado, associação iniciada
+    BOOT_STAGE_WIFI_LINK,       ///< Associado e com endereço IP
+    BOOT_STAGE_ALERTS_READY,    ///< Primeiro alerta pode ser entregue
+    BOOT_STAGE_DNS,             ///< Servidor CallMeBot resolvido
+    BOOT_STAGE_INIT_MESSAGE,    ///< Resultado da mensagem inicial
+    BOOT_STAGE_COUNT
+};
+
+/**
+ * @brief Marca a conclusão de uma etapa. Só a primeira marcação é mantida.
+ */
+void boot_profile_mark(enum boot_stage stage);
+
+/**
+ * @brief Instante em que uma etapa foi concluída, em microssegundos desde o reset (0 = não concluída).
+ */
+uint32_t boot_profile_time_us(enum boot_stage stage);
+
+/**
+ * @brief Exibe no monitor serial o instante de cada etapa e os tempos até os botões e até o primeiro alerta.
+ */
+void boot_profile_dump(void);
+
+#endif // BOOT_PROFILE_H
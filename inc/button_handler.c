@@ -4,193 +4,165 @@
  *
  * Esta implementação contém as funções responsáveis pela inicialização e
  * leitura do estado dos pinos GPIO do Raspberry Pi Pico nos quais o receptor 
- * do controle RF está conectado. Além disso, realiza o envio de mensagens via
- * WhatsApp ao detectar eventos de pressão nos botões.
+ * do controle RF está conectado. Ao detectar a pressão de um botão, o pedido
+ * de envio da mensagem correspondente é publicado para o núcleo 0, que cuida
+ * da rede; a leitura dos botões nunca espera pelo envio.
  *
  * @author Gabriel Mattano da Silva
  * @date 2025
  */
 
 #include "button_handler.h"
-#include "credentials.h"
-
-// Variáveis globais para controle de envio de mensagens
-volatile bool msg_1_sent = false;
-volatile bool msg_2_sent = false;
-volatile bool msg_3_sent = false;
-volatile bool msg_4_sent = false;
+#include "hot_path.h"
+#include "log.h"
+#include "supervisor.h"
+#include "xip_profile.h"
+
+// Estado de cada botão do controle
+struct button {
+    uint pin;                          // Pino GPIO do botão
+    char name;                         // Letra do botão no controle
+    uint8_t message;                   // Mensagem enviada ao pressionar
+    bool last_state;                   // Estado na leitura anterior
+    bool blocked;                      // Dentro do debounce do último acionamento aceito
+    bool pending;                      // Acionamento aceito e ainda não publicado
+    uint32_t blocked_until_us;         // Fim do debounce
+    uint32_t pressed_at_us;            // Instante do acionamento pendente
+};
+
+static struct button buttons[] = {
+    {BUTTON_A, 'A', 4},
+    {BUTTON_B, 'B', 3},
+    {BUTTON_C, 'C', 2},
+    {BUTTON_D, 'D', 1},
+};
 
 /**
  * @brief Inicializa os pinos dos botões
  */
 void button_handler_init()
 {
-    gpio_init(BUTTON_A);
-    gpio_init(BUTTON_B);
-    gpio_init(BUTTON_C);
-    gpio_init(BUTTON_D);
-    gpio_set_dir(BUTTON_A, GPIO_IN);
-    gpio_set_dir(BUTTON_B, GPIO_IN);
-    gpio_set_dir(BUTTON_C, GPIO_IN);
-    gpio_set_dir(BUTTON_D, GPIO_IN);
-    gpio_pull_up(BUTTON_A);
-    gpio_pull_up(BUTTON_B);
-    gpio_pull_up(BUTTON_C);
-    gpio_pull_up(BUTTON_D);
+    for (int i = 0; i < count_of(buttons); i++)
+    {
+        gpio_init(buttons[i].pin);
+        gpio_set_dir(buttons[i].pin, GPIO_IN);
+        gpio_pull_up(buttons[i].pin);
+        buttons[i].blocked = true;
+        buttons[i].blocked_until_us = time_us_32() + BUTTON_DEBOUNCE_US;
+    }
 }
 
 /**
- * @brief Callback do temporizador para checagem do estado dos botões
- * 
- * Essa função verifica periodicamente o estado dos pinos nos quais o 
- * receptor RF está conectado, aplicando um debounce e enviando uma 
- * mensagem via WhatsApp quando um botão é pressionado no controle.
- * 
- * @param t Ponteiro para a estrutura do temporizador.
- * @return true Para manter o temporizador ativo.
+ * @brief Lê os pinos e aplica o debounce, guardando os acionamentos aceitos.
+ *
+ * Usa apenas o contador de 32 bits do temporizador e os registradores do
+ * GPIO, de modo que pode ser chamada com a flash desligada. O fim do debounce
+ * é comparado pela diferença com sinal, válida enquanto as leituras ocorrerem
+ * a menos de 35 minutos uma da outra.
+ *
+ * @return Quantidade de acionamentos aceitos nesta leitura.
  */
-bool button_check_callback(struct repeating_timer *t)
+uint __not_in_flash_func(button_handler_sample)(void)
 {
-    static absolute_time_t last_press_time_A;
-    static absolute_time_t last_press_time_B;
-    static absolute_time_t last_press_time_C;
-    static absolute_time_t last_press_time_D;
-    static bool button_last_state_A = false;
-    static bool button_last_state_B = false;
-    static bool button_last_state_C = false;
-    static bool button_last_state_D = false;
-
-    // Verifica o pino correspondente ao botão A
-    bool button_pressed_A = gpio_get(BUTTON_A);
-    if (is_nil_time(last_press_time_A))
-    {
-        last_press_time_A = get_absolute_time();
-    }
+    uint32_t now = time_us_32();
+    uint accepted = 0;
 
-    if (button_pressed_A && !button_last_state_A &&
-        absolute_time_diff_us(last_press_time_A, get_absolute_time()) > 200000)
+    for (int i = 0; i < count_of(buttons); i++)
     {
-        last_press_time_A = get_absolute_time();
-        button_last_state_A = true;
+        struct button *button = &buttons[i];
+        bool pressed = gpio_get(button->pin);
 
-        printf("Botão A pressionado! Enviando mensagem...\n");
-        if (send_whatsapp_message(MESSAGE_4, PHONE_NUMBER, API_KEY))
+        if (button->blocked && (int32_t)(now - button->blocked_until_us) > 0)
         {
-            printf("Mensagem 4 enviada com sucesso!\n");
-            msg_4_sent = true;
-            display_text(msg_4_success, 3);
-            buzzer_led_msg_4();
+            button->blocked = false;
         }
-        else
-        {
-            printf("Falha ao enviar mensagem 4!\n");
-            display_text(msg_4_fail, 3);
-            buzzer_led_fail();
-        }
-    }
-    else if (!button_pressed_A)
-    {
-        button_last_state_A = false;
-    }
-
-    // Verifica o pino correspondente ao botão B
-    bool button_pressed_B = gpio_get(BUTTON_B);
-    if (is_nil_time(last_press_time_B))
-    {
-        last_press_time_B = get_absolute_time();
-    }
-
-    if (button_pressed_B && !button_last_state_B &&
-        absolute_time_diff_us(last_press_time_B, get_absolute_time()) > 200000)
-    {
-        last_press_time_B = get_absolute_time();
-        button_last_state_B = true;
 
-        printf("Botão B pressionado! Enviando mensagem...\n");
-        if (send_whatsapp_message(MESSAGE_3, PHONE_NUMBER, API_KEY))
+        if (pressed && !button->last_state && !button->blocked)
         {
-            printf("Mensagem 3 enviada com sucesso!\n");
-            msg_3_sent = true;
-            display_text(msg_3_success, 3);
-            buzzer_led_msg_3();
+            button->last_state = true;
+            button->blocked = true;
+            button->blocked_until_us = now + BUTTON_DEBOUNCE_US;
+            button->pending = true;
+            button->pressed_at_us = now;
+            accepted++;
         }
-        else
+        else if (!pressed)
         {
-            printf("Falha ao enviar mensagem 3.\n");
-            display_text(msg_3_fail, 3);
-            buzzer_led_fail();
+            button->last_state = false;
         }
     }
-    else if (!button_pressed_B)
-    {
-        button_last_state_B = false;
-    }
-
-    // Verifica o pino correspondente ao botão C
-    bool button_pressed_C = gpio_get(BUTTON_C);
-    if (is_nil_time(last_press_time_C))
-    {
-        last_press_time_C = get_absolute_time();
-    }
+    return accepted;
+}
 
-    if (button_pressed_C && !button_last_state_C &&
-        absolute_time_diff_us(last_press_time_C, get_absolute_time()) > 200000)
+/**
+ * @brief Registra como acionamentos as bordas que despertaram o dispositivo.
+ *
+ * Chamada no núcleo 1 ao sair do modo dormant, antes da próxima leitura: o
+ * pino ainda em nível alto não gera um segundo acionamento, e o debounce
+ * conta a partir do despertar.
+ *
+ * @param pins Máscara dos pinos com borda de subida.
+ * @param at_us Instante do despertar.
+ */
+void button_handler_latch(uint32_t pins, uint32_t at_us)
+{
+    for (int i = 0; i < count_of(buttons); i++)
     {
-        last_press_time_C = get_absolute_time();
-        button_last_state_C = true;
+        struct button *button = &buttons[i];
 
-        printf("Botão C pressionado! Enviando mensagem...\n");
-        if (send_whatsapp_message(MESSAGE_2, PHONE_NUMBER, API_KEY))
-        {
-            printf("Mensagem 2 enviada com sucesso!\n");
-            msg_2_sent = true;
-            display_text(msg_2_success, 3);
-            buzzer_led_msg_2();
-        }
-        else
+        if (!(pins & 1u << button->pin) ||
+            (button->blocked && (int32_t)(at_us - button->blocked_until_us) <= 0))
         {
-            printf("Falha ao enviar mensagem 2.\n");
-            display_text(msg_2_fail, 3);
-            buzzer_led_fail();
+            continue;
         }
+        button->last_state = true;
+        button->blocked = true;
+        button->blocked_until_us = at_us + BUTTON_DEBOUNCE_US;
+        button->pending = true;
+        button->pressed_at_us = at_us;
     }
-    else if (!button_pressed_C)
-    {
-        button_last_state_C = false;
-    }
+}
 
-    // Verifica o pino correspondente ao botão D
-    bool button_pressed_D = gpio_get(BUTTON_D);
-    if (is_nil_time(last_press_time_D))
-    {
-        last_press_time_D = get_absolute_time();
-    }
+/**
+ * @brief Tratador do temporizador para checagem do estado dos botões
+ * 
+ * Essa função verifica periodicamente o estado dos pinos nos quais o 
+ * receptor RF está conectado, aplicando um debounce e pedindo ao núcleo 0
+ * o envio da mensagem via WhatsApp quando um botão é pressionado no controle.
+ * Também publica os acionamentos lidos durante uma gravação da flash, com o
+ * instante em que foram lidos.
+ * 
+ * @param arg Não utilizado.
+ */
+void HOT_PATH(button_check_handler)(void *arg)
+{
+    struct xip_window xip;
+    xip_profile_begin(&xip);
+    supervisor_checkin(SUPERVISOR_INPUT);
+
+    // A leitura durante uma gravação da flash interrompe este núcleo
+    uint32_t status = save_and_disable_interrupts();
+    button_handler_sample();
+    restore_interrupts(status);
 
-    if (button_pressed_D && !button_last_state_D &&
-        absolute_time_diff_us(last_press_time_D, get_absolute_time()) > 200000)
+    for (int i = 0; i < count_of(buttons); i++)
     {
-        last_press_time_D = get_absolute_time();
-        button_last_state_D = true;
+        struct button *button = &buttons[i];
 
-        printf("Botão D pressionado! Enviando mensagem...\n");
-        if (send_whatsapp_message(MESSAGE_1, PHONE_NUMBER, API_KEY))
-        {
-            printf("Mensagem 1 enviada com sucesso!\n");
-            msg_1_sent = true;
-            display_text(msg_1_success, 3);
-            buzzer_led_msg_1();
-        }
-        else
+        status = save_and_disable_interrupts();
+        bool pending = button->pending;
+        uint32_t pressed_at_us = button->pressed_at_us;
+        button->pending = false;
+        restore_interrupts(status);
+
+        if (pending)
         {
-            printf("Falha ao enviar mensagem 1.\n");
-            display_text(msg_1_fail, 3);
-            buzzer_led_fail();
+            LOG("Botão %c pressionado! Enviando mensagem %u...\n", button->name, button->message);
+            if (!ui_post_button(button->message, pressed_at_us))
+            {
+                LOG("Fila de alertas cheia, mensagem %u descartada.\n", button->message);
+            }
         }
     }
-    else if (!button_pressed_D)
-    {
-        button_last_state_D = false;
-    }
-
-    return true;
-}
\ No newline at end of file
+    xip_profile_end(XIP_SUBSYSTEM_INPUT, &xip);
+}
@@ -14,10 +14,7 @@
 
 #include "pico/stdlib.h"
 #include "hardware/timer.h"
-#include "callmebot_whatsapp.h"
-#include "buzzer_led.h"
-#include "display_oled.h"
-#include "display_text.h"
+#include "ui_core.h"
 
 // Definição dos pinos
 /*      Botão do            Pino do
@@ -27,8 +24,13 @@
 #define BUTTON_C    9     // D1
 #define BUTTON_D    8     // D0 
 
+#define BUTTON_POLL_MS      50      // Intervalo de leitura dos botões
+#define BUTTON_DEBOUNCE_US  200000  // Tempo mínimo entre dois acionamentos do mesmo botão
+
 // Declaração das funções
 void button_handler_init();
-bool button_check_callback(struct repeating_timer *t);
+void button_check_handler(void *arg);
+uint button_handler_sample(void);
+void button_handler_latch(uint32_t pins, uint32_t at_us);
 
-#endif // BUTTON_HANDLER_H
\ No newline at end of file
+#endif // BUTTON_HANDLER_H
@@ -3,13 +3,75 @@
  * @brief Implementação para controle de buzzer e LED via GPIO/PWM.
  *
  * Esta implementação define funções para inicializar, ativar e desativar
- * buzzers e LEDs utilizando GPIO e PWM.
- * 
+ * buzzers e LEDs utilizando GPIO e PWM. Os sinais são tabelas de passos
+ * tocadas por um sequenciador avançado por alarmes de hardware: iniciar um
+ * padrão apenas aplica o primeiro passo e agenda o próximo, sem espera ativa.
+ *
  * @author Gabriel Mattano da Silva
  * @date 2025
  */
 
+#include <limits.h>
+
+#include "audio_pwm.h"
 #include "buzzer_led.h"
+#include "clock_governor.h"
+#include "ui_core.h"
+
+// Estado do sequenciador de padrões
+static const struct buzzer_led_pattern *current_pattern = NULL;
+static uint8_t current_step = 0;
+static uint8_t current_cycle = 0;
+static alarm_id_t step_alarm = 0;
+
+// Sinal de sucesso: um sinal curto com o LED verde
+static const struct buzzer_led_step init_success_steps[] = {
+    {5000, BUZZER_LED_MASK_GREEN, 150},
+};
+
+// Sinal de falha: um sinal longo com o LED vermelho
+static const struct buzzer_led_step fail_steps[] = {
+    {2500, BUZZER_LED_MASK_RED, 500},
+};
+
+// Mensagem 1: dois sinais curtos
+static const struct buzzer_led_step msg_1_steps[] = {
+    {5000, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+};
+
+// Mensagem 2: três sinais alternando frequência
+static const struct buzzer_led_step msg_2_steps[] = {
+    {2500, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+    {5000, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+    {2500, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+};
+
+// Mensagem 3: seis sinais alternando frequência
+static const struct buzzer_led_step msg_3_steps[] = {
+    {2500, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+    {7500, BUZZER_LED_MASK_GREEN, 250},
+    {0,    0,                     50},
+};
+
+// Mensagem 4: doze sinais alternando frequência
+static const struct buzzer_led_step msg_4_steps[] = {
+    {5000,  BUZZER_LED_MASK_GREEN, 250},
+    {0,     0,                     50},
+    {10000, BUZZER_LED_MASK_GREEN, 250},
+    {0,     0,                     50},
+};
+
+static const struct buzzer_led_pattern init_success_pattern = {init_success_steps, count_of(init_success_steps), 1, 1};
+static const struct buzzer_led_pattern fail_pattern = {fail_steps, count_of(fail_steps), 1, 4};
+static const struct buzzer_led_pattern msg_1_pattern = {msg_1_steps, count_of(msg_1_steps), 2, 2};
+static const struct buzzer_led_pattern msg_2_pattern = {msg_2_steps, count_of(msg_2_steps), 1, 3};
+static const struct buzzer_led_pattern msg_3_pattern = {msg_3_steps, count_of(msg_3_steps), 3, 4};
+static const struct buzzer_led_pattern msg_4_pattern = {msg_4_steps, count_of(msg_4_steps), 6, 5};
 
 /**
  * @brief Inicializa um pino como saída PWM para o buzzer.
@@ -23,16 +85,71 @@ void buzzer_init(uint8_t pin) {
     pwm_set_gpio_level(pin, 0);
 }
 
+/**
+ * @brief Calcula o divisor fracionário 8.4 e o período do PWM para uma frequência.
+ *
+ * Parte do menor divisor que permite o período caber em 16 bits (maior
+ * resolução) e testa os 16 divisores seguintes, escolhendo o par com o
+ * menor erro de frequência. O divisor fica limitado a 1,0 .. 255 + 15/16.
+ *
+ * @param clock_hz Frequência do clk_sys em Hz.
+ * @param frequency Frequência desejada em Hz.
+ * @param div16 Divisor em dezesseis avos (parte inteira << 4 | fração).
+ * @param top Valor de wrap do contador (período - 1).
+ * @return true se a frequência pode ser gerada, false caso contrário.
+ */
+bool buzzer_tone_config(uint32_t clock_hz, uint16_t frequency, uint16_t *div16, uint16_t *top) {
+    if (frequency == 0) {
+        return false;
+    }
+
+    uint64_t clock16 = (uint64_t)clock_hz * 16;
+    uint64_t first = (clock16 + (uint64_t)frequency * 65536 - 1) / ((uint64_t)frequency * 65536);
+    if (first < 16) first = 16;
+    if (first > 0xFFF) first = 0xFFF;
+
+    uint64_t best_error = UINT64_MAX;
+    uint64_t best_div = first;
+    uint64_t best_period = 65536;
+    for (uint64_t div = first; div < first + 16 && div <= 0xFFF; div++) {
+        uint64_t period = (clock16 + div * frequency / 2) / (div * frequency);
+        if (period < 2) period = 2;
+        if (period > 65536) period = 65536;
+
+        // Erro em milésimos de Hz entre a frequência obtida e a desejada
+        uint64_t actual = clock16 * 1000 / (div * period);
+        uint64_t wanted = (uint64_t)frequency * 1000;
+        uint64_t error = actual > wanted ? actual - wanted : wanted - actual;
+
+        if (error < best_error) {
+            best_error = error;
+            best_div = div;
+            best_period = period;
+        }
+    }
+
+    // Escritos sempre, mesmo que nenhum divisor seja testado
+    *div16 = (uint16_t)best_div;
+    *top = (uint16_t)(best_period - 1);
+    return true;
+}
+
 /**
  * @brief Gera um tom no buzzer com a frequência especificada.
  * @param pin Pino GPIO do buzzer.
  * @param frequency Frequência do som em Hz.
  */
 void tone(uint8_t pin, uint16_t frequency) {
+    uint16_t div16, top;
+    if (!buzzer_tone_config(clock_get_hz(clk_sys), frequency, &div16, &top)) {
+        no_tone(pin);
+        return;
+    }
+
     uint slice_num = pwm_gpio_to_slice_num(pin);
-    uint32_t clock_div = clock_get_hz(clk_sys) / (frequency * 4096);
-    pwm_set_clkdiv(slice_num, clock_div);
-    pwm_set_gpio_level(pin, 2048);  // Define o nível PWM para 50% do ciclo
+    pwm_set_clkdiv_int_frac(slice_num, div16 >> 4, div16 & 0xF);
+    pwm_set_wrap(slice_num, top);
+    pwm_set_gpio_level(pin, (top + 1) / 2);  // Define o nível PWM para 50% do ciclo
 }
 
 /**
@@ -44,24 +161,125 @@ void no_tone(uint8_t pin) {
 }
 
 /**
- * @brief Liga o buzzer e acende o LED correspondente.
- * @param led Pino GPIO do LED.
- * @param frequency Frequência do buzzer.
+ * @brief Aplica um passo: tom nos dois buzzers e estado dos LEDs.
+ * @param step Passo a ser aplicado.
  */
-void buzzer_led_on(uint8_t led, uint16_t frequency) {
-    tone(BUZZER1_PIN, frequency);
-    tone(BUZZER2_PIN, frequency);
-    gpio_put(led, 1);
+static void apply_step(const struct buzzer_led_step *step) {
+    // Enquanto há áudio em reprodução o BUZZER1_PIN pertence ao PWM-DAC
+    bool audio = audio_is_playing();
+
+    if (step->frequency) {
+        if (!audio) tone(BUZZER1_PIN, step->frequency);
+        tone(BUZZER2_PIN, step->frequency);
+    }
+    else {
+        if (!audio) no_tone(BUZZER1_PIN);
+        no_tone(BUZZER2_PIN);
+    }
+    gpio_put(LED_GREEN, step->led_mask & BUZZER_LED_MASK_GREEN);
+    gpio_put(LED_RED, step->led_mask & BUZZER_LED_MASK_RED);
 }
 
 /**
- * @brief Desliga o buzzer e apaga o LED correspondente.
- * @param led Pino GPIO do LED.
+ * @brief Silencia os buzzers e apaga os LEDs.
  */
-void buzzer_led_off(uint8_t led) {
-    no_tone(BUZZER1_PIN);
+static void silence() {
+    if (!audio_is_playing()) no_tone(BUZZER1_PIN);
     no_tone(BUZZER2_PIN);
-    gpio_put(led, 0);
+    gpio_put(LED_GREEN, 0);
+    gpio_put(LED_RED, 0);
+}
+
+/**
+ * @brief Callback do alarme que avança o padrão para o próximo passo.
+ *
+ * Retorna a duração do novo passo para reagendar o alarme a partir do
+ * instante previsto do disparo anterior, evitando acúmulo de atraso.
+ */
+static int64_t step_callback(alarm_id_t id, void *user_data) {
+    const struct buzzer_led_pattern *pattern = current_pattern;
+    if (pattern == NULL) {
+        return 0;
+    }
+
+    if (++current_step >= pattern->length) {
+        current_step = 0;
+        if (++current_cycle >= pattern->repeat) {
+            current_pattern = NULL;
+            step_alarm = 0;
+            silence();
+            return 0;
+        }
+    }
+
+    const struct buzzer_led_step *step = &pattern->steps[current_step];
+    apply_step(step);
+    return (int64_t)step->duration_ms * 1000;
+}
+
+/**
+ * @brief Inicia a execução de um padrão em segundo plano.
+ *
+ * Retorna imediatamente. O padrão em execução é interrompido se o novo
+ * tiver prioridade maior ou igual; caso contrário o novo é descartado.
+ *
+ * @param pattern Padrão a ser tocado.
+ * @return true se o padrão foi iniciado.
+ */
+bool buzzer_led_play(const struct buzzer_led_pattern *pattern) {
+    uint32_t status = save_and_disable_interrupts();
+
+    if (current_pattern != NULL && pattern->priority < current_pattern->priority) {
+        restore_interrupts(status);
+        return false;
+    }
+
+    if (step_alarm > 0) {
+        alarm_pool_cancel_alarm(ui_alarm_pool(), step_alarm);
+    }
+
+    current_pattern = pattern;
+    current_step = 0;
+    current_cycle = 0;
+    apply_step(&pattern->steps[0]);
+    step_alarm = alarm_pool_add_alarm_in_ms(ui_alarm_pool(), pattern->steps[0].duration_ms, step_callback, NULL, true);
+
+    restore_interrupts(status);
+    return step_alarm > 0;
+}
+
+/**
+ * @brief Interrompe o padrão em execução.
+ */
+void buzzer_led_stop() {
+    uint32_t status = save_and_disable_interrupts();
+
+    if (step_alarm > 0) {
+        alarm_pool_cancel_alarm(ui_alarm_pool(), step_alarm);
+        step_alarm = 0;
+    }
+    current_pattern = NULL;
+    silence();
+
+    restore_interrupts(status);
+}
+
+/**
+ * @brief Informa se há um padrão em execução.
+ */
+bool buzzer_led_is_playing() {
+    return current_pattern != NULL;
+}
+
+/**
+ * @brief Recalcula o tom do passo em execução após uma troca do clk_sys.
+ */
+static void clock_changed(uint32_t sys_hz) {
+    uint32_t status = save_and_disable_interrupts();
+    if (current_pattern != NULL) {
+        apply_step(&current_pattern->steps[current_step]);
+    }
+    restore_interrupts(status);
 }
 
 /**
@@ -74,70 +292,47 @@ void buzzer_led_init() {
     gpio_set_dir(LED_RED, GPIO_OUT);
     buzzer_init(BUZZER1_PIN);
     buzzer_init(BUZZER2_PIN);
+    clock_governor_on_change(clock_changed);
 }
 
 /**
  * @brief Indica sucesso piscando o LED verde e emitindo um som curto.
  */
 void buzzer_led_init_success() {
-    buzzer_led_on(LED_GREEN, 5000);
-    busy_wait_ms(150);
-    buzzer_led_off(LED_GREEN);
+    buzzer_led_play(&init_success_pattern);
 }
 
 /**
  * @brief Indica falha piscando o LED vermelho e emitindo um som longo.
  */
 void buzzer_led_fail() {
-    buzzer_led_on(LED_RED, 2500);
-    busy_wait_ms(500);
-    buzzer_led_off(LED_RED);
+    buzzer_led_play(&fail_pattern);
 }
 
 /**
  * @brief Mensagem sonora e visual número 1: Dois sinais curtos.
  */
 void buzzer_led_msg_1() {
-    for (int i = 0; i < 2; i++) {
-        buzzer_led_on(LED_GREEN, 5000);
-        busy_wait_ms(250);
-        buzzer_led_off(LED_GREEN);
-        busy_wait_ms(50);
-    }
+    buzzer_led_play(&msg_1_pattern);
 }
 
 /**
  * @brief Mensagem sonora e visual número 2: Três sinais alternando frequência.
  */
 void buzzer_led_msg_2() {
-    for (int i = 0; i < 3; i++) {
-        buzzer_led_on(LED_GREEN, (i % 2 == 0) ? 2500 : 5000);
-        busy_wait_ms(250);
-        buzzer_led_off(LED_GREEN);
-        busy_wait_ms(50);
-    }
+    buzzer_led_play(&msg_2_pattern);
 }
 
 /**
  * @brief Mensagem sonora e visual número 3: Seis sinais alternando frequência.
  */
 void buzzer_led_msg_3() {
-    for (int i = 0; i < 6; i++) {
-        buzzer_led_on(LED_GREEN, (i % 2 == 0) ? 2500 : 7500);
-        busy_wait_ms(250);
-        buzzer_led_off(LED_GREEN);
-        busy_wait_ms(50);
-    }
+    buzzer_led_play(&msg_3_pattern);
 }
 
 /**
  * @brief Mensagem sonora e visual número 4: Doze sinais alternando frequência.
  */
 void buzzer_led_msg_4() {
-    for (int i = 0; i < 12; i++) {
-        buzzer_led_on(LED_GREEN, (i % 2 == 0) ? 5000 : 10000);
-        busy_wait_ms(250);
-        buzzer_led_off(LED_GREEN);
-        busy_wait_ms(50);
-    }
+    buzzer_led_play(&msg_4_pattern);
 }
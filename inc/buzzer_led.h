@@ -6,8 +6,10 @@
  * @brief Biblioteca para controle de buzzer e LED via GPIO/PWM.
  *
  * Este cabeçalho contém as definições de pinos e as declarações de funções
- * para controlar buzzers e LEDs.
- * 
+ * para controlar buzzers e LEDs. Os sinais sonoros e visuais são descritos
+ * como tabelas de passos (frequência, LEDs acesos, duração) tocadas em segundo
+ * plano por alarmes de hardware, de modo que iniciar um padrão não bloqueia.
+ *
  * @author Gabriel Mattano da Silva
  * @date 2025
  */
@@ -22,13 +24,44 @@
 #define LED_GREEN  11   ///< Pino GPIO do LED verde
 #define LED_RED    13   ///< Pino GPIO do LED vermelho
 
+// Máscaras de LEDs usadas nos passos dos padrões
+#define BUZZER_LED_MASK_GREEN 0x01  ///< Acende o LED verde
+#define BUZZER_LED_MASK_RED   0x02  ///< Acende o LED vermelho
+
+/**
+ * @brief Passo de um padrão sonoro e visual.
+ */
+struct buzzer_led_step {
+    uint16_t frequency;    ///< Frequência dos buzzers em Hz (0 para silêncio)
+    uint8_t led_mask;      ///< LEDs acesos durante o passo
+    uint16_t duration_ms;  ///< Duração do passo em milissegundos
+};
+
+/**
+ * @brief Padrão sonoro e visual: uma sequência de passos repetida algumas vezes.
+ *
+ * Um padrão só interrompe o que está tocando se tiver prioridade maior ou igual.
+ */
+struct buzzer_led_pattern {
+    const struct buzzer_led_step *steps;  ///< Passos de um ciclo do padrão
+    uint8_t length;                       ///< Número de passos do ciclo
+    uint8_t repeat;                       ///< Quantas vezes o ciclo é tocado
+    uint8_t priority;                     ///< Prioridade (maior interrompe menor)
+};
+
 // Declaração das funções
 void buzzer_led_init();
+void tone(uint8_t pin, uint16_t frequency);
+void no_tone(uint8_t pin);
+bool buzzer_tone_config(uint32_t clock_hz, uint16_t frequency, uint16_t *div16, uint16_t *top);
+bool buzzer_led_play(const struct buzzer_led_pattern *pattern);
+void buzzer_led_stop();
+bool buzzer_led_is_playing();
 void buzzer_led_init_success();
 void buzzer_led_fail();
 void buzzer_led_msg_1();
 void buzzer_led_msg_2();
 void buzzer_led_msg_3();
 void buzzer_led_msg_4();
- 
+
 #endif // BUZZER_LED_H
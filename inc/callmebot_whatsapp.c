@@ -4,7 +4,10 @@
  *
  * Esta implementação permite que um Raspberry Pi Pico W envie mensagens de WhatsApp
  * utilizando o serviço CallMeBot. A comunicação é feita via TCP/IP, resolvendo o 
- * DNS do servidor CallMeBot e enviando requisições HTTP.
+ * DNS do servidor CallMeBot e enviando requisições HTTP. Cada etapa avança por
+ * um callback do lwIP, sem espera ativa; o resultado volta ao laço de eventos
+ * pela fila de chamadas adiadas ou, com a fila cheia, por uma função de
+ * verificação registrada no laço.
  *
  * Recursos principais:
  * - Configuração do servidor DNS para resolução do CallMeBot.
@@ -22,13 +25,41 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include "pico/cyw43_arch.h"
+#include "alert_template.h"
+#include "boot_profile.h"
 #include "callmebot_whatsapp.h"
+#include "event_loop.h"
+#include "log.h"
+#include "trace.h"
+#include "wifi_power.h"
+
+// Etapas de um envio
+enum whatsapp_state {
+    WHATSAPP_IDLE,
+    WHATSAPP_RESOLVING,
+    WHATSAPP_CONNECTING,
+    WHATSAPP_WAITING,
+    WHATSAPP_DONE
+};
 
 // Variáveis globais
 static ip4_addr_t server_ip;      // Armazena o IP do servidor CallMeBot
 static int dns_resolved = 0;      // Flag para indicar se o DNS já foi resolvido
+static bool dns_configured = false;
 static bool message_sent = false; // Status do envio da mensagem
 
+static volatile uint8_t state = WHATSAPP_IDLE;
+static struct tcp_pcb *pcb = NULL;
+static struct event_timer timeout_timer;
+static whatsapp_done_t done_handler;
+static void *done_arg;
+static uint done_core;            // Núcleo cujo laço de eventos recebe o resultado
+static volatile bool finish_pending = false; // Resultado que não coube na fila de chamadas adiadas
+static uint8_t poll_cores = 0;    // Núcleos com finish_poll() registrada, bit (1 << núcleo)
+static char request[1024];        // Requisição montada no início do envio
+static size_t request_length;
+
 /**
  * @brief Configura o servidor DNS para o Google (8.8.8.8)
  */
@@ -37,63 +68,7 @@ static void set_dns_server()
     ip4_addr_t dns_server;
     IP4_ADDR(&dns_server, 8, 8, 8, 8);
     dns_setserver(0, &dns_server);
-    printf("Servidor DNS configurado para 8.8.8.8\n");
-}
-
-/**
- * @brief Resolve o hostname do servidor CallMeBot para um endereço IP.
- *
- * @param hostname Nome do host a ser resolvido.
- * @param ip_addr Ponteiro para armazenar o endereço IP resolvido.
- * @return err_t Código de erro da resolução DNS.
- */
-static err_t resolve_dns(const char *hostname, ip4_addr_t *ip_addr)
-{
-    if (dns_resolved)
-    {
-        *ip_addr = server_ip;
-        printf("Usando IP já resolvido: %s\n", ip4addr_ntoa(ip_addr));
-        return ERR_OK;
-    }
-
-    struct ip4_addr temp_ip;
-    err_t err;
-
-    printf("Resolvendo hostname: %s\n", hostname);
-    err = dns_gethostbyname(hostname, &temp_ip, NULL, NULL);
-
-    if (err == ERR_OK)
-    {
-        *ip_addr = temp_ip;
-        server_ip = temp_ip;
-        dns_resolved = 1;
-        printf("Hostname resolvido: %s -> %s\n", hostname, ip4addr_ntoa(&temp_ip));
-        return ERR_OK;
-    }
-    else if (err == ERR_INPROGRESS)
-    {
-        printf("Aguardando resolução de DNS...\n");
-        for (int i = 0; i < 50; i++) // Tenta resolver o DNS por um tempo limitado
-        {
-            err = dns_gethostbyname(hostname, &temp_ip, NULL, NULL);
-            if (err == ERR_OK)
-            {
-                *ip_addr = temp_ip;
-                server_ip = temp_ip;
-                dns_resolved = 1;
-                printf("Hostname resolvido: %s -> %s\n", hostname, ip4addr_ntoa(&temp_ip));
-                return ERR_OK;
-            }
-            sleep_ms(100); // Aguarda um intervalo antes de tentar novamente
-        }
-        printf("Erro: Tempo limite atingido na resolução de DNS\n");
-    }
-    else
-    {
-        printf("Erro ao resolver DNS: %d\n", err);
-    }
-
-    return err;
+    LOG("Servidor DNS configurado para 8.8.8.8\n");
 }
 
 /**
@@ -134,6 +109,153 @@ void url_encode(const char *input, char *output, int output_size)
     output[j] = '\0'; // Garante que a string esteja corretamente terminada
 }
 
+/**
+ * @brief Acrescenta @p length bytes de @p text à requisição, até o limite @p end.
+ */
+static char *append(char *next, const char *end, const char *text, size_t length)
+{
+    if (length > (size_t)(end - next))
+    {
+        length = (size_t)(end - next);
+    }
+    memcpy(next, text, length);
+    return next + length;
+}
+
+#define APPEND_LITERAL(next, end, text) append(next, end, text, sizeof(text) - 1)
+
+/**
+ * @brief Monta a requisição HTTP de envio de uma mensagem.
+ *
+ * @param output Buffer da requisição.
+ * @param output_size Tamanho do buffer.
+ * @param message Modelo da mensagem; o texto é codificado no formato URL durante a escrita.
+ * @param values Valores dos campos do modelo.
+ * @param phone Número de telefone do destinatário.
+ * @param apikey Chave da API CallMeBot.
+ * @return Tamanho da requisição, sem o terminador.
+ */
+size_t whatsapp_build_request(char *output, size_t output_size, const struct alert_template *message,
+                              const struct alert_values *values, const char *phone, const char *apikey)
+{
+    if (output_size == 0)
+    {
+        return 0;
+    }
+
+    const char *end = output + output_size - 1;
+    char *next = APPEND_LITERAL(output, end, "GET /whatsapp.php?phone=");
+    next = append(next, end, phone, strlen(phone));
+    next = APPEND_LITERAL(next, end, "&text=");
+    next += alert_template_render(message, values, true, next, (size_t)(end - next) + 1);
+    next = APPEND_LITERAL(next, end, "&apikey=");
+    next = append(next, end, apikey, strlen(apikey));
+    next = APPEND_LITERAL(next, end,
+                          " HTTP/1.1\r\n"
+                          "Host: " SERVER_HOSTNAME "\r\n"
+                          "Connection: close\r\n"
+                          "User-Agent: Mozilla/5.0\r\n"
+                          "Accept: */*\r\n\r\n");
+    *next = '\0';
+    return (size_t)(next - output);
+}
+
+/**
+ * @brief Extrai o código HTTP da linha de status da resposta.
+ *
+ * @param p Primeiro buffer da resposta.
+ * @return Código HTTP, ou 0 se a resposta não começa com "HTTP/1.x NNN".
+ */
+int whatsapp_parse_status(const struct pbuf *p)
+{
+    char line[48];
+    uint16_t length = pbuf_copy_partial(p, line, sizeof(line) - 1, 0);
+    line[length] = '\0';
+
+    // "HTTP/1.x NNN": o código só é lido com a linha completa até ele
+    if (length < 12 || strncmp(line, "HTTP/1.", 7) != 0 || line[8] != ' ')
+    {
+        return 0;
+    }
+    return atoi(&line[9]);
+}
+
+/**
+ * @brief Encerra o envio no laço de eventos e entrega o resultado.
+ */
+static void finish_handler(void *arg)
+{
+    if (state == WHATSAPP_IDLE)
+    {
+        return; // Já encerrado pelo tempo limite
+    }
+
+    event_timer_stop(&timeout_timer);
+
+    cyw43_arch_lwip_begin();
+    if (pcb)
+    {
+        tcp_arg(pcb, NULL);
+        tcp_recv(pcb, NULL);
+        tcp_err(pcb, NULL);
+        if (tcp_close(pcb) != ERR_OK)
+        {
+            tcp_abort(pcb);
+        }
+        pcb = NULL;
+    }
+    cyw43_arch_lwip_end();
+
+    state = WHATSAPP_IDLE;
+    done_handler(message_sent, done_arg);
+}
+
+/**
+ * @brief Marca o fim do envio a partir de um callback do lwIP.
+ */
+static void finish(bool sent)
+{
+    if (state == WHATSAPP_DONE || state == WHATSAPP_IDLE)
+    {
+        return;
+    }
+    message_sent = sent;
+    state = WHATSAPP_DONE;
+    if (!event_loop_post_to(done_core, finish_handler, NULL))
+    {
+        finish_pending = true; // Fila cheia: finish_poll() entrega no despertar que a publicação já provocou
+    }
+}
+
+/**
+ * @brief Entrega, no laço de eventos, um resultado que não coube na fila.
+ */
+static bool finish_poll(void *arg)
+{
+    if (!finish_pending || get_core_num() != done_core)
+    {
+        return false;
+    }
+    finish_pending = false;
+    finish_handler(NULL);
+    return true;
+}
+
+/**
+ * @brief Tempo limite do envio, executado no laço de eventos.
+ */
+static void timeout_handler(void *arg)
+{
+    if (state == WHATSAPP_IDLE || state == WHATSAPP_DONE)
+    {
+        return;
+    }
+    LOG("Erro: Timeout ao aguardar resposta do servidor\n");
+    message_sent = false;
+    state = WHATSAPP_DONE;
+    finish_handler(NULL);
+}
+
 /**
  * @brief Callback para processar a resposta do servidor após o envio da mensagem.
  */
@@ -141,95 +263,234 @@ static err_t recv_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_
 {
     if (p == NULL)
     {
-        tcp_close(tpcb); // Fecha a conexão se não houver dados recebidos
+        finish(false); // Conexão fechada pelo servidor sem resposta
         return ERR_OK;
     }
 
-    char *response = (char *)p->payload;
-    printf("Resposta da API: %s\n", strtok(response, "\r\n")); // Exibe a primeira linha da resposta
+    int code = whatsapp_parse_status(p);
+    LOG("Resposta da API: código HTTP %d\n", code); // Só o código: a linha está na RAM
+
+    tcp_recved(tpcb, p->tot_len);
+    pbuf_free(p); // Libera a memória usada pelo buffer
+    trace_mark_alert(TRACE_RESPONSE_PARSED);
 
-    if (strstr(response, "HTTP/1.1 200 OK") != NULL)
+    if (code == 200)
     {
-        message_sent = true; // Marca como enviado se o código de status for 200
-        printf("Mensagem enviada com sucesso (Código 200)\n");
+        LOG("Mensagem enviada com sucesso (Código 200)\n");
+        finish(true);
     }
     else
     {
-        message_sent = false;
-        printf("Erro ao enviar mensagem\n");
+        LOG("Erro ao enviar mensagem\n");
+        finish(false);
     }
+    return ERR_OK;
+}
 
-    pbuf_free(p); // Libera a memória usada pelo buffer
-    tcp_close(tpcb); // Fecha a conexão TCP
-    printf("Conexão fechada após resposta recebida.\n");
+/**
+ * @brief Callback de erro da conexão; o lwIP já liberou o PCB.
+ */
+static void err_callback(void *arg, err_t err)
+{
+    LOG("Erro na conexão com o servidor, código: %d\n", err);
+    pcb = NULL;
+    finish(false);
+}
+
+/**
+ * @brief Callback de conexão estabelecida: envia a requisição HTTP.
+ */
+static err_t connected_callback(void *arg, struct tcp_pcb *tpcb, err_t err)
+{
+    trace_mark_alert(TRACE_TCP_CONNECTED);
+    wifi_power_rx();
+    LOG("Conectado ao CallMeBot. Enviando mensagem...\n");
+
+    err = tcp_write(tpcb, request, request_length, TCP_WRITE_FLAG_COPY); // Envia a requisição
+    if (err == ERR_OK)
+    {
+        err = tcp_output(tpcb);
+    }
+    if (err != ERR_OK)
+    {
+        LOG("Erro ao enviar requisição, código: %d\n", err);
+        finish(false);
+        return ERR_OK;
+    }
+
+    trace_mark_alert(TRACE_REQUEST_SENT);
+    state = WHATSAPP_WAITING;
     return ERR_OK;
 }
 
 /**
- * @brief Envia uma mensagem via WhatsApp usando a API CallMeBot.
- *
- * @param message Texto da mensagem.
- * @param phone Número de telefone do destinatário.
- * @param apikey Chave da API CallMeBot.
- * @return true se a mensagem foi enviada com sucesso, false caso contrário.
+ * @brief Abre a conexão TCP com o servidor já resolvido. Chamada com o lwIP travado.
  */
-bool send_whatsapp_message(const char *message, const char *phone, const char *apikey)
+static void connect_server(void)
 {
-    struct tcp_pcb *pcb = tcp_new();
+    pcb = tcp_new();
     if (!pcb)
     {
-        printf("Erro ao criar PCB\n");
-        return false;
+        LOG("Erro ao criar PCB\n");
+        finish(false);
+        return;
     }
 
-    set_dns_server(); // Configura o servidor DNS
-    if (resolve_dns(SERVER_HOSTNAME, &server_ip) != ERR_OK) // Resolve o hostname
+    state = WHATSAPP_CONNECTING;
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, recv_callback); // Define o callback para processar a resposta
+    tcp_err(pcb, err_callback);
+
+    wifi_power_tx();
+    if (tcp_connect(pcb, &server_ip, SERVER_PORT, connected_callback) != ERR_OK) // Estabelece a conexão TCP
     {
-        printf("Erro ao resolver DNS\n");
-        return false;
+        LOG("Erro ao conectar ao servidor\n");
+        tcp_abort(pcb);
+        pcb = NULL;
+        finish(false);
     }
+}
 
-    if (tcp_connect(pcb, &server_ip, SERVER_PORT, NULL) != ERR_OK) // Estabelece a conexão TCP
+/**
+ * @brief Callback da resolução de DNS.
+ */
+static void dns_callback(const char *hostname, const ip_addr_t *ipaddr, void *arg)
+{
+    if (state != WHATSAPP_RESOLVING)
     {
-        printf("Erro ao conectar ao servidor\n");
-        return false;
+        // Resposta de um envio já encerrado pelo tempo limite: só guarda o endereço
+        if (ipaddr != NULL)
+        {
+            server_ip = *ipaddr;
+            dns_resolved = 1;
+        }
+        return;
+    }
+    if (ipaddr == NULL)
+    {
+        LOG("Erro ao resolver DNS\n");
+        finish(false);
+        return;
     }
 
-    printf("Conectado ao CallMeBot. Enviando mensagem...\n");
+    server_ip = *ipaddr;
+    dns_resolved = 1;
+    boot_profile_mark(BOOT_STAGE_DNS);
+    trace_mark_alert(TRACE_DNS_DONE);
+    LOG("Hostname resolvido: %s -> %u.%u.%u.%u\n", LOG_STR(SERVER_HOSTNAME),
+        ip4_addr1(&server_ip), ip4_addr2(&server_ip), ip4_addr3(&server_ip), ip4_addr4(&server_ip));
+    connect_server();
+}
 
-    char encoded_message[1024];
-    url_encode(message, encoded_message, sizeof(encoded_message)); // Codifica a mensagem
+/**
+ * @brief Callback da resolução antecipada de DNS.
+ */
+static void dns_prefetch_callback(const char *hostname, const ip_addr_t *ipaddr, void *arg)
+{
+    if (ipaddr != NULL)
+    {
+        server_ip = *ipaddr;
+        dns_resolved = 1;
+        boot_profile_mark(BOOT_STAGE_DNS);
+        LOG("Hostname resolvido antecipadamente: %s -> %u.%u.%u.%u\n", LOG_STR(SERVER_HOSTNAME),
+            ip4_addr1(&server_ip), ip4_addr2(&server_ip), ip4_addr3(&server_ip), ip4_addr4(&server_ip));
+    }
+}
+
+/**
+ * @brief Configura o servidor DNS na primeira utilização. Chamada com o lwIP travado.
+ */
+static void ensure_dns_server(void)
+{
+    if (!dns_configured)
+    {
+        set_dns_server(); // Configura o servidor DNS
+        dns_configured = true;
+    }
+}
 
-    char request[1024];
-    snprintf(request, sizeof(request),
-            "GET /whatsapp.php?phone=%s&text=%s&apikey=%s HTTP/1.1\r\n"
-            "Host: %s\r\n"
-            "Connection: close\r\n"
-            "User-Agent: Mozilla/5.0\r\n"
-            "Accept: */*\r\n\r\n",
-            phone, encoded_message, apikey, SERVER_HOSTNAME); // Monta a requisição HTTP
+void whatsapp_prefetch_dns(void)
+{
+    if (dns_resolved)
+    {
+        return;
+    }
 
-    err_t err = tcp_write(pcb, request, strlen(request), TCP_WRITE_FLAG_COPY); // Envia a requisição
-    if (err != ERR_OK)
+    cyw43_arch_lwip_begin();
+    ensure_dns_server();
+    ip_addr_t address;
+    if (dns_gethostbyname(SERVER_HOSTNAME, &address, dns_prefetch_callback, NULL) == ERR_OK)
+    {
+        dns_prefetch_callback(SERVER_HOSTNAME, &address, NULL);
+    }
+    cyw43_arch_lwip_end();
+}
+
+bool whatsapp_is_busy(void)
+{
+    return state != WHATSAPP_IDLE;
+}
+
+/**
+ * @brief Inicia o envio de uma mensagem via WhatsApp usando a API CallMeBot.
+ *
+ * @param message Modelo da mensagem.
+ * @param values Valores dos campos do modelo.
+ * @param phone Número de telefone do destinatário.
+ * @param apikey Chave da API CallMeBot.
+ * @param done Tratador do resultado, chamado no laço de eventos.
+ * @param arg Argumento repassado a done.
+ * @return true se o envio foi iniciado, false se já havia um envio em andamento.
+ */
+bool send_whatsapp_message(const struct alert_template *message, const struct alert_values *values,
+                           const char *phone, const char *apikey, whatsapp_done_t done, void *arg)
+{
+    if (state != WHATSAPP_IDLE)
     {
-        printf("Erro ao enviar requisição, código: %d\n", err);
         return false;
     }
 
-    tcp_recv(pcb, recv_callback); // Define o callback para processar a resposta
+    request_length = whatsapp_build_request(request, sizeof(request), message, values, phone, apikey);
 
-    absolute_time_t start_time = get_absolute_time();
-    while (!message_sent && absolute_time_diff_us(start_time, get_absolute_time()) < 10000000)
+    done_handler = done;
+    done_arg = arg;
+    done_core = get_core_num();
+    if (!(poll_cores & 1u << done_core))
     {
-        sleep_ms(100); // Aguarda a resposta do servidor por um tempo limite
+        event_loop_add_poll(finish_poll, NULL);
+        poll_cores |= 1u << done_core;
     }
+    message_sent = false;
+    finish_pending = false;
+    state = WHATSAPP_RESOLVING;
+    event_timer_start(&timeout_timer, CALLMEBOT_TIMEOUT_MS, 0, timeout_handler, NULL);
+
+    cyw43_arch_lwip_begin();
+    ensure_dns_server();
 
-    if (!message_sent)
+    if (dns_resolved)
     {
-        printf("Erro: Timeout ao aguardar resposta do servidor\n");
-        tcp_close(pcb); // Fecha a conexão após o timeout
-        return false;
+        trace_mark_alert(TRACE_DNS_DONE);
+        LOG("Usando IP já resolvido: %u.%u.%u.%u\n",
+            ip4_addr1(&server_ip), ip4_addr2(&server_ip), ip4_addr3(&server_ip), ip4_addr4(&server_ip));
+        connect_server();
+    }
+    else
+    {
+        LOG("Resolvendo hostname: %s\n", LOG_STR(SERVER_HOSTNAME));
+        ip_addr_t address;
+        err_t err = dns_gethostbyname(SERVER_HOSTNAME, &address, dns_callback, NULL);
+        if (err == ERR_OK)
+        {
+            dns_callback(SERVER_HOSTNAME, &address, NULL);
+        }
+        else if (err != ERR_INPROGRESS)
+        {
+            LOG("Erro ao resolver DNS: %d\n", err);
+            finish(false);
+        }
     }
+    cyw43_arch_lwip_end();
 
     return true;
 }
@@ -20,21 +20,84 @@
 // Definições de constantes                   
 #define SERVER_HOSTNAME "api.callmebot.com" // Hostname do servidor CallMeBot
 #define SERVER_PORT 80                      // Porta do servidor HTTP
+#define CALLMEBOT_TIMEOUT_MS 10000          // Tempo máximo de um envio, da resolução de DNS à resposta
 
-// Definição das mensagens
-#define MESSAGE_1 "Estou bem, mas gostaria de conversar. Me ligue por favor?"
-#define MESSAGE_2 "Estou tendo dificuldades. Por favor, me ajude."
-#define MESSAGE_3 "Estou me sentindo um pouco mal. Me ligue por favor?"
-#define MESSAGE_4 "SOCORRO! Preciso de ajuda imediata!"
+// Textos de fábrica das mensagens; os vigentes vêm de config_get() (inc/config_store.h).
+// Os campos entre chaves são preenchidos no envio (inc/alert_template.h).
+#define MESSAGE_INIT "Dispositivo pronto para uso! Bateria: {bateria}, sinal: {rssi} dBm."
+#define MESSAGE_1 "Estou bem, mas gostaria de conversar. Me ligue por favor? ({hora}, pedido {tentativa})"
+#define MESSAGE_2 "Estou tendo dificuldades. Por favor, me ajude. ({hora}, pedido {tentativa})"
+#define MESSAGE_3 "Estou me sentindo um pouco mal. Me ligue por favor? ({hora}, pedido {tentativa})"
+#define MESSAGE_4 "SOCORRO! Preciso de ajuda imediata! ({hora}, pedido {tentativa})"
+
+#define ALERT_MESSAGE_COUNT 5  ///< Mensagem inicial e as quatro mensagens dos botões
+
+struct alert_template;
+struct alert_values;
 
 /**
- * @brief Envia uma mensagem via WhatsApp utilizando o serviço CallMeBot.
+ * @brief Tratador chamado, no laço de eventos, ao fim de um envio.
+ *
+ * @param sent true se o servidor confirmou o envio (código 200).
+ * @param arg Argumento passado a send_whatsapp_message().
+ */
+typedef void (*whatsapp_done_t)(bool sent, void *arg);
+
+/**
+ * @brief Inicia o envio de uma mensagem via WhatsApp utilizando o serviço CallMeBot.
+ *
+ * Retorna imediatamente; a resolução de DNS, a conexão e a resposta são
+ * tratadas por callbacks do lwIP e o resultado é entregue a @p done no laço
+ * de eventos do núcleo que iniciou o envio. Apenas um envio ocorre por vez.
  *
- * @param message Ponteiro para a string contendo a mensagem a ser enviada.
+ * @param message Modelo da mensagem a ser enviada (alert_template_get()).
+ * @param values Valores dos campos do modelo, lidos só durante a chamada.
  * @param phone Ponteiro para a string contendo o número de telefone de destino.
  * @param apikey Ponteiro para a string contendo a chave de API para autenticação.
- * @return true se a mensagem for enviada com sucesso, false caso contrário.
+ * @param done Tratador do resultado.
+ * @param arg Argumento repassado a @p done.
+ * @return true se o envio foi iniciado, false se já havia um envio em andamento.
+ */
+bool send_whatsapp_message(const struct alert_template *message, const struct alert_values *values,
+                           const char *phone, const char *apikey, whatsapp_done_t done, void *arg);
+
+/**
+ * @brief Antecipa a resolução do DNS do servidor, assim que a rede estiver disponível.
+ *
+ * Retorna imediatamente; o endereço obtido é usado pelo primeiro envio.
+ */
+void whatsapp_prefetch_dns(void);
+
+/**
+ * @brief Informa se há um envio em andamento.
+ */
+bool whatsapp_is_busy(void);
+
+/**
+ * @brief Codifica uma string no formato URL (espaço vira '+').
+ *
+ * @param input String de entrada.
+ * @param output Buffer para a string codificada, sempre terminado em '\0'.
+ * @param output_size Tamanho do buffer de saída.
+ */
+void url_encode(const char *input, char *output, int output_size);
+
+/**
+ * @brief Monta a requisição HTTP de envio de uma mensagem à API CallMeBot.
+ *
+ * Os trechos fixos e o texto da mensagem são escritos em sequência em
+ * @p output, sem snprintf(); a mensagem é codificada durante a escrita.
+ *
+ * @return Tamanho da requisição, sem o terminador '\0'; truncada se não couber.
+ */
+size_t whatsapp_build_request(char *output, size_t output_size, const struct alert_template *message,
+                              const struct alert_values *values, const char *phone, const char *apikey);
+
+/**
+ * @brief Extrai o código HTTP da linha de status da resposta do servidor.
+ *
+ * @return Código HTTP, ou 0 se a resposta não começa com "HTTP/1.x NNN".
  */
-bool send_whatsapp_message(const char *message, const char *phone, const char *apikey);
+int whatsapp_parse_status(const struct pbuf *p);
 
 #endif // CALLMEBOT_WHATSAPP_H
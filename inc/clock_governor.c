@@ -0,0 +1,263 @@
+/**
+ * @file clock_governor.c
+ * @brief Implementação do governador do clk_sys.
+ *
+ * O estado do governador pertence ao núcleo 1: o núcleo 0 apenas altera o
+ * contador de pedidos de rajada (escrito só por ele) ou o ponto fixado e
+ * publica uma reavaliação no laço do núcleo 1. A permanência e as latências
+ * são lidas pelo console sem trava; uma leitura no meio de uma troca só
+ * atrasa o relatório em uma troca.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/clocks.h"
+#include "clock_governor.h"
+#include "event_loop.h"
+#include "usb_console.h"
+
+#if LIB_PICO_STDIO_UART
+#include "hardware/uart.h"
+#endif
+
+// Ponto de operação
+struct clock_point {
+    const char *name;
+    uint32_t khz;
+};
+
+// 48 MHz vem do PLL_USB (set_sys_clock_48mhz), permitindo desligar o PLL_SYS
+static const struct clock_point points[CLOCK_LEVEL_COUNT] = {
+    {"repouso", 48000},
+    {"normal", 125000},
+    {"rajada", 133000},
+};
+
+// Permanência e alertas de um ponto
+struct clock_point_stats {
+    uint64_t residency_us;
+    uint32_t alerts;
+    uint32_t latency_total_ms;
+    uint32_t latency_max_ms;
+};
+
+static struct clock_point_stats stats[CLOCK_LEVEL_COUNT];
+static volatile enum clock_level level = CLOCK_LEVEL_NORMAL;  // Ponto do SDK na partida
+static volatile int pinned = -1;              // Ponto fixado pelo console, ou -1
+static volatile uint8_t boost_requests = 0;   // Escrito só pelo núcleo 0
+static uint64_t level_since_us;
+static uint64_t last_activity_us;
+static uint32_t switches = 0;
+static uint32_t switch_max_us = 0;
+static bool running = false;
+
+static clock_listener_t listeners[CLOCK_GOVERNOR_MAX_LISTENERS];
+static uint8_t listener_count = 0;
+
+// Acumula a permanência do ponto atual até agora
+static void account(void) {
+    uint64_t now = time_us_64();
+    stats[level].residency_us += now - level_since_us;
+    level_since_us = now;
+}
+
+// Recalcula os divisores dependentes com o clk_sys atual
+static void notify(void) {
+    uint32_t sys_hz = clock_get_hz(clk_sys);
+    for (int i = 0; i < listener_count; i++) {
+        listeners[i](sys_hz);
+    }
+#if LIB_PICO_STDIO_UART
+    uart_set_baudrate(uart_default, PICO_DEFAULT_UART_BAUD_RATE);
+#endif
+}
+
+// Permanência de um ponto, incluindo a ainda não contabilizada do ponto atual
+static uint64_t residency_us(enum clock_level i) {
+    uint64_t residency = stats[i].residency_us;
+    if (i == level && running) {
+        residency += time_us_64() - level_since_us;
+    }
+    return residency;
+}
+
+// Corrente estimada de um ponto, em uA
+static uint32_t point_ua(enum clock_level i) {
+    return CLOCK_GOVERNOR_BASE_UA + CLOCK_GOVERNOR_UA_PER_MHZ * points[i].khz / 1000;
+}
+
+// Núcleo 1: troca o clk_sys e recalcula os divisores dependentes
+static void set_level(enum clock_level next) {
+    if (next == level) {
+        return;
+    }
+
+    uint32_t start = time_us_32();
+    account();
+
+    if (points[next].khz == 48000) {
+        set_sys_clock_48mhz();
+    }
+    else {
+        set_sys_clock_khz(points[next].khz, true);
+    }
+
+    notify();
+    level = next;
+    switches++;
+    uint32_t elapsed = time_us_32() - start;
+    if (elapsed > switch_max_us) {
+        switch_max_us = elapsed;
+    }
+}
+
+// Ponto exigido pela carga atual
+static enum clock_level wanted_level(void) {
+    if (pinned >= 0) {
+        return (enum clock_level)pinned;
+    }
+    if (boost_requests) {
+        return CLOCK_LEVEL_BOOST;
+    }
+    if (time_us_64() - last_activity_us < CLOCK_GOVERNOR_IDLE_MS * 1000ull) {
+        return CLOCK_LEVEL_NORMAL;
+    }
+    return CLOCK_LEVEL_IDLE;
+}
+
+static void evaluate(void *arg) {
+    if (running) {
+        set_level(wanted_level());
+    }
+}
+
+#if !EVENT_LOOP_FREERTOS
+static struct event_timer check_timer;
+
+static void start(void *arg) {
+    level_since_us = last_activity_us = time_us_64();
+    running = true;
+    event_timer_start(&check_timer, CLOCK_GOVERNOR_CHECK_MS, CLOCK_GOVERNOR_CHECK_MS, evaluate, NULL);
+}
+#endif
+
+void clock_governor_on_change(clock_listener_t listener) {
+    hard_assert(listener_count < CLOCK_GOVERNOR_MAX_LISTENERS);
+    listeners[listener_count++] = listener;
+}
+
+void clock_governor_boost(bool on) {
+    if (on) {
+        boost_requests++;
+    }
+    else if (boost_requests > 0) {
+        boost_requests--;
+    }
+    event_loop_post_to(1, evaluate, NULL);
+}
+
+void clock_governor_activity(void) {
+    last_activity_us = time_us_64();
+    if (running && level < CLOCK_LEVEL_NORMAL) {
+        set_level(wanted_level());
+    }
+}
+
+void clock_governor_resume(void) {
+    account();
+    level = CLOCK_LEVEL_NORMAL;
+    last_activity_us = time_us_64();
+    switches++;
+    notify();
+}
+
+uint64_t clock_governor_charge_uas(void) {
+    uint64_t charge = 0;
+    for (int i = 0; i < CLOCK_LEVEL_COUNT; i++) {
+        charge += residency_us(i) / 1000 * point_ua(i) / 1000;
+    }
+    return charge;
+}
+
+void clock_governor_record_alert(uint32_t latency_us) {
+    struct clock_point_stats *s = &stats[level];
+    uint32_t latency_ms = latency_us / 1000;
+
+    s->alerts++;
+    s->latency_total_ms += latency_ms;
+    if (latency_ms > s->latency_max_ms) {
+        s->latency_max_ms = latency_ms;
+    }
+}
+
+void clock_governor_print(void) {
+    uint64_t total_us = 0, total_charge = 0;  // Carga em uA·s
+    enum clock_level current = level;
+
+    printf("Relógio: %s (%u MHz), %s, %u trocas, troca mais lenta %u us\n",
+           points[current].name, (unsigned)(clock_get_hz(clk_sys) / 1000000),
+           pinned >= 0 ? "fixo" : running ? "automático" : "parado",
+           (unsigned)switches, (unsigned)switch_max_us);
+    printf("%-8s %5s %10s %8s %10s %8s %10s %10s\n", "ponto", "MHz", "tempo (s)", "uA est.",
+           "carga mAh", "alertas", "média ms", "máxima ms");
+
+    for (int i = 0; i < CLOCK_LEVEL_COUNT; i++) {
+        const struct clock_point_stats *s = &stats[i];
+        uint32_t current_ua = point_ua(i);
+        uint64_t residency = residency_us(i);
+        uint64_t seconds = residency / 1000000;
+        uint64_t charge = residency / 1000 * current_ua / 1000;
+
+        total_us += residency;
+        total_charge += charge;
+        printf("%-8s %5u %10u %8u %6u.%03u %8u %10u %10u\n", points[i].name, (unsigned)(points[i].khz / 1000),
+               (unsigned)seconds, (unsigned)current_ua,
+               (unsigned)(charge / 3600000), (unsigned)(charge / 3600 % 1000),
+               (unsigned)s->alerts, (unsigned)(s->alerts ? s->latency_total_ms / s->alerts : 0),
+               (unsigned)s->latency_max_ms);
+    }
+
+    uint64_t total_s = total_us / 1000000;
+    printf("Corrente média estimada: %u uA\n", (unsigned)(total_s ? total_charge / total_s : 0));
+}
+
+// Comando "clock [auto|repouso|normal|rajada]" do console USB
+static void clock_command(const char *args) {
+    if (*args == '\0') {
+        clock_governor_print();
+        return;
+    }
+
+    int point = -2;
+    if (strcmp(args, "auto") == 0) {
+        point = -1;
+    }
+    for (int i = 0; i < CLOCK_LEVEL_COUNT; i++) {
+        if (strcmp(args, points[i].name) == 0) {
+            point = i;
+        }
+    }
+    if (point == -2) {
+        printf("Ponto desconhecido: %s\n", args);
+        return;
+    }
+
+    pinned = point;
+    event_loop_post_to(1, evaluate, NULL);
+    printf("Relógio: %s\n", point >= 0 ? points[point].name : "automático");
+}
+
+static const struct usb_console_command clock_console_command = {
+    "clock", "[auto|repouso|normal|rajada] pontos de operação do clk_sys", clock_command
+};
+
+void clock_governor_init(void) {
+    usb_console_register(&clock_console_command);
+#if !EVENT_LOOP_FREERTOS
+    event_loop_post_to(1, start, NULL);
+#endif
+}
@@ -0,0 +1,101 @@
+#ifndef CLOCK_GOVERNOR_H
+#define CLOCK_GOVERNOR_H
+
+/**
+ * @file clock_governor.h
+ * @brief Frequência do clk_sys conforme a carga.
+ *
+ * Três pontos de operação: repouso (48 MHz, do PLL_USB, com o PLL_SYS
+ * desligado), normal (125 MHz) e rajada (133 MHz). O envio de um alerta pede
+ * a rajada, qualquer atividade da interface garante ao menos o normal e,
+ * sem atividade por CLOCK_GOVERNOR_IDLE_MS, o relógio cai para o repouso.
+ *
+ * As trocas são feitas no núcleo 1, dono dos periféricos que dependem do
+ * clk_sys (que também alimenta o clk_peri): logo após a troca, ainda no mesmo
+ * tratador, cada módulo registrado com clock_governor_on_change() recalcula
+ * os seus divisores (tons dos buzzers, taxa de amostragem do áudio, baud do
+ * I2C do display e, se habilitada, a UART do stdio). O clk_usb vem do
+ * PLL_USB e não muda; o temporizador de 1 MHz vem do clk_ref.
+ *
+ * O comando "clock" do console USB exibe, para cada ponto, o tempo de
+ * permanência, a carga estimada pelo modelo de corrente abaixo e a latência
+ * dos alertas concluídos nele; "clock repouso|normal|rajada" fixa um ponto
+ * para medir, "clock auto" volta ao governador.
+ *
+ * Na variante FreeRTOS o relógio fica fixo: o SysTick do escalonador é
+ * derivado do clk_sys na partida.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define CLOCK_GOVERNOR_IDLE_MS      10000  ///< Sem atividade por este tempo, repouso
+#define CLOCK_GOVERNOR_CHECK_MS     1000   ///< Reavaliação periódica no núcleo 1
+#define CLOCK_GOVERNOR_MAX_LISTENERS 4     ///< Módulos que recalculam os divisores
+
+// Modelo de corrente do RP2040 (sem o CYW43), para a estimativa do relatório
+#define CLOCK_GOVERNOR_BASE_UA      2500   ///< Parcela fixa, em uA
+#define CLOCK_GOVERNOR_UA_PER_MHZ   150    ///< Parcela proporcional ao clk_sys, em uA/MHz
+
+/**
+ * @brief Pontos de operação, do mais econômico ao mais rápido.
+ */
+enum clock_level {
+    CLOCK_LEVEL_IDLE,
+    CLOCK_LEVEL_NORMAL,
+    CLOCK_LEVEL_BOOST,
+    CLOCK_LEVEL_COUNT
+};
+
+/**
+ * @brief Chamada no núcleo 1 logo após cada troca, com a nova frequência do clk_sys.
+ */
+typedef void (*clock_listener_t)(uint32_t sys_hz);
+
+/**
+ * @brief Registra o comando "clock" e inicia o governador no laço do núcleo 1.
+ *
+ * Chamada no núcleo 0, depois de ui_core_launch().
+ */
+void clock_governor_init(void);
+
+/**
+ * @brief Registra um módulo que depende do clk_sys ou do clk_peri.
+ */
+void clock_governor_on_change(clock_listener_t listener);
+
+/**
+ * @brief Núcleo 0: pede (true) ou libera (false) a rajada; os pedidos se acumulam.
+ */
+void clock_governor_boost(bool on);
+
+/**
+ * @brief Núcleo 1: registra atividade da interface, subindo imediatamente ao ponto normal.
+ */
+void clock_governor_activity(void);
+
+/**
+ * @brief Núcleo 1: clocks_init() devolveu o clk_sys ao ponto normal (despertar do dormant).
+ *
+ * Recalcula os divisores dependentes e conta o despertar como atividade.
+ */
+void clock_governor_resume(void);
+
+/**
+ * @brief Carga estimada do RP2040 acordado desde a partida, em uA·s.
+ */
+uint64_t clock_governor_charge_uas(void);
+
+/**
+ * @brief Núcleo 0: registra a latência de um alerta concluído no ponto atual.
+ */
+void clock_governor_record_alert(uint32_t latency_us);
+
+/**
+ * @brief Exibe permanência, carga estimada e latência dos alertas de cada ponto.
+ */
+void clock_governor_print(void);
+
+#endif // CLOCK_GOVERNOR_H
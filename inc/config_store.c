@@ -0,0 +1,372 @@
+/**
+ * @file config_store.c
+ * @brief Implementação da configuração gravada na flash.
+ *
+ * Formato de um setor do anel:
+ *
+ * - cabeçalho de 16 bytes: assinatura, geração e o seu complemento;
+ * - registros alinhados a 4 bytes: chave, tamanho do valor (com o '\0'; 0
+ *   volta ao valor de fábrica), CRC-16 da chave, do tamanho e do valor, o
+ *   valor completado com 0xFF e a palavra de confirmação;
+ * - o restante apagado (0xFF).
+ *
+ * Programar só leva bits de 1 a 0: um tamanho gravado pela metade é maior ou
+ * igual ao correto, e pular o registro nunca cai dentro do próximo. Um
+ * cabeçalho de registro impossível (chave desconhecida ou tamanho além do
+ * setor), ou um byte programado depois do fim do log, força a compactação na
+ * próxima gravação.
+ *
+ * Os valores são programados página a página a partir de uma cópia na SRAM,
+ * e cada página é conferida pelo XIP depois da operação.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "hardware/flash.h"
+#include "config_store.h"
+#include "credentials.h"
+#include "flash_guard.h"
+#include "log.h"
+#include "usb_console.h"
+
+#define CONFIG_STORE_OFFSET   (PICO_FLASH_SIZE_BYTES - CONFIG_STORE_SECTORS * FLASH_SECTOR_SIZE)
+#define CONFIG_SECTOR_MAGIC   0x47464343u  // "CCFG"
+#define CONFIG_RECORD_COMMIT  0x214B4F43u  // "COK!"
+#define CONFIG_ERASED_WORD    0xFFFFFFFFu
+
+#define CONFIG_DEFAULTS {SSID, PASSWORD, PHONE_NUMBER, API_KEY, MESSAGE_INIT, MESSAGE_1, MESSAGE_2, MESSAGE_3, MESSAGE_4}
+
+// Cabeçalho do setor, programado por último na compactação
+struct config_sector_header {
+    uint32_t magic;
+    uint32_t generation;
+    uint32_t generation_check;  // ~generation
+    uint32_t reserved;          // 0xFFFFFFFF
+};
+
+// Cabeçalho de um registro; o valor e a confirmação vêm em seguida
+struct config_record {
+    uint8_t key;
+    uint8_t length;
+    uint16_t crc;
+};
+
+// Operação sobre a flash: programa uma página, ou apaga um setor se data é NULL
+struct flash_request {
+    uint32_t offset;
+    const uint8_t *data;
+};
+
+static const char *const defaults[CONFIG_KEY_COUNT] = CONFIG_DEFAULTS;
+const char *volatile config_values[CONFIG_KEY_COUNT] = CONFIG_DEFAULTS;
+
+static const char *const key_names[CONFIG_KEY_COUNT] = {
+    "ssid", "senha", "telefone", "apikey", "mensagem0", "mensagem1", "mensagem2", "mensagem3", "mensagem4",
+};
+
+static int active = -1;          // Setor ativo, ou -1 se nenhum é válido
+static uint32_t generation = 0;
+static uint32_t used = 0;        // Início da área livre do setor ativo
+static bool tainted = false;     // Registro interrompido: a próxima gravação compacta
+
+static uint32_t writes = 0;
+static uint32_t compactions = 0;
+static uint32_t discarded = 0;   // Registros sem confirmação ou com CRC errado, na partida
+static uint32_t failures = 0;
+
+static uint8_t page[FLASH_PAGE_SIZE];  // Fonte das programações, na SRAM
+static uint8_t record_buffer[sizeof(struct config_record) + CONFIG_STORE_VALUE_MAX + 4];
+
+static void __not_in_flash_func(flash_request_run)(void *arg) {
+    const struct flash_request *request = arg;
+    if (request->data) {
+        flash_range_program(request->offset, request->data, FLASH_PAGE_SIZE);
+    } else {
+        flash_range_erase(request->offset, FLASH_SECTOR_SIZE);
+    }
+}
+
+static uint32_t sector_offset(int sector) {
+    return CONFIG_STORE_OFFSET + (uint32_t)sector * FLASH_SECTOR_SIZE;
+}
+
+static const uint8_t *flash_at(uint32_t offset) {
+    return (const uint8_t *)(uintptr_t)(XIP_BASE + offset);
+}
+
+static uint32_t record_size(uint8_t length) {
+    return sizeof(struct config_record) + ((length + 3u) & ~3u) + sizeof(uint32_t);
+}
+
+static uint16_t record_crc(uint8_t key, uint8_t length, const uint8_t *value) {
+    uint8_t head[2] = {key, length};
+    uint16_t crc = 0xFFFF;
+
+    for (uint32_t i = 0; i < 2u + length; i++) {
+        crc ^= (uint16_t)(i < 2 ? head[i] : value[i - 2]) << 8;
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x8000 ? (uint16_t)(crc << 1 ^ 0x1021) : (uint16_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+// Programa bytes quaisquer, página a página, e confere pelo XIP
+static bool program(uint32_t offset, const void *data, size_t length) {
+    const uint8_t *src = data;
+
+    while (length) {
+        uint32_t page_offset = offset & ~(FLASH_PAGE_SIZE - 1u);
+        size_t start = offset - page_offset;
+        size_t count = length < FLASH_PAGE_SIZE - start ? length : FLASH_PAGE_SIZE - start;
+
+        // O restante da página fica em 0xFF, que não altera o que já está gravado
+        memset(page, 0xFF, sizeof(page));
+        memcpy(page + start, src, count);
+        struct flash_request request = {page_offset, page};
+        flash_guard_run(flash_request_run, &request);
+        if (memcmp(flash_at(offset), src, count) != 0) {
+            return false;
+        }
+
+        offset += count;
+        src += count;
+        length -= count;
+    }
+    return true;
+}
+
+static void erase(int sector) {
+    struct flash_request request = {sector_offset(sector), NULL};
+    flash_guard_run(flash_request_run, &request);
+}
+
+// Grava um registro (valor NULL: volta ao de fábrica); devolve o valor na flash
+static const char *write_record(uint32_t offset, enum config_key key, const char *value) {
+    struct config_record *record = (struct config_record *)record_buffer;
+    uint8_t length = value ? (uint8_t)(strlen(value) + 1) : 0;
+    uint32_t size = record_size(length) - sizeof(uint32_t);
+    static const uint32_t commit = CONFIG_RECORD_COMMIT;
+
+    memset(record_buffer, 0xFF, sizeof(record_buffer));
+    record->key = (uint8_t)key;
+    record->length = length;
+    memcpy(record_buffer + sizeof(*record), value ? value : "", length);
+    record->crc = record_crc(record->key, length, record_buffer + sizeof(*record));
+
+    // A confirmação é uma segunda programação, depois do registro completo
+    if (!program(offset, record_buffer, size) || !program(offset + size, &commit, sizeof(commit))) {
+        return NULL;
+    }
+    return value ? (const char *)flash_at(offset + sizeof(*record)) : defaults[key];
+}
+
+static bool header_valid(int sector) {
+    const struct config_sector_header *header = (const void *)flash_at(sector_offset(sector));
+    return header->magic == CONFIG_SECTOR_MAGIC && header->generation_check == ~header->generation;
+}
+
+static bool record_valid(const struct config_record *record) {
+    const uint8_t *value = (const uint8_t *)(record + 1);
+    uint32_t commit;
+
+    memcpy(&commit, value + record_size(record->length) - sizeof(*record) - sizeof(commit), sizeof(commit));
+    if (commit != CONFIG_RECORD_COMMIT || record->length > CONFIG_STORE_VALUE_MAX + 1) {
+        return false;
+    }
+    if (record->length && value[record->length - 1] != '\0') {
+        return false;
+    }
+    return record->crc == record_crc(record->key, record->length, value);
+}
+
+// Lê o log do setor ativo: cada registro confirmado substitui o valor anterior
+static void scan(void) {
+    uint32_t base = sector_offset(active);
+    uint32_t offset = sizeof(struct config_sector_header);
+
+    while (offset + sizeof(struct config_record) <= FLASH_SECTOR_SIZE) {
+        const struct config_record *record = (const void *)flash_at(base + offset);
+        uint32_t word;
+        memcpy(&word, record, sizeof(word));
+        if (word == CONFIG_ERASED_WORD) {
+            break;
+        }
+
+        uint32_t size = record_size(record->length);
+        if (record->key >= CONFIG_KEY_COUNT || offset + size > FLASH_SECTOR_SIZE) {
+            tainted = true;
+            break;
+        }
+        if (record_valid(record)) {
+            config_values[record->key] = record->length ? (const char *)(record + 1) : defaults[record->key];
+        } else {
+            discarded++;
+        }
+        offset += size;
+    }
+    used = offset;
+
+    // Bytes programados além do fim do log: registro interrompido antes do cabeçalho
+    for (uint32_t i = offset; i < FLASH_SECTOR_SIZE && !tainted; i++) {
+        tainted = flash_at(base + i)[0] != 0xFF;
+    }
+}
+
+static bool stored(enum config_key key) {
+    return config_values[key] != defaults[key];
+}
+
+// Copia os valores vigentes, com o novo, para o próximo setor do anel
+static bool compact(enum config_key key, const char *value) {
+    int target = active < 0 ? 0 : (active + 1) % CONFIG_STORE_SECTORS;
+    uint32_t base = sector_offset(target);
+    uint32_t offset = sizeof(struct config_sector_header);
+    const char *next[CONFIG_KEY_COUNT];
+
+    erase(target);
+    for (int i = 0; i < CONFIG_KEY_COUNT; i++) {
+        const char *v = i == (int)key ? value : stored(i) ? config_values[i] : NULL;
+        next[i] = defaults[i];
+        if (v == NULL) {
+            continue;
+        }
+        next[i] = write_record(base + offset, i, v);
+        if (next[i] == NULL) {
+            return false;
+        }
+        offset += record_size((uint8_t)(strlen(v) + 1));
+    }
+
+    // Só o cabeçalho completo torna o setor válido, com a geração mais alta
+    struct config_sector_header header = {CONFIG_SECTOR_MAGIC, generation + 1, ~(generation + 1), CONFIG_ERASED_WORD};
+    if (!program(base, &header, sizeof(header))) {
+        return false;
+    }
+
+    active = target;
+    generation++;
+    used = offset;
+    tainted = false;
+    compactions++;
+    for (int i = 0; i < CONFIG_KEY_COUNT; i++) {
+        config_values[i] = next[i];
+    }
+    return true;
+}
+
+bool config_store_set(enum config_key key, const char *value) {
+    size_t length = value ? strlen(value) + 1 : 0;
+    if (key >= CONFIG_KEY_COUNT || length > CONFIG_STORE_VALUE_MAX + 1) {
+        return false;
+    }
+
+    // Nada a gravar: poupa a flash
+    if (value ? strcmp(value, config_values[key]) == 0 : !stored(key)) {
+        return true;
+    }
+
+    bool ok;
+    uint32_t size = record_size((uint8_t)length);
+    if (active < 0 || tainted || used + size > FLASH_SECTOR_SIZE) {
+        ok = compact(key, value);
+    } else {
+        const char *written = write_record(sector_offset(active) + used, key, value);
+        used += size;  // Mesmo com falha: o espaço não é reaproveitado
+        ok = written != NULL;
+        if (ok) {
+            config_values[key] = written;
+        } else {
+            tainted = true;
+        }
+    }
+
+    if (ok) {
+        writes++;
+    } else {
+        failures++;
+        LOG("Falha ao gravar a configuração \"%s\" na flash.\n", LOG_STR(key_names[key]));
+    }
+    return ok;
+}
+
+void config_store_print(void) {
+    for (int i = 0; i < CONFIG_KEY_COUNT; i++) {
+        printf("  %-10s %-7s %s\n", key_names[i], stored(i) ? "flash" : "fábrica",
+               i == CONFIG_PASSWORD ? "********" : config_values[i]);
+    }
+    if (active < 0) {
+        printf("Configuração: nenhum valor gravado (%u setores reservados)\n", CONFIG_STORE_SECTORS);
+    } else {
+        printf("Configuração: setor %d de %u, geração %u (~%u apagamentos por setor), %u de %u bytes usados\n",
+               active, CONFIG_STORE_SECTORS, (unsigned)generation,
+               (unsigned)((generation + CONFIG_STORE_SECTORS - 1) / CONFIG_STORE_SECTORS), (unsigned)used,
+               (unsigned)FLASH_SECTOR_SIZE);
+    }
+    printf("%u gravações, %u compactações, %u falhas, %u registros descartados na partida%s\n", (unsigned)writes,
+           (unsigned)compactions, (unsigned)failures, (unsigned)discarded,
+           tainted ? "; registro interrompido, a próxima gravação compacta" : "");
+}
+
+static int find_key(const char *name, size_t length) {
+    for (int i = 0; i < CONFIG_KEY_COUNT; i++) {
+        if (strlen(key_names[i]) == length && strncmp(name, key_names[i], length) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Comando "config [set <chave> <valor>|reset <chave>]" do console USB
+static void config_command(const char *args) {
+    bool set = strncmp(args, "set ", 4) == 0;
+    bool reset = strncmp(args, "reset ", 6) == 0;
+    if (!set && !reset) {
+        config_store_print();
+        return;
+    }
+
+    const char *name = args + (set ? 4 : 6);
+    size_t name_length = strcspn(name, " ");
+    const char *value = name[name_length] ? name + name_length + 1 : "";
+    int key = find_key(name, name_length);
+    if (key < 0) {
+        printf("Chave desconhecida: %.*s\n", (int)name_length, name);
+        return;
+    }
+    if (set && (*value == '\0' || strlen(value) > CONFIG_STORE_VALUE_MAX)) {
+        printf("Valor vazio ou com mais de %u caracteres\n", CONFIG_STORE_VALUE_MAX);
+        return;
+    }
+
+    if (!config_store_set(key, set ? value : NULL)) {
+        printf("Falha ao gravar %s\n", key_names[key]);
+        return;
+    }
+    printf("%s: %s%s\n", key_names[key], set ? "gravado" : "valor de fábrica",
+           key <= CONFIG_PASSWORD ? " (vale na próxima conexão Wi-Fi)" : "");
+}
+
+static const struct usb_console_command config_console_command = {
+    "config", "[set <chave> <valor>|reset <chave>] credenciais e mensagens na flash", config_command
+};
+
+void config_store_init(void) {
+    for (int i = 0; i < CONFIG_STORE_SECTORS; i++) {
+        if (header_valid(i)) {
+            const struct config_sector_header *header = (const void *)flash_at(sector_offset(i));
+            if (active < 0 || header->generation > generation) {
+                active = i;
+                generation = header->generation;
+            }
+        }
+    }
+    if (active >= 0) {
+        scan();
+    }
+    usb_console_register(&config_console_command);
+}
@@ -0,0 +1,84 @@
+#ifndef CONFIG_STORE_H
+#define CONFIG_STORE_H
+
+/**
+ * @file config_store.h
+ * @brief Configuração gravada na flash: credenciais e textos das mensagens.
+ *
+ * As credenciais de credentials.h e as mensagens de callmebot_whatsapp.h são
+ * os valores de fábrica; cada um pode ser trocado em campo pelo comando
+ * "config" do console USB, sem recompilar. Os valores gravados ficam em um
+ * anel de CONFIG_STORE_SECTORS setores no fim da flash, como um log:
+ *
+ * - cada gravação acrescenta um registro (chave, tamanho, CRC e valor) ao
+ *   setor ativo e só depois programa a palavra de confirmação; um registro
+ *   sem ela (queda de energia no meio) é ignorado na leitura;
+ * - com o setor cheio, os valores vigentes são copiados para o próximo setor
+ *   do anel, cujo cabeçalho (com a geração) é programado por último: até lá
+ *   o setor anterior continua valendo. O rodízio distribui os apagamentos
+ *   entre os setores.
+ *
+ * Os valores são lidos da flash pelo XIP, sem cópia: a partida monta uma
+ * tabela de ponteiros na SRAM, e config_get() é uma leitura dessa tabela,
+ * como era a do vetor de mensagens. A gravação passa por flash_guard_run(),
+ * no núcleo 0.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "callmebot_whatsapp.h"
+
+#define CONFIG_STORE_SECTORS   4    ///< Setores do anel, no fim da flash
+#define CONFIG_STORE_VALUE_MAX 127  ///< Maior valor, em caracteres
+
+/**
+ * @brief Chaves da configuração.
+ */
+enum config_key {
+    CONFIG_SSID,
+    CONFIG_PASSWORD,
+    CONFIG_PHONE,
+    CONFIG_API_KEY,
+    CONFIG_MESSAGE,  ///< Mensagem inicial; CONFIG_MESSAGE + n é a mensagem n
+    CONFIG_KEY_COUNT = CONFIG_MESSAGE + ALERT_MESSAGE_COUNT
+};
+
+/**
+ * @brief Valor vigente de cada chave: na flash (XIP) ou o de fábrica.
+ */
+extern const char *volatile config_values[CONFIG_KEY_COUNT];
+
+/**
+ * @brief Valor vigente de uma chave, sempre terminado em '\0'.
+ *
+ * Pode ser chamada nos dois núcleos.
+ */
+static inline const char *config_get(enum config_key key) {
+    return config_values[key];
+}
+
+/**
+ * @brief Lê o setor ativo, monta a tabela de valores e registra o comando "config".
+ *
+ * Chamada no núcleo 0, antes do Wi-Fi e dos alertas.
+ */
+void config_store_init(void);
+
+/**
+ * @brief Grava um valor; NULL volta ao valor de fábrica.
+ *
+ * Núcleo 0. Com o setor cheio, compacta para o próximo do anel (um
+ * apagamento, dezenas de milissegundos).
+ *
+ * @return false se o valor é longo demais ou a gravação não foi confirmada.
+ */
+bool config_store_set(enum config_key key, const char *value);
+
+/**
+ * @brief Exibe os valores (a senha mascarada), a geração e a ocupação do setor ativo.
+ */
+void config_store_print(void);
+
+#endif // CONFIG_STORE_H
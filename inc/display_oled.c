@@ -19,13 +19,103 @@
 #include "hardware/i2c.h"
 #include "pico/binary_info.h"
 #include "pico/stdlib.h"
+#include "clock_governor.h"
 #include "display_oled.h"
 #include "display_text.h"
+#include "event_loop.h"
 #include "ssd1306.h"
+#include "supervisor.h"
 
 // Variável para verificar se o display já foi inicializado
 static bool display_initialized = false;
 
+// Indica que uma tela está sendo enviada, para o letreiro não disputar o barramento
+static volatile bool display_busy = false;
+
+// Quadro de display_text() e display_clear(), fora da pilha: as duas só rodam no laço da interface
+static uint8_t frame[ssd1306_buffer_length];
+
+// Estado de energia do painel
+enum {
+    DISPLAY_POWER_ON,
+    DISPLAY_POWER_DIM,
+    DISPLAY_POWER_OFF
+};
+
+static volatile uint8_t display_power = DISPLAY_POWER_ON;
+static absolute_time_t last_activity;
+static struct event_timer idle_timer;
+
+// Estado do letreiro: faixa renderizada uma vez (texto + uma tela em branco) e janela enviada
+static uint8_t marquee_strip[DISPLAY_MARQUEE_MAX_CHARS * 8 + ssd1306_width];
+static uint8_t marquee_window[ssd1306_width + 1];
+static int marquee_length = 0;
+static int marquee_offset = 0;
+static uint8_t marquee_page = DISPLAY_MARQUEE_PAGE;
+static bool marquee_running = false;
+static uint marquee_loops = 0;
+static struct event_timer marquee_timer;
+
+// Envia a janela atual da faixa do letreiro para a sua página
+static void marquee_send_window(void) {
+    uint8_t commands[] = {
+        ssd1306_set_column_address, 0, ssd1306_width - 1,
+        ssd1306_set_page_address, marquee_page, marquee_page
+    };
+
+    marquee_window[0] = 0x40;
+    for (int i = 0; i < ssd1306_width; i++) {
+        marquee_window[i + 1] = marquee_strip[(marquee_offset + i) % marquee_length];
+    }
+
+    ssd1306_send_command_list(commands, count_of(commands));
+    ssd1306_send_image(marquee_window, sizeof(marquee_window));
+}
+
+// Avança o letreiro alguns pixels, atualizando apenas a página que ele ocupa
+static void marquee_handler(void *arg) {
+    if (display_busy) return; // Tenta novamente no próximo passo
+
+    int offset = (marquee_offset + DISPLAY_MARQUEE_STEP_PX) % marquee_length;
+    if (offset < marquee_offset) {
+        marquee_loops++;
+    }
+
+    // Depois de algumas voltas, ou com o painel escurecido, o texto fica parado no início
+    if (marquee_loops >= DISPLAY_MARQUEE_LOOPS || display_power != DISPLAY_POWER_ON) {
+        event_timer_stop(&marquee_timer);
+        marquee_running = false;
+        offset = 0;
+    }
+
+    marquee_offset = offset;
+    if (display_power != DISPLAY_POWER_OFF) {
+        marquee_send_window();
+    }
+}
+
+// Reduz o contraste e depois apaga o painel conforme o tempo sem atividade
+static void idle_handler(void *arg) {
+    supervisor_checkin(SUPERVISOR_DISPLAY); // Prova de vida: o laço da interface e o barramento I2C respondem
+    if (display_busy) return;
+
+    int64_t idle_ms = absolute_time_diff_us(last_activity, get_absolute_time()) / 1000;
+
+    if (display_power == DISPLAY_POWER_ON && idle_ms >= DISPLAY_DIM_MS) {
+        ssd1306_set_contrast_level(DISPLAY_DIM_CONTRAST);
+        display_power = DISPLAY_POWER_DIM;
+    }
+    else if (display_power == DISPLAY_POWER_DIM && idle_ms >= DISPLAY_OFF_MS) {
+        ssd1306_set_power(false);
+        display_power = DISPLAY_POWER_OFF;
+    }
+}
+
+// O divisor do I2C vem do clk_peri, que acompanha o clk_sys
+static void clock_changed(uint32_t sys_hz) {
+    i2c_set_baudrate(i2c1, ssd1306_i2c_clock * 1000);
+}
+
 void display_init(void) {
     if (display_initialized) return; // Evitar inicialização repetida
 
@@ -35,6 +125,7 @@ void display_init(void) {
     gpio_set_function(I2C_SCL, GPIO_FUNC_I2C);
     gpio_pull_up(I2C_SDA);
     gpio_pull_up(I2C_SCL);
+    clock_governor_on_change(clock_changed);
 
     // Inicialização do OLED SSD1306
     ssd1306_init();
@@ -44,14 +135,19 @@ void display_init(void) {
 
     display_initialized = true; // Marcar como inicializado
 
-    // Exibe mensagem inicial
-    display_text(init, 3);
-    sleep_ms(2000);
+    // Inicia a política de inatividade do painel
+    last_activity = get_absolute_time();
+    event_timer_start(&idle_timer, DISPLAY_IDLE_CHECK_MS, DISPLAY_IDLE_CHECK_MS, idle_handler, NULL);
+
+    // Exibe mensagem inicial, mantida até a próxima tela de status
+    display_show(&init);
 }
 
 void display_clear(void) {
     if (!display_initialized) return; // Verificar se o display foi inicializado
 
+    display_busy = true;
+
     // Definir a área de renderização
     struct render_area frame_area = {
         .start_column = 0,
@@ -63,9 +159,10 @@ void display_clear(void) {
     calculate_render_area_buffer_length(&frame_area);
 
     // Zerar o display inteiro
-    uint8_t ssd[ssd1306_buffer_length];
-    memset(ssd, 0, ssd1306_buffer_length);
-    render_on_display(ssd, &frame_area);
+    memset(frame, 0, sizeof(frame));
+    render_on_display(frame, &frame_area);
+
+    display_busy = false;
 }
 
 void display_text(const char *text[], int y) {
@@ -82,15 +179,91 @@ void display_text(const char *text[], int y) {
     calculate_render_area_buffer_length(&frame_area);
 
     // Zerar o display inteiro
-    uint8_t ssd[ssd1306_buffer_length];
-    memset(ssd, 0, ssd1306_buffer_length);
+    memset(frame, 0, sizeof(frame));
 
     // Renderizar o texto linha por linha
     for (int i = 0; text[i] != NULL; i++) { // Itera até encontrar NULL
-        ssd1306_draw_string(ssd, 0, y * 8, text[i]);
+        ssd1306_draw_string(frame, 0, y * 8, text[i]);
         y += 1; // Avançar para a próxima linha
     }
 
     // Atualizar o display com o novo conteúdo
-    render_on_display(ssd, &frame_area);
+    display_busy = true;
+    render_on_display(frame, &frame_area);
+    display_busy = false;
+}
+
+void display_show(const struct display_screen *screen) {
+    if (!display_initialized) return; // Verificar se o display foi inicializado
+
+    // Restringe a escrita à faixa de páginas ocupada pela tela
+    uint8_t commands[] = {
+        ssd1306_set_column_address, 0, ssd1306_width - 1,
+        ssd1306_set_page_address, screen->start_page, screen->end_page
+    };
+
+    display_busy = true;
+    display_wake(); // Uma nova tela de status é sempre um evento de alerta ou de estado
+    ssd1306_send_command_list(commands, count_of(commands));
+    ssd1306_send_image(screen->image, screen->image_length);
+    display_busy = false;
+}
+
+bool display_is_busy(void) {
+    return display_busy;
+}
+
+bool display_is_awake(void) {
+    return display_power != DISPLAY_POWER_OFF;
+}
+
+void display_wake(void) {
+    if (!display_initialized) return; // Verificar se o display foi inicializado
+
+    last_activity = get_absolute_time();
+    if (display_power == DISPLAY_POWER_ON) return;
+
+    // Dois comandos curtos: o painel volta no próximo quadro com o conteúdo que já estava na GDDRAM
+    if (display_power == DISPLAY_POWER_OFF) {
+        ssd1306_set_power(true);
+    }
+    ssd1306_set_contrast_level(DISPLAY_CONTRAST);
+    display_power = DISPLAY_POWER_ON;
+}
+
+void display_marquee_start(const char *text, uint8_t page) {
+    if (!display_initialized) return; // Verificar se o display foi inicializado
+
+    display_marquee_stop();
+
+    // Renderiza o texto uma única vez; a tela em branco no fim separa as repetições
+    memset(marquee_strip, 0, sizeof(marquee_strip));
+    int width = ssd1306_draw_string_strip(marquee_strip, DISPLAY_MARQUEE_MAX_CHARS * 8, text);
+    marquee_length = width + ssd1306_width;
+    marquee_offset = 0;
+    marquee_loops = 0;
+    marquee_page = page;
+
+    marquee_send_window();
+
+    // Só rola se o texto não couber na largura do display
+    if (width > ssd1306_width) {
+        event_timer_start(&marquee_timer, DISPLAY_MARQUEE_STEP_MS, DISPLAY_MARQUEE_STEP_MS, marquee_handler, NULL);
+        marquee_running = true;
+    }
+}
+
+void display_marquee_stop(void) {
+    if (marquee_running) {
+        event_timer_stop(&marquee_timer);
+        marquee_running = false;
+    }
+
+    if (marquee_length > 0) {
+        // Apaga a página do letreiro
+        memset(marquee_strip, 0, sizeof(marquee_strip));
+        marquee_offset = 0;
+        marquee_send_window();
+        marquee_length = 0;
+    }
 }
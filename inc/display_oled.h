@@ -15,10 +15,40 @@
  * @date 2025
  */
 
+#include <stdbool.h>
+#include <stdint.h>
+
 // Definição dos pinos I2C utilizados para comunicação com o display OLED
 #define I2C_SDA 14  ///< Pino GPIO para SDA (dados do I2C)
 #define I2C_SCL 15  ///< Pino GPIO para SCL (clock do I2C)
 
+// Parâmetros do letreiro rolante para textos maiores que o display
+#define DISPLAY_MARQUEE_PAGE      7   ///< Página (linha de 8 pixels) usada pelo letreiro
+#define DISPLAY_MARQUEE_MAX_CHARS 96  ///< Tamanho máximo do texto do letreiro
+#define DISPLAY_MARQUEE_STEP_PX   2   ///< Deslocamento em colunas a cada passo
+#define DISPLAY_MARQUEE_STEP_MS   50  ///< Intervalo entre passos em milissegundos
+#define DISPLAY_MARQUEE_LOOPS     3   ///< Voltas completas antes de o texto parar
+
+// Política de economia de energia e proteção contra burn-in do painel
+#define DISPLAY_CONTRAST      0xFF    ///< Contraste normal (mesmo valor de ssd1306_init)
+#define DISPLAY_DIM_CONTRAST  0x08    ///< Contraste reduzido após DISPLAY_DIM_MS sem atividade
+#define DISPLAY_DIM_MS        60000   ///< Tempo sem atividade até reduzir o contraste
+#define DISPLAY_OFF_MS        300000  ///< Tempo sem atividade até desligar o painel
+#define DISPLAY_IDLE_CHECK_MS 1000    ///< Intervalo de verificação da inatividade
+
+/**
+ * @brief Tela de status pré-rasterizada durante a compilação.
+ *
+ * A imagem fica na flash em ordem de páginas, já precedida pelo byte de
+ * controle 0x40 do SSD1306, e é enviada ao display sem cópia para a RAM.
+ */
+struct display_screen {
+    uint8_t start_page;     ///< Primeira página ocupada pela imagem
+    uint8_t end_page;       ///< Última página ocupada pela imagem
+    const uint8_t *image;   ///< Byte de controle seguido dos dados das páginas
+    uint16_t image_length;  ///< Tamanho total da imagem em bytes
+};
+
 /**
  * @brief Inicializa o display OLED SSD1306.
  *
@@ -40,4 +70,61 @@ void display_clear(void);
  */
 void display_text(const char *text[], int y);
 
+/**
+ * @brief Exibe uma tela de status pré-rasterizada.
+ *
+ * Apenas a faixa de páginas da tela é atualizada, enviando a imagem
+ * diretamente da flash.
+ *
+ * @param screen Tela a ser exibida (declaradas em display_text.h).
+ */
+void display_show(const struct display_screen *screen);
+
+/**
+ * @brief Informa se uma tela está sendo enviada ao display neste momento.
+ *
+ * Usada pelos elementos atualizados periodicamente para não disputar o
+ * barramento I2C com as telas de status.
+ *
+ * @return true se há uma transferência de tela em andamento.
+ */
+bool display_is_busy(void);
+
+/**
+ * @brief Informa se o painel está aceso (com contraste normal ou reduzido).
+ *
+ * Com o painel desligado os elementos periódicos deixam de enviar dados,
+ * pois o conteúdo não está visível.
+ *
+ * @return true se o painel está ligado.
+ */
+bool display_is_awake(void);
+
+/**
+ * @brief Registra atividade e acende o painel imediatamente, se necessário.
+ *
+ * Deve ser chamada em qualquer evento de entrada ou alerta. O conteúdo
+ * mantido na memória do SSD1306 volta a ser exibido sem ser redesenhado.
+ */
+void display_wake(void);
+
+/**
+ * @brief Exibe um texto longo rolando horizontalmente em uma única página.
+ *
+ * O texto é desenhado uma única vez em uma faixa fora da tela e, a cada passo,
+ * apenas a janela de 128 colunas da página é enviada ao display. Textos que
+ * cabem na largura do display são exibidos parados. A rolagem termina depois
+ * de DISPLAY_MARQUEE_LOOPS voltas, ou quando o painel escurece por
+ * inatividade, com o início do texto parado na página.
+ *
+ * @param text Texto a ser exibido (até DISPLAY_MARQUEE_MAX_CHARS caracteres).
+ * @param page Página do display usada pelo letreiro.
+ */
+void display_marquee_start(const char *text, uint8_t page);
+
+/**
+ * @brief Interrompe o letreiro e apaga a página que ele ocupava.
+ */
+void display_marquee_stop(void);
+
 #endif // DISPLAY_OLED_H
@@ -0,0 +1,314 @@
+/**
+ * @file event_loop.c
+ * @brief Implementação do laço de eventos cooperativo.
+ *
+ * Os temporizadores ficam em uma lista encadeada ordenada pelo prazo, então o
+ * próximo prazo é sempre o primeiro elemento e o repouso usa exatamente esse
+ * instante; só o núcleo dono altera a lista. As chamadas adiadas ficam em uma
+ * fila circular protegida por uma trava de hardware, pois podem ser publicadas
+ * por interrupções ou pelo outro núcleo.
+ *
+ * Sem sistema operacional o laço dorme em WFE e é acordado por SEV. Com
+ * EVENT_LOOP_FREERTOS cada laço pertence a uma tarefa fixada em um núcleo, que
+ * dorme em uma notificação da tarefa com o tempo até o próximo prazo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "pico/sync.h"
+#include "event_loop.h"
+#include "hot_path.h"
+
+#if EVENT_LOOP_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
+// Chamada adiada
+struct event_post {
+    event_handler_t handler;
+    void *arg;
+};
+
+// Função de verificação registrada
+struct event_poll_entry {
+    event_poll_t poll;
+    void *arg;
+};
+
+// Estado do laço de um núcleo
+struct event_loop {
+    struct event_timer *timers;  // Ordenados pelo prazo
+    struct event_post posts[EVENT_LOOP_MAX_POSTS];
+    volatile uint8_t post_head;
+    volatile uint8_t post_tail;
+    struct event_poll_entry polls[EVENT_LOOP_MAX_POLLS];
+    uint8_t poll_count;
+    spin_lock_t *lock;           // Protege a fila de chamadas adiadas
+#if EVENT_LOOP_FREERTOS
+    TaskHandle_t task;           // Tarefa que executa o laço
+#endif
+    struct event_loop_stats stats;
+};
+
+static struct event_loop loops[2];
+
+static inline struct event_loop *current_loop(void) {
+    return &loops[get_core_num()];
+}
+
+// Insere um temporizador mantendo a lista ordenada; chamada com as interrupções desabilitadas
+static void HOT_PATH(insert_timer)(struct event_loop *loop, struct event_timer *timer) {
+    struct event_timer **link = &loop->timers;
+
+    while (*link && absolute_time_diff_us((*link)->deadline, timer->deadline) >= 0) {
+        link = &(*link)->next;
+    }
+    timer->next = *link;
+    *link = timer;
+    timer->active = true;
+}
+
+// Remove um temporizador da lista; chamada com as interrupções desabilitadas
+static void HOT_PATH(remove_timer)(struct event_loop *loop, struct event_timer *timer) {
+    for (struct event_timer **link = &loop->timers; *link; link = &(*link)->next) {
+        if (*link == timer) {
+            *link = timer->next;
+            break;
+        }
+    }
+    timer->next = NULL;
+    timer->active = false;
+}
+
+void event_loop_init(void) {
+    struct event_loop *loop = current_loop();
+    loop->timers = NULL;
+    loop->post_head = loop->post_tail = 0;
+    loop->poll_count = 0;
+    if (loop->lock == NULL) {
+        loop->lock = spin_lock_init(spin_lock_claim_unused(true));
+    }
+#if EVENT_LOOP_FREERTOS
+    loop->task = xTaskGetCurrentTaskHandle();
+#endif
+}
+
+void event_timer_start(struct event_timer *timer, uint32_t delay_ms, uint32_t period_ms,
+                       event_handler_t handler, void *arg) {
+    struct event_loop *loop = current_loop();
+    uint32_t status = save_and_disable_interrupts();
+
+    if (timer->active) {
+        remove_timer(loop, timer);
+    }
+    timer->deadline = make_timeout_time_ms(delay_ms);
+    timer->period_ms = period_ms;
+    timer->handler = handler;
+    timer->arg = arg;
+    insert_timer(loop, timer);
+
+    restore_interrupts(status);
+}
+
+void event_timer_stop(struct event_timer *timer) {
+    uint32_t status = save_and_disable_interrupts();
+    if (timer->active) {
+        remove_timer(current_loop(), timer);
+    }
+    restore_interrupts(status);
+}
+
+bool event_timer_is_active(const struct event_timer *timer) {
+    return timer->active;
+}
+
+bool HOT_PATH(event_loop_post_to)(uint core, event_handler_t handler, void *arg) {
+    struct event_loop *loop = &loops[core];
+    uint32_t status = spin_lock_blocking(loop->lock);
+
+    uint8_t next = (loop->post_head + 1) % EVENT_LOOP_MAX_POSTS;
+    bool posted = next != loop->post_tail;
+    if (posted) {
+        loop->posts[loop->post_head].handler = handler;
+        loop->posts[loop->post_head].arg = arg;
+        loop->post_head = next;
+    }
+
+    spin_unlock(loop->lock, status);
+    event_loop_wake(core); // Garante que o próximo repouso do laço retorne imediatamente
+    return posted;
+}
+
+bool HOT_PATH(event_loop_post)(event_handler_t handler, void *arg) {
+    return event_loop_post_to(get_core_num(), handler, arg);
+}
+
+void HOT_PATH(event_loop_wake)(uint core) {
+#if EVENT_LOOP_FREERTOS
+    TaskHandle_t task = loops[core].task;
+    if (task == NULL) {
+        return;
+    }
+    if (portCHECK_IF_IN_ISR()) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &woken);
+        portYIELD_FROM_ISR(woken);
+    }
+    else {
+        xTaskNotifyGive(task);
+    }
+#else
+    __sev();
+#endif
+}
+
+void event_loop_add_poll(event_poll_t poll, void *arg) {
+    struct event_loop *loop = current_loop();
+    hard_assert(loop->poll_count < EVENT_LOOP_MAX_POLLS);
+    loop->polls[loop->poll_count].poll = poll;
+    loop->polls[loop->poll_count].arg = arg;
+    loop->poll_count++;
+}
+
+// Retira a próxima chamada adiada
+static bool HOT_PATH(pop_post)(struct event_loop *loop, struct event_post *post) {
+    uint32_t status = spin_lock_blocking(loop->lock);
+
+    bool found = loop->post_tail != loop->post_head;
+    if (found) {
+        *post = loop->posts[loop->post_tail];
+        loop->post_tail = (loop->post_tail + 1) % EVENT_LOOP_MAX_POSTS;
+    }
+
+    spin_unlock(loop->lock, status);
+    return found;
+}
+
+// Dorme até o prazo indicado ou até ser acordado
+static void wait_until(const struct event_timer *next) {
+#if EVENT_LOOP_FREERTOS
+    TickType_t ticks = portMAX_DELAY;
+    if (next) {
+        int64_t wait_us = absolute_time_diff_us(get_absolute_time(), next->deadline);
+        ticks = wait_us <= 0 ? 0 : pdMS_TO_TICKS((uint32_t)((wait_us + 999) / 1000));
+        if (wait_us > 0 && ticks == 0) {
+            ticks = 1;
+        }
+    }
+    ulTaskNotifyTake(pdTRUE, ticks);
+#else
+    if (next) {
+        best_effort_wfe_or_timeout(next->deadline);
+    }
+    else {
+        __wfe();
+    }
+#endif
+}
+
+// Executa os temporizadores vencidos; retorna true se algum disparou
+static bool run_timers(struct event_loop *loop) {
+    bool worked = false;
+
+    while (true) {
+        uint32_t status = save_and_disable_interrupts();
+
+        struct event_timer *timer = loop->timers;
+        absolute_time_t now = get_absolute_time();
+        if (timer == NULL || absolute_time_diff_us(timer->deadline, now) < 0) {
+            restore_interrupts(status);
+            break;
+        }
+
+        uint32_t late_us = (uint32_t)absolute_time_diff_us(timer->deadline, now);
+        remove_timer(loop, timer);
+        if (timer->period_ms) {
+            // Reagenda a partir do prazo anterior; se ficou muito para trás, a partir de agora
+            timer->deadline = delayed_by_ms(timer->deadline, timer->period_ms);
+            if (absolute_time_diff_us(timer->deadline, now) > 0) {
+                timer->deadline = delayed_by_ms(now, timer->period_ms);
+            }
+            insert_timer(loop, timer);
+        }
+
+        restore_interrupts(status);
+
+        loop->stats.timer_runs++;
+        loop->stats.latency_total_us += late_us;
+        if (late_us > loop->stats.latency_max_us) {
+            loop->stats.latency_max_us = late_us;
+        }
+
+        timer->handler(timer->arg);
+        loop->stats.dispatched++;
+        worked = true;
+    }
+
+    return worked;
+}
+
+void event_loop_run_once(void) {
+    struct event_loop *loop = current_loop();
+    bool worked = false;
+
+    // Só as chamadas já publicadas: as que elas publicam ficam para a próxima
+    // passagem, depois das funções de verificação e dos temporizadores
+    struct event_post post;
+    uint32_t pending = (loop->post_head + EVENT_LOOP_MAX_POSTS - loop->post_tail) % EVENT_LOOP_MAX_POSTS;
+    while (pending-- && pop_post(loop, &post)) {
+        post.handler(post.arg);
+        loop->stats.dispatched++;
+        worked = true;
+    }
+
+    for (int i = 0; i < loop->poll_count; i++) {
+        if (loop->polls[i].poll(loop->polls[i].arg)) {
+            loop->stats.dispatched++;
+            worked = true;
+        }
+    }
+
+    if (run_timers(loop)) {
+        worked = true;
+    }
+
+    if (!worked) {
+        loop->stats.idle_wakeups++;
+    }
+
+    // Há trabalho publicado durante a execução: não dorme
+    if (loop->post_tail != loop->post_head) {
+        return;
+    }
+
+    // Dorme até o próximo prazo ou até qualquer interrupção, SEV ou notificação
+    wait_until(loop->timers);
+    loop->stats.wakeups++;
+}
+
+void event_loop_run(void) {
+    while (true) {
+        event_loop_run_once();
+    }
+}
+
+const struct event_loop_stats *event_loop_get_stats(uint core) {
+    return &loops[core].stats;
+}
+
+void event_loop_print_stats(uint core) {
+    const struct event_loop_stats *stats = &loops[core].stats;
+    uint32_t uptime_s = to_ms_since_boot(get_absolute_time()) / 1000;
+
+    printf("Laço do núcleo %u: %u tratadores, %u despertares (%u ociosos, %u.%02u/s), "
+           "atraso dos temporizadores médio %u us, máximo %u us\n",
+           core, (unsigned)stats->dispatched, (unsigned)stats->wakeups, (unsigned)stats->idle_wakeups,
+           (unsigned)(uptime_s ? stats->idle_wakeups / uptime_s : 0),
+           (unsigned)(uptime_s ? stats->idle_wakeups * 100 / uptime_s % 100 : 0),
+           (unsigned)(stats->timer_runs ? stats->latency_total_us / stats->timer_runs : 0),
+           (unsigned)stats->latency_max_us);
+}
@@ -0,0 +1,154 @@
+#ifndef EVENT_LOOP_H
+#define EVENT_LOOP_H
+
+/**
+ * @file event_loop.h
+ * @brief Laço de eventos cooperativo com temporizadores e repouso sem tique.
+ *
+ * Cada núcleo executa o seu próprio laço. Os módulos registram tratadores em
+ * vez de esperar com sleep_ms(): temporizadores (únicos ou periódicos),
+ * chamadas adiadas publicadas por interrupções e funções de verificação
+ * executadas a cada despertar. Todos os tratadores rodam até o fim, em modo
+ * thread, um de cada vez. Sem trabalho pendente, o núcleo dorme em WFE até o
+ * próximo prazo ou até qualquer interrupção ou SEV.
+ *
+ * Na versão FreeRTOS (EVENT_LOOP_FREERTOS) o laço de cada núcleo pertence a
+ * uma tarefa fixada nele, que dorme em uma notificação em vez de WFE.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define EVENT_LOOP_MAX_POSTS 16  ///< Chamadas adiadas aguardando execução, por núcleo
+#define EVENT_LOOP_MAX_POLLS 4   ///< Funções de verificação registradas, por núcleo
+
+/**
+ * @brief Tratador de temporizador ou de chamada adiada.
+ */
+typedef void (*event_handler_t)(void *arg);
+
+/**
+ * @brief Função de verificação executada a cada despertar do laço.
+ *
+ * @return true se realizou algum trabalho (usado nas estatísticas de ociosidade).
+ */
+typedef bool (*event_poll_t)(void *arg);
+
+/**
+ * @brief Temporizador do laço de eventos.
+ *
+ * A estrutura pertence a quem o inicia e deve permanecer válida enquanto
+ * o temporizador estiver ativo.
+ */
+struct event_timer {
+    absolute_time_t deadline;   ///< Próximo disparo
+    uint32_t period_ms;         ///< Período (0 = disparo único)
+    event_handler_t handler;    ///< Tratador chamado no disparo
+    void *arg;                  ///< Argumento do tratador
+    bool active;                ///< Se está na lista de temporizadores
+    struct event_timer *next;   ///< Próximo na lista ordenada por prazo
+};
+
+/**
+ * @brief Estatísticas do laço de eventos de um núcleo.
+ */
+struct event_loop_stats {
+    uint32_t dispatched;        ///< Tratadores executados
+    uint32_t wakeups;           ///< Retornos do WFE
+    uint32_t idle_wakeups;      ///< Despertares sem nenhum trabalho a fazer
+    uint32_t latency_max_us;    ///< Maior atraso entre o prazo de um temporizador e a sua execução
+    uint64_t latency_total_us;  ///< Soma dos atrasos, para a média
+    uint32_t timer_runs;        ///< Disparos de temporizadores
+};
+
+/**
+ * @brief Prepara o laço de eventos do núcleo que a chama.
+ */
+void event_loop_init(void);
+
+/**
+ * @brief Inicia (ou reinicia) um temporizador no laço do núcleo atual.
+ *
+ * Os temporizadores periódicos são reagendados a partir do prazo anterior,
+ * sem acumular atraso.
+ *
+ * @param timer Temporizador a iniciar.
+ * @param delay_ms Tempo até o primeiro disparo.
+ * @param period_ms Período dos disparos seguintes (0 = disparo único).
+ * @param handler Tratador chamado a cada disparo.
+ * @param arg Argumento do tratador.
+ */
+void event_timer_start(struct event_timer *timer, uint32_t delay_ms, uint32_t period_ms,
+                       event_handler_t handler, void *arg);
+
+/**
+ * @brief Cancela um temporizador. Não faz nada se ele não estiver ativo.
+ */
+void event_timer_stop(struct event_timer *timer);
+
+/**
+ * @brief Informa se um temporizador está ativo.
+ */
+bool event_timer_is_active(const struct event_timer *timer);
+
+/**
+ * @brief Agenda uma chamada para o laço do núcleo atual.
+ *
+ * Pode ser chamada de interrupções do mesmo núcleo; é a forma de levar
+ * trabalho de um callback de interrupção para o modo thread.
+ *
+ * @return true se a chamada foi agendada, false se a fila estava cheia.
+ */
+bool event_loop_post(event_handler_t handler, void *arg);
+
+/**
+ * @brief Agenda uma chamada para o laço de um núcleo específico.
+ *
+ * Pode ser chamada de qualquer núcleo, interrupção ou tarefa; usada por
+ * callbacks que não executam no núcleo dono do laço (como os do lwIP na
+ * versão FreeRTOS).
+ *
+ * @param core Núcleo dono do laço.
+ * @return true se a chamada foi agendada, false se a fila estava cheia.
+ */
+bool event_loop_post_to(uint core, event_handler_t handler, void *arg);
+
+/**
+ * @brief Acorda o laço de um núcleo para que execute as suas funções de verificação.
+ *
+ * Chamada após publicar em uma fila consumida por esse laço.
+ */
+void event_loop_wake(uint core);
+
+/**
+ * @brief Registra uma função executada a cada despertar do laço do núcleo atual.
+ *
+ * Usada para consumir filas alimentadas pelo outro núcleo, que acorda este com SEV.
+ */
+void event_loop_add_poll(event_poll_t poll, void *arg);
+
+/**
+ * @brief Executa os tratadores prontos e dorme até o próximo evento.
+ */
+void event_loop_run_once(void);
+
+/**
+ * @brief Executa o laço de eventos do núcleo atual indefinidamente.
+ */
+void event_loop_run(void);
+
+/**
+ * @brief Estatísticas do laço de eventos de um núcleo.
+ *
+ * @param core Número do núcleo (0 ou 1).
+ */
+const struct event_loop_stats *event_loop_get_stats(uint core);
+
+/**
+ * @brief Exibe as estatísticas do laço de um núcleo no monitor serial.
+ */
+void event_loop_print_stats(uint core);
+
+#endif // EVENT_LOOP_H
@@ -0,0 +1,148 @@
+/**
+ * @file flash_guard.c
+ * @brief Implementação da gravação protegida da flash.
+ *
+ * O núcleo 0 marca a operação como ativa e acorda o núcleo 1: pela FIFO
+ * entre os núcleos (interrupção SIO_IRQ_PROC1) ou, no FreeRTOS, pela
+ * notificação de uma tarefa de prioridade máxima fixada no núcleo 1. O
+ * núcleo 1 desabilita as interrupções, confirma por ready e fica no laço da
+ * SRAM até a operação terminar. Tudo o que o laço executa é inline ou
+ * __not_in_flash_func.
+ *
+ * Na simulação não há flash: a operação é executada diretamente.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "button_handler.h"
+#include "event_loop.h"
+#include "flash_guard.h"
+
+#if EVENT_LOOP_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+#elif PICO_ON_DEVICE
+#include "pico/multicore.h"
+#include "hardware/irq.h"
+#endif
+
+#define FLASH_GUARD_ENTER 0x464C4531u  // Palavra da FIFO que inicia a proteção
+
+static volatile bool active = false;   // Operação em andamento (escrito pelo núcleo 0)
+static volatile bool ready = false;    // Núcleo 1 no laço da SRAM (escrito pelo núcleo 1)
+static bool armed = false;
+
+static uint32_t operations = 0;
+static uint32_t longest_us = 0;
+static volatile uint32_t samples = 0;   // Leituras dos botões durante as operações
+static volatile uint32_t presses = 0;   // Acionamentos aceitos durante as operações
+
+#if EVENT_LOOP_FREERTOS
+static TaskHandle_t guard_task;
+#endif
+
+#if EVENT_LOOP_FREERTOS || PICO_ON_DEVICE
+// Núcleo 1, interrupções desabilitadas: lê os botões até o fim da operação
+static uint __not_in_flash_func(guard_loop)(void) {
+    uint32_t next = time_us_32();
+    uint accepted = 0;
+
+    ready = true;
+    while (active) {
+        if ((int32_t)(time_us_32() - next) >= 0) {
+            accepted += button_handler_sample();
+            samples++;
+            next += FLASH_GUARD_POLL_US;
+        }
+    }
+    ready = false;
+    presses += accepted;
+    return accepted;
+}
+#endif
+
+#if EVENT_LOOP_FREERTOS
+// A tarefa de entrada publica os acionamentos na sua próxima leitura
+static void flash_guard_task(void *params) {
+    while (true) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        uint32_t status = save_and_disable_interrupts();
+        guard_loop();
+        restore_interrupts(status);
+    }
+}
+#elif PICO_ON_DEVICE
+static void __not_in_flash_func(flash_guard_irq)(void) {
+    bool enter = false;
+    while (multicore_fifo_rvalid()) {
+        enter |= sio_hw->fifo_rd == FLASH_GUARD_ENTER;
+    }
+    multicore_fifo_clear_irq();
+    if (!enter) {
+        return;
+    }
+
+    uint32_t status = save_and_disable_interrupts();
+    uint accepted = guard_loop();
+    restore_interrupts(status);
+
+    // Com a flash de volta, a publicação não precisa esperar o próximo período
+    if (accepted) {
+        event_loop_post(button_check_handler, NULL);
+    }
+}
+#endif
+
+void flash_guard_init(void) {
+#if EVENT_LOOP_FREERTOS
+    xTaskCreateAffinitySet(flash_guard_task, "flash", FLASH_GUARD_TASK_STACK_WORDS, NULL,
+                           configMAX_PRIORITIES - 1, 1 << 1, &guard_task);
+#elif PICO_ON_DEVICE
+    multicore_fifo_drain();
+    multicore_fifo_clear_irq();
+    irq_set_exclusive_handler(SIO_IRQ_PROC1, flash_guard_irq);
+    irq_set_enabled(SIO_IRQ_PROC1, true);
+#endif
+    armed = true;
+}
+
+void flash_guard_run(flash_guard_op_t op, void *arg) {
+    uint32_t start = time_us_32();
+
+#if PICO_ON_DEVICE
+    if (armed) {
+        active = true;
+#if EVENT_LOOP_FREERTOS
+        xTaskNotifyGive(guard_task);
+#else
+        multicore_fifo_push_blocking(FLASH_GUARD_ENTER);
+#endif
+        while (!ready) {
+            tight_loop_contents();
+        }
+    }
+#endif
+
+    uint32_t status = save_and_disable_interrupts();
+    op(arg);
+    restore_interrupts(status);
+
+    active = false;
+    while (ready) {
+        tight_loop_contents();
+    }
+
+    uint32_t elapsed = time_us_32() - start;
+    operations++;
+    if (elapsed > longest_us) {
+        longest_us = elapsed;
+    }
+}
+
+void flash_guard_print(void) {
+    printf("Gravações da flash: %u, maior duração %u us, %u leituras e %u acionamentos dos botões durante elas\n",
+           (unsigned)operations, (unsigned)longest_us, (unsigned)samples, (unsigned)presses);
+}
@@ -0,0 +1,54 @@
+#ifndef FLASH_GUARD_H
+#define FLASH_GUARD_H
+
+/**
+ * @file flash_guard.h
+ * @brief Gravação da flash sem perder a leitura dos botões.
+ *
+ * Enquanto a flash é apagada ou programada o XIP fica desligado, e qualquer
+ * busca de instrução na flash trava o núcleo até o fim da operação (dezenas
+ * de milissegundos por setor apagado). flash_guard_run() é chamada pelo
+ * núcleo 0: ela avisa o núcleo 1 pela FIFO entre os núcleos e só executa a
+ * operação depois que ele entra no tratador da FIFO, que roda da SRAM com as
+ * interrupções desabilitadas e continua lendo os botões a cada
+ * FLASH_GUARD_POLL_US com o debounce de button_handler_sample(). Os
+ * acionamentos lidos são publicados pela leitura seguinte dos botões, com o
+ * instante em que ocorreram; o atraso de detecção fica limitado ao intervalo
+ * de leitura, mesmo durante o apagamento.
+ *
+ * Na variante FreeRTOS a FIFO pertence ao port SMP; o mesmo laço roda em uma
+ * tarefa de prioridade máxima fixada no núcleo 1, acordada por notificação.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define FLASH_GUARD_POLL_US 1000          ///< Intervalo de leitura dos botões durante uma operação
+#define FLASH_GUARD_TASK_STACK_WORDS 256  ///< Pilha da tarefa do núcleo 1 (FreeRTOS), em palavras
+
+/**
+ * @brief Operação sobre a flash; deve estar na SRAM ou na ROM (como flash_range_erase).
+ */
+typedef void (*flash_guard_op_t)(void *arg);
+
+/**
+ * @brief Instala o tratador da FIFO (no FreeRTOS, cria a tarefa); chamada no núcleo 1.
+ */
+void flash_guard_init(void);
+
+/**
+ * @brief Executa uma operação sobre a flash com o núcleo 1 fora dela.
+ *
+ * Chamada no núcleo 0, fora de interrupções. As interrupções do núcleo 0
+ * ficam desabilitadas durante a operação.
+ */
+void flash_guard_run(flash_guard_op_t op, void *arg);
+
+/**
+ * @brief Exibe as operações protegidas: quantidade, maior duração e acionamentos lidos.
+ */
+void flash_guard_print(void);
+
+#endif // FLASH_GUARD_H
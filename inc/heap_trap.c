@@ -0,0 +1,52 @@
+/**
+ * @file heap_trap.c
+ * @brief Funções que substituem o alocador no modo sem heap.
+ *
+ * Só são ligadas com -Wl,--wrap (ver CMakeLists.txt); sem NO_HEAP o arquivo
+ * fica vazio. O panic() informa a função e o tamanho pedido; o ponto de
+ * chamada aparece no backtrace do depurador a partir do panic.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stddef.h>
+
+#include "pico/stdlib.h"
+#include "heap_trap.h"
+
+#if NO_HEAP
+static void __attribute__((noreturn)) heap_trap(const char *function, size_t size) {
+    panic("heap desabilitado (NO_HEAP): %s de %u bytes", function, (unsigned)size);
+}
+
+#if PICO_ON_DEVICE
+struct _reent;
+
+// malloc, calloc e realloc da newlib (e o invólucro do SDK) chegam a estas funções
+void *__wrap__malloc_r(struct _reent *reent, size_t size) {
+    heap_trap("malloc", size);
+}
+
+void *__wrap__calloc_r(struct _reent *reent, size_t count, size_t size) {
+    heap_trap("calloc", count * size);
+}
+
+void *__wrap__realloc_r(struct _reent *reent, void *ptr, size_t size) {
+    heap_trap("realloc", size);
+}
+#else
+// Na simulação o desvio vale só para o código ligado ao executável, não para a libc
+void *__wrap_malloc(size_t size) {
+    heap_trap("malloc", size);
+}
+
+void *__wrap_calloc(size_t count, size_t size) {
+    heap_trap("calloc", count * size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size) {
+    heap_trap("realloc", size);
+}
+#endif
+#endif
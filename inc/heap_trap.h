@@ -0,0 +1,24 @@
+#ifndef HEAP_TRAP_H
+#define HEAP_TRAP_H
+
+/**
+ * @file heap_trap.h
+ * @brief Modo sem heap: qualquer alocação dinâmica interrompe o firmware.
+ *
+ * Com a opção NO_HEAP do CMake, o ligador desvia malloc, calloc e realloc
+ * (no RP2040, as versões reentrantes da newlib, abaixo do invólucro do SDK)
+ * para funções que chamam panic(). Toda a memória do firmware passa a ser
+ * estática, com tamanho conhecido na ligação e verificado por
+ * tools/mem_report.py; o lwIP troca o seu heap por pools de blocos fixos
+ * (inc/lwippools.h). Sem alocações, não há fragmentação ao longo dos anos de
+ * operação, e uma alocação esquecida é encontrada no primeiro uso.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#ifndef NO_HEAP
+#define NO_HEAP 0
+#endif
+
+#endif // HEAP_TRAP_H
@@ -0,0 +1,34 @@
+#ifndef HOT_PATH_H
+#define HOT_PATH_H
+
+/**
+ * @file hot_path.h
+ * @brief Caminhos críticos executados da SRAM.
+ *
+ * Todo o código roda da flash QSPI pelo cache XIP, e uma falha no cache custa
+ * a leitura de uma linha pela QSPI. No perfil RAM_HOT_PATHS as funções
+ * marcadas com HOT_PATH() vão para a seção .time_critical, copiada para a
+ * SRAM na partida: leitura e debounce dos botões, filas entre os núcleos e
+ * chamadas adiadas do laço de eventos. Fora do perfil (e na simulação) a
+ * marcação não tem efeito.
+ *
+ * O que precisa rodar com a flash desligada (inc/flash_guard.h) usa
+ * __not_in_flash_func diretamente, em qualquer perfil.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#ifndef RAM_HOT_PATHS
+#define RAM_HOT_PATHS 0
+#endif
+
+#if RAM_HOT_PATHS
+#define HOT_PATH(name) __time_critical_func(name)
+#else
+#define HOT_PATH(name) name
+#endif
+
+#endif // HOT_PATH_H
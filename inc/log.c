@@ -0,0 +1,150 @@
+/**
+ * @file log.c
+ * @brief Implementação do registro de mensagens com formatação adiada.
+ *
+ * Cada núcleo tem o seu anel: os produtores de um anel (modo thread e
+ * interrupções do mesmo núcleo) só mascaram as interrupções pelas poucas
+ * instruções da gravação, e o núcleo que esvazia os anéis apenas avança a
+ * cauda. Cada mensagem sai pela USB como uma linha de texto
+ * "#L <cabeçalho> <instante> <argumentos...>" em hexadecimal, para conviver
+ * com as respostas do console; o cabeçalho leva o identificador do formato
+ * nos 24 bits baixos e o número de argumentos no byte alto.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "hardware/clocks.h"
+#include "hardware/structs/timer.h"
+#include "pico/sync.h"
+#include "event_loop.h"
+#include "log.h"
+#include "usb_console.h"
+#include "xip_profile.h"
+
+#if LIB_PICO_STDIO_USB
+#include "pico/stdio_usb.h"
+#endif
+
+#define LOG_BENCH_CALLS 32  // Chamadas medidas por "logbench" (cabem no anel)
+
+// Mensagem gravada no anel
+struct log_record {
+    uint32_t header;              // Identificador do formato | argumentos << 24
+    uint32_t time_us;             // Palavra baixa do temporizador
+    uint32_t args[LOG_MAX_ARGS];
+};
+
+// Anel de mensagens de um núcleo
+struct log_ring {
+    struct log_record records[LOG_RING_SIZE];
+    volatile uint32_t head;       // Escrito apenas pelo núcleo dono
+    volatile uint32_t tail;       // Escrito apenas por log_drain()
+    volatile uint32_t dropped;    // Mensagens descartadas com o anel cheio
+};
+
+static struct log_ring rings[2];
+static uint32_t dropped_reported[2];
+
+#if !EVENT_LOOP_FREERTOS
+static struct event_timer drain_timer;
+#endif
+
+void log_write(uint32_t id, uint32_t argc, const uint32_t *args) {
+    uint32_t now = timer_hw->timerawl;
+    struct log_ring *ring = &rings[get_core_num()];
+
+    uint32_t status = save_and_disable_interrupts();
+    uint32_t head = ring->head;
+    if (head - ring->tail >= LOG_RING_SIZE) {
+        ring->dropped++;
+        restore_interrupts(status);
+        return;
+    }
+
+    struct log_record *record = &ring->records[head & (LOG_RING_SIZE - 1)];
+    record->header = id | argc << 24;
+    record->time_us = now;
+    for (uint32_t i = 0; i < argc; i++) {
+        record->args[i] = args[i];
+    }
+    __dmb();  // A mensagem fica visível ao outro núcleo antes do novo head
+    ring->head = head + 1;
+    restore_interrupts(status);
+}
+
+void log_drain(void) {
+#if LIB_PICO_STDIO_USB
+    if (!stdio_usb_connected()) {
+        return;  // Sem terminal as mensagens aguardam no anel
+    }
+#endif
+
+    for (int core = 0; core < 2; core++) {
+        struct log_ring *ring = &rings[core];
+        uint32_t head = ring->head;
+        __dmb();  // Lê as mensagens só depois do head publicado
+
+        for (uint32_t tail = ring->tail; tail != head; tail++) {
+            const struct log_record *record = &ring->records[tail & (LOG_RING_SIZE - 1)];
+            uint32_t argc = record->header >> 24;
+
+            printf("#L %x %x", (unsigned)record->header, (unsigned)record->time_us);
+            for (uint32_t i = 0; i < argc && i < LOG_MAX_ARGS; i++) {
+                printf(" %x", (unsigned)record->args[i]);
+            }
+            printf("\n");
+
+            __dmb();  // Libera a posição só depois de lida
+            ring->tail = tail + 1;
+        }
+
+        uint32_t dropped = ring->dropped;
+        if (dropped != dropped_reported[core]) {
+            printf("#D %u\n", (unsigned)(dropped - dropped_reported[core]));
+            dropped_reported[core] = dropped;
+        }
+    }
+}
+
+#if !EVENT_LOOP_FREERTOS
+static void drain_handler(void *arg) {
+    struct xip_window xip;
+    xip_profile_begin(&xip);
+    log_drain();
+    xip_profile_end(XIP_SUBSYSTEM_LOG, &xip);
+}
+#endif
+
+// Comando "logbench": ciclos por chamada de LOG() e de printf()
+static void bench_command(const char *args) {
+    uint32_t mhz = clock_get_hz(clk_sys) / 1000000;
+
+    log_drain();  // Esvazia os anéis para as chamadas medidas caberem neles
+    uint64_t start = time_us_64();
+    for (uint32_t i = 0; i < LOG_BENCH_CALLS; i++) {
+        LOG("logbench %u\n", i);
+    }
+    uint32_t log_us = (uint32_t)(time_us_64() - start);
+
+    start = time_us_64();
+    for (uint32_t i = 0; i < LOG_BENCH_CALLS; i++) {
+        printf("logbench %u\n", (unsigned)i);
+    }
+    uint32_t printf_us = (uint32_t)(time_us_64() - start);
+
+    printf("LOG(): %u ciclos por chamada; printf(): %u ciclos por chamada (%u chamadas, %u MHz)\n",
+           (unsigned)(log_us * mhz / LOG_BENCH_CALLS), (unsigned)(printf_us * mhz / LOG_BENCH_CALLS),
+           LOG_BENCH_CALLS, (unsigned)mhz);
+}
+
+static const struct usb_console_command bench_console_command = {
+    "logbench", "custo de LOG() comparado ao de printf()", bench_command
+};
+
+void log_init(void) {
+    usb_console_register(&bench_console_command);
+#if !EVENT_LOOP_FREERTOS
+    event_timer_start(&drain_timer, LOG_DRAIN_MS, LOG_DRAIN_MS, drain_handler, NULL);
+#endif
+}
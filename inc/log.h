@@ -0,0 +1,89 @@
+#ifndef LOG_H
+#define LOG_H
+
+/**
+ * @file log.h
+ * @brief Registro de mensagens com formatação adiada, no estilo do defmt.
+ *
+ * LOG() não formata nada no dispositivo: a string de formato fica apenas no
+ * ELF, na seção não alocada ".logstr", e a chamada grava no anel do núcleo
+ * atual só o identificador do formato (o seu endereço nessa seção), o
+ * instante e os argumentos como palavras de 32 bits. O anel é esvaziado pela
+ * USB em segundo plano (temporizador do laço do núcleo 0, ou tarefa de
+ * telemetria na versão FreeRTOS), sem bloquear quem registra, e pode ser
+ * usado em interrupções. Com o anel cheio a mensagem é descartada e contada.
+ *
+ * tools/log_decode.py lê o ELF e reconstrói as mensagens a partir das linhas
+ * "#L" recebidas pela USB, repassando as demais linhas sem alteração.
+ *
+ * Argumentos:
+ * - inteiros e caracteres são gravados diretamente (no máximo LOG_MAX_ARGS);
+ * - strings só podem ser constantes na flash, passadas por LOG_STR(), pois o
+ *   decodificador as lê do ELF.
+ *
+ * Com LOG_DEFERRED=0 (opção LOG_DEFERRED do CMake) LOG() volta a ser printf().
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#ifndef LOG_DEFERRED
+#define LOG_DEFERRED 1
+#endif
+
+#define LOG_MAX_ARGS   6    ///< Argumentos por mensagem
+#define LOG_RING_SIZE  128  ///< Mensagens aguardando envio, por núcleo (potência de 2)
+#define LOG_DRAIN_MS   100  ///< Intervalo entre os esvaziamentos dos anéis
+
+#if LOG_DEFERRED
+
+// Seção não alocada: o "@" comenta as opções que o GCC acrescenta ao nome
+#define LOG_FORMAT_SECTION __attribute__((section(".logstr,\"\",%progbits @"), used))
+
+/**
+ * @brief Registra uma mensagem com formato no estilo de printf().
+ */
+#define LOG(format, ...) do { \
+        static const char LOG_FORMAT_SECTION log_format_[] = format; \
+        const uint32_t log_args_[] = {0, ##__VA_ARGS__}; \
+        _Static_assert(count_of(log_args_) - 1 <= LOG_MAX_ARGS, "LOG: argumentos demais"); \
+        log_write((uint32_t)(uintptr_t)log_format_, count_of(log_args_) - 1, &log_args_[1]); \
+    } while (0)
+
+/**
+ * @brief Argumento %s de LOG(): string constante na flash.
+ */
+#define LOG_STR(s) ((uint32_t)(uintptr_t)(s))
+
+#else
+
+#define LOG(format, ...) printf(format, ##__VA_ARGS__)
+#define LOG_STR(s) (s)
+
+#endif
+
+/**
+ * @brief Grava uma mensagem no anel do núcleo atual. Use LOG().
+ *
+ * @param id Endereço do formato na seção ".logstr".
+ * @param argc Número de argumentos.
+ * @param args Argumentos, como palavras de 32 bits.
+ */
+void log_write(uint32_t id, uint32_t argc, const uint32_t *args);
+
+/**
+ * @brief Envia pela USB as mensagens registradas, se houver um terminal conectado.
+ */
+void log_drain(void);
+
+/**
+ * @brief Registra o comando "logbench" no console e, sem FreeRTOS, inicia o
+ * esvaziamento periódico no laço do núcleo que a chama.
+ */
+void log_init(void);
+
+#endif // LOG_H
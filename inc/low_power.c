@@ -0,0 +1,317 @@
+/**
+ * @file low_power.c
+ * @brief Implementação do modo de baixo consumo.
+ *
+ * Toda a sequência roda em um único tratador do núcleo 0: o laço de eventos
+ * nunca gira com o chip Wi-Fi desligado. O núcleo 1 é preso em um tratador
+ * adiado do seu próprio laço, como na gravação da flash (inc/flash_guard.h),
+ * e ao ser liberado retoma o governador, os acionamentos e a leitura dos
+ * botões antes de devolver o laço.
+ *
+ * As bordas dos pinos ficam registradas em INTR mesmo sem interrupção
+ * habilitada. As antigas são apagadas assim que o núcleo 1 para de ler os
+ * botões; as que chegam depois disso, ainda antes do dormant, o encerram
+ * imediatamente.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "hardware/clocks.h"
+#include "hardware/structs/iobank0.h"
+#include "hardware/xosc.h"
+#include "alert_service.h"
+#include "button_handler.h"
+#include "callmebot_whatsapp.h"
+#include "clock_governor.h"
+#include "event_loop.h"
+#include "log.h"
+#include "low_power.h"
+#include "ota_update.h"
+#include "time_sync.h"
+#include "ui_core.h"
+#include "usb_console.h"
+#include "wifi.h"
+#include "wifi_power.h"
+
+#if LOW_POWER_ENABLED && PICO_ON_DEVICE
+#include "hardware/pll.h"
+#include "hardware/structs/rosc.h"
+#endif
+
+#if LIB_PICO_STDIO_USB
+#include "pico/stdio_usb.h"
+#endif
+
+#if LOW_POWER_ENABLED
+#define LOW_POWER_EDGES (GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL)
+
+// Latência de uma etapa do despertar
+struct wake_latency {
+    uint32_t last_us;
+    uint32_t max_us;
+    uint64_t total_us;
+    uint32_t count;
+};
+
+// Estado do núcleo 1 durante o modo de baixo consumo
+enum park_state {
+    PARK_IDLE,
+    PARK_REQUESTED,
+    PARK_PARKED,
+    PARK_REFUSED
+};
+
+static const uint wake_pins[] = {BUTTON_A, BUTTON_B, BUTTON_C, BUTTON_D};
+
+static bool enabled = true;
+static volatile uint8_t park_state = PARK_IDLE;
+static volatile bool park_release = false;
+static volatile uint32_t wake_mask = 0;  // Pinos com borda de subida no despertar
+static uint32_t wake_us;
+static bool awaiting_alert = false;
+static struct event_timer check_timer;
+
+static uint32_t sleeps = 0;                // Entradas no modo de baixo consumo
+static uint32_t release_wakes = 0;         // Despertares só por borda de descida, de volta ao dormant
+static uint32_t refusals = 0;              // Verificações recusadas pela interface ocupada
+static struct wake_latency chip_latency;   // Despertar até o chip Wi-Fi carregado
+static struct wake_latency link_latency;   // Despertar até o enlace ativo
+static struct wake_latency alert_latency;  // Despertar até o alerta entregue
+
+static void record(struct wake_latency *latency, uint32_t us) {
+    latency->last_us = us;
+    latency->total_us += us;
+    latency->count++;
+    if (us > latency->max_us) {
+        latency->max_us = us;
+    }
+}
+
+// Núcleo 1: fica em WFE até o despertar, se a interface estiver ociosa
+static void park_handler(void *arg) {
+    if (!ui_is_idle()) {
+        park_state = PARK_REFUSED;
+        return;
+    }
+
+    uint32_t status = save_and_disable_interrupts();
+    park_state = PARK_PARKED;
+    while (!park_release) {
+        __wfe();
+    }
+    park_release = false;
+    restore_interrupts(status);
+    park_state = PARK_IDLE;
+
+    // Relógios da partida, e o botão que despertou o dispositivo publicado já
+    clock_governor_resume();
+    button_handler_latch(wake_mask, time_us_32());
+    button_check_handler(NULL);
+}
+
+static bool park_core1(void) {
+    park_state = PARK_REQUESTED;
+    if (!event_loop_post_to(1, park_handler, NULL)) {
+        park_state = PARK_IDLE;
+        return false;
+    }
+    while (park_state == PARK_REQUESTED) {
+        tight_loop_contents();
+    }
+    if (park_state == PARK_REFUSED) {
+        park_state = PARK_IDLE;
+        return false;
+    }
+    return true;
+}
+
+static void release_core1(uint32_t pins) {
+    wake_mask = pins;
+    park_release = true;
+    __sev();
+}
+
+#if PICO_ON_DEVICE
+// clk_sys e clk_peri do XOSC; PLLs, ROSC, clk_usb, clk_adc e clk_rtc parados
+static void run_from_xosc(void) {
+    uint32_t xosc_hz = XOSC_MHZ * MHZ;
+
+    clock_configure(clk_ref, CLOCKS_CLK_REF_CTRL_SRC_VALUE_XOSC_CLKSRC, 0, xosc_hz, xosc_hz);
+    clock_configure(clk_sys, CLOCKS_CLK_SYS_CTRL_SRC_VALUE_CLK_REF, 0, xosc_hz, xosc_hz);
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS, xosc_hz, xosc_hz);
+    clock_stop(clk_usb);
+    clock_stop(clk_adc);
+    clock_stop(clk_rtc);
+    pll_deinit(pll_sys);
+    pll_deinit(pll_usb);
+    hw_write_masked(&rosc_hw->ctrl, ROSC_CTRL_ENABLE_VALUE_DISABLE << ROSC_CTRL_ENABLE_LSB, ROSC_CTRL_ENABLE_BITS);
+}
+
+static void restart_rosc(void) {
+    hw_write_masked(&rosc_hw->ctrl, ROSC_CTRL_ENABLE_VALUE_ENABLE << ROSC_CTRL_ENABLE_LSB, ROSC_CTRL_ENABLE_BITS);
+    while (!(rosc_hw->status & ROSC_STATUS_STABLE_BITS)) {
+        tight_loop_contents();
+    }
+}
+#endif
+
+// Bordas registradas de um pino
+static uint32_t pin_edges(uint pin) {
+    return iobank0_hw->intr[pin / 8] >> 4 * (pin % 8) & LOW_POWER_EDGES;
+}
+
+// Dormant até uma borda de subida em um dos botões; devolve a máscara desses pinos
+static uint32_t dormant_until_press(void) {
+    uint32_t rises = 0;
+
+#if PICO_ON_DEVICE
+    run_from_xosc();
+#endif
+    while (rises == 0) {
+        for (uint i = 0; i < count_of(wake_pins); i++) {
+            gpio_set_dormant_irq_enabled(wake_pins[i], LOW_POWER_EDGES, true);
+        }
+        xosc_dormant();
+
+        for (uint i = 0; i < count_of(wake_pins); i++) {
+            if (pin_edges(wake_pins[i]) & GPIO_IRQ_EDGE_RISE) {
+                rises |= 1u << wake_pins[i];
+            }
+            gpio_set_dormant_irq_enabled(wake_pins[i], LOW_POWER_EDGES, false);
+            gpio_acknowledge_irq(wake_pins[i], LOW_POWER_EDGES);
+        }
+        if (rises == 0) {
+            release_wakes++;
+        }
+    }
+#if PICO_ON_DEVICE
+    restart_rosc();
+#endif
+    clocks_init();
+    return rises;
+}
+
+// Enlace de volta: libera os pedidos retidos
+static void network_resumed(bool connected) {
+    record(&link_latency, time_us_32() - wake_us);
+    if (connected) {
+        whatsapp_prefetch_dns();
+        time_sync_start();
+    }
+    else {
+        LOG("Rede não religada; os alertas retidos serão tentados assim mesmo.\n");
+    }
+    alert_service_hold(false);
+}
+
+// Rede ociosa e sem terminal: o clk_usb para no dormant e o terminal cairia
+static bool network_idle(void) {
+#if LIB_PICO_STDIO_USB
+    if (stdio_usb_connected()) {
+        return false;
+    }
+#endif
+    return cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) == CYW43_LINK_UP &&
+           alert_service_is_idle() && !whatsapp_is_busy() && !ota_update_is_busy();
+}
+
+static void check_handler(void *arg) {
+    if (!enabled || !network_idle()) {
+        return;
+    }
+    if (!park_core1()) {
+        refusals++;
+        return;
+    }
+
+    // O núcleo 1 não lê mais os botões: a partir daqui as bordas ficam em INTR
+    for (uint i = 0; i < count_of(wake_pins); i++) {
+        gpio_acknowledge_irq(wake_pins[i], LOW_POWER_EDGES);
+    }
+
+    LOG("Entrando no modo de baixo consumo.\n");
+    alert_service_hold(true);
+    time_sync_invalidate(); // O RTC para no dormant
+    if (!wifi_suspend()) {
+        LOG("Associação não guardada; o Wi-Fi procurará a rede no despertar.\n");
+    }
+
+    sleeps++;
+    uint32_t status = save_and_disable_interrupts();
+    uint32_t pins = dormant_until_press();
+    restore_interrupts(status);
+
+    wake_us = time_us_32();
+    awaiting_alert = true;
+    release_core1(pins);
+    LOG("Despertado pelos pinos 0x%x.\n", (unsigned)pins);
+    wifi_power_edge();
+
+    if (wifi_resume(network_resumed)) {
+        panic("Wi-Fi não religou após o dormant"); // O supervisor reinicia o dispositivo
+    }
+    record(&chip_latency, time_us_32() - wake_us);
+}
+
+static void print_latency(const char *name, const struct wake_latency *latency) {
+    printf("  até %-14s última %5u ms, média %5u ms, máxima %5u ms\n", name, (unsigned)(latency->last_us / 1000),
+           (unsigned)(latency->count ? latency->total_us / latency->count / 1000 : 0),
+           (unsigned)(latency->max_us / 1000));
+}
+#endif
+
+void low_power_alert_done(bool sent) {
+#if LOW_POWER_ENABLED
+    // Só o primeiro alerta depois de cada despertar
+    if (awaiting_alert && sent) {
+        record(&alert_latency, time_us_32() - wake_us);
+    }
+    awaiting_alert = false;
+#endif
+}
+
+void low_power_print(void) {
+#if LOW_POWER_ENABLED
+    uint64_t awake_us = time_us_64();
+    uint64_t charge = clock_governor_charge_uas() + wifi_power_charge_uas();
+
+    printf("Baixo consumo: %s, %u entradas em dormant, %u despertares por botão solto, %u recusas\n",
+           enabled ? "ligado" : "desligado", (unsigned)sleeps, (unsigned)release_wakes, (unsigned)refusals);
+    printf("Do despertar:\n");
+    print_latency("o chip Wi-Fi", &chip_latency);
+    print_latency("o enlace", &link_latency);
+    print_latency("o alerta", &alert_latency);
+    printf("Acordado %u s, carga estimada %u.%03u mAh (RP2040 e rádio; o tempo em dormant não é medido)\n",
+           (unsigned)(awake_us / 1000000), (unsigned)(charge / 3600000), (unsigned)(charge / 3600 % 1000));
+#else
+    printf("Modo de baixo consumo desligado (compile com LOW_POWER).\n");
+#endif
+}
+
+// Comando "power [on|off]" do console USB
+static void power_command(const char *args) {
+#if LOW_POWER_ENABLED
+    if (strcmp(args, "on") == 0 || strcmp(args, "off") == 0) {
+        enabled = strcmp(args, "on") == 0;
+        printf("Baixo consumo: %s\n", enabled ? "ligado" : "desligado");
+        return;
+    }
+#endif
+    low_power_print();
+}
+
+static const struct usb_console_command power_console_command = {
+    "power", "[on|off] modo de baixo consumo e latência do despertar", power_command
+};
+
+void low_power_init(void) {
+    usb_console_register(&power_console_command);
+#if LOW_POWER_ENABLED
+    event_timer_start(&check_timer, LOW_POWER_CHECK_MS, LOW_POWER_CHECK_MS, check_handler, NULL);
+#endif
+}
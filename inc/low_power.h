@@ -0,0 +1,74 @@
+#ifndef LOW_POWER_H
+#define LOW_POWER_H
+
+/**
+ * @file low_power.h
+ * @brief Modo de baixo consumo: RP2040 em dormant e chip Wi-Fi desligado.
+ *
+ * Com LOW_POWER, um temporizador do núcleo 0 verifica a cada
+ * LOW_POWER_CHECK_MS se o dispositivo está ocioso: enlace ativo, nenhum
+ * alerta em envio ou retido, nenhuma conexão aberta, terminal USB
+ * desconectado e, no núcleo 1, interface ociosa (painel apagado pela política
+ * de inatividade do display, sem sinal nem áudio tocando). Nesse caso:
+ *
+ * 1. o núcleo 1 fica preso em WFE com as interrupções desabilitadas;
+ * 2. o BSSID e o canal são guardados e o chip Wi-Fi é desligado;
+ * 3. os relógios passam para o XOSC, os PLLs e o ROSC são desligados e o
+ *    XOSC entra em dormant, despertado por qualquer borda em BUTTON_A..D.
+ *
+ * No despertar clocks_init() devolve os relógios da partida, o governador do
+ * clk_sys recalcula os divisores, as bordas de subida viram acionamentos dos
+ * botões e o Wi-Fi é religado pela associação guardada, sem varredura. Os
+ * pedidos ficam retidos na fila até o enlace subir. Um despertar só por borda
+ * de descida (botão solto) volta ao dormant sem religar nada.
+ *
+ * O temporizador do RP2040 para no dormant: os prazos dos laços de eventos e
+ * do watchdog continuam de onde pararam, e o tempo em dormant não é medido
+ * pelo próprio dispositivo. O comando "power [on|off]" do console USB exibe
+ * as entradas, a latência do despertar até o alerta entregue (por etapa) e a
+ * carga estimada enquanto acordado; a simulação (host/) mede também o tempo
+ * em dormant e a corrente média.
+ *
+ * Só na versão sem sistema operacional.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#ifndef LOW_POWER
+#define LOW_POWER 0
+#endif
+
+#if LOW_POWER && !EVENT_LOOP_FREERTOS
+#define LOW_POWER_ENABLED 1
+#else
+#define LOW_POWER_ENABLED 0
+#endif
+
+#define LOW_POWER_CHECK_MS 1000  ///< Intervalo de verificação da ociosidade
+
+// Modelo de corrente da placa em dormant (estimativa; o RP2040 acordado e o
+// rádio vêm de clock_governor.h e wifi_power.h)
+#define LOW_POWER_DORMANT_UA   1000   ///< Pico W em dormant, com o regulador, em uA
+#define LOW_POWER_BATTERY_MAH  2600   ///< Bateria da estimativa de autonomia
+
+/**
+ * @brief Registra o comando "power" e, com LOW_POWER, inicia a verificação de ociosidade.
+ *
+ * Chamada no núcleo 0, depois de clock_governor_init().
+ */
+void low_power_init(void);
+
+/**
+ * @brief Núcleo 0: fim do envio de um alerta dos botões, para a latência do despertar.
+ */
+void low_power_alert_done(bool sent);
+
+/**
+ * @brief Exibe as entradas em dormant, a latência do despertar e a carga estimada acordado.
+ */
+void low_power_print(void);
+
+#endif // LOW_POWER_H
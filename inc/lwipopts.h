@@ -19,7 +19,17 @@
 #define MEM_LIBC_MALLOC             0
 #endif
 #define MEM_ALIGNMENT               4
+#if NO_HEAP
+// Heap-free build: mem_malloc() takes fixed-size blocks from the pools in lwippools.h
+#if MEM_LIBC_MALLOC
+#error "NO_HEAP requires the lwIP internal allocator (MEM_LIBC_MALLOC=0)"
+#endif
+#define MEM_USE_POOLS               1
+#define MEM_USE_POOLS_TRY_BIGGER_POOL 1
+#define MEMP_USE_CUSTOM_POOLS       1
+#else
 #define MEM_SIZE                    4000
+#endif
 #define MEMP_NUM_TCP_SEG            32
 #define MEMP_NUM_ARP_QUEUE          10
 #define PBUF_POOL_SIZE              24
@@ -35,10 +45,21 @@
 #define LWIP_NETIF_LINK_CALLBACK    1
 #define LWIP_NETIF_HOSTNAME         1
 #define LWIP_NETCONN                0
-#define MEM_STATS                   0
+// Heap and pool counters stay on in every build (read by net_memory.c);
+// the per-protocol counters only in debug builds
+#define LWIP_STATS                  1
+#define MEM_STATS                   1
 #define SYS_STATS                   0
-#define MEMP_STATS                  0
+#define MEMP_STATS                  1
 #define LINK_STATS                  0
+#ifdef NDEBUG
+#define ETHARP_STATS                0
+#define IP_STATS                    0
+#define IPFRAG_STATS                0
+#define ICMP_STATS                  0
+#define UDP_STATS                   0
+#define TCP_STATS                   0
+#endif
 // #define ETH_PAD_SIZE                2
 #define LWIP_CHKSUM_ALGORITHM       3
 #define LWIP_DHCP                   1
@@ -51,9 +72,27 @@
 #define DHCP_DOES_ARP_CHECK         0
 #define LWIP_DHCP_DOES_ACD_CHECK    0
 
+// SNTP client (inc/time_sync.h): the received time is written to the RP2040 RTC;
+// the client needs one more lwIP timeout
+#include <stdint.h>
+void time_sync_set(uint32_t seconds);
+#define SNTP_SERVER_DNS             1
+#define SNTP_STARTUP_DELAY          0
+#define SNTP_SET_SYSTEM_TIME(sec)   time_sync_set(sec)
+#define MEMP_NUM_SYS_TIMEOUT        (LWIP_NUM_SYS_TIMEOUT_INTERNAL + 1)
+
+#if !NO_SYS
+// FreeRTOS variant (pico_cyw43_arch_lwip_sys_freertos): lwIP runs in its own thread
+#define TCPIP_THREAD_STACKSIZE      1024
+#define DEFAULT_THREAD_STACKSIZE    1024
+#define DEFAULT_RAW_RECVMBOX_SIZE   8
+#define TCPIP_MBOX_SIZE             8
+#define LWIP_TIMEVAL_PRIVATE        0
+#define LWIP_TCPIP_CORE_LOCKING_INPUT 1
+#endif
+
 #ifndef NDEBUG
 #define LWIP_DEBUG                  1
-#define LWIP_STATS                  1
 #define LWIP_STATS_DISPLAY          1
 #endif
 
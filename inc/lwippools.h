@@ -0,0 +1,16 @@
+// Pools used by mem_malloc() in the heap-free build (NO_HEAP, see lwipopts.h).
+// Sized for what this firmware allocates from the lwIP heap: ARP, DNS and TCP
+// control segments, DHCP messages and one HTTP request segment.
+// Included by lwip/priv/memp_std.h, possibly more than once: no include guard.
+
+#if TCP_MSS + 100 > 1560
+#error "lwippools.h: the largest pool must hold a full TCP segment (TCP_MSS + headers)"
+#endif
+
+#ifdef LWIP_MALLOC_MEMPOOL
+LWIP_MALLOC_MEMPOOL_START
+LWIP_MALLOC_MEMPOOL(8, 256)
+LWIP_MALLOC_MEMPOOL(4, 640)
+LWIP_MALLOC_MEMPOOL(2, 1560)
+LWIP_MALLOC_MEMPOOL_END
+#endif
@@ -0,0 +1,101 @@
+/**
+ * @file net_memory.c
+ * @brief Leitura dos contadores de memória do lwIP.
+ *
+ * Os contadores são escritos pelo lwIP no núcleo 0 e lidos aqui sem trava:
+ * um valor lido no meio de uma alocação só atrasa a leitura em uma
+ * atualização. Zerar os picos, por outro lado, é feito com o lwIP travado.
+ *
+ * Na simulação não há lwIP; o comando envia um bloco vazio.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "net_memory.h"
+#include "usb_console.h"
+
+#if PICO_ON_DEVICE
+#include "lwip/memp.h"
+#include "lwip/stats.h"
+#include "lwip/priv/memp_priv.h"
+
+// Nomes dos pools na ordem de memp_t, pela mesma lista que gera a enumeração
+static const char *const pool_names[MEMP_MAX] = {
+#define LWIP_MEMPOOL(name, num, size, desc) #name,
+#include "lwip/priv/memp_std.h"
+};
+#endif
+
+uint32_t net_memory_failures(void) {
+    uint32_t failures = 0;
+#if PICO_ON_DEVICE
+    failures += lwip_stats.mem.err;
+    for (int i = 0; i < MEMP_MAX; i++) {
+        failures += lwip_stats.memp[i]->err;
+    }
+#endif
+    return failures;
+}
+
+void net_memory_dump(void) {
+    printf("#lwip begin\n");
+#if PICO_ON_DEVICE
+    // Heap (ausente com MEM_USE_POOLS): tamanho em bytes, uso, pico, total e falhas
+    if (lwip_stats.mem.avail > 0) {
+        printf("M heap 1 %u %u %u %u\n", (unsigned)lwip_stats.mem.used, (unsigned)lwip_stats.mem.max,
+               (unsigned)lwip_stats.mem.avail, (unsigned)lwip_stats.mem.err);
+    }
+    // Pools: tamanho do bloco, blocos em uso, pico, total e falhas
+    for (int i = 0; i < MEMP_MAX; i++) {
+        const struct stats_mem *stats = lwip_stats.memp[i];
+        printf("P %s %u %u %u %u %u\n", pool_names[i], (unsigned)memp_pools[i]->size, (unsigned)stats->used,
+               (unsigned)stats->max, (unsigned)stats->avail, (unsigned)stats->err);
+    }
+#endif
+    printf("#lwip end\n");
+}
+
+void net_memory_print_summary(void) {
+#if PICO_ON_DEVICE
+    printf("lwIP: pico do heap %u de %u bytes, %u falhas de alocação\n", (unsigned)lwip_stats.mem.max,
+           (unsigned)lwip_stats.mem.avail, (unsigned)net_memory_failures());
+#endif
+}
+
+// Picos voltam ao uso atual, para medir uma nova carga sem reiniciar
+static void net_memory_reset(void) {
+#if PICO_ON_DEVICE
+    cyw43_arch_lwip_begin();
+    lwip_stats.mem.max = lwip_stats.mem.used;
+    lwip_stats.mem.err = 0;
+    for (int i = 0; i < MEMP_MAX; i++) {
+        lwip_stats.memp[i]->max = lwip_stats.memp[i]->used;
+        lwip_stats.memp[i]->err = 0;
+    }
+    cyw43_arch_lwip_end();
+#endif
+}
+
+// Comando "lwip [reset]" do console USB
+static void lwip_command(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        net_memory_reset();
+        printf("Picos e falhas do lwIP zerados.\n");
+    }
+    else {
+        net_memory_dump();
+    }
+}
+
+static const struct usb_console_command lwip_console_command = {
+    "lwip", "[reset] uso dos pools e do heap do lwIP", lwip_command
+};
+
+void net_memory_init(void) {
+    usb_console_register(&lwip_console_command);
+}
@@ -0,0 +1,40 @@
+#ifndef NET_MEMORY_H
+#define NET_MEMORY_H
+
+/**
+ * @file net_memory.h
+ * @brief Uso do heap e dos pools do lwIP, com picos e falhas de alocação.
+ *
+ * Os contadores são os do próprio lwIP (MEM_STATS e MEMP_STATS), ligados em
+ * todas as versões: cada alocação só atualiza o uso e o pico do pool. O
+ * comando "lwip" do console USB envia o uso de cada pool para
+ * tools/lwip_advisor.py, que recomenda os menores tamanhos sem falhas; o
+ * relatório periódico avisa quando alguma alocação falhou.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+/**
+ * @brief Registra o comando "lwip" no console USB.
+ */
+void net_memory_init(void);
+
+/**
+ * @brief Total de alocações do lwIP que falharam desde o boot (ou o último "lwip reset").
+ */
+uint32_t net_memory_failures(void);
+
+/**
+ * @brief Envia o uso de cada pool pela USB, no formato lido por tools/lwip_advisor.py.
+ */
+void net_memory_dump(void);
+
+/**
+ * @brief Exibe uma linha de resumo: pico do heap e falhas de alocação.
+ */
+void net_memory_print_summary(void);
+
+#endif // NET_MEMORY_H
@@ -0,0 +1,98 @@
+#ifndef OTA_SLOTS_H
+#define OTA_SLOTS_H
+
+/**
+ * @file ota_slots.h
+ * @brief Divisão da flash e bloco de controle da atualização, comuns ao firmware e ao carregador.
+ *
+ * Com OTA_UPDATE, a flash de 2 MB é dividida assim:
+ *
+ * | Região       | Deslocamento | Tamanho  | Conteúdo                                  |
+ * |--------------|--------------|----------|-------------------------------------------|
+ * | carregador   | 0x000000     | 32 KB    | bootloader/bootloader.c, com o boot2      |
+ * | slot A       | 0x008000     | 992 KB   | firmware em execução                      |
+ * | slot B       | 0x100000     | 992 KB   | imagem baixada, ou a anterior após a troca|
+ * | rascunho     | 0x1F8000     | 4 KB     | cópia de um setor durante a troca         |
+ * | controle     | 0x1F9000     | 4 KB     | struct ota_control                        |
+ * | configuração | 0x1FC000     | 16 KB    | inc/config_store.h                        |
+ *
+ * O firmware sempre executa do slot A. A troca é feita pelo carregador setor
+ * a setor, passando pelo setor de rascunho (A→rascunho, B→A, rascunho→B): no
+ * fim, A tem a imagem nova e B a anterior, e desfazer é repetir a troca.
+ * Setores iguais nos dois slots (em geral, os apagados depois do fim das
+ * imagens) não são copiados.
+ *
+ * O bloco de controle só é programado, nunca reescrito: cada marca é uma
+ * palavra que passa de 0xFFFFFFFF a OTA_MARK_SET, e cada etapa concluída da
+ * troca zera um bit do mapa de progresso. Uma queda de energia no meio de uma
+ * etapa a repete na partida seguinte; as etapas são idempotentes porque a
+ * origem de cada cópia só é apagada depois da etapa que a preserva.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+
+#define OTA_BOOT_SIZE       0x8000u                                ///< Carregador, com o boot2
+#define OTA_APP_OFFSET      OTA_BOOT_SIZE                          ///< Slot A, de onde o firmware executa
+#define OTA_SLOT_SIZE       0xF8000u                               ///< Tamanho de cada slot
+#define OTA_DOWNLOAD_OFFSET (OTA_APP_OFFSET + OTA_SLOT_SIZE)       ///< Slot B
+#define OTA_SCRATCH_OFFSET  (OTA_DOWNLOAD_OFFSET + OTA_SLOT_SIZE)  ///< Setor de rascunho da troca
+#define OTA_CONTROL_OFFSET  (OTA_SCRATCH_OFFSET + FLASH_SECTOR_SIZE)
+#define OTA_SLOT_SECTORS    (OTA_SLOT_SIZE / FLASH_SECTOR_SIZE)
+
+#define OTA_VECTOR_OFFSET   0x100u  ///< Tabela de vetores do firmware, depois do boot2 da imagem
+
+#define OTA_CONTROL_MAGIC   0x4C54434Fu  // "OCTL"
+#define OTA_MARK_SET        0x0000A55Au  ///< Marca programada; 0xFFFFFFFF é "não marcada"
+#define OTA_BOOT_WATCHDOG_MS 8000        ///< Watchdog armado pelo carregador para a imagem em teste
+
+// Etapas da troca de um setor, na ordem
+enum ota_swap_step {
+    OTA_STEP_SAVE,     ///< Setor de A copiado para o rascunho
+    OTA_STEP_INSTALL,  ///< Setor de B copiado para A
+    OTA_STEP_STASH,    ///< Rascunho copiado para B
+    OTA_STEP_COUNT
+};
+
+// Marcas do bloco de controle, programadas uma vez cada, nesta ordem
+enum ota_mark {
+    OTA_MARK_SWAPPED,    ///< Imagem nova instalada em A
+    OTA_MARK_TRIAL,      ///< Imagem nova já partiu uma vez, em teste
+    OTA_MARK_CONFIRMED,  ///< Imagem nova aprovada pelo firmware
+    OTA_MARK_REVERTING,  ///< Partida sem aprovação: troca desfeita em andamento
+    OTA_MARK_REVERTED,   ///< Imagem anterior de volta em A
+    OTA_MARK_REJECTED,   ///< Resumo do slot B não confere; nada foi trocado
+    OTA_MARK_COUNT
+};
+
+#define OTA_PROGRESS_BYTES ((OTA_SLOT_SECTORS * OTA_STEP_COUNT + 31) / 32 * 4)
+
+/**
+ * @brief Bloco de controle, no início do setor de controle.
+ *
+ * Os campos até digest são programados pelo firmware ao pedir a troca, depois
+ * de verificar a assinatura da imagem; as marcas e o progresso, pelo
+ * carregador (exceto OTA_MARK_CONFIRMED, do firmware em teste).
+ */
+struct ota_control {
+    uint32_t magic;                                  ///< OTA_CONTROL_MAGIC: troca pedida
+    uint32_t image_size;                             ///< Bytes da imagem no slot B
+    uint32_t version;                                ///< Versão da imagem
+    uint32_t reserved;                               ///< 0xFFFFFFFF
+    uint8_t digest[32];                              ///< SHA-256 da imagem
+    uint32_t marks[OTA_MARK_COUNT];                  ///< enum ota_mark
+    uint8_t progress[2][OTA_PROGRESS_BYTES];         ///< Etapas concluídas (bit zerado): instalação e reversão
+};
+
+static inline const struct ota_control *ota_control_get(void) {
+    return (const struct ota_control *)(uintptr_t)(XIP_BASE + OTA_CONTROL_OFFSET);
+}
+
+static inline bool ota_control_marked(const struct ota_control *control, enum ota_mark mark) {
+    return control->marks[mark] == OTA_MARK_SET;
+}
+
+#endif // OTA_SLOTS_H
@@ -0,0 +1,810 @@
+/**
+ * @file ota_update.c
+ * @brief Implementação da atualização do firmware pela rede.
+ *
+ * O download é uma máquina de estados no laço de eventos do núcleo 0. Os
+ * callbacks do lwIP só encadeiam os pbufs recebidos (pbuf_cat) e agendam
+ * drain_handler(), que os consome na ordem: cabeçalhos HTTP, cabeçalho da
+ * imagem e binário. Cada chamada faz no máximo uma operação na flash (um
+ * apagamento de setor ou a programação de uma página) e se reagenda, de modo
+ * que os pedidos dos botões e o console continuam sendo atendidos entre elas.
+ *
+ * A SRAM usada é fixa: uma página de flash, a linha de cabeçalho HTTP em
+ * análise, o cabeçalho da imagem e o estado do SHA-256. O restante da
+ * imagem em trânsito está nos pbufs, limitado pela janela TCP (TCP_WND).
+ *
+ * Uma conexão perdida não perde nada do que já foi consumido: os bytes estão
+ * na flash ou na página em montagem, e o resumo continua do mesmo estado. A
+ * reconexão pede "Range: bytes=<recebidos>-"; um servidor que responde 200 em
+ * vez de 206 recomeça a imagem do zero.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "ota_update.h"
+
+#if OTA_ENABLED
+
+#include "pico/cyw43_arch.h"
+#include "hardware/flash.h"
+#include "hardware/watchdog.h"
+#include "lwip/dns.h"
+#include "lwip/tcp.h"
+#include "alert_service.h"
+#include "credentials.h"
+#include "event_loop.h"
+#include "flash_guard.h"
+#include "log.h"
+#include "ota_slots.h"
+#include "sha256.h"
+#include "usb_console.h"
+#include "wifi_power.h"
+
+#ifndef OTA_KEY
+#error "OTA_UPDATE exige OTA_KEY em credentials.h, a mesma chave passada a tools/ota_pack.py"
+#endif
+
+#define OTA_CHECK_MS 1000  // Verificação da inatividade da conexão
+
+enum ota_state {
+    OTA_IDLE,
+    OTA_CONNECTING,  // DNS, conexão e cabeçalhos HTTP
+    OTA_RECEIVING,   // Imagem
+    OTA_RETRYING,    // Conexão perdida, aguardando para retomar
+    OTA_READY,       // Imagem verificada no slot B
+    OTA_FAILED,
+    OTA_STATE_COUNT
+};
+
+static const char *const state_names[OTA_STATE_COUNT] = {
+    "nenhum download", "conectando", "recebendo", "aguardando para retomar", "imagem pronta", "falhou",
+};
+
+// Operação sobre a flash: programa uma página, ou apaga um setor se data é NULL
+struct flash_request {
+    uint32_t offset;
+    const uint8_t *data;
+};
+
+static volatile uint8_t state = OTA_IDLE;
+static uint loop_core;
+static char server[64];
+static char path[96];
+static uint16_t port;
+static ip_addr_t server_ip;
+static char request[256];
+
+// Conexão; pending e remote_closed são alterados nos callbacks do lwIP
+static struct tcp_pcb *pcb = NULL;
+static struct pbuf *pending = NULL;     // Recebido e ainda não consumido
+static volatile bool remote_closed = false;
+static volatile bool drain_posted = false;
+static uint32_t last_progress_us;
+
+// Resposta HTTP
+static bool headers_done;
+static int http_status;
+static uint32_t range_start;
+static char line[64];
+static uint32_t line_length;
+
+// Imagem: cabeçalho, resumo e página em montagem
+static struct ota_image_header header;
+static struct sha256 hash;
+static uint8_t page[FLASH_PAGE_SIZE];
+static uint32_t page_fill = 0;
+static uint32_t received = 0;           // Bytes da imagem consumidos, com o cabeçalho
+static uint32_t written = 0;            // Bytes do binário programados no slot B
+static uint32_t erased = 0;             // Bytes do slot B apagados
+static uint8_t digest[SHA256_SIZE];
+static const char *failure = NULL;      // Motivo da falha, constante na flash
+
+static struct event_timer check_timer;
+static struct event_timer retry_timer;
+static struct event_timer yield_timer;
+static struct event_timer trial_timer;
+static bool trial = false;
+
+// Estatísticas do download atual
+static uint64_t started_us, finished_us;
+static uint32_t transferred = 0;        // Bytes consumidos, contando os recebidos de novo
+static uint32_t connections = 0, resumes = 0, restarts = 0, retries = 0, yields = 0;
+static uint32_t erases = 0, programs = 0;
+static uint64_t erase_us = 0, program_us = 0;
+static uint32_t flash_max_us = 0;
+
+static void drain_handler(void *arg);
+static void start_connection(void *arg);
+
+static const uint8_t *flash_at(uint32_t offset) {
+    return (const uint8_t *)(uintptr_t)(XIP_BASE + offset);
+}
+
+static uint32_t image_total(void) {
+    return sizeof(header) + header.image_size;
+}
+
+static void __not_in_flash_func(flash_request_run)(void *arg) {
+    const struct flash_request *request = arg;
+    if (request->data) {
+        flash_range_program(request->offset, request->data, FLASH_PAGE_SIZE);
+    } else {
+        flash_range_erase(request->offset, FLASH_SECTOR_SIZE);
+    }
+}
+
+static void flash_run(uint32_t offset, const uint8_t *data) {
+    struct flash_request request = {offset, data};
+    uint64_t start = time_us_64();
+    flash_guard_run(flash_request_run, &request);
+    uint32_t elapsed = (uint32_t)(time_us_64() - start);
+
+    if (data) {
+        programs++;
+        program_us += elapsed;
+    } else {
+        erases++;
+        erase_us += elapsed;
+    }
+    if (elapsed > flash_max_us) {
+        flash_max_us = elapsed;
+    }
+}
+
+// Programa bytes quaisquer do bloco de controle e confere pelo XIP; usa a
+// página do download, que não está em uso com uma imagem pronta ou em teste
+static bool program_control(const void *field, const void *data, size_t length) {
+    uint32_t offset = OTA_CONTROL_OFFSET + (uint32_t)((const uint8_t *)field - flash_at(OTA_CONTROL_OFFSET));
+    const void *target = field;
+    const uint8_t *src = data;
+    size_t total = length;
+
+    while (length) {
+        uint32_t page_offset = offset & ~(FLASH_PAGE_SIZE - 1u);
+        size_t start = offset - page_offset;
+        size_t count = length < FLASH_PAGE_SIZE - start ? length : FLASH_PAGE_SIZE - start;
+
+        memset(page, 0xFF, sizeof(page));
+        memcpy(page + start, src, count);
+        flash_run(page_offset, page);
+
+        offset += count;
+        src += count;
+        length -= count;
+    }
+    return memcmp(target, data, total) == 0;
+}
+
+static bool control_erased(void) {
+    const uint32_t *words = (const uint32_t *)ota_control_get();
+    for (size_t i = 0; i < sizeof(struct ota_control) / sizeof(uint32_t); i++) {
+        if (words[i] != 0xFFFFFFFFu) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Conexão
+
+static void post_drain(void) {
+    if (!drain_posted) {
+        drain_posted = event_loop_post_to(loop_core, drain_handler, NULL);
+    }
+}
+
+// Qualquer falha da conexão termina aqui: o drain_handler() consome o que
+// chegou antes e decide pela retomada
+static void connection_lost(void) {
+    remote_closed = true;
+    post_drain();
+}
+
+static err_t recv_callback(void *arg, struct tcp_pcb *tpcb, struct pbuf *p, err_t err) {
+    if (p == NULL) {
+        connection_lost();
+        return ERR_OK;
+    }
+    if (pending) {
+        pbuf_cat(pending, p);
+    } else {
+        pending = p;
+    }
+    post_drain();
+    return ERR_OK;
+}
+
+// O lwIP já liberou o pcb
+static void err_callback(void *arg, err_t err) {
+    pcb = NULL;
+    connection_lost();
+}
+
+static err_t connected_callback(void *arg, struct tcp_pcb *tpcb, err_t err) {
+    wifi_power_rx();
+    err = tcp_write(tpcb, request, strlen(request), TCP_WRITE_FLAG_COPY);
+    if (err == ERR_OK) {
+        err = tcp_output(tpcb);
+    }
+    if (err != ERR_OK) {
+        LOG("Atualização: erro %d ao enviar a requisição.\n", err);
+        connection_lost();
+    }
+    return ERR_OK;
+}
+
+// Chamada com o lwIP travado
+static void connect_server(void) {
+    pcb = tcp_new();
+    if (pcb == NULL) {
+        connection_lost();
+        return;
+    }
+    tcp_arg(pcb, NULL);
+    tcp_recv(pcb, recv_callback);
+    tcp_err(pcb, err_callback);
+
+    wifi_power_tx();
+    if (tcp_connect(pcb, &server_ip, port, connected_callback) != ERR_OK) {
+        tcp_abort(pcb);
+        pcb = NULL;
+        connection_lost();
+    }
+}
+
+static void dns_callback(const char *name, const ip_addr_t *ipaddr, void *arg) {
+    if ((uintptr_t)arg != connections || state != OTA_CONNECTING) {
+        return;  // Resposta de uma tentativa já abandonada
+    }
+    if (ipaddr == NULL) {
+        LOG("Atualização: servidor não encontrado pelo DNS.\n");
+        connection_lost();
+        return;
+    }
+    server_ip = *ipaddr;
+    connect_server();
+}
+
+// Encerra a conexão e devolve os pbufs não consumidos
+static void close_connection(void) {
+    event_timer_stop(&retry_timer);
+    event_timer_stop(&yield_timer);
+
+    cyw43_arch_lwip_begin();
+    if (pcb) {
+        tcp_arg(pcb, NULL);
+        tcp_recv(pcb, NULL);
+        tcp_err(pcb, NULL);
+        if (tcp_close(pcb) != ERR_OK) {
+            tcp_abort(pcb);
+        }
+        pcb = NULL;
+    }
+    if (pending) {
+        pbuf_free(pending);
+        pending = NULL;
+    }
+    cyw43_arch_lwip_end();
+}
+
+static void stop(enum ota_state next) {
+    close_connection();
+    event_timer_stop(&check_timer);
+    wifi_power_transfer(false);
+    finished_us = time_us_64();
+    state = next;
+}
+
+static void fail(const char *reason) {
+    failure = reason;
+    stop(OTA_FAILED);
+    LOG("Atualização: %s.\n", LOG_STR(reason));
+}
+
+static void start_connection(void *arg) {
+    state = OTA_CONNECTING;
+    remote_closed = false;
+    headers_done = false;
+    http_status = 0;
+    range_start = 0;
+    line_length = 0;
+    connections++;
+    last_progress_us = time_us_32();
+
+    // Retoma do primeiro byte ainda não consumido
+    int length = snprintf(request, sizeof(request), "GET %s HTTP/1.1\r\nHost: %s\r\nConnection: close\r\n", path,
+                          server);
+    if (received) {
+        length += snprintf(request + length, sizeof(request) - length, "Range: bytes=%u-\r\n", (unsigned)received);
+    }
+    snprintf(request + length, sizeof(request) - length, "\r\n");
+
+    cyw43_arch_lwip_begin();
+    ip_addr_t address;
+    void *attempt = (void *)(uintptr_t)connections;
+    err_t err = dns_gethostbyname(server, &address, dns_callback, attempt);
+    if (err == ERR_OK) {
+        dns_callback(server, &address, attempt);
+    } else if (err != ERR_INPROGRESS) {
+        connection_lost();
+    }
+    cyw43_arch_lwip_end();
+}
+
+static void retry(void) {
+    close_connection();
+    if (++retries > OTA_MAX_RETRIES) {
+        fail("servidor sem resposta depois das reconexões");
+        return;
+    }
+    LOG("Atualização: conexão perdida com %u bytes recebidos; nova tentativa em %u ms.\n", (unsigned)received,
+        OTA_RETRY_MS);
+    state = OTA_RETRYING;
+    event_timer_start(&retry_timer, OTA_RETRY_MS, 0, start_connection, NULL);
+}
+
+// Consumo dos dados recebidos
+
+// Copia até length bytes recebidos e reabre a janela na mesma quantidade
+static uint32_t take(void *dst, uint32_t length) {
+    uint32_t count = 0;
+
+    cyw43_arch_lwip_begin();
+    if (pending) {
+        count = pbuf_copy_partial(pending, dst, (u16_t)length, 0);
+        pending = pbuf_free_header(pending, (u16_t)count);
+        if (pcb && count) {
+            tcp_recved(pcb, (u16_t)count);
+        }
+    }
+    cyw43_arch_lwip_end();
+
+    if (count) {
+        transferred += count;
+        retries = 0;
+        last_progress_us = time_us_32();
+    }
+    return count;
+}
+
+static void restart_image(void) {
+    received = 0;
+    written = 0;
+    erased = 0;
+    page_fill = 0;
+    sha256_init(&hash);
+}
+
+static void header_line(void) {
+    line[line_length] = '\0';
+    if (http_status == 0) {
+        // "HTTP/1.x NNN": uma linha mais curta não chega ao código
+        bool valid = line_length >= 12 && strncmp(line, "HTTP/1.", 7) == 0 && line[8] == ' ';
+        http_status = valid ? atoi(&line[9]) : -1;
+    } else if (line_length == 0) {
+        headers_done = true;
+    } else if (strncasecmp(line, "Content-Range: bytes ", 21) == 0) {
+        range_start = (uint32_t)strtoul(&line[21], NULL, 10);
+    }
+    line_length = 0;
+}
+
+// Analisa os cabeçalhos HTTP; false se a resposta não serve
+static bool parse_headers(void) {
+    char chunk[32];
+    uint32_t count = 0;
+
+    while (!headers_done) {
+        cyw43_arch_lwip_begin();
+        count = pending ? pbuf_copy_partial(pending, chunk, sizeof(chunk), 0) : 0;
+        cyw43_arch_lwip_end();
+        if (count == 0) {
+            return true;
+        }
+
+        // Só o que pertence aos cabeçalhos é consumido
+        uint32_t used = 0;
+        while (used < count && !headers_done) {
+            char c = chunk[used++];
+            if (c == '\n') {
+                header_line();
+            } else if (c != '\r' && line_length < sizeof(line) - 1) {
+                line[line_length++] = c;
+            }
+        }
+        take(chunk, used);
+    }
+
+    if (http_status == 206 && range_start == received) {
+        resumes++;
+        return true;
+    }
+    if (http_status == 200) {
+        if (received) {
+            // Sem retomada, uma conexão que sempre cai antes do fim nunca termina
+            if (++restarts > OTA_MAX_RETRIES) {
+                LOG("Atualização: o servidor não retoma downloads e a conexão não chega ao fim.\n");
+                return false;
+            }
+            LOG("Atualização: o servidor não retoma downloads; recomeçando do início.\n");
+            restart_image();
+        }
+        return true;
+    }
+    LOG("Atualização: resposta HTTP %d.\n", http_status);
+    return false;
+}
+
+static const char *check_header(void) {
+    if (header.magic != OTA_IMAGE_MAGIC || header.image_size == 0 || header.image_size > OTA_SLOT_SIZE) {
+        return "cabeçalho da imagem inválido";
+    }
+    if (header.version <= OTA_FIRMWARE_VERSION) {
+        return "a imagem não é mais nova que o firmware em execução";
+    }
+    return NULL;
+}
+
+// Uma operação na flash: o apagamento do próximo setor ou a página montada
+static bool write_page(void) {
+    uint32_t offset = OTA_DOWNLOAD_OFFSET + written;
+
+    if (written == erased) {
+        flash_run(offset, NULL);
+        erased += FLASH_SECTOR_SIZE;
+        return true;
+    }
+
+    memset(page + page_fill, 0xFF, sizeof(page) - page_fill);
+    flash_run(offset, page);
+    if (memcmp(flash_at(offset), page, page_fill) != 0) {
+        return false;
+    }
+    written += page_fill;
+    page_fill = 0;
+    return true;
+}
+
+// A etiqueta cobre o início do cabeçalho e o resumo do binário
+static bool signature_valid(void) {
+    uint8_t message[offsetof(struct ota_image_header, tag) + SHA256_SIZE];
+    uint8_t expected[SHA256_SIZE];
+    uint8_t difference = 0;
+
+    memcpy(message, &header, offsetof(struct ota_image_header, tag));
+    memcpy(message + offsetof(struct ota_image_header, tag), digest, SHA256_SIZE);
+    hmac_sha256(OTA_KEY, strlen(OTA_KEY), message, sizeof(message), expected);
+    for (int i = 0; i < SHA256_SIZE; i++) {
+        difference |= expected[i] ^ header.tag[i];
+    }
+    return difference == 0;
+}
+
+static void complete(void) {
+    sha256_final(&hash, digest);
+    if (!signature_valid()) {
+        fail("assinatura da imagem inválida");
+        return;
+    }
+    stop(OTA_READY);
+    LOG("Atualização: versão %u recebida e verificada (%u bytes); \"ota aplicar\" instala.\n",
+        (unsigned)header.version, (unsigned)header.image_size);
+}
+
+static void yield_handler(void *arg) {
+    post_drain();
+}
+
+// Resultado de uma rodada de consumo
+enum ota_drain {
+    OTA_DRAIN_WAIT,   // Sem mais dados recebidos
+    OTA_DRAIN_AGAIN,  // Uma operação na flash feita; há mais trabalho
+    OTA_DRAIN_DONE,   // Download encerrado (imagem completa ou falha)
+};
+
+static enum ota_drain consume(void) {
+    if (!headers_done) {
+        if (!parse_headers()) {
+            fail("o servidor não entregou a imagem");
+            return OTA_DRAIN_DONE;
+        }
+        if (!headers_done) {
+            return OTA_DRAIN_WAIT;
+        }
+        state = OTA_RECEIVING;
+    }
+
+    if (received < sizeof(header)) {
+        received += take((uint8_t *)&header + received, sizeof(header) - received);
+        if (received < sizeof(header)) {
+            return OTA_DRAIN_WAIT;
+        }
+        const char *error = check_header();
+        if (error) {
+            fail(error);
+            return OTA_DRAIN_DONE;
+        }
+        LOG("Atualização: imagem da versão %u com %u bytes.\n", (unsigned)header.version,
+            (unsigned)header.image_size);
+    }
+
+    // Completa a página; com ela cheia (ou no fim da imagem), uma operação na flash
+    uint32_t wanted = image_total() - received;
+    if (wanted > sizeof(page) - page_fill) {
+        wanted = sizeof(page) - page_fill;
+    }
+    if (wanted) {
+        uint32_t count = take(page + page_fill, wanted);
+        sha256_update(&hash, page + page_fill, count);
+        page_fill += count;
+        received += count;
+    }
+    if (page_fill == sizeof(page) || (page_fill && received == image_total())) {
+        if (!write_page()) {
+            fail("a flash não confirmou a gravação");
+            return OTA_DRAIN_DONE;
+        }
+        return OTA_DRAIN_AGAIN;
+    }
+    if (received == image_total()) {
+        complete();
+        return OTA_DRAIN_DONE;
+    }
+    return OTA_DRAIN_WAIT;
+}
+
+static void drain_handler(void *arg) {
+    drain_posted = false;
+    if (state != OTA_CONNECTING && state != OTA_RECEIVING) {
+        return;
+    }
+
+    // Alerta em envio: a conexão espera com a janela cheia
+    if (!alert_service_is_idle()) {
+        if (!event_timer_is_active(&yield_timer)) {
+            yields++;
+            event_timer_start(&yield_timer, OTA_YIELD_MS, 0, yield_handler, NULL);
+        }
+        return;
+    }
+
+    enum ota_drain result = consume();
+    if (result == OTA_DRAIN_AGAIN) {
+        post_drain();
+        return;
+    }
+    if (result == OTA_DRAIN_DONE) {
+        return;
+    }
+
+    // Sem mais dados: espera o próximo segmento, ou retoma se a conexão caiu
+    cyw43_arch_lwip_begin();
+    bool more = pending != NULL;
+    cyw43_arch_lwip_end();
+    if (more) {
+        post_drain();
+    } else if (remote_closed) {
+        retry();
+    }
+}
+
+static void check_handler(void *arg) {
+    if (state != OTA_CONNECTING && state != OTA_RECEIVING) {
+        return;
+    }
+    // A pausa por um alerta não conta como inatividade
+    if (!alert_service_is_idle() || event_timer_is_active(&yield_timer)) {
+        last_progress_us = time_us_32();
+        return;
+    }
+    if (time_us_32() - last_progress_us > OTA_TIMEOUT_MS * 1000u) {
+        LOG("Atualização: servidor sem dados há %u ms.\n", OTA_TIMEOUT_MS);
+        retry();
+        return;
+    }
+    post_drain();  // Garante o consumo se um agendamento não coube na fila
+}
+
+// Comandos
+
+static bool parse_url(const char *url) {
+    if (strncmp(url, "http://", 7) == 0) {
+        url += 7;
+    }
+    const char *slash = strchr(url, '/');
+    const char *colon = strchr(url, ':');
+    if (slash == NULL || slash == url || strlen(slash) >= sizeof(path)) {
+        return false;
+    }
+
+    const char *host_end = colon && colon < slash ? colon : slash;
+    if ((size_t)(host_end - url) >= sizeof(server)) {
+        return false;
+    }
+    memcpy(server, url, host_end - url);
+    server[host_end - url] = '\0';
+    port = colon && colon < slash ? (uint16_t)atoi(colon + 1) : OTA_HTTP_PORT;
+    strcpy(path, slash);
+    return port != 0;
+}
+
+static bool trial_pending(void) {
+    const struct ota_control *control = ota_control_get();
+    return control->magic == OTA_CONTROL_MAGIC && ota_control_marked(control, OTA_MARK_TRIAL) &&
+           !ota_control_marked(control, OTA_MARK_CONFIRMED) && !ota_control_marked(control, OTA_MARK_REVERTED);
+}
+
+static void start_download(const char *url) {
+    if (state == OTA_CONNECTING || state == OTA_RECEIVING || state == OTA_RETRYING) {
+        printf("Download em andamento; \"ota cancelar\" interrompe\n");
+        return;
+    }
+    if (trial_pending()) {
+        printf("Imagem em teste: aguarde a aprovação antes de outra atualização\n");
+        return;
+    }
+    if (!parse_url(url)) {
+        printf("Endereço inválido; use servidor[:porta]/caminho\n");
+        return;
+    }
+
+    // Um pedido de troca anterior (aprovado, revertido ou recusado) deixa de valer
+    if (!control_erased()) {
+        flash_run(OTA_CONTROL_OFFSET, NULL);
+    }
+
+    restart_image();
+    failure = NULL;
+    transferred = connections = resumes = restarts = retries = yields = 0;
+    erases = programs = flash_max_us = 0;
+    erase_us = program_us = 0;
+    started_us = time_us_64();
+    wifi_power_transfer(true);
+    event_timer_start(&check_timer, OTA_CHECK_MS, OTA_CHECK_MS, check_handler, NULL);
+    start_connection(NULL);
+    printf("Baixando http://%s:%u%s para o slot B\n", server, port, path);
+}
+
+static void apply(void) {
+    if (state != OTA_READY) {
+        printf("Nenhuma imagem verificada para instalar\n");
+        return;
+    }
+    if (!alert_service_is_idle()) {
+        printf("Alerta em envio; tente novamente em instantes\n");
+        return;
+    }
+
+    struct ota_control request = {OTA_CONTROL_MAGIC, header.image_size, header.version, 0xFFFFFFFFu};
+    memcpy(request.digest, digest, SHA256_SIZE);
+    if (!program_control(ota_control_get(), &request, offsetof(struct ota_control, marks))) {
+        fail("a flash não confirmou o pedido de troca");
+        return;
+    }
+    printf("Reiniciando para instalar a versão %u\n", (unsigned)header.version);
+    watchdog_reboot(0, 0, 100);
+}
+
+static void print_slots(void) {
+    const struct ota_control *control = ota_control_get();
+
+    printf("Firmware versão %u; ", OTA_FIRMWARE_VERSION);
+    if (control->magic != OTA_CONTROL_MAGIC) {
+        printf("nenhuma troca pedida\n");
+    } else if (ota_control_marked(control, OTA_MARK_REJECTED)) {
+        printf("troca recusada pelo carregador: o slot B não confere com o resumo\n");
+    } else if (ota_control_marked(control, OTA_MARK_REVERTED)) {
+        printf("versão %u revertida: reiniciou antes da aprovação\n", (unsigned)control->version);
+    } else if (ota_control_marked(control, OTA_MARK_CONFIRMED)) {
+        printf("versão %u aprovada\n", (unsigned)control->version);
+    } else if (trial) {
+        int64_t left_us = absolute_time_diff_us(get_absolute_time(), trial_timer.deadline);
+        printf("versão %u em teste, aprovação em %u s\n", (unsigned)control->version,
+               (unsigned)(left_us > 0 ? left_us / 1000000 : 0));
+    } else {
+        printf("troca para a versão %u pedida\n", (unsigned)control->version);
+    }
+}
+
+void ota_update_print(void) {
+    print_slots();
+    printf("Atualização: %s", state_names[state]);
+    if (state == OTA_FAILED && failure) {
+        printf(" (%s)", failure);
+    }
+    printf("\n");
+    if (state == OTA_IDLE) {
+        return;
+    }
+
+    uint32_t total = received >= sizeof(header) ? image_total() : 0;
+    uint64_t elapsed_us = (state == OTA_READY || state == OTA_FAILED ? finished_us : time_us_64()) - started_us;
+    printf("  http://%s:%u%s: %u de %u bytes", server, port, path, (unsigned)received, (unsigned)total);
+    if (total) {
+        printf(" (%u%%), versão %u", (unsigned)((uint64_t)received * 100 / total), (unsigned)header.version);
+    }
+    printf("\n  %u conexões, %u retomadas pelo Range, %u recomeços do zero, %u pausas por alertas\n",
+           (unsigned)connections, (unsigned)resumes, (unsigned)restarts, (unsigned)yields);
+    printf("  %u bytes em %u ms: %u KB/s\n", (unsigned)transferred, (unsigned)(elapsed_us / 1000),
+           (unsigned)(elapsed_us ? (uint64_t)transferred * 1000000 / elapsed_us / 1024 : 0));
+    printf("  Flash: %u setores apagados (%u ms), %u páginas programadas (%u ms), maior operação %u us\n",
+           (unsigned)erases, (unsigned)(erase_us / 1000), (unsigned)programs, (unsigned)(program_us / 1000),
+           (unsigned)flash_max_us);
+}
+
+// Comando "ota [<servidor[:porta]/caminho>|aplicar|cancelar]" do console USB
+static void ota_command(const char *args) {
+    if (strcmp(args, "aplicar") == 0) {
+        apply();
+    } else if (strcmp(args, "cancelar") == 0) {
+        if (state == OTA_CONNECTING || state == OTA_RECEIVING || state == OTA_RETRYING) {
+            stop(OTA_IDLE);
+            LOG("Atualização cancelada.\n");
+        }
+    } else if (*args) {
+        start_download(args);
+    } else {
+        ota_update_print();
+    }
+}
+
+static const struct usb_console_command ota_console_command = {
+    "ota", "[<servidor[:porta]/caminho>|aplicar|cancelar] atualização pela rede", ota_command
+};
+
+// Imagem em teste: aprovada depois de OTA_TRIAL_MS sem reinício e com o Wi-Fi associado
+static void trial_handler(void *arg) {
+    static const uint32_t set = OTA_MARK_SET;
+
+    if (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) != CYW43_LINK_UP) {
+        event_timer_start(&trial_timer, OTA_CHECK_MS, 0, trial_handler, NULL);
+        return;
+    }
+    if (!program_control(&ota_control_get()->marks[OTA_MARK_CONFIRMED], &set, sizeof(set))) {
+        LOG("Atualização: falha ao gravar a aprovação.\n");
+        return;
+    }
+    trial = false;
+    LOG("Atualização: versão %u aprovada.\n", (unsigned)ota_control_get()->version);
+}
+
+void ota_update_init(void) {
+    const struct ota_control *control = ota_control_get();
+
+    loop_core = get_core_num();
+    if (trial_pending()) {
+        trial = true;
+        event_timer_start(&trial_timer, OTA_TRIAL_MS, 0, trial_handler, NULL);
+        LOG("Atualização: versão %u em teste; aprovação em %u ms.\n", (unsigned)control->version, OTA_TRIAL_MS);
+    } else if (control->magic == OTA_CONTROL_MAGIC && ota_control_marked(control, OTA_MARK_REVERTED)) {
+        LOG("Atualização: versão %u não aprovada; o carregador voltou à anterior.\n", (unsigned)control->version);
+    } else if (control->magic == OTA_CONTROL_MAGIC && ota_control_marked(control, OTA_MARK_REJECTED)) {
+        LOG("Atualização: troca recusada pelo carregador (slot B corrompido).\n");
+    }
+    usb_console_register(&ota_console_command);
+}
+
+bool ota_update_is_busy(void) {
+    return trial || state == OTA_CONNECTING || state == OTA_RECEIVING || state == OTA_RETRYING;
+}
+
+#else
+
+void ota_update_init(void) {
+}
+
+bool ota_update_is_busy(void) {
+    return false;
+}
+
+void ota_update_print(void) {
+}
+
+#endif
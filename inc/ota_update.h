@@ -0,0 +1,84 @@
+#ifndef OTA_UPDATE_H
+#define OTA_UPDATE_H
+
+/**
+ * @file ota_update.h
+ * @brief Atualização do firmware pela rede, em dois slots, com reversão automática.
+ *
+ * Com OTA_UPDATE, o comando "ota <servidor[:porta]/caminho>" do console USB
+ * baixa por HTTP uma imagem gerada por tools/ota_pack.py direto para o slot B
+ * (inc/ota_slots.h), sem guardá-la na SRAM:
+ *
+ * - os segmentos TCP recebidos ficam nos pbufs do lwIP e são consumidos pelo
+ *   laço de eventos do núcleo 0, uma página de flash por vez; a janela só é
+ *   reaberta (tcp_recved) depois que a página foi programada, e o servidor
+ *   espera enquanto a flash é apagada;
+ * - o SHA-256 é calculado à medida que os bytes chegam; no fim, a etiqueta
+ *   HMAC-SHA256 do cabeçalho da imagem (com a chave OTA_KEY de
+ *   credentials.h) é conferida, e só então a troca pode ser pedida;
+ * - uma conexão perdida é retomada do byte seguinte, com o cabeçalho Range;
+ * - enquanto um alerta está em envio, a cópia para e a conexão fica parada
+ *   com a janela cheia: o alerta tem a rede e a flash só para ele.
+ *
+ * "ota aplicar" grava o bloco de controle e reinicia; o carregador troca os
+ * slots e parte a imagem nova em teste. Ela é aprovada depois de
+ * OTA_TRIAL_MS funcionando, com o supervisor alimentando o watchdog, e com o
+ * Wi-Fi associado (uma imagem sem rede não receberia a correção). Qualquer
+ * reinício antes disso, inclusive pelo watchdog, faz o carregador voltar à
+ * imagem anterior.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#ifndef OTA_UPDATE
+#define OTA_UPDATE 0
+#endif
+
+#define OTA_ENABLED OTA_UPDATE
+
+#ifndef OTA_FIRMWARE_VERSION
+#define OTA_FIRMWARE_VERSION 1  ///< Versão deste firmware; só imagens mais novas são aceitas
+#endif
+
+#define OTA_IMAGE_MAGIC      0x3141544Fu  ///< "OTA1", início da imagem
+#define OTA_HTTP_PORT        80
+#define OTA_TIMEOUT_MS       10000  ///< Sem dados por este tempo, a conexão é refeita
+#define OTA_RETRY_MS         2000   ///< Espera antes de reconectar
+#define OTA_MAX_RETRIES      5      ///< Reconexões seguidas sem progresso antes de desistir
+#define OTA_YIELD_MS         50     ///< Nova verificação da cópia parada por um alerta
+#define OTA_TRIAL_MS         60000  ///< Funcionamento exigido da imagem em teste
+
+/**
+ * @brief Cabeçalho da imagem, seguido do binário do slot A.
+ *
+ * tag = HMAC-SHA256(OTA_KEY, os 16 primeiros bytes || SHA-256 do binário).
+ */
+struct ota_image_header {
+    uint32_t magic;       ///< OTA_IMAGE_MAGIC
+    uint32_t image_size;  ///< Bytes do binário
+    uint32_t version;     ///< Maior que OTA_FIRMWARE_VERSION
+    uint32_t reserved;
+    uint8_t tag[32];
+};
+
+/**
+ * @brief Registra o comando "ota" e, com a imagem em teste, inicia o prazo da aprovação.
+ *
+ * Chamada no núcleo 0, depois de config_store_init().
+ */
+void ota_update_init(void);
+
+/**
+ * @brief Informa se há um download em andamento (impede o modo de baixo consumo).
+ */
+bool ota_update_is_busy(void);
+
+/**
+ * @brief Exibe o estado, a vazão, as retomadas e o tempo gasto na flash.
+ */
+void ota_update_print(void);
+
+#endif // OTA_UPDATE_H
@@ -0,0 +1,45 @@
+#ifndef SHA256_H
+#define SHA256_H
+
+/**
+ * @file sha256.h
+ * @brief SHA-256 incremental e HMAC-SHA256.
+ *
+ * O resumo é alimentado em partes de qualquer tamanho, à medida que os dados
+ * chegam; o estado ocupa pouco mais de 100 bytes. Usado pela atualização pela
+ * rede (inc/ota_update.h) e pelo carregador (bootloader/).
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_SIZE       32  ///< Tamanho do resumo, em bytes
+#define SHA256_BLOCK_SIZE 64  ///< Tamanho do bloco, em bytes
+
+/**
+ * @brief Estado de um resumo em andamento.
+ */
+struct sha256 {
+    uint32_t state[8];
+    uint64_t length;                   ///< Bytes processados
+    uint8_t block[SHA256_BLOCK_SIZE];  ///< Bloco incompleto
+    uint8_t used;                      ///< Bytes em block
+};
+
+void sha256_init(struct sha256 *ctx);
+void sha256_update(struct sha256 *ctx, const void *data, size_t length);
+
+/**
+ * @brief Encerra o resumo; o estado precisa de sha256_init() para ser reutilizado.
+ */
+void sha256_final(struct sha256 *ctx, uint8_t digest[SHA256_SIZE]);
+
+/**
+ * @brief HMAC-SHA256 de um bloco de dados.
+ */
+void hmac_sha256(const void *key, size_t key_length, const void *data, size_t length, uint8_t mac[SHA256_SIZE]);
+
+#endif // SHA256_H
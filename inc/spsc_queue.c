@@ -0,0 +1,62 @@
+/**
+ * @file spsc_queue.c
+ * @brief Implementação da fila circular sem travas de um produtor e um consumidor.
+ *
+ * Os índices crescem livremente e a posição no vetor é obtida com uma máscara,
+ * de modo que head - tail é sempre a quantidade de eventos na fila.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/sync.h"
+#include "hot_path.h"
+#include "spsc_queue.h"
+
+bool HOT_PATH(spsc_queue_push)(struct spsc_queue *queue, struct app_event *event)
+{
+    uint32_t head = queue->head;
+
+    if (head - queue->tail >= SPSC_QUEUE_SIZE)
+    {
+        queue->dropped++;
+        return false;
+    }
+
+    event->timestamp_us = time_us_32();
+    queue->items[head & (SPSC_QUEUE_SIZE - 1)] = *event;
+
+    __dmb(); // O evento precisa estar visível antes do novo índice
+    queue->head = head + 1;
+    __sev(); // Acorda o outro núcleo, se estiver em WFE
+    return true;
+}
+
+bool HOT_PATH(spsc_queue_pop)(struct spsc_queue *queue, struct app_event *event)
+{
+    uint32_t tail = queue->tail;
+
+    if (tail == queue->head)
+    {
+        return false;
+    }
+
+    __dmb(); // Lê o evento somente depois de observar o índice publicado
+    *event = queue->items[tail & (SPSC_QUEUE_SIZE - 1)];
+    __dmb();
+    queue->tail = tail + 1;
+
+    uint32_t latency = time_us_32() - event->timestamp_us;
+    queue->received++;
+    queue->latency_total_us += latency;
+    if (latency > queue->latency_max_us)
+    {
+        queue->latency_max_us = latency;
+    }
+    return true;
+}
+
+uint32_t spsc_queue_depth(const struct spsc_queue *queue)
+{
+    return queue->head - queue->tail;
+}
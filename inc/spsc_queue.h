@@ -0,0 +1,59 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+/**
+ * @file spsc_queue.h
+ * @brief Fila circular sem travas de um produtor e um consumidor.
+ *
+ * Cada fila liga exatamente um produtor a um consumidor, normalmente em
+ * núcleos diferentes. O produtor só escreve o índice head e o consumidor só
+ * escreve o índice tail, então nenhuma trava é necessária: uma barreira de
+ * memória garante que o evento esteja visível antes do índice. Após publicar,
+ * o produtor executa SEV para acordar o outro núcleo do WFE.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "app_event.h"
+
+#define SPSC_QUEUE_SIZE 32  ///< Capacidade da fila (potência de 2)
+
+/**
+ * @brief Fila SPSC de eventos com estatísticas de latência.
+ */
+struct spsc_queue {
+    struct app_event items[SPSC_QUEUE_SIZE];
+    volatile uint32_t head;     ///< Próxima posição a escrever (somente o produtor altera)
+    volatile uint32_t tail;     ///< Próxima posição a ler (somente o consumidor altera)
+    uint32_t dropped;           ///< Eventos descartados com a fila cheia (produtor)
+    uint32_t received;          ///< Eventos retirados da fila (consumidor)
+    uint32_t latency_max_us;    ///< Maior tempo entre publicação e retirada (consumidor)
+    uint64_t latency_total_us;  ///< Soma dos tempos, para a média (consumidor)
+};
+
+/**
+ * @brief Publica um evento na fila. Deve ser chamada apenas pelo produtor.
+ *
+ * @param queue Fila de destino.
+ * @param event Evento a publicar; o instante de publicação é preenchido aqui.
+ * @return true se o evento foi publicado, false se a fila estava cheia.
+ */
+bool spsc_queue_push(struct spsc_queue *queue, struct app_event *event);
+
+/**
+ * @brief Retira o evento mais antigo da fila. Deve ser chamada apenas pelo consumidor.
+ *
+ * @param queue Fila de origem.
+ * @param event Recebe o evento retirado.
+ * @return true se havia um evento, false se a fila estava vazia.
+ */
+bool spsc_queue_pop(struct spsc_queue *queue, struct app_event *event);
+
+/**
+ * @brief Quantidade de eventos aguardando na fila.
+ */
+uint32_t spsc_queue_depth(const struct spsc_queue *queue);
+
+#endif // SPSC_QUEUE_H
@@ -30,6 +30,12 @@
 #include "ssd1306_font.h"
 #include "ssd1306_i2c.h"
 
+// Área a enviar precedida do byte de controle; só o núcleo da interface envia áreas ao display
+static uint8_t send_buffer[ssd1306_buffer_length + 1];
+
+// Buffer do modo bitmap, com o byte de controle e o painel inteiro
+static uint8_t bitmap_buffer[ssd1306_buffer_length + 1];
+
 // Calcular quanto do buffer será destinado à área de renderização
 void calculate_render_area_buffer_length(struct render_area *area) {
     area->buffer_length = (area->end_column - area->start_column + 1) * (area->end_page - area->start_page + 1);
@@ -48,16 +54,19 @@ void ssd1306_send_command_list(uint8_t *ssd, int number) {
     }
 }
 
-// Copia buffer de referência num novo buffer, a fim de adicionar o byte de controle desde o início
+// Copia buffer de referência no buffer de envio, a fim de adicionar o byte de controle desde o início
 void ssd1306_send_buffer(uint8_t ssd[], int buffer_length) {
-    uint8_t *temp_buffer = malloc(buffer_length + 1);
+    assert(buffer_length <= ssd1306_buffer_length);
 
-    temp_buffer[0] = 0x40;
-    memcpy(temp_buffer + 1, ssd, buffer_length);
+    send_buffer[0] = 0x40;
+    memcpy(send_buffer + 1, ssd, buffer_length);
 
-    i2c_write_blocking(i2c1, ssd1306_i2c_address, temp_buffer, buffer_length + 1, false);
+    i2c_write_blocking(i2c1, ssd1306_i2c_address, send_buffer, buffer_length + 1, false);
+}
 
-    free(temp_buffer);
+// Envia uma imagem que já começa com o byte de controle, direto da flash e sem cópia
+void ssd1306_send_image(const uint8_t *image, int image_length) {
+    i2c_write_blocking(i2c1, ssd1306_i2c_address, image, image_length, false);
 }
 
 // Cria a lista de comandos (com base nos endereços definidos em ssd1306_i2c.h) para a inicialização do display
@@ -86,6 +95,18 @@ void ssd1306_init() {
     ssd1306_send_command_list(commands, count_of(commands));
 }
 
+// Ajusta o contraste (brilho) do display
+void ssd1306_set_contrast_level(uint8_t level) {
+    uint8_t commands[] = {ssd1306_set_contrast, level};
+
+    ssd1306_send_command_list(commands, count_of(commands));
+}
+
+// Liga ou desliga o painel; a memória do display (GDDRAM) é mantida enquanto desligado
+void ssd1306_set_power(bool on) {
+    ssd1306_send_command(ssd1306_set_display | (on ? 0x01 : 0x00));
+}
+
 // Cria a lista de comandos para configurar o scrolling
 void ssd1306_scroll(bool set) {
     uint8_t commands[] = {
@@ -202,6 +223,19 @@ void ssd1306_draw_string(uint8_t *ssd, int16_t x, int16_t y, const char *string)
     }
 }
 
+// Desenha uma string numa faixa de uma página com largura arbitrária e retorna a largura ocupada
+int ssd1306_draw_string_strip(uint8_t *strip, int strip_width, const char *string) {
+    int x = 0;
+
+    while (*string && x <= strip_width - 8) {
+        int idx = ssd1306_get_font(toupper((uint8_t)*string++));
+        memcpy(&strip[x], &font[idx * 8], 8);
+        x += 8;
+    }
+
+    return x;
+}
+
 // Comando de configuração com base na estrutura ssd1306_t
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
   ssd->port_buffer[1] = command;
@@ -246,7 +280,9 @@ void ssd1306_init_bm(ssd1306_t *ssd, uint8_t width, uint8_t height, bool externa
     ssd->address = address;
     ssd->i2c_port = i2c;
     ssd->bufsize = ssd->pages * ssd->width + 1;
-    ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+    assert(ssd->bufsize <= sizeof(bitmap_buffer));
+    ssd->ram_buffer = bitmap_buffer;
+    memset(ssd->ram_buffer, 0, ssd->bufsize);
     ssd->ram_buffer[0] = 0x40;
     ssd->port_buffer[0] = 0x80;
 }
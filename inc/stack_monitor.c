@@ -0,0 +1,114 @@
+/**
+ * @file stack_monitor.c
+ * @brief Implementação da marca d'água das pilhas.
+ *
+ * As pilhas vêm do script de ligação do SDK: a do núcleo 0 termina em
+ * __StackTop (SCRATCH_Y) e a do núcleo 1, lançada sem pilha própria, ocupa
+ * [__StackOneBottom, __StackOneTop) (SCRATCH_X).
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "stack_monitor.h"
+#include "usb_console.h"
+
+#if PICO_ON_DEVICE
+extern uint32_t __StackBottom[], __StackTop[];
+extern uint32_t __StackOneBottom[], __StackOneTop[];
+
+static uint32_t *const stack_bottom[2] = {__StackBottom, __StackOneBottom};
+static uint32_t *const stack_top[2] = {__StackTop, __StackOneTop};
+
+static bool painted = false;
+
+// Pinta [bottom, end) palavra a palavra, sem chamar funções que usem a pilha pintada
+static void paint(uint32_t *bottom, uint32_t *end) {
+    for (volatile uint32_t *p = bottom; p < end; p++) {
+        *p = STACK_MONITOR_PATTERN;
+    }
+}
+#endif
+
+#if EVENT_LOOP_FREERTOS
+static TaskHandle_t tasks[STACK_MONITOR_MAX_TASKS];
+static uint8_t task_count = 0;
+#endif
+
+void stack_monitor_paint(void) {
+#if PICO_ON_DEVICE
+    uint32_t *sp;
+    __asm volatile("mov %0, sp" : "=r"(sp));
+
+    // Núcleo 0: só abaixo do quadro atual, com uma margem para esta função
+    paint(stack_bottom[0], sp - 16);
+    paint(stack_bottom[1], stack_top[1]);
+    painted = true;
+#endif
+}
+
+bool stack_monitor_usage(uint core, struct stack_usage *usage) {
+#if PICO_ON_DEVICE
+    if (!painted || core > 1) {
+        return false;
+    }
+
+    const uint32_t *p = stack_bottom[core];
+    while (p < stack_top[core] && *p == STACK_MONITOR_PATTERN) {
+        p++;
+    }
+    usage->size = (uint32_t)(stack_top[core] - stack_bottom[core]) * sizeof(uint32_t);
+    usage->used = (uint32_t)(stack_top[core] - p) * sizeof(uint32_t);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void stack_monitor_print(void) {
+    for (uint core = 0; core < 2; core++) {
+        struct stack_usage usage;
+        if (!stack_monitor_usage(core, &usage)) {
+            printf("Pilha do núcleo %u: não pintada\n", core);
+            continue;
+        }
+
+        printf("Pilha do núcleo %u: %u de %u bytes usados", core, (unsigned)usage.used, (unsigned)usage.size);
+        if (usage.used >= usage.size) {
+            printf(" (fundo atingido: possível estouro)\n");
+        } else if (usage.size - usage.used < STACK_MONITOR_WARN_BYTES) {
+            printf(" (folga de apenas %u bytes)\n", (unsigned)(usage.size - usage.used));
+        } else {
+            printf("\n");
+        }
+    }
+
+#if EVENT_LOOP_FREERTOS
+    for (int i = 0; i < task_count; i++) {
+        printf("Tarefa %s: folga mínima de %u bytes\n", pcTaskGetName(tasks[i]),
+               (unsigned)(uxTaskGetStackHighWaterMark(tasks[i]) * sizeof(StackType_t)));
+    }
+#endif
+}
+
+#if EVENT_LOOP_FREERTOS
+void stack_monitor_watch_task(TaskHandle_t task) {
+    if (task != NULL && task_count < STACK_MONITOR_MAX_TASKS) {
+        tasks[task_count++] = task;
+    }
+}
+#endif
+
+static void stack_command(const char *args) {
+    stack_monitor_print();
+}
+
+static const struct usb_console_command stack_console_command = {
+    "stack", "uso máximo das pilhas desde o boot", stack_command
+};
+
+void stack_monitor_init(void) {
+    usb_console_register(&stack_console_command);
+}
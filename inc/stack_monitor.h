@@ -0,0 +1,68 @@
+#ifndef STACK_MONITOR_H
+#define STACK_MONITOR_H
+
+/**
+ * @file stack_monitor.h
+ * @brief Marca d'água das pilhas dos dois núcleos.
+ *
+ * No início de main() a parte livre das pilhas é preenchida com um padrão
+ * conhecido; a região em que o padrão foi sobrescrito é o máximo já usado
+ * desde o boot, incluindo as interrupções atendidas pelo núcleo. A leitura
+ * percorre a pilha a partir do fundo, sem custo nos caminhos monitorados, e
+ * é exibida pelo comando "stack" do console USB e no relatório periódico.
+ * Na variante FreeRTOS, as pilhas dos núcleos são as das interrupções e as
+ * tarefas registradas são informadas pela marca d'água do próprio FreeRTOS.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define STACK_MONITOR_PATTERN 0x5AC3A55Cu  ///< Palavra de pintura das pilhas
+#define STACK_MONITOR_WARN_BYTES 256       ///< Folga abaixo da qual o relatório avisa
+#define STACK_MONITOR_MAX_TASKS 4          ///< Tarefas FreeRTOS acompanhadas
+
+/**
+ * @brief Uso de uma pilha desde a pintura.
+ */
+struct stack_usage {
+    uint32_t size;       ///< Bytes reservados para a pilha
+    uint32_t used;       ///< Máximo usado; igual a size se o fundo foi atingido
+};
+
+/**
+ * @brief Pinta as pilhas dos dois núcleos.
+ *
+ * Deve ser a primeira chamada de main(), antes do lançamento do núcleo 1.
+ */
+void stack_monitor_paint(void);
+
+/**
+ * @brief Registra o comando "stack" no console USB.
+ */
+void stack_monitor_init(void);
+
+/**
+ * @brief Lê o uso máximo da pilha de um núcleo.
+ *
+ * @return false se a pilha não foi pintada (ou na simulação).
+ */
+bool stack_monitor_usage(uint core, struct stack_usage *usage);
+
+/**
+ * @brief Exibe o uso das pilhas pela USB.
+ */
+void stack_monitor_print(void);
+
+#if EVENT_LOOP_FREERTOS
+#include "FreeRTOS.h"
+#include "task.h"
+
+/**
+ * @brief Inclui uma tarefa no relatório.
+ */
+void stack_monitor_watch_task(TaskHandle_t task);
+#endif
+
+#endif // STACK_MONITOR_H
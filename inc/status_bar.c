@@ -0,0 +1,171 @@
+/**
+ * @file status_bar.c
+ * @brief Implementação da barra de status persistente do display OLED.
+ *
+ * A barra é mantida em um buffer de uma página. A cada STATUS_BAR_REFRESH_MS
+ * os campos são formatados e somente aqueles cujo texto mudou são enviados,
+ * cada um como uma área de renderização própria. A atualização é adiada
+ * para o ciclo seguinte enquanto uma tela está sendo enviada.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "display_oled.h"
+#include "event_loop.h"
+#include "ssd1306.h"
+#include "status_bar.h"
+
+// Campos da barra, na ordem em que aparecem
+enum {
+    FIELD_RSSI,
+    FIELD_LINK,
+    FIELD_PENDING,
+    FIELD_LAST_ALERT,
+    FIELD_UPTIME,
+    FIELD_COUNT
+};
+
+// Posição e último texto desenhado de cada campo
+struct status_field {
+    uint8_t column;  // Coluna inicial, em caracteres
+    uint8_t chars;   // Largura, em caracteres
+    char text[4];    // Último texto enviado ao display
+};
+
+static struct status_field fields[FIELD_COUNT] = {
+    [FIELD_RSSI]       = {0, 3},   // "-67"
+    [FIELD_LINK]       = {4, 2},   // "OK" ou "--"
+    [FIELD_PENDING]    = {7, 1},   // "0" a "9"
+    [FIELD_LAST_ALERT] = {9, 3},   // "12M", "3H", "--"
+    [FIELD_UPTIME]     = {13, 3},  // "45M", "7D"
+};
+
+static uint8_t bar[ssd1306_width];          // Conteúdo da página da barra
+static struct event_timer bar_timer;
+static volatile int32_t wifi_rssi = 0;      // Último RSSI lido (0 = desconhecido)
+static volatile int wifi_link = CYW43_LINK_DOWN;
+static volatile uint pending_alerts = 0;
+static volatile bool alert_delivered = false;
+static volatile uint32_t last_alert_s = 0;  // Segundos desde o boot no último alerta entregue
+static absolute_time_t last_rssi_time;
+
+// Formata uma duração em no máximo 3 caracteres (minutos, horas ou dias)
+static void format_duration(char *out, uint32_t seconds) {
+    uint32_t minutes = seconds / 60;
+
+    if (minutes < 100) {
+        snprintf(out, 4, "%uM", (unsigned)minutes);
+    }
+    else if (minutes / 60 < 100) {
+        snprintf(out, 4, "%uH", (unsigned)(minutes / 60));
+    }
+    else {
+        uint32_t days = minutes / (60 * 24);
+        snprintf(out, 4, "%uD", (unsigned)(days > 99 ? 99 : days));
+    }
+}
+
+// Redesenha um campo apenas se o texto mudou, enviando somente a sua área
+static void update_field(struct status_field *field, const char *text) {
+    if (strncmp(field->text, text, sizeof(field->text)) == 0) {
+        return;
+    }
+    snprintf(field->text, sizeof(field->text), "%s", text);
+
+    int x = field->column * 8;
+    memset(&bar[x], 0, field->chars * 8);
+    for (int i = 0; i < field->chars && text[i]; i++) {
+        ssd1306_draw_char(bar, x + i * 8, 0, text[i]);
+    }
+
+    struct render_area area = {
+        .start_column = x,
+        .end_column = x + field->chars * 8 - 1,
+        .start_page = STATUS_BAR_PAGE,
+        .end_page = STATUS_BAR_PAGE
+    };
+
+    calculate_render_area_buffer_length(&area);
+    render_on_display(&bar[x], &area);
+}
+
+// Formata todos os campos e envia os que mudaram
+static void status_bar_handler(void *arg) {
+    if (display_is_busy()) {
+        return; // Cede o barramento às telas de alerta
+    }
+    if (!display_is_awake()) {
+        return; // Painel apagado: os campos são atualizados quando ele acender
+    }
+
+    char text[4];
+    uint32_t uptime = to_ms_since_boot(get_absolute_time()) / 1000;
+
+    if (wifi_link == CYW43_LINK_UP && wifi_rssi < 0) {
+        snprintf(text, sizeof(text), "%d", (int)(wifi_rssi < -99 ? -99 : wifi_rssi));
+    }
+    else {
+        strcpy(text, "---");
+    }
+    update_field(&fields[FIELD_RSSI], text);
+
+    update_field(&fields[FIELD_LINK], wifi_link == CYW43_LINK_UP ? "OK" : "--");
+
+    snprintf(text, sizeof(text), "%u", pending_alerts > 9 ? 9 : pending_alerts);
+    update_field(&fields[FIELD_PENDING], text);
+
+    if (alert_delivered) {
+        format_duration(text, uptime - last_alert_s);
+    }
+    else {
+        strcpy(text, "--");
+    }
+    update_field(&fields[FIELD_LAST_ALERT], text);
+
+    format_duration(text, uptime);
+    update_field(&fields[FIELD_UPTIME], text);
+}
+
+void status_bar_init(void) {
+    memset(bar, 0, sizeof(bar));
+    for (int i = 0; i < FIELD_COUNT; i++) {
+        fields[i].text[0] = '\xff'; // Força o primeiro desenho de todos os campos
+    }
+
+    status_bar_handler(NULL);
+    event_timer_start(&bar_timer, STATUS_BAR_REFRESH_MS, STATUS_BAR_REFRESH_MS, status_bar_handler, NULL);
+}
+
+void status_bar_poll(void) {
+    wifi_link = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+
+    // A leitura do RSSI é uma consulta ao chip Wi-Fi, feita fora da interrupção e com pouca frequência
+    if (wifi_link == CYW43_LINK_UP &&
+        (is_nil_time(last_rssi_time) ||
+         absolute_time_diff_us(last_rssi_time, get_absolute_time()) >= STATUS_BAR_RSSI_MS * 1000))
+    {
+        int32_t rssi;
+        if (cyw43_wifi_get_rssi(&cyw43_state, &rssi) == 0) {
+            wifi_rssi = rssi;
+        }
+        last_rssi_time = get_absolute_time();
+    }
+}
+
+int32_t status_bar_rssi(void) {
+    return wifi_rssi;
+}
+
+void status_bar_set_pending(uint pending) {
+    pending_alerts = pending;
+}
+
+void status_bar_alert_delivered(void) {
+    last_alert_s = to_ms_since_boot(get_absolute_time()) / 1000;
+    alert_delivered = true;
+}
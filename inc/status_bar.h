@@ -0,0 +1,57 @@
+#ifndef STATUS_BAR_H
+#define STATUS_BAR_H
+
+/**
+ * @file status_bar.h
+ * @brief Barra de status persistente na primeira linha do display OLED.
+ *
+ * A barra mostra, da esquerda para a direita, o RSSI do Wi-Fi, o estado do
+ * enlace, a quantidade de alertas pendentes, o tempo desde o último alerta
+ * entregue e o tempo ligado. Cada campo é redesenhado apenas quando o seu
+ * texto muda, como uma atualização parcial da página 0 do display.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define STATUS_BAR_PAGE       0      ///< Página do display ocupada pela barra
+#define STATUS_BAR_REFRESH_MS 1000   ///< Intervalo mínimo entre atualizações da barra
+#define STATUS_BAR_RSSI_MS    10000  ///< Intervalo entre leituras do RSSI no laço principal
+
+/**
+ * @brief Desenha a barra de status e inicia a sua atualização periódica.
+ *
+ * Deve ser chamada depois de display_init().
+ */
+void status_bar_init(void);
+
+/**
+ * @brief Coleta as informações do Wi-Fi que não podem ser lidas em interrupção.
+ *
+ * Deve ser chamada periodicamente pelo laço principal.
+ */
+void status_bar_poll(void);
+
+/**
+ * @brief Último RSSI lido por status_bar_poll(), em dBm, ou 0 se desconhecido.
+ */
+int32_t status_bar_rssi(void);
+
+/**
+ * @brief Informa a quantidade de alertas aguardando envio.
+ *
+ * O campo é redesenhado na próxima atualização da barra, que só envia os
+ * campos alterados e espera o fim de uma tela de alerta em andamento.
+ *
+ * @param pending Número de alertas pendentes.
+ */
+void status_bar_set_pending(uint pending);
+
+/**
+ * @brief Registra o instante em que um alerta foi entregue com sucesso.
+ */
+void status_bar_alert_delivered(void);
+
+#endif // STATUS_BAR_H
@@ -0,0 +1,130 @@
+/**
+ * @file supervisor.c
+ * @brief Implementação do supervisor de saúde com o watchdog.
+ *
+ * Registradores de rascunho usados (os de 4 a 7 são reservados ao bootrom):
+ * - scratch[0]: SUPERVISOR_MAGIC, indica que os demais são válidos
+ * - scratch[1]: máscara dos subsistemas atrasados no momento da falha
+ * - scratch[2]: atraso, em ms, do subsistema mais atrasado
+ * - scratch[3]: resets consecutivos causados pelo supervisor, zerado depois
+ *   de SUPERVISOR_SETTLE_MS sem atrasos
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "hardware/watchdog.h"
+#include "event_loop.h"
+#include "hot_path.h"
+#include "supervisor.h"
+
+#define SUPERVISOR_MAGIC 0x5AFE0036u
+
+// Prazo máximo entre duas apresentações de cada subsistema
+static const uint32_t deadlines_ms[SUPERVISOR_COUNT] = {
+    [SUPERVISOR_INPUT]   = 1000,
+    [SUPERVISOR_NETWORK] = 5000,
+    [SUPERVISOR_DISPLAY] = 3000,
+};
+
+static const char *const names[SUPERVISOR_COUNT] = {
+    [SUPERVISOR_INPUT]   = "entrada",
+    [SUPERVISOR_NETWORK] = "rede",
+    [SUPERVISOR_DISPLAY] = "display",
+};
+
+static volatile uint32_t last_checkin_us[SUPERVISOR_COUNT];
+static struct repeating_timer feed_timer;
+static struct event_timer heartbeat_timers[SUPERVISOR_COUNT];
+static bool recovered = false;
+static uint32_t failed_mask = 0;
+static uint32_t failed_late_ms = 0;
+static uint32_t reset_count = 0;
+static uint32_t healthy_since_us;  // Início do período com todos os subsistemas no prazo
+
+// Alimenta o watchdog somente se todos os subsistemas estão dentro do prazo
+static bool feed_callback(struct repeating_timer *t) {
+    uint32_t now = time_us_32();
+    uint32_t mask = 0;
+    uint32_t worst_ms = 0;
+
+    for (int i = 0; i < SUPERVISOR_COUNT; i++) {
+        uint32_t age_ms = (now - last_checkin_us[i]) / 1000;
+        if (age_ms > deadlines_ms[i]) {
+            mask |= 1u << i;
+            if (age_ms > worst_ms) worst_ms = age_ms;
+        }
+    }
+
+    if (mask == 0) {
+        watchdog_update();
+        if (reset_count && now - healthy_since_us >= SUPERVISOR_SETTLE_MS * 1000u) {
+            reset_count = 0; // Estável de novo: o próximo reset começa uma nova sequência
+            watchdog_hw->scratch[3] = 0;
+        }
+        return true;
+    }
+    healthy_since_us = now;
+
+    // Grava o estado para o próximo boot e deixa o watchdog expirar
+    watchdog_hw->scratch[0] = SUPERVISOR_MAGIC;
+    watchdog_hw->scratch[1] = mask;
+    watchdog_hw->scratch[2] = worst_ms;
+    watchdog_hw->scratch[3] = reset_count + 1;
+    return false;
+}
+
+static void heartbeat_handler(void *arg) {
+    supervisor_checkin((enum supervisor_subsystem)(uintptr_t)arg);
+}
+
+void supervisor_init(void) {
+    // Os registradores de rascunho sobrevivem ao reset do watchdog, mas não à energização
+    if (watchdog_enable_caused_reboot() && watchdog_hw->scratch[0] == SUPERVISOR_MAGIC) {
+        recovered = true;
+        failed_mask = watchdog_hw->scratch[1];
+        failed_late_ms = watchdog_hw->scratch[2];
+        reset_count = watchdog_hw->scratch[3];
+    }
+    watchdog_hw->scratch[0] = 0;
+    watchdog_hw->scratch[3] = reset_count;
+
+    // Todos os subsistemas têm o prazo completo para a primeira apresentação
+    uint32_t now = time_us_32();
+    for (int i = 0; i < SUPERVISOR_COUNT; i++) {
+        last_checkin_us[i] = now;
+    }
+    healthy_since_us = now;
+
+    watchdog_enable(SUPERVISOR_WATCHDOG_MS, true);
+    add_repeating_timer_ms(SUPERVISOR_FEED_MS, feed_callback, NULL, &feed_timer);
+}
+
+void HOT_PATH(supervisor_checkin)(enum supervisor_subsystem subsystem) {
+    last_checkin_us[subsystem] = time_us_32();
+}
+
+void supervisor_watch_loop(enum supervisor_subsystem subsystem) {
+    event_timer_start(&heartbeat_timers[subsystem], SUPERVISOR_HEARTBEAT_MS, SUPERVISOR_HEARTBEAT_MS,
+                      heartbeat_handler, (void *)(uintptr_t)subsystem);
+}
+
+bool supervisor_recovered(void) {
+    return recovered;
+}
+
+void supervisor_print_reset(void) {
+    if (!recovered) {
+        return;
+    }
+
+    printf("Reinício pelo watchdog (%u consecutivos): ", (unsigned)reset_count);
+    for (int i = 0; i < SUPERVISOR_COUNT; i++) {
+        if (failed_mask & (1u << i)) {
+            printf("%s ", names[i]);
+        }
+    }
+    printf("sem resposta há %u ms\n", (unsigned)failed_late_ms);
+}
@@ -0,0 +1,64 @@
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+/**
+ * @file supervisor.h
+ * @brief Supervisor de saúde dos subsistemas com o watchdog do RP2040.
+ *
+ * Cada subsistema monitorado se apresenta periodicamente com
+ * supervisor_checkin(). Um alarme alimenta o watchdog apenas enquanto todos se
+ * apresentaram dentro dos seus prazos; se algum travar, o estado é gravado nos
+ * registradores de rascunho do watchdog (preservados no reset) e a
+ * alimentação é interrompida, reiniciando o dispositivo. A contagem de
+ * resets consecutivos volta a zero depois de SUPERVISOR_SETTLE_MS com todos
+ * os subsistemas dentro do prazo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define SUPERVISOR_WATCHDOG_MS  3000  ///< Tempo sem alimentação até o reset
+#define SUPERVISOR_FEED_MS      250   ///< Intervalo de verificação e alimentação
+#define SUPERVISOR_HEARTBEAT_MS 500   ///< Período das apresentações de supervisor_watch_loop()
+#define SUPERVISOR_SETTLE_MS    60000 ///< Tempo sem atrasos que encerra uma sequência de resets
+
+// Subsistemas monitorados
+enum supervisor_subsystem {
+    SUPERVISOR_INPUT,    ///< Leitura dos botões (laço da interface)
+    SUPERVISOR_NETWORK,  ///< Laço da rede (Wi-Fi, lwIP, envio)
+    SUPERVISOR_DISPLAY,  ///< Display (temporizador de inatividade)
+    SUPERVISOR_COUNT
+};
+
+/**
+ * @brief Informa a causa do último reset e arma o watchdog.
+ *
+ * Deve ser chamada no início de main(), antes da inicialização dos subsistemas.
+ */
+void supervisor_init(void);
+
+/**
+ * @brief Registra que um subsistema está funcionando.
+ */
+void supervisor_checkin(enum supervisor_subsystem subsystem);
+
+/**
+ * @brief Apresenta um subsistema periodicamente a partir do laço de eventos do núcleo atual.
+ *
+ * Usado quando a prova de vida do subsistema é o próprio laço continuar girando.
+ */
+void supervisor_watch_loop(enum supervisor_subsystem subsystem);
+
+/**
+ * @brief Informa se o dispositivo voltou de um reset causado pelo supervisor.
+ */
+bool supervisor_recovered(void);
+
+/**
+ * @brief Exibe no monitor serial a causa do último reset.
+ */
+void supervisor_print_reset(void);
+
+#endif // SUPERVISOR_H
@@ -0,0 +1,74 @@
+/**
+ * @file time_sync.c
+ * @brief Implementação da hora local pelo SNTP e pelo RTC.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <time.h>
+
+#include "hardware/rtc.h"
+#include "lwip/apps/sntp.h"
+#include "pico/cyw43_arch.h"
+#include "log.h"
+#include "time_sync.h"
+
+#define SECONDS_PER_DAY 86400
+
+static bool rtc_started = false;
+static volatile bool valid = false;   // RTC com a hora do servidor
+
+void time_sync_start(void) {
+    if (!rtc_started) {
+        rtc_init();
+        rtc_started = true;
+    }
+
+    cyw43_arch_lwip_begin();
+    if (sntp_enabled()) {
+        sntp_stop();
+    }
+    sntp_setoperatingmode(SNTP_OPMODE_POLL);
+    sntp_setservername(0, TIME_SYNC_SERVER);
+    sntp_init();
+    cyw43_arch_lwip_end();
+}
+
+void time_sync_invalidate(void) {
+    valid = false;
+}
+
+void time_sync_set(uint32_t seconds) {
+    time_t local = (time_t)seconds + TIME_SYNC_UTC_OFFSET_S;
+    struct tm tm;
+    gmtime_r(&local, &tm);
+
+    datetime_t now = {
+        .year = (int16_t)(tm.tm_year + 1900),
+        .month = (int8_t)(tm.tm_mon + 1),
+        .day = (int8_t)tm.tm_mday,
+        .dotw = (int8_t)tm.tm_wday,
+        .hour = (int8_t)tm.tm_hour,
+        .min = (int8_t)tm.tm_min,
+        .sec = (int8_t)tm.tm_sec,
+    };
+    if (!rtc_set_datetime(&now)) {
+        return;
+    }
+    if (!valid) {
+        LOG("Hora sincronizada pelo SNTP: %02d:%02d:%02d\n", tm.tm_hour, tm.tm_min, tm.tm_sec);
+    }
+    valid = true;
+}
+
+int32_t time_sync_seconds_of_day(uint32_t age_us) {
+    datetime_t now;
+    if (!valid || !rtc_get_datetime(&now)) {
+        return -1;
+    }
+
+    int32_t seconds = now.hour * 3600 + now.min * 60 + now.sec - (int32_t)(age_us / 1000000);
+    seconds %= SECONDS_PER_DAY;
+    return seconds < 0 ? seconds + SECONDS_PER_DAY : seconds;
+}
@@ -0,0 +1,55 @@
+#ifndef TIME_SYNC_H
+#define TIME_SYNC_H
+
+/**
+ * @file time_sync.h
+ * @brief Hora local pelo SNTP, mantida no RTC do RP2040.
+ *
+ * Usa a aplicação SNTP do lwIP no modo de consulta: a resposta do servidor
+ * chega pelo gancho SNTP_SET_SYSTEM_TIME (inc/lwipopts.h), que grava a data
+ * e a hora locais no RTC; o lwIP repete a consulta a cada hora. Até a
+ * primeira resposta a hora é desconhecida.
+ *
+ * O RTC para junto com os relógios no dormant (inc/low_power.h): a hora é
+ * descartada antes de dormir e consultada de novo quando o Wi-Fi religa.
+ *
+ * time_sync_start() e time_sync_invalidate() rodam no núcleo 0; a leitura
+ * pode ser feita de qualquer núcleo.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define TIME_SYNC_SERVER       "pool.ntp.org"  ///< Servidor NTP, resolvido pelo DNS
+#define TIME_SYNC_UTC_OFFSET_S (-3 * 3600)     ///< Fuso horário local (Brasília, sem horário de verão)
+
+/**
+ * @brief Inicia (ou reinicia, com consulta imediata) o SNTP.
+ *
+ * Deve ser chamada com o enlace Wi-Fi ativo.
+ */
+void time_sync_start(void);
+
+/**
+ * @brief Descarta a hora do RTC, antes de o relógio parar.
+ */
+void time_sync_invalidate(void);
+
+/**
+ * @brief Grava no RTC a hora recebida do servidor (gancho do lwIP).
+ *
+ * @param seconds Segundos desde 1970-01-01 00:00 UTC.
+ */
+void time_sync_set(uint32_t seconds);
+
+/**
+ * @brief Hora local de um instante passado, em segundos desde a meia-noite.
+ *
+ * @param age_us Tempo decorrido desde o instante, em microssegundos.
+ * @return Segundos desde a meia-noite, ou -1 se a hora é desconhecida.
+ */
+int32_t time_sync_seconds_of_day(uint32_t age_us);
+
+#endif // TIME_SYNC_H
@@ -0,0 +1,124 @@
+/**
+ * @file trace.c
+ * @brief Implementação dos histogramas de latência da entrega dos alertas.
+ *
+ * Só o laço do núcleo 0 lê os anéis. Um registro pode ser sobrescrito pelo
+ * núcleo dono enquanto é lido se o anel der a volta nesse intervalo; com
+ * TRACE_RING_SIZE registros e o esvaziamento a cada TRACE_COLLECT_MS isso
+ * exigiria dezenas de alertas por segundo, e o registro perdido é contado.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event_loop.h"
+#include "trace.h"
+#include "usb_console.h"
+
+struct trace_ring trace_rings[2];
+volatile uint32_t trace_alert_origin_us;
+
+static uint32_t histograms[TRACE_POINT_COUNT][TRACE_BUCKETS];
+static uint32_t tails[2];  // Próximo registro a esvaziar de cada anel
+static uint32_t lost = 0;
+static struct event_timer collect_timer;
+
+static const char *const point_names[TRACE_POINT_COUNT] = {
+    [TRACE_EDGE]            = "borda",
+    [TRACE_DEQUEUE]         = "fila",
+    [TRACE_DNS_DONE]        = "dns",
+    [TRACE_TCP_CONNECTED]   = "tcp",
+    [TRACE_REQUEST_SENT]    = "requisicao",
+    [TRACE_RESPONSE_PARSED] = "resposta",
+    [TRACE_UI_DONE]         = "interface",
+};
+
+// Faixa do histograma: 0 para 0 us, n para [2^(n-1), 2^n) us
+static inline uint bucket_of(uint32_t latency_us) {
+    uint bucket = latency_us ? 32 - __builtin_clz(latency_us) : 0;
+    return bucket < TRACE_BUCKETS ? bucket : TRACE_BUCKETS - 1;
+}
+
+void trace_collect(void) {
+    for (int core = 0; core < 2; core++) {
+        struct trace_ring *ring = &trace_rings[core];
+        uint32_t head = ring->head;
+        __dmb();  // Lê os registros só depois do head publicado
+
+        if (head - tails[core] > TRACE_RING_SIZE) {
+            lost += head - tails[core] - TRACE_RING_SIZE;
+            tails[core] = head - TRACE_RING_SIZE;
+        }
+
+        for (; tails[core] != head; tails[core]++) {
+            const struct trace_record *record = &ring->records[tails[core] & (TRACE_RING_SIZE - 1)];
+            if (record->point < TRACE_POINT_COUNT) {
+                histograms[record->point][bucket_of(record->latency_us)]++;
+            }
+        }
+    }
+}
+
+void trace_dump(void) {
+    trace_collect();
+
+    printf("#trace begin\n");
+    for (int point = 0; point < TRACE_POINT_COUNT; point++) {
+        printf("H %s", point_names[point]);
+        for (int bucket = 0; bucket < TRACE_BUCKETS; bucket++) {
+            printf(" %u", (unsigned)histograms[point][bucket]);
+        }
+        printf("\n");
+    }
+
+    for (int core = 0; core < 2; core++) {
+        const struct trace_ring *ring = &trace_rings[core];
+        uint32_t head = ring->head;
+        __dmb();
+        uint32_t first = head > TRACE_RING_SIZE ? head - TRACE_RING_SIZE : 0;
+
+        for (uint32_t i = first; i != head; i++) {
+            struct trace_record record = ring->records[i & (TRACE_RING_SIZE - 1)];
+            if (record.point < TRACE_POINT_COUNT) {
+                printf("R %d %s %u %u\n", core, point_names[record.point],
+                       (unsigned)record.time_us, (unsigned)record.latency_us);
+            }
+        }
+    }
+
+    printf("L %u\n", (unsigned)lost);
+    printf("#trace end\n");
+}
+
+void trace_reset(void) {
+    trace_collect();
+    memset(histograms, 0, sizeof(histograms));
+    lost = 0;
+}
+
+static void collect_handler(void *arg) {
+    trace_collect();
+}
+
+// Comando "trace [reset]" do console USB
+static void trace_command(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        trace_reset();
+        printf("Histogramas de rastreio zerados.\n");
+    }
+    else {
+        trace_dump();
+    }
+}
+
+static const struct usb_console_command trace_console_command = {
+    "trace", "[reset] histogramas de latencia dos alertas", trace_command
+};
+
+void trace_init(void) {
+    event_timer_start(&collect_timer, TRACE_COLLECT_MS, TRACE_COLLECT_MS, collect_handler, NULL);
+    usb_console_register(&trace_console_command);
+}
@@ -0,0 +1,136 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/**
+ * @file trace.h
+ * @brief Pontos de rastreio da entrega de um alerta, do botão à confirmação.
+ *
+ * Cada ponto grava o valor bruto do temporizador de 64 bits (a palavra baixa,
+ * em microssegundos) e o atraso desde a borda do botão que originou o alerta
+ * em um anel por núcleo: um único produtor por anel, sem travas entre os
+ * núcleos. Dentro do núcleo o registro só mascara as interrupções pelas poucas
+ * instruções da escrita, pois alguns pontos são marcados nos callbacks do lwIP.
+ *
+ * O laço do núcleo 0 esvazia os dois anéis periodicamente em histogramas por
+ * etapa com faixas em potências de 2. O comando "trace" do console USB envia
+ * os histogramas e os registros recentes para tools/trace_report.py, que
+ * calcula os percentis.
+ *
+ * Os pontos ficam ativos também na versão de produção; TRACE_ENABLED=0 os
+ * remove na compilação.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "pico/sync.h"
+#include "hardware/structs/timer.h"
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 1
+#endif
+
+#define TRACE_RING_SIZE      64    ///< Registros por núcleo (potência de 2)
+#define TRACE_BUCKETS        24    ///< Faixas do histograma: [2^(n-1), 2^n) us, a última acumula o resto
+#define TRACE_COLLECT_MS     1000  ///< Intervalo entre os esvaziamentos dos anéis
+
+// Pontos de rastreio, na ordem em que um alerta passa por eles
+enum trace_point {
+    TRACE_EDGE,              ///< Borda do botão aceita (núcleo 1)
+    TRACE_DEQUEUE,           ///< Pedido retirado da fila pela rede (núcleo 0)
+    TRACE_DNS_DONE,          ///< Servidor resolvido ou IP já conhecido (núcleo 0)
+    TRACE_TCP_CONNECTED,     ///< Conexão TCP estabelecida (núcleo 0)
+    TRACE_REQUEST_SENT,      ///< Requisição HTTP entregue ao lwIP (núcleo 0)
+    TRACE_RESPONSE_PARSED,   ///< Resposta do servidor interpretada (núcleo 0)
+    TRACE_UI_DONE,           ///< Resultado exibido e sinalizado (núcleo 1)
+    TRACE_POINT_COUNT
+};
+
+/**
+ * @brief Registro de um ponto de rastreio.
+ */
+struct trace_record {
+    uint32_t time_us;     ///< Palavra baixa do temporizador no ponto
+    uint32_t latency_us;  ///< Atraso desde a borda que originou o alerta
+    uint8_t point;        ///< Um dos valores de trace_point
+};
+
+/**
+ * @brief Anel de registros de um núcleo.
+ */
+struct trace_ring {
+    struct trace_record records[TRACE_RING_SIZE];
+    volatile uint32_t head;  ///< Total de registros gravados (só o núcleo dono escreve)
+};
+
+extern struct trace_ring trace_rings[2];
+extern volatile uint32_t trace_alert_origin_us;
+
+/**
+ * @brief Marca um ponto de rastreio no anel do núcleo atual.
+ *
+ * @param point Ponto atingido.
+ * @param origin_us Instante da borda do botão que originou o alerta.
+ */
+static inline void trace_mark(enum trace_point point, uint32_t origin_us) {
+#if TRACE_ENABLED
+    uint32_t now = timer_hw->timerawl;
+    struct trace_ring *ring = &trace_rings[get_core_num()];
+
+    uint32_t status = save_and_disable_interrupts();
+    uint32_t head = ring->head;
+    struct trace_record *record = &ring->records[head & (TRACE_RING_SIZE - 1)];
+    record->time_us = now;
+    record->latency_us = now - origin_us;
+    record->point = (uint8_t)point;
+    __dmb();  // O registro fica visível ao outro núcleo antes do novo head
+    ring->head = head + 1;
+    restore_interrupts(status);
+#else
+    (void)point;
+    (void)origin_us;
+#endif
+}
+
+/**
+ * @brief Marca um ponto do alerta em envio, cuja origem foi definida por trace_set_alert_origin().
+ */
+static inline void trace_mark_alert(enum trace_point point) {
+    trace_mark(point, trace_alert_origin_us);
+}
+
+/**
+ * @brief Define a origem do alerta em envio, usada pelos pontos da pilha de rede.
+ */
+static inline void trace_set_alert_origin(uint32_t origin_us) {
+    trace_alert_origin_us = origin_us;
+}
+
+/**
+ * @brief Inicia o esvaziamento periódico dos anéis no laço do núcleo que a chama (núcleo 0).
+ */
+void trace_init(void);
+
+/**
+ * @brief Transfere os registros novos dos dois anéis para os histogramas.
+ */
+void trace_collect(void);
+
+/**
+ * @brief Envia pelo monitor serial os histogramas e os registros recentes.
+ *
+ * O formato, lido por tools/trace_report.py, é uma linha por item entre
+ * "#trace begin" e "#trace end":
+ * - "H <ponto> <n0> ... <n23>": contagens de cada faixa do histograma;
+ * - "R <núcleo> <ponto> <instante_us> <atraso_us>": registro ainda no anel;
+ * - "L <perdidos>": registros sobrescritos antes de serem esvaziados.
+ */
+void trace_dump(void);
+
+/**
+ * @brief Zera os histogramas e o contador de perdidos.
+ */
+void trace_reset(void);
+
+#endif // TRACE_H
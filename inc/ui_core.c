@@ -0,0 +1,394 @@
+/**
+ * @file ui_core.c
+ * @brief Implementação do núcleo 1: botões, display, buzzers e áudio.
+ *
+ * O núcleo 1 executa o seu próprio laço de eventos: a leitura dos botões, o
+ * letreiro, a barra de status e a inatividade do display são temporizadores
+ * desse laço, e os comandos do núcleo 0 são consumidos por uma função de
+ * verificação, acordada pelo SEV da fila. Apenas o sequenciador de sinais usa
+ * alarmes de hardware, do grupo criado neste núcleo.
+ *
+ * Na versão FreeRTOS (EVENT_LOOP_FREERTOS) o laço da interface é a tarefa
+ * "interface" e a leitura dos botões é a tarefa "entrada", ambas fixadas no
+ * núcleo 1; as filas SPSC dão lugar a filas limitadas do FreeRTOS.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "alert_service.h"
+#include "alert_template.h"
+#include "audio_clips.h"
+#include "audio_pwm.h"
+#include "boot_profile.h"
+#include "button_handler.h"
+#include "buzzer_led.h"
+#include "callmebot_whatsapp.h"
+#include "clock_governor.h"
+#include "config_store.h"
+#include "display_text.h"
+#include "event_loop.h"
+#include "flash_guard.h"
+#include "status_bar.h"
+#include "trace.h"
+#include "ui_core.h"
+#include "xip_profile.h"
+
+#if EVENT_LOOP_FREERTOS
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+#include "stack_monitor.h"
+#else
+#include "pico/multicore.h"
+#include "spsc_queue.h"
+#endif
+
+#if EVENT_LOOP_FREERTOS
+// Filas limitadas entre as tarefas
+static QueueHandle_t ui_to_net;  // Produtor: tarefa de entrada; consumidor: tarefa de alertas
+static QueueHandle_t net_to_ui;  // Produtores: tarefas de alertas e de entrada; consumidor: tarefa de interface
+static uint32_t dropped[2];
+static uint32_t received[2];
+static uint32_t latency_max_us[2];
+#else
+// Filas entre os núcleos: cada uma tem um único produtor e um único consumidor
+static struct spsc_queue ui_to_net;  // Produtor: laço do núcleo 1; consumidor: laço do núcleo 0
+static struct spsc_queue net_to_ui;  // Produtor: laço do núcleo 0; consumidor: laço do núcleo 1
+#endif
+
+static alarm_pool_t *alarm_pool = NULL;
+static volatile bool ui_ready = false;
+static uint pending_alerts = 0;  // Pedidos enfileirados ou em envio (alterado só pela interface)
+
+// Retorno dado ao usuário para o resultado de cada mensagem (0 = mensagem inicial)
+struct alert_feedback {
+    const struct display_screen *success;
+    const struct display_screen *fail;
+    void (*signal)(void);
+    const struct audio_clip *clip;
+};
+
+static const struct alert_feedback feedback[ALERT_MESSAGE_COUNT] = {
+    {&msg_init_success, &msg_init_fail, buzzer_led_init_success, NULL},
+    {&msg_1_success, &msg_1_fail, buzzer_led_msg_1, &audio_clip_mensagem_enviada},
+    {&msg_2_success, &msg_2_fail, buzzer_led_msg_2, &audio_clip_mensagem_enviada},
+    {&msg_3_success, &msg_3_fail, buzzer_led_msg_3, &audio_clip_mensagem_enviada},
+    {&msg_4_success, &msg_4_fail, buzzer_led_msg_4, &audio_clip_ajuda_a_caminho},
+};
+
+#if !EVENT_LOOP_FREERTOS
+static struct event_timer button_timer;
+#endif
+
+#if EVENT_LOOP_FREERTOS
+// Publica em uma fila do FreeRTOS sem bloquear e acorda o laço consumidor
+static bool queue_push(QueueHandle_t queue, int index, uint core, struct app_event *event)
+{
+    event->timestamp_us = time_us_32();
+    if (xQueueSend(queue, event, 0) != pdTRUE)
+    {
+        dropped[index]++;
+        return false;
+    }
+    event_loop_wake(core);
+    return true;
+}
+
+// Retira de uma fila do FreeRTOS sem bloquear, registrando a latência
+static bool queue_pop(QueueHandle_t queue, int index, struct app_event *event)
+{
+    if (xQueueReceive(queue, event, 0) != pdTRUE)
+    {
+        return false;
+    }
+    uint32_t latency = time_us_32() - event->timestamp_us;
+    received[index]++;
+    if (latency > latency_max_us[index])
+    {
+        latency_max_us[index] = latency;
+    }
+    return true;
+}
+
+#define push_to_net(event)  queue_push(ui_to_net, 0, 0, event)
+#define push_to_ui(event)   queue_push(net_to_ui, 1, 1, event)
+#define pop_from_net(event) queue_pop(ui_to_net, 0, event)
+#define pop_from_ui(event)  queue_pop(net_to_ui, 1, event)
+#else
+#define push_to_net(event)  spsc_queue_push(&ui_to_net, event)
+#define push_to_ui(event)   spsc_queue_push(&net_to_ui, event)
+#define pop_from_net(event) spsc_queue_pop(&ui_to_net, event)
+#define pop_from_ui(event)  spsc_queue_pop(&net_to_ui, event)
+#endif
+
+// Trata um comando vindo da rede ou o aceite de um botão
+static void ui_handle(const struct app_event *event)
+{
+    clock_governor_activity();
+
+    switch (event->type)
+    {
+    case APP_EVENT_BUTTON:
+        pending_alerts++;
+        status_bar_set_pending(pending_alerts);
+        display_wake();
+        break;
+
+    case APP_EVENT_SHOW_SCREEN:
+        display_show(event->screen);
+        break;
+
+    case APP_EVENT_SIGNAL_FAIL:
+        buzzer_led_fail();
+        break;
+
+    case APP_EVENT_ALERT_RESULT:
+    {
+        const struct alert_feedback *f = &feedback[event->message];
+
+        if (event->message > 0 && pending_alerts > 0)
+        {
+            pending_alerts--;
+            status_bar_set_pending(pending_alerts);
+        }
+
+        if (event->ok)
+        {
+            if (event->message > 0)
+            {
+                status_bar_alert_delivered();
+            }
+            display_show(f->success);
+            if (event->message > 0)
+            {
+                // O texto com os campos preenchidos como no envio; o letreiro o desenha já aqui
+                char text[DISPLAY_MARQUEE_MAX_CHARS + 1];
+                alert_template_format(config_get(CONFIG_MESSAGE + event->message),
+                                      &event->values, text, sizeof(text));
+                display_marquee_start(text, DISPLAY_MARQUEE_PAGE);
+            }
+            f->signal();
+            if (f->clip)
+            {
+                audio_play(f->clip);
+            }
+        }
+        else
+        {
+            display_show(f->fail);
+            display_marquee_stop();
+            buzzer_led_fail();
+        }
+        trace_mark(TRACE_UI_DONE, event->origin_us);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+// Consome os comandos da rede
+static bool ui_poll(void *arg)
+{
+    struct app_event event;
+    bool handled = false;
+
+    while (pop_from_ui(&event))
+    {
+        struct xip_window xip;
+        xip_profile_begin(&xip);
+        ui_handle(&event);
+        xip_profile_end(XIP_SUBSYSTEM_UI, &xip);
+        handled = true;
+    }
+    return handled;
+}
+
+// Etapas de inicialização dos periféricos de interface, executadas uma por vez pelo laço
+struct ui_init_stage {
+    void (*init)(void);
+    enum boot_stage stage;
+};
+
+static const struct ui_init_stage ui_init_stages[] = {
+    {buzzer_led_init, BOOT_STAGE_BUZZER},
+    {audio_pwm_init, BOOT_STAGE_AUDIO},
+    {display_init, BOOT_STAGE_DISPLAY},
+    {status_bar_init, BOOT_STAGE_STATUS_BAR},
+};
+
+// Executa uma etapa e agenda a seguinte, deixando a leitura dos botões rodar entre elas
+static void ui_init_next(void *arg)
+{
+    uint index = (uint)(uintptr_t)arg;
+
+    ui_init_stages[index].init();
+    boot_profile_mark(ui_init_stages[index].stage);
+
+    if (++index < count_of(ui_init_stages))
+    {
+        event_loop_post(ui_init_next, (void *)(uintptr_t)index);
+    }
+    else
+    {
+        // Interface pronta: passa a consumir os comandos da rede, inclusive os já enfileirados
+        event_loop_add_poll(ui_poll, NULL);
+    }
+}
+
+// Inicializa os periféricos de interface e executa o laço de eventos
+static void ui_run(void)
+{
+    // Os alarmes criados aqui disparam no núcleo 1
+    alarm_pool = alarm_pool_create_with_unused_hardware_alarm(UI_ALARM_POOL_TIMERS);
+    event_loop_init();
+
+#if !EVENT_LOOP_FREERTOS
+    // Os botões são monitorados antes de tudo; os pedidos ficam na fila até a rede subir
+    button_handler_init();
+    flash_guard_init();  // A partir daqui o núcleo 0 pode gravar a flash
+    event_timer_start(&button_timer, 0, BUTTON_POLL_MS, button_check_handler, NULL);
+    boot_profile_mark(BOOT_STAGE_INPUT_ARMED);
+    ui_ready = true;
+#endif
+
+    event_loop_post(ui_init_next, (void *)0);
+    event_loop_run(); // Dorme até o próximo prazo, interrupção do núcleo 1 ou aviso da rede
+}
+
+#if EVENT_LOOP_FREERTOS
+// Tarefa de interface: display, buzzers, LEDs e áudio
+static void ui_task(void *params)
+{
+    ui_run();
+}
+
+// Tarefa de entrada: leitura periódica dos botões, acima da interface em prioridade
+static void input_task(void *params)
+{
+    button_handler_init();
+    flash_guard_init();
+    boot_profile_mark(BOOT_STAGE_INPUT_ARMED);
+    ui_ready = true;
+
+    TickType_t last_wake = xTaskGetTickCount();
+    while (true)
+    {
+        button_check_handler(NULL);
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(BUTTON_POLL_MS));
+    }
+}
+
+void ui_core_launch(void)
+{
+    ui_to_net = xQueueCreate(ALERT_QUEUE_LENGTH, sizeof(struct app_event));
+    net_to_ui = xQueueCreate(UI_QUEUE_LENGTH, sizeof(struct app_event));
+
+    TaskHandle_t input, ui;
+    xTaskCreateAffinitySet(input_task, "entrada", INPUT_TASK_STACK_WORDS, NULL, INPUT_TASK_PRIORITY, 1 << 1, &input);
+    xTaskCreateAffinitySet(ui_task, "interface", UI_TASK_STACK_WORDS, NULL, UI_TASK_PRIORITY, 1 << 1, &ui);
+    stack_monitor_watch_task(input);
+    stack_monitor_watch_task(ui);
+
+    while (!ui_ready)
+    {
+        vTaskDelay(1);
+    }
+}
+#else
+// Ponto de entrada do núcleo 1
+static void ui_core_entry(void)
+{
+    ui_run();
+}
+
+void ui_core_launch(void)
+{
+    multicore_launch_core1(ui_core_entry);
+    while (!ui_ready)
+    {
+        tight_loop_contents();
+    }
+}
+#endif
+
+alarm_pool_t *ui_alarm_pool(void)
+{
+    return alarm_pool;
+}
+
+bool ui_post_button(uint8_t message, uint32_t origin_us)
+{
+    struct app_event event = {.type = APP_EVENT_BUTTON, .message = message, .origin_us = origin_us};
+
+    trace_mark(TRACE_EDGE, event.origin_us);
+    if (!push_to_net(&event))
+    {
+        return false;
+    }
+
+#if EVENT_LOOP_FREERTOS
+    push_to_ui(&event); // A tarefa de interface atualiza a barra e acorda o display
+#else
+    ui_handle(&event);  // Já estamos no laço da interface
+#endif
+    return true;
+}
+
+bool ui_is_idle(void)
+{
+    return pending_alerts == 0 && !display_is_awake() && !display_is_busy() && !buzzer_led_is_playing() &&
+           !audio_is_playing();
+}
+
+bool ui_next_request(struct app_event *event)
+{
+    return pop_from_net(event);
+}
+
+void ui_show(const struct display_screen *screen)
+{
+    struct app_event event = {.type = APP_EVENT_SHOW_SCREEN, .screen = screen};
+    push_to_ui(&event);
+}
+
+void ui_signal_fail(void)
+{
+    struct app_event event = {.type = APP_EVENT_SIGNAL_FAIL};
+    push_to_ui(&event);
+}
+
+void ui_alert_result(uint8_t message, bool ok, uint32_t origin_us, const struct alert_values *values)
+{
+    struct app_event event = {.type = APP_EVENT_ALERT_RESULT, .message = message, .ok = ok, .origin_us = origin_us,
+                              .values = *values};
+    push_to_ui(&event);
+}
+
+void ui_print_queue_stats(void)
+{
+    const char *names[] = {"interface -> rede", "rede -> interface"};
+
+#if EVENT_LOOP_FREERTOS
+    for (int i = 0; i < 2; i++)
+    {
+        printf("Fila %s: %u eventos, %u descartados, latencia maxima %u us\n",
+               names[i], (unsigned)received[i], (unsigned)dropped[i], (unsigned)latency_max_us[i]);
+    }
+#else
+    const struct spsc_queue *queues[] = {&ui_to_net, &net_to_ui};
+
+    for (int i = 0; i < 2; i++)
+    {
+        const struct spsc_queue *q = queues[i];
+        printf("Fila %s: %u eventos, %u descartados, latencia media %u us, maxima %u us\n",
+               names[i], (unsigned)q->received, (unsigned)q->dropped,
+               (unsigned)(q->received ? q->latency_total_us / q->received : 0),
+               (unsigned)q->latency_max_us);
+    }
+#endif
+}
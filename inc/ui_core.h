@@ -0,0 +1,108 @@
+#ifndef UI_CORE_H
+#define UI_CORE_H
+
+/**
+ * @file ui_core.h
+ * @brief Interface com o núcleo 1, responsável por botões, display, buzzers e áudio.
+ *
+ * O núcleo 0 (Wi-Fi, lwIP e envio das mensagens) nunca acessa esses periféricos
+ * diretamente: ele publica comandos para o núcleo 1 e recebe dele os pedidos de
+ * alerta, sempre por filas SPSC sem travas. Assim o trabalho de interface nunca
+ * atrasa o envio de um alerta, e vice-versa.
+ *
+ * Na versão FreeRTOS a mesma interface é atendida pelas tarefas de entrada e
+ * de interface, fixadas no núcleo 1, ligadas à tarefa de alertas por filas
+ * limitadas do FreeRTOS.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+#include "app_event.h"
+#include "display_oled.h"
+
+#define UI_ALARM_POOL_TIMERS 4  ///< Alarmes simultâneos no grupo do núcleo 1 (sequenciador de sinais)
+
+#if EVENT_LOOP_FREERTOS
+#define INPUT_TASK_PRIORITY     3     ///< Leitura dos botões: acima da interface
+#define UI_TASK_PRIORITY        2     ///< Display, buzzers, LEDs e áudio
+#define INPUT_TASK_STACK_WORDS  512   ///< Pilha da tarefa de entrada, em palavras
+#define UI_TASK_STACK_WORDS     1024  ///< Pilha da tarefa de interface, em palavras
+#define ALERT_QUEUE_LENGTH      8     ///< Pedidos de envio aguardando a tarefa de alertas
+#define UI_QUEUE_LENGTH         16    ///< Comandos aguardando a tarefa de interface
+#endif
+
+/**
+ * @brief Inicia o núcleo 1 e aguarda até que os botões estejam monitorados.
+ *
+ * Deve ser chamada pelo núcleo 0, logo após stdio_init_all(). Na versão
+ * FreeRTOS cria as tarefas de entrada e de interface e deve ser chamada pela
+ * tarefa de alertas.
+ */
+void ui_core_launch(void);
+
+/**
+ * @brief Grupo de alarmes cujos callbacks executam no núcleo 1.
+ *
+ * Reservado ao que precisa de precisão de interrupção, como os passos do
+ * sequenciador de sinais; os demais temporizadores da interface são do laço
+ * de eventos do núcleo 1.
+ */
+alarm_pool_t *ui_alarm_pool(void);
+
+/**
+ * @brief Núcleo 1: pede ao núcleo 0 o envio de uma mensagem.
+ *
+ * Também acorda o display e atualiza a contagem de pendências da barra de status.
+ *
+ * @param message Número da mensagem (1 a 4).
+ * @param origin_us Instante em que o acionamento foi lido.
+ * @return true se o pedido foi enfileirado.
+ */
+bool ui_post_button(uint8_t message, uint32_t origin_us);
+
+/**
+ * @brief Núcleo 1: informa se a interface está ociosa.
+ *
+ * Sem pedidos pendentes, com o painel apagado e sem sinal ou áudio tocando.
+ */
+bool ui_is_idle(void);
+
+/**
+ * @brief Núcleo 0: retira o próximo pedido de envio de mensagem.
+ *
+ * @param event Recebe o pedido.
+ * @return true se havia um pedido.
+ */
+bool ui_next_request(struct app_event *event);
+
+/**
+ * @brief Núcleo 0: pede ao núcleo 1 que exiba uma tela de status.
+ */
+void ui_show(const struct display_screen *screen);
+
+/**
+ * @brief Núcleo 0: pede ao núcleo 1 o sinal sonoro e visual de falha.
+ */
+void ui_signal_fail(void);
+
+/**
+ * @brief Núcleo 0: informa ao núcleo 1 o resultado do envio de uma mensagem.
+ *
+ * O núcleo 1 exibe a tela, toca o sinal e o áudio correspondentes.
+ *
+ * @param message Número da mensagem (0 = mensagem inicial).
+ * @param ok true se a mensagem foi entregue.
+ * @param origin_us Instante da borda do botão que originou o alerta.
+ * @param values Campos usados no envio; copiados no evento, pois o núcleo 0
+ *               os reescreve no próximo envio da mesma mensagem.
+ */
+void ui_alert_result(uint8_t message, bool ok, uint32_t origin_us, const struct alert_values *values);
+
+/**
+ * @brief Exibe as estatísticas das filas entre os núcleos no monitor serial.
+ */
+void ui_print_queue_stats(void);
+
+#endif // UI_CORE_H
@@ -0,0 +1,97 @@
+/**
+ * @file usb_console.c
+ * @brief Implementação do console de comandos pela USB.
+ *
+ * O aviso de caracteres disponíveis do stdio chega em interrupção e apenas
+ * publica a leitura no laço de eventos; a leitura e os comandos rodam em modo
+ * thread, sem bloquear.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event_loop.h"
+#include "usb_console.h"
+
+static const struct usb_console_command *commands[USB_CONSOLE_MAX_COMMANDS];
+static uint8_t command_count = 0;
+static char line[USB_CONSOLE_LINE_LENGTH + 1];
+static uint8_t line_length = 0;
+static uint console_core;
+static volatile bool read_posted = false;
+
+// Executa a linha recebida
+static void run_line(void) {
+    char *args = line;
+    while (*args && *args != ' ') {
+        args++;
+    }
+    if (*args) {
+        *args++ = '\0';
+        while (*args == ' ') {
+            args++;
+        }
+    }
+
+    if (line[0] == '\0') {
+        return;
+    }
+
+    if (strcmp(line, "help") == 0) {
+        for (int i = 0; i < command_count; i++) {
+            printf("  %-10s %s\n", commands[i]->name, commands[i]->help);
+        }
+        return;
+    }
+
+    for (int i = 0; i < command_count; i++) {
+        if (strcmp(line, commands[i]->name) == 0) {
+            commands[i]->handler(args);
+            return;
+        }
+    }
+    printf("Comando desconhecido: %s (use \"help\")\n", line);
+}
+
+// Lê os caracteres disponíveis no laço de eventos
+static void read_handler(void *arg) {
+    read_posted = false;
+
+    int c;
+    while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+        if (c == '\r' || c == '\n') {
+            line[line_length] = '\0';
+            line_length = 0;
+            run_line();
+        }
+        else if (line_length < USB_CONSOLE_LINE_LENGTH) {
+            line[line_length++] = (char)c;
+        }
+    }
+}
+
+// Chamado pelo stdio em interrupção quando chegam caracteres
+static void chars_available(void *arg) {
+    if (!read_posted) {
+        read_posted = true;
+        if (!event_loop_post_to(console_core, read_handler, NULL)) {
+            read_posted = false;
+        }
+    }
+}
+
+void usb_console_init(void) {
+    console_core = get_core_num();
+    stdio_set_chars_available_callback(chars_available, NULL);
+}
+
+bool usb_console_register(const struct usb_console_command *command) {
+    if (command_count >= USB_CONSOLE_MAX_COMMANDS) {
+        return false;
+    }
+    commands[command_count++] = command;
+    return true;
+}
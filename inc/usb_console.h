@@ -0,0 +1,45 @@
+#ifndef USB_CONSOLE_H
+#define USB_CONSOLE_H
+
+/**
+ * @file usb_console.h
+ * @brief Console de comandos de texto pela USB (CDC).
+ *
+ * Os caracteres recebidos pela USB acordam o laço de eventos do núcleo que
+ * iniciou o console; cada linha completa é separada em nome do comando e
+ * argumentos e entregue ao tratador registrado. O comando "help" lista os
+ * comandos disponíveis.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define USB_CONSOLE_MAX_COMMANDS  14   ///< Comandos registrados
+#define USB_CONSOLE_LINE_LENGTH   160  ///< Maior linha aceita, sem o terminador (cabe "config set" com um valor completo)
+
+/**
+ * @brief Comando do console.
+ *
+ * A estrutura pertence a quem a registra e deve permanecer válida.
+ */
+struct usb_console_command {
+    const char *name;                   ///< Primeira palavra da linha
+    const char *help;                   ///< Descrição exibida por "help"
+    void (*handler)(const char *args);  ///< Tratador; args aponta para o restante da linha
+};
+
+/**
+ * @brief Inicia o console no laço de eventos do núcleo que a chama.
+ */
+void usb_console_init(void);
+
+/**
+ * @brief Registra um comando.
+ *
+ * @return false se já há USB_CONSOLE_MAX_COMMANDS comandos.
+ */
+bool usb_console_register(const struct usb_console_command *command);
+
+#endif // USB_CONSOLE_H
@@ -3,56 +3,217 @@
  * @brief Implementação para gerenciar a conexão Wi-Fi.
  *
  * Esta implementação contém a função `wifi_init()`, que inicializa o módulo Wi-Fi, 
- * conecta-se à rede configurada e gerencia a exibição de mensagens relacionadas à 
+ * inicia a conexão à rede configurada e gerencia a exibição de mensagens relacionadas à 
  * conexão Wi-Fi. Utiliza o módulo CYW43 para a comunicação Wi-Fi.
+ *
+ * A associação e o DHCP ocorrem no chip e na pilha de rede em segundo plano;
+ * um temporizador do laço de eventos acompanha o estado do enlace, de modo que
+ * o restante da inicialização continua enquanto a conexão é estabelecida.
+ *
+ * Antes de desligar o chip para o modo de baixo consumo, o BSSID e o canal do
+ * ponto de acesso são guardados; ao religar, a associação vai direto a eles,
+ * sem a varredura dos canais. Se o ponto de acesso recusar, a conexão volta a
+ * procurar a rede pelo SSID.
  * 
  * @author Gabriel Mattano da Silva
  * @date 2025
  */
 
+#include <string.h>
+
 #include "wifi.h"
-#include "credentials.h"
+#include "boot_profile.h"
+#include "config_store.h"
+#include "event_loop.h"
+#include "log.h"
+#include "wifi_power.h"
+
+static struct event_timer connect_timer;  // Acompanha a associação
+static absolute_time_t connect_deadline;
+static wifi_ready_t ready_handler;
+static bool resuming = false;             // Religado após o modo de baixo consumo
+
+// Associação guardada por wifi_suspend()
+static uint8_t cached_bssid[6];
+static uint32_t cached_channel;
+static bool cached = false;
+
+/**
+ * @brief Inicia a associação, pelo BSSID e canal guardados quando houver.
+ */
+static int wifi_connect(void)
+{
+    const char *ssid = config_get(CONFIG_SSID);
+    const char *password = config_get(CONFIG_PASSWORD);
+
+    if (cached)
+    {
+        return cyw43_wifi_join(&cyw43_state, strlen(ssid), (const uint8_t *)ssid, strlen(password),
+                               (const uint8_t *)password, CYW43_AUTH_WPA2_AES_PSK, cached_bssid, cached_channel);
+    }
+    return cyw43_arch_wifi_connect_async(ssid, password, CYW43_AUTH_WPA2_AES_PSK);
+}
+
+/**
+ * @brief Encerra a tentativa de conexão e informa o resultado.
+ */
+static void wifi_finish(bool connected)
+{
+    event_timer_stop(&connect_timer);
+    if (connected)
+    {
+        wifi_power_link_up();
+    }
+
+    if (connected && resuming)
+    {
+        LOG("Wi-Fi reconectado!\n"); // Painel apagado: a tela de conexão não é exibida
+    }
+    else if (connected)
+    {
+        LOG("Wi-Fi conectado!\n");
+        boot_profile_mark(BOOT_STAGE_WIFI_LINK);
+        ui_show(&wifi_conected);
+    }
+    else
+    {
+        LOG("Wi-Fi não conectado!\n");
+        ui_show(&wifi_not_conected);
+        ui_signal_fail();
+    }
+
+    resuming = false;
+    ready_handler(connected);
+}
 
 /**
- * @brief Função para inicializar e conectar o módulo Wi-Fi com parâmetros personalizados
+ * @brief Verifica periodicamente o estado da associação.
+ */
+static void wifi_poll(void *arg)
+{
+    int status = cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA);
+
+    if (status == CYW43_LINK_UP)
+    {
+        wifi_finish(true);
+    }
+    else if (cached && (status == CYW43_LINK_FAIL || status == CYW43_LINK_NONET))
+    {
+        // O ponto de acesso mudou de canal ou saiu do ar: procura a rede pelo SSID
+        LOG("Associação guardada recusada, código: %d\n", status);
+        cached = false;
+        if (wifi_connect())
+        {
+            wifi_finish(false);
+        }
+    }
+    else if (status == CYW43_LINK_FAIL || status == CYW43_LINK_NONET || status == CYW43_LINK_BADAUTH)
+    {
+        LOG("Falha na associação Wi-Fi, código: %d\n", status);
+        wifi_finish(false);
+    }
+    else if (absolute_time_diff_us(connect_deadline, get_absolute_time()) >= 0)
+    {
+        wifi_finish(false);
+    }
+}
+
+/**
+ * @brief Função para inicializar o módulo Wi-Fi e iniciar a conexão com parâmetros personalizados
  * 
  * Essa função inicializa o módulo Wi-Fi, configura o modo cliente (sta),
- * e tenta estabelecer uma conexão com a rede Wi-Fi fornecida através dos 
- * parâmetros SSID e senha. Durante o processo, são exibidas mensagens no 
- * display e, em caso de falha, um sinal sonoro e luminoso de erro é acionado. 
- * Se a conexão for bem-sucedida, o sistema aguarda um curto período de tempo 
- * antes de prosseguir.
+ * e inicia a conexão com a rede Wi-Fi da configuração (SSID e senha de
+ * inc/config_store.h), retornando em seguida. Durante o processo, são exibidas mensagens no 
+ * display e, em caso de falha, um sinal sonoro e luminoso de erro é acionado,
+ * ambos pedidos ao núcleo 1. O resultado é entregue a @p ready no laço de
+ * eventos do núcleo que chamou a função.
  * 
- * @return int Retorna 0 se a conexão for bem-sucedida ou 1 em caso de falha.
+ * @param ready Tratador chamado quando a conexão termina, com sucesso ou não.
+ * @return int Retorna 0 se a conexão foi iniciada ou 1 em caso de falha do módulo
+ *         (nesse caso @p ready não é chamado).
  */
-int wifi_init()
+int wifi_init(wifi_ready_t ready)
 {
     if (cyw43_arch_init())
     {
-        printf("Falha ao inicializar Wi-Fi!\n");
-        display_text(wifi_init_fail, 3);
+        LOG("Falha ao inicializar Wi-Fi!\n");
+        ui_show(&wifi_init_fail);
         return 1;
     }
+    wifi_power_chip_on();
 
-    display_text(wifi_init_success, 3);
+    ui_show(&wifi_init_success);
 
     cyw43_arch_enable_sta_mode();
-    printf("Conectando ao Wi-Fi...\n");
-    display_text(wifi_connecting, 3);
-
-    if (cyw43_arch_wifi_connect_timeout_ms(SSID, PASSWORD, CYW43_AUTH_WPA2_AES_PSK, 30000))
-    {   
-        printf("Wi-Fi não conectado!\n");
-        display_text(wifi_not_conected, 3);
-        buzzer_led_fail();
+    LOG("Conectando ao Wi-Fi...\n");
+    ui_show(&wifi_connecting);
+
+    ready_handler = ready;
+    connect_deadline = make_timeout_time_ms(WIFI_CONNECT_TIMEOUT_MS);
+    if (wifi_connect())
+    {
+        LOG("Falha ao iniciar a conexão Wi-Fi!\n");
+        ui_show(&wifi_not_conected);
+        ui_signal_fail();
         return 1;
     }
-    else
+
+    boot_profile_mark(BOOT_STAGE_WIFI_CHIP);
+    event_timer_start(&connect_timer, WIFI_POLL_MS, WIFI_POLL_MS, wifi_poll, NULL);
+    return 0;
+}
+
+/**
+ * @brief Guarda a associação atual e desliga o chip Wi-Fi.
+ *
+ * Deve ser chamada com o enlace ativo e sem conexões TCP abertas.
+ *
+ * @return true se o BSSID e o canal foram guardados para wifi_resume().
+ */
+bool wifi_suspend(void)
+{
+    uint32_t channel_info[3]; // hw_channel, target_channel, scan_channel
+
+    cached = cyw43_wifi_get_bssid(&cyw43_state, cached_bssid) == 0 &&
+             cyw43_ioctl(&cyw43_state, CYW43_IOCTL_GET_CHANNEL, sizeof(channel_info), (uint8_t *)channel_info,
+                         CYW43_ITF_STA) == 0;
+    cached_channel = channel_info[0];
+
+    wifi_power_chip_off();
+    cyw43_arch_deinit();
+    return cached;
+}
+
+/**
+ * @brief Religa o chip Wi-Fi e reassocia pela associação guardada.
+ *
+ * A carga do firmware do chip bloqueia por algumas centenas de milissegundos;
+ * a associação continua em segundo plano, como em wifi_init(), mas sem exibir
+ * as telas de conexão.
+ *
+ * @param ready Tratador chamado quando a conexão termina, com sucesso ou não.
+ * @return int Retorna 0 se a conexão foi iniciada ou 1 em caso de falha do módulo.
+ */
+int wifi_resume(wifi_ready_t ready)
+{
+    if (cyw43_arch_init())
+    {
+        LOG("Falha ao religar o Wi-Fi!\n");
+        return 1;
+    }
+    wifi_power_chip_on();
+    cyw43_arch_enable_sta_mode();
+
+    ready_handler = ready;
+    resuming = true;
+    connect_deadline = make_timeout_time_ms(WIFI_CONNECT_TIMEOUT_MS);
+    if (wifi_connect())
     {
-        printf("Wi-Fi conectado!\n");
-        display_text(wifi_conected, 3);
-        sleep_ms(2000);
+        LOG("Falha ao iniciar a reconexão Wi-Fi!\n");
+        resuming = false;
+        return 1;
     }
-    
+
+    event_timer_start(&connect_timer, WIFI_POLL_MS, WIFI_POLL_MS, wifi_poll, NULL);
     return 0;
-}
\ No newline at end of file
+}
@@ -15,10 +15,21 @@
 #include <stdlib.h>
 
 #include "pico/cyw43_arch.h"
-#include "buzzer_led.h"
-#include "display_oled.h"
 #include "display_text.h"
+#include "ui_core.h"
 
-int wifi_init();
+#define WIFI_CONNECT_TIMEOUT_MS 30000  // Tempo máximo para associar e obter endereço IP
+#define WIFI_POLL_MS            50     // Intervalo de verificação do estado da associação
 
-#endif // WIFI_H
\ No newline at end of file
+/**
+ * @brief Tratador chamado no laço de eventos quando a associação termina.
+ *
+ * @param connected true se o dispositivo está conectado e com endereço IP.
+ */
+typedef void (*wifi_ready_t)(bool connected);
+
+int wifi_init(wifi_ready_t ready);
+bool wifi_suspend(void);
+int wifi_resume(wifi_ready_t ready);
+
+#endif // WIFI_H
@@ -0,0 +1,304 @@
+/**
+ * @file wifi_power.c
+ * @brief Implementação da política de economia de energia do chip Wi-Fi.
+ *
+ * O modo só é trocado com o enlace ativo: até a associação o chip fica no
+ * padrão que o SDK aplica em cyw43_arch_init(), e os períodos do ponto de
+ * acesso só são conhecidos depois dela. A permanência é contada apenas com o
+ * chip ligado.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pico/cyw43_arch.h"
+#include "event_loop.h"
+#include "log.h"
+#include "usb_console.h"
+#include "wifi_power.h"
+
+// Receptor sempre ligado; o CYW43_PERFORMANCE_PM ainda cochila entre os quadros
+#define WIFI_POWER_NONE_PM cyw43_pm_value(CYW43_NO_POWERSAVE_MODE, 20, 1, 1, 1)
+
+// Ponto de operação
+struct wifi_power_point {
+    const char *name;
+    uint32_t ua;
+};
+
+static const struct wifi_power_point points[WIFI_POWER_LEVEL_COUNT] = {
+    {"economia", WIFI_POWER_SAVE_UA},
+    {"padrao", WIFI_POWER_DEFAULT_UA},
+    {"desempenho", WIFI_POWER_PERFORMANCE_UA},
+};
+
+// Permanência e primeiro pacote dos alertas de um ponto
+struct wifi_power_stats {
+    uint64_t residency_us;
+    uint32_t alerts;
+    uint64_t first_rx_total_us;
+    uint32_t first_rx_max_us;
+};
+
+static struct wifi_power_stats stats[WIFI_POWER_LEVEL_COUNT];
+static enum wifi_power_level level = WIFI_POWER_DEFAULT;
+static int pinned = -1;             // Ponto fixado pelo console, ou -1
+static bool chip_on = false;
+static bool link_up = false;
+static bool busy = false;           // Alerta em envio
+static bool transfer = false;       // Transferência longa (atualização pela rede)
+static bool awaiting_rx = false;    // Conexão do alerta aberta, resposta ainda não recebida
+static uint32_t tx_us;
+static uint64_t level_since_us;
+static uint64_t last_alert_us;
+static uint32_t switches = 0;
+static uint32_t switch_max_us = 0;
+
+// Economia calculada com os períodos do ponto de acesso
+static uint32_t save_pm = CYW43_AGGRESSIVE_PM;
+static uint32_t beacon_ms = 0;      // 0 se o ponto de acesso não informou
+static uint32_t dtim_period = 0;
+static uint32_t listen_ms = 0;
+
+static struct event_timer check_timer;
+
+// Acumula a permanência do ponto atual até agora
+static void account(void) {
+    uint64_t now = time_us_64();
+    if (chip_on) {
+        stats[level].residency_us += now - level_since_us;
+    }
+    level_since_us = now;
+}
+
+static uint32_t pm_value(enum wifi_power_level i) {
+    switch (i) {
+    case WIFI_POWER_PERFORMANCE:
+        return WIFI_POWER_NONE_PM;
+    case WIFI_POWER_DEFAULT:
+        return CYW43_DEFAULT_PM;
+    default:
+        return save_pm;
+    }
+}
+
+// Escuta a cada tantos DTIMs quanto couberem em WIFI_POWER_LISTEN_MAX_MS
+static void read_periods(void) {
+    uint32_t beacon_tu = 0, dtim = 0;
+
+    if (cyw43_ioctl(&cyw43_state, WIFI_POWER_IOCTL_GET_BCNPRD, sizeof(beacon_tu), (uint8_t *)&beacon_tu,
+                    CYW43_ITF_STA) != 0 ||
+        cyw43_ioctl(&cyw43_state, WIFI_POWER_IOCTL_GET_DTIMPRD, sizeof(dtim), (uint8_t *)&dtim,
+                    CYW43_ITF_STA) != 0 ||
+        beacon_tu == 0 || dtim == 0) {
+        save_pm = CYW43_AGGRESSIVE_PM;
+        beacon_ms = dtim_period = listen_ms = 0;
+        return;
+    }
+
+    beacon_ms = beacon_tu * 1024 / 1000;
+    dtim_period = dtim;
+    uint32_t dtims = WIFI_POWER_LISTEN_MAX_MS / (beacon_ms * dtim);
+    if (dtims < 1) {
+        dtims = 1;
+    }
+    if (dtims > 15) {
+        dtims = 15;  // Campo de 4 bits
+    }
+    uint32_t assoc = dtims * dtim > 255 ? 255 : dtims * dtim;
+    save_pm = cyw43_pm_value(CYW43_PM2_POWERSAVE_MODE, 2000, 1, dtims, assoc);
+    listen_ms = dtims * dtim * beacon_ms;
+}
+
+static void set_level(enum wifi_power_level next) {
+    if (!link_up || next == level) {
+        return;
+    }
+
+    uint32_t start = time_us_32();
+    int err = cyw43_wifi_pm(&cyw43_state, pm_value(next));
+    if (err) {
+        LOG("Falha ao trocar o modo do Wi-Fi, código: %d\n", err);
+        return;
+    }
+
+    account();  // A troca conta no ponto anterior
+    level = next;
+    switches++;
+    uint32_t elapsed = time_us_32() - start;
+    if (elapsed > switch_max_us) {
+        switch_max_us = elapsed;
+    }
+}
+
+// Ponto exigido pelo tráfego atual
+static enum wifi_power_level wanted_level(void) {
+    if (pinned >= 0) {
+        return (enum wifi_power_level)pinned;
+    }
+    uint64_t quiet_us = time_us_64() - last_alert_us;
+    if (busy || transfer || quiet_us < WIFI_POWER_QUIET_MS * 1000ull) {
+        return WIFI_POWER_PERFORMANCE;
+    }
+    if (quiet_us < WIFI_POWER_IDLE_MS * 1000ull) {
+        return WIFI_POWER_DEFAULT;
+    }
+    return WIFI_POWER_SAVE;
+}
+
+static void evaluate(void *arg) {
+    set_level(wanted_level());
+}
+
+void wifi_power_chip_on(void) {
+    account();
+    chip_on = true;
+    link_up = false;
+    level = WIFI_POWER_DEFAULT;
+}
+
+void wifi_power_link_up(void) {
+    read_periods();
+    link_up = true;
+    set_level(wanted_level());
+}
+
+void wifi_power_chip_off(void) {
+    account();
+    chip_on = false;
+    link_up = false;
+}
+
+void wifi_power_busy(bool on) {
+    busy = on;
+    awaiting_rx = false;
+    if (on) {
+        set_level(wanted_level());  // Antes do primeiro pacote do alerta
+    }
+    else {
+        last_alert_us = time_us_64();
+    }
+}
+
+void wifi_power_transfer(bool on) {
+    transfer = on;
+    set_level(wanted_level());
+}
+
+void wifi_power_edge(void) {
+    last_alert_us = time_us_64();
+    set_level(wanted_level());
+}
+
+void wifi_power_tx(void) {
+    awaiting_rx = busy;
+    tx_us = time_us_32();
+}
+
+void wifi_power_rx(void) {
+    if (!awaiting_rx) {
+        return;
+    }
+    awaiting_rx = false;
+
+    struct wifi_power_stats *s = &stats[level];
+    uint32_t latency = time_us_32() - tx_us;
+    s->alerts++;
+    s->first_rx_total_us += latency;
+    if (latency > s->first_rx_max_us) {
+        s->first_rx_max_us = latency;
+    }
+}
+
+// Permanência de um ponto, incluindo a ainda não contabilizada do ponto atual
+static uint64_t residency_us(enum wifi_power_level i) {
+    uint64_t residency = stats[i].residency_us;
+    if (i == level && chip_on) {
+        residency += time_us_64() - level_since_us;
+    }
+    return residency;
+}
+
+uint64_t wifi_power_charge_uas(void) {
+    uint64_t charge = 0;
+    for (int i = 0; i < WIFI_POWER_LEVEL_COUNT; i++) {
+        charge += residency_us(i) / 1000 * points[i].ua / 1000;
+    }
+    return charge;
+}
+
+static uint32_t first_rx_us(enum wifi_power_level i) {
+    return stats[i].alerts ? (uint32_t)(stats[i].first_rx_total_us / stats[i].alerts) : 0;
+}
+
+void wifi_power_print(void) {
+    uint64_t total_us = 0, total_charge = 0;  // Carga em uA·s
+    const struct wifi_power_stats *fastest = &stats[WIFI_POWER_PERFORMANCE];
+
+    printf("Rádio: %s, %s, %u trocas, troca mais lenta %u us\n", chip_on ? points[level].name : "desligado",
+           pinned >= 0 ? "fixo" : "automático", (unsigned)switches, (unsigned)switch_max_us);
+    if (beacon_ms) {
+        printf("Ponto de acesso: beacon %u ms, DTIM %u; escuta da economia a cada %u ms\n", (unsigned)beacon_ms,
+               (unsigned)dtim_period, (unsigned)listen_ms);
+    }
+    printf("%-10s %10s %8s %10s %8s %14s %10s %12s\n", "ponto", "tempo (s)", "uA est.", "carga mAh", "alertas",
+           "1º pacote ms", "máxima ms", "acréscimo ms");
+
+    for (int i = 0; i < WIFI_POWER_LEVEL_COUNT; i++) {
+        const struct wifi_power_stats *s = &stats[i];
+        uint64_t residency = residency_us(i);
+        uint64_t charge = residency / 1000 * points[i].ua / 1000;
+        int32_t added = 0;
+        if (s->alerts && fastest->alerts) {
+            added = (int32_t)(first_rx_us(i) - first_rx_us(WIFI_POWER_PERFORMANCE));
+        }
+
+        total_us += residency;
+        total_charge += charge;
+        printf("%-10s %10u %8u %6u.%03u %8u %14u %10u %12d\n", points[i].name, (unsigned)(residency / 1000000),
+               (unsigned)points[i].ua, (unsigned)(charge / 3600000), (unsigned)(charge / 3600 % 1000),
+               (unsigned)s->alerts, (unsigned)(first_rx_us(i) / 1000), (unsigned)(s->first_rx_max_us / 1000),
+               (int)(added / 1000));
+    }
+
+    uint64_t total_s = total_us / 1000000;
+    printf("Corrente média estimada do rádio ligado: %u uA\n", (unsigned)(total_s ? total_charge / total_s : 0));
+}
+
+// Comando "radio [auto|desempenho|padrao|economia]" do console USB
+static void radio_command(const char *args) {
+    if (*args == '\0') {
+        wifi_power_print();
+        return;
+    }
+
+    int point = -2;
+    if (strcmp(args, "auto") == 0) {
+        point = -1;
+    }
+    for (int i = 0; i < WIFI_POWER_LEVEL_COUNT; i++) {
+        if (strcmp(args, points[i].name) == 0) {
+            point = i;
+        }
+    }
+    if (point == -2) {
+        printf("Ponto desconhecido: %s\n", args);
+        return;
+    }
+
+    pinned = point;
+    evaluate(NULL);
+    printf("Rádio: %s\n", point >= 0 ? points[point].name : "automático");
+}
+
+static const struct usb_console_command radio_console_command = {
+    "radio", "[auto|desempenho|padrao|economia] modo de economia do Wi-Fi", radio_command
+};
+
+void wifi_power_init(void) {
+    usb_console_register(&radio_console_command);
+    event_timer_start(&check_timer, WIFI_POWER_CHECK_MS, WIFI_POWER_CHECK_MS, evaluate, NULL);
+}
@@ -0,0 +1,124 @@
+#ifndef WIFI_POWER_H
+#define WIFI_POWER_H
+
+/**
+ * @file wifi_power.h
+ * @brief Modo de economia de energia do chip Wi-Fi conforme o tráfego dos alertas.
+ *
+ * Três pontos de operação do CYW43:
+ *
+ * - desempenho: receptor sempre ligado, enquanto um alerta está em envio e
+ *   por WIFI_POWER_QUIET_MS depois dele;
+ * - padrão: CYW43_DEFAULT_PM do SDK, acordando a cada DTIM;
+ * - economia: PM2 com intervalo de escuta de vários DTIMs, depois de
+ *   WIFI_POWER_IDLE_MS sem alertas.
+ *
+ * O intervalo de escuta da economia é calculado com o período de beacon e o
+ * DTIM anunciados pelo ponto de acesso, lidos a cada associação, de modo que
+ * um pacote retido para o dispositivo espere no máximo
+ * WIFI_POWER_LISTEN_MAX_MS. O pedido de um botão leva o chip ao desempenho
+ * antes do primeiro pacote do alerta.
+ *
+ * O CYW43439 com CYW43_PERFORMANCE_PM ainda cochila 20 ms após cada quadro,
+ * menos que a ida e volta até o servidor: a resposta da conexão TCP esperaria
+ * o próximo beacon. Por isso o desempenho desliga a economia de vez.
+ *
+ * O comando "radio" do console USB exibe, para cada ponto, o tempo de
+ * permanência, a carga estimada pelo modelo de corrente abaixo e o atraso do
+ * primeiro pacote recebido dos alertas (a resposta à abertura da conexão
+ * TCP), com o acréscimo em relação ao desempenho; "radio desempenho|padrao|economia"
+ * fixa um ponto para medir, "radio auto" volta à política.
+ *
+ * Tudo roda no núcleo 0, dono do chip Wi-Fi.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#define WIFI_POWER_QUIET_MS       10000  ///< Sem alertas por este tempo, padrão
+#define WIFI_POWER_IDLE_MS        60000  ///< Sem alertas por este tempo, economia
+#define WIFI_POWER_CHECK_MS       1000   ///< Reavaliação periódica
+#define WIFI_POWER_LISTEN_MAX_MS  500    ///< Maior intervalo de escuta da economia
+
+// Períodos anunciados pelo ponto de acesso (WLC_GET_BCNPRD e WLC_GET_DTIMPRD)
+#define WIFI_POWER_IOCTL_GET_BCNPRD  0x96
+#define WIFI_POWER_IOCTL_GET_DTIMPRD 0x9a
+
+// Modelo de corrente do CYW43 associado (estimativas; ajuste com uma medição)
+#define WIFI_POWER_PERFORMANCE_UA  40000  ///< Receptor sempre ligado, em uA
+#define WIFI_POWER_DEFAULT_UA      12000  ///< Escuta a cada DTIM, em uA
+#define WIFI_POWER_SAVE_UA         4000   ///< Escuta a cada WIFI_POWER_LISTEN_MAX_MS, em uA
+
+/**
+ * @brief Pontos de operação, do mais econômico ao mais rápido.
+ */
+enum wifi_power_level {
+    WIFI_POWER_SAVE,
+    WIFI_POWER_DEFAULT,
+    WIFI_POWER_PERFORMANCE,
+    WIFI_POWER_LEVEL_COUNT
+};
+
+/**
+ * @brief Registra o comando "radio" e inicia a reavaliação periódica.
+ */
+void wifi_power_init(void);
+
+/**
+ * @brief Chip ligado por cyw43_arch_init(), no modo padrão do SDK.
+ */
+void wifi_power_chip_on(void);
+
+/**
+ * @brief Enlace ativo: lê os períodos do ponto de acesso e aplica o ponto atual.
+ */
+void wifi_power_link_up(void);
+
+/**
+ * @brief Chip prestes a ser desligado por cyw43_arch_deinit().
+ */
+void wifi_power_chip_off(void);
+
+/**
+ * @brief Início (true) ou fim (false) do envio de um alerta; o início sobe ao desempenho.
+ */
+void wifi_power_busy(bool on);
+
+/**
+ * @brief Início (true) ou fim (false) de uma transferência longa, mantida no desempenho.
+ *
+ * Usada pelo download da atualização (inc/ota_update.h): no modo de economia
+ * cada janela TCP esperaria o próximo intervalo de escuta.
+ */
+void wifi_power_transfer(bool on);
+
+/**
+ * @brief Borda de um botão cujo pedido ainda não começou a ser enviado.
+ *
+ * Usada no despertar do dormant: o enlace já sobe no desempenho.
+ */
+void wifi_power_edge(void);
+
+/**
+ * @brief Abertura da conexão TCP de um alerta: início da medida do primeiro pacote.
+ */
+void wifi_power_tx(void);
+
+/**
+ * @brief Conexão TCP estabelecida: fim da medida do primeiro pacote.
+ */
+void wifi_power_rx(void);
+
+/**
+ * @brief Carga estimada do chip Wi-Fi desde a partida, em uA·s.
+ */
+uint64_t wifi_power_charge_uas(void);
+
+/**
+ * @brief Exibe permanência, carga estimada e atraso do primeiro pacote de cada ponto.
+ */
+void wifi_power_print(void);
+
+#endif // WIFI_POWER_H
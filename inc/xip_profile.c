@@ -0,0 +1,115 @@
+/**
+ * @file xip_profile.c
+ * @brief Acúmulo e relatório das falhas do cache XIP.
+ *
+ * Os contadores do controlador nunca são zerados: as janelas e o total usam
+ * diferenças sem sinal, corretas mesmo quando o contador dá a volta. Cada
+ * subsistema é atualizado por um único núcleo; o "xip reset" do console pode
+ * cruzar com uma atualização e deixar nela uma janela a mais.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event_loop.h"
+#include "flash_guard.h"
+#include "usb_console.h"
+#include "xip_profile.h"
+
+#if XIP_PROFILE_ENABLED
+// Totais de um subsistema ou do sistema
+struct xip_totals {
+    uint64_t hits;
+    uint64_t accesses;
+    uint32_t calls;
+    uint32_t worst_misses;  // Maior número de falhas em uma única chamada
+};
+
+static const char *const subsystem_names[XIP_SUBSYSTEM_COUNT] = {
+    "entrada", "interface", "alertas", "rede", "log",
+};
+
+static struct xip_totals subsystems[XIP_SUBSYSTEM_COUNT];
+static struct xip_totals system;
+static struct xip_window last_sample;
+static struct event_timer sample_timer;
+
+void xip_profile_account(enum xip_subsystem subsystem, uint32_t hits, uint32_t accesses) {
+    struct xip_totals *totals = &subsystems[subsystem];
+    uint32_t misses = accesses - hits;
+
+    totals->hits += hits;
+    totals->accesses += accesses;
+    totals->calls++;
+    if (misses > totals->worst_misses) {
+        totals->worst_misses = misses;
+    }
+}
+
+// Acumula o total do sistema antes que os contadores deem a volta
+static void sample_handler(void *arg) {
+    struct xip_window now;
+    xip_profile_begin(&now);
+    system.hits += now.hits - last_sample.hits;
+    system.accesses += now.accesses - last_sample.accesses;
+    last_sample = now;
+}
+
+// Uma linha do relatório, com a taxa de falhas em décimos de porcento
+static void print_totals(const char *name, const struct xip_totals *totals) {
+    uint64_t misses = totals->accesses - totals->hits;
+    unsigned permille = totals->accesses ? (unsigned)(misses * 1000 / totals->accesses) : 0;
+
+    printf("%-10s %10u %12llu %10llu %3u.%u%% %8u\n", name, (unsigned)totals->calls,
+           (unsigned long long)totals->accesses, (unsigned long long)misses,
+           permille / 10, permille % 10, (unsigned)totals->worst_misses);
+}
+#endif
+
+void xip_profile_print(void) {
+#if XIP_PROFILE_ENABLED
+    sample_handler(NULL);
+    printf("%-10s %10s %12s %10s %6s %8s\n", "subsistema", "chamadas", "acessos", "falhas", "taxa", "pior");
+    for (int i = 0; i < XIP_SUBSYSTEM_COUNT; i++) {
+        print_totals(subsystem_names[i], &subsystems[i]);
+    }
+    print_totals("sistema", &system);
+#else
+    printf("Perfil do cache XIP desligado (compile com XIP_PROFILE).\n");
+#endif
+    flash_guard_print();
+}
+
+void xip_profile_reset(void) {
+#if XIP_PROFILE_ENABLED
+    memset(subsystems, 0, sizeof(subsystems));
+    memset(&system, 0, sizeof(system));
+    xip_profile_begin(&last_sample);
+#endif
+}
+
+// Comando "xip [reset]" do console USB
+static void xip_command(const char *args) {
+    if (strcmp(args, "reset") == 0) {
+        xip_profile_reset();
+        printf("Contagem do cache XIP zerada.\n");
+    }
+    else {
+        xip_profile_print();
+    }
+}
+
+static const struct usb_console_command xip_console_command = {
+    "xip", "[reset] falhas do cache XIP por subsistema", xip_command
+};
+
+void xip_profile_init(void) {
+    usb_console_register(&xip_console_command);
+#if XIP_PROFILE_ENABLED
+    xip_profile_reset();
+    event_timer_start(&sample_timer, XIP_PROFILE_SAMPLE_MS, XIP_PROFILE_SAMPLE_MS, sample_handler, NULL);
+#endif
+}
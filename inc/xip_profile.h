@@ -0,0 +1,107 @@
+#ifndef XIP_PROFILE_H
+#define XIP_PROFILE_H
+
+/**
+ * @file xip_profile.h
+ * @brief Taxa de falhas do cache XIP por subsistema.
+ *
+ * O controlador XIP conta os acessos à flash mapeada e os acertos no cache
+ * (CTR_ACC e CTR_HIT). Com XIP_PROFILE os tratadores de cada subsistema
+ * leem os dois contadores na entrada e na saída e acumulam a diferença; o
+ * total do sistema é acumulado por um temporizador do núcleo 0, antes que os
+ * contadores de 32 bits deem a volta. O comando "xip [reset]" do console USB
+ * exibe as falhas de cada subsistema e a pior chamada, para comparar os
+ * perfis com e sem RAM_HOT_PATHS (inc/hot_path.h).
+ *
+ * Os contadores são do controlador, não do núcleo: a janela de um tratador
+ * inclui os acessos do outro núcleo no mesmo intervalo. Os números de um
+ * subsistema são, portanto, um limite superior.
+ *
+ * Sem XIP_PROFILE as janelas não geram código; na simulação não há cache.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "pico/stdlib.h"
+
+#ifndef XIP_PROFILE
+#define XIP_PROFILE 0
+#endif
+
+#if XIP_PROFILE && PICO_ON_DEVICE
+#include "hardware/structs/xip_ctrl.h"
+#define XIP_PROFILE_ENABLED 1
+#else
+#define XIP_PROFILE_ENABLED 0
+#endif
+
+#define XIP_PROFILE_SAMPLE_MS 1000  ///< Acúmulo do total; os contadores dão a volta em ~34 s a 125 MHz
+
+/**
+ * @brief Subsistemas com janelas de medição.
+ */
+enum xip_subsystem {
+    XIP_SUBSYSTEM_INPUT,    ///< Leitura dos botões (núcleo 1)
+    XIP_SUBSYSTEM_UI,       ///< Comandos da interface (núcleo 1)
+    XIP_SUBSYSTEM_ALERT,    ///< Início do envio de um alerta (núcleo 0)
+    XIP_SUBSYSTEM_NETWORK,  ///< cyw43_arch_poll (núcleo 0)
+    XIP_SUBSYSTEM_LOG,      ///< Esvaziamento do anel de mensagens (núcleo 0)
+    XIP_SUBSYSTEM_COUNT
+};
+
+/**
+ * @brief Contadores lidos na entrada de uma janela.
+ */
+struct xip_window {
+    uint32_t hits;
+    uint32_t accesses;
+};
+
+/**
+ * @brief Acumula uma janela; chamada por xip_profile_end().
+ */
+void xip_profile_account(enum xip_subsystem subsystem, uint32_t hits, uint32_t accesses);
+
+/**
+ * @brief Abre a janela de medição de um tratador.
+ */
+static inline void xip_profile_begin(struct xip_window *window) {
+#if XIP_PROFILE_ENABLED
+    window->accesses = xip_ctrl_hw->ctr_acc;
+    window->hits = xip_ctrl_hw->ctr_hit;
+#else
+    (void)window;
+#endif
+}
+
+/**
+ * @brief Fecha a janela e a atribui ao subsistema.
+ */
+static inline void xip_profile_end(enum xip_subsystem subsystem, const struct xip_window *window) {
+#if XIP_PROFILE_ENABLED
+    uint32_t hits = xip_ctrl_hw->ctr_hit - window->hits;
+    uint32_t accesses = xip_ctrl_hw->ctr_acc - window->accesses;
+    xip_profile_account(subsystem, hits, accesses);
+#else
+    (void)subsystem;
+    (void)window;
+#endif
+}
+
+/**
+ * @brief Registra o comando "xip" e inicia o acúmulo do total; chamada no núcleo 0.
+ */
+void xip_profile_init(void);
+
+/**
+ * @brief Exibe as falhas do cache por subsistema e as gravações protegidas da flash.
+ */
+void xip_profile_print(void);
+
+/**
+ * @brief Zera os totais e os piores casos.
+ */
+void xip_profile_reset(void);
+
+#endif // XIP_PROFILE_H
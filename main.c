@@ -16,9 +16,14 @@
  *  
  * Funcionalidades:
  * - Monitoramento de 4 pinos com debounce
- * - Envio de mensagens via WhatsApp
+ * - Envio de mensagens via WhatsApp, com hora (SNTP e RTC), sinal, tentativa e bateria
  * - Exibição de status no display OLED
+ * - Barra de status com RSSI, enlace, alertas pendentes e tempo ligado
  * - Tocar buzzers e piscar led
+ * - Confirmação falada via PWM-DAC a partir de trechos IMA-ADPCM na flash
+ * - Núcleo 0 dedicado à rede e núcleo 1 à interface, ligados por filas sem travas
+ * - Histogramas de latência de cada etapa do alerta, consultados pelo console USB
+ * - Atualização do firmware pela rede em dois slots, com reversão automática (opcional)
  * 
  * @author Gabriel Mattano da Silva
  * @date 2025
@@ -28,59 +33,131 @@
 
 #include "pico/cyw43_arch.h"
 #include "pico/stdlib.h"
-#include "button_handler.h"
-#include "buzzer_led.h"
+#include "alert_service.h"
+#include "boot_profile.h"
 #include "callmebot_whatsapp.h"
-#include "credentials.h"
-#include "display_oled.h"
-#include "display_text.h"
+#include "clock_governor.h"
+#include "config_store.h"
+#include "event_loop.h"
+#include "log.h"
+#include "low_power.h"
+#include "net_memory.h"
+#include "ota_update.h"
+#include "stack_monitor.h"
+#include "status_bar.h"
+#include "supervisor.h"
+#include "time_sync.h"
+#include "trace.h"
+#include "ui_core.h"
+#include "usb_console.h"
 #include "wifi.h"
+#include "wifi_power.h"
+#include "xip_profile.h"
+
+#define STATS_PERIOD_MS 60000 // Intervalo entre os relatórios dos laços de eventos
+
+static struct event_timer status_timer;  // Leitura do enlace e do RSSI para a barra de status
+static struct event_timer stats_timer;   // Relatório periódico dos laços de eventos
+
+/**
+ * @brief Mantém o Wi-Fi ativo a cada despertar do laço.
+ */
+static bool network_poll(void *arg)
+{
+    struct xip_window xip;
+    xip_profile_begin(&xip);
+    cyw43_arch_poll();
+    xip_profile_end(XIP_SUBSYSTEM_NETWORK, &xip);
+    return false;
+}
+
+/**
+ * @brief Atualiza RSSI e estado do enlace exibidos na barra de status.
+ */
+static void status_handler(void *arg)
+{
+    status_bar_poll();
+}
+
+/**
+ * @brief Exibe as estatísticas dos laços de eventos, o uso das pilhas e a memória do lwIP.
+ */
+static void stats_handler(void *arg)
+{
+    event_loop_print_stats(0);
+    event_loop_print_stats(1);
+    stack_monitor_print();
+    net_memory_print_summary();
+}
+
+/**
+ * @brief Fim da conexão Wi-Fi: antecipa o DNS e libera o envio dos alertas.
+ */
+static void wifi_ready(bool connected)
+{
+    if (connected)
+    {
+        whatsapp_prefetch_dns();
+        time_sync_start();
+        boot_profile_mark(BOOT_STAGE_ALERTS_READY);
+    }
+
+    // Envia uma mensagem inicial indicando que o dispositivo está pronto
+    alert_service_start();
+}
 
 /**
  * @brief Função principal
  * 
- * Inicializa monitor serial, o display OLED, o Wi-Fi, os buzzers, o led eos botões, 
- * e entra em um loop infinito para monitoramento do sistema.
+ * Executa no núcleo 0: inicializa o monitor serial, lança o núcleo 1 (display,
+ * buzzers, led e botões), inicia a conexão Wi-Fi, registra os tratadores da
+ * rede e entra no laço de eventos, que dorme até o próximo prazo ou pedido.
+ * A associação ocorre em paralelo com a inicialização da interface no núcleo
+ * 1, e os botões são monitorados desde o início: os pedidos ficam na fila até
+ * a rede estar pronta.
  * 
  * @return int Retorna 0 se executado com sucesso, 1 caso haja erro
  */
 int main()
 {  
-    // Inicialização dos periféricos
-    stdio_init_all();
-    display_init();
-    buzzer_led_init();
-    button_handler_init();
-    sleep_ms(1000);
+    stack_monitor_paint(); // Antes de qualquer outra chamada, com o núcleo 1 parado
+    boot_profile_mark(BOOT_STAGE_MAIN);
+    supervisor_init();
 
-    // Inicialização do Wi-Fi
-    wifi_init();
+    // Inicialização do laço de eventos e do núcleo 1, que cuida dos periféricos de interface
+    event_loop_init();
+    ui_core_launch();
 
-    // Inicia um temporizador para verificar os botões a cada 1s
-    struct repeating_timer button_timer;
-    add_repeating_timer_ms(1000, button_check_callback, NULL, &button_timer);
+    // Inicialização do monitor serial, com os botões já monitorados
+    stdio_init_all();
+    boot_profile_mark(BOOT_STAGE_STDIO);
 
-    // Envia uma mensagem inicial indicando que o dispositivo está pronto
-    if (send_whatsapp_message("Dispositivo pronto para uso!", PHONE_NUMBER, API_KEY))
-    {
-        printf("Mensagem inicial enviada com sucesso!\n");
-        display_text(ready_to_use, 3);
-        sleep_ms(2000);
-        display_text(msg_init_success, 3);
-        buzzer_led_init_success();
-    }
-    else
-    {   printf("Falha ao enviar mensagem inicial!\n");
-        display_text(msg_init_fail, 3);
-        buzzer_led_fail();
-    }
+    // Tratadores do núcleo 0
+    event_loop_add_poll(network_poll, NULL);
+    supervisor_watch_loop(SUPERVISOR_NETWORK);
+    alert_service_init(); // Acordado pelo SEV da fila do núcleo 1
+    usb_console_init();   // Comandos de diagnóstico pela USB
+    config_store_init();  // Credenciais e mensagens gravadas na flash, antes do Wi-Fi
+    ota_update_init();    // Atualização pela rede e aprovação da imagem em teste, com OTA_UPDATE
+    stack_monitor_init();
+    net_memory_init();
+    xip_profile_init();
+    clock_governor_init();
+    low_power_init();     // Dormant quando ocioso, com LOW_POWER
+    wifi_power_init();    // Economia do rádio conforme os alertas
+    trace_init();
+    log_init();           // Mensagens enviadas pela USB em segundo plano
+    event_timer_start(&status_timer, 0, STATUS_BAR_REFRESH_MS, status_handler, NULL);
+    event_timer_start(&stats_timer, STATS_PERIOD_MS, STATS_PERIOD_MS, stats_handler, NULL);
 
-    while (true)
+    // Inicia a conexão Wi-Fi; wifi_ready() é chamado quando ela terminar
+    if (wifi_init(wifi_ready))
     {
-        cyw43_arch_poll(); // Mantém o Wi-Fi ativo
-        sleep_ms(100);
+        alert_service_start();
     }
 
+    event_loop_run();
+
     cyw43_arch_deinit();
     return 0;
 }
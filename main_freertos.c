@@ -0,0 +1,174 @@
+/**
+ * @file main_freertos.c
+ * @brief Variante FreeRTOS SMP do Sistema de Envio de Mensagens de Alerta Via Whatsapp
+ *
+ * Mesma aplicação de main.c, escalonada pelo FreeRTOS nos dois núcleos com
+ * pico_cyw43_arch_lwip_sys_freertos. As prioridades deixam explícito que o
+ * envio de um alerta vem antes de qualquer atualização de interface:
+ *
+ * | Tarefa      | Núcleo | Prioridade | Função                                        |
+ * |-------------|--------|------------|-----------------------------------------------|
+ * | alertas     | 0      | 4          | Wi-Fi, envio das mensagens (laço de eventos)  |
+ * | entrada     | 1      | 3          | Leitura dos botões a cada BUTTON_POLL_MS      |
+ * | interface   | 1      | 2          | Display, buzzers, LEDs e áudio (laço de eventos) |
+ * | telemetria  | 0      | 1          | Enlace e RSSI da barra de status, LOG(), estatísticas |
+ *
+ * As tarefas trocam app_event por filas limitadas (ALERT_QUEUE_LENGTH e
+ * UI_QUEUE_LENGTH); uma fila cheia descarta o evento e conta o descarte, sem
+ * bloquear o produtor.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "pico/stdlib.h"
+#include "alert_service.h"
+#include "boot_profile.h"
+#include "callmebot_whatsapp.h"
+#include "clock_governor.h"
+#include "config_store.h"
+#include "event_loop.h"
+#include "log.h"
+#include "net_memory.h"
+#include "ota_update.h"
+#include "stack_monitor.h"
+#include "status_bar.h"
+#include "supervisor.h"
+#include "time_sync.h"
+#include "trace.h"
+#include "ui_core.h"
+#include "usb_console.h"
+#include "wifi.h"
+#include "wifi_power.h"
+#include "xip_profile.h"
+
+#define ALERT_TASK_PRIORITY       4     // Envio das mensagens: a maior prioridade da aplicação
+#define TELEMETRY_TASK_PRIORITY   1     // Barra de status e estatísticas: a menor
+#define ALERT_TASK_STACK_WORDS    2048  // Pilha da tarefa de alertas (montagem da requisição HTTP)
+#define TELEMETRY_TASK_STACK_WORDS 512  // Pilha da tarefa de telemetria
+#define STATS_PERIOD_MS           60000 // Intervalo entre os relatórios de estatísticas
+
+/**
+ * @brief Tarefa de telemetria: atualiza o enlace e o RSSI, envia as mensagens
+ * registradas por LOG() e relata estatísticas.
+ */
+static void telemetry_task(void *params)
+{
+    TickType_t last_wake = xTaskGetTickCount();
+    uint32_t elapsed_ms = 0;
+
+    while (true)
+    {
+        status_bar_poll();
+        log_drain();
+
+        elapsed_ms += STATUS_BAR_REFRESH_MS;
+        if (elapsed_ms >= STATS_PERIOD_MS)
+        {
+            elapsed_ms = 0;
+            event_loop_print_stats(0);
+            event_loop_print_stats(1);
+            stack_monitor_print();
+            net_memory_print_summary();
+            printf("Maior atraso entre botão e envio: %u us\n", (unsigned)alert_service_latency_max_us());
+        }
+
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(STATUS_BAR_REFRESH_MS));
+    }
+}
+
+/**
+ * @brief Fim da conexão Wi-Fi: antecipa o DNS e libera o envio dos alertas.
+ */
+static void wifi_ready(bool connected)
+{
+    if (connected)
+    {
+        whatsapp_prefetch_dns();
+        time_sync_start();
+        boot_profile_mark(BOOT_STAGE_ALERTS_READY);
+    }
+
+    alert_service_start();
+}
+
+/**
+ * @brief Tarefa de alertas: inicia a interface e o Wi-Fi e executa o laço de eventos da rede.
+ */
+static void alert_task(void *params)
+{
+    event_loop_init();
+    ui_core_launch();
+
+    TaskHandle_t telemetry;
+    xTaskCreateAffinitySet(telemetry_task, "telemetria", TELEMETRY_TASK_STACK_WORDS, NULL,
+                           TELEMETRY_TASK_PRIORITY, 1 << 0, &telemetry);
+    stack_monitor_watch_task(xTaskGetCurrentTaskHandle());
+    stack_monitor_watch_task(telemetry);
+
+    alert_service_init(); // Acordado pela notificação da tarefa de entrada
+    usb_console_init();
+    config_store_init();  // Credenciais e mensagens gravadas na flash, antes do Wi-Fi
+    ota_update_init();    // Atualização pela rede, com OTA_UPDATE
+    stack_monitor_init();
+    net_memory_init();
+    xip_profile_init();
+    clock_governor_init();
+    wifi_power_init();    // Economia do rádio conforme os alertas
+    // Sem low_power_init(): o dormant prende o núcleo 1 em WFE com as interrupções
+    // desabilitadas, o que o escalonador do FreeRTOS não permite (LOW_POWER_ENABLED é 0)
+    trace_init();
+    log_init();
+    supervisor_watch_loop(SUPERVISOR_NETWORK);
+
+    // Inicia a conexão Wi-Fi; wifi_ready() é chamado quando ela terminar
+    if (wifi_init(wifi_ready))
+    {
+        alert_service_start();
+    }
+
+    event_loop_run();
+}
+
+/**
+ * @brief Chamado pelo FreeRTOS se o heap se esgotar.
+ */
+void vApplicationMallocFailedHook(void)
+{
+    panic("FreeRTOS: heap esgotado");
+}
+
+/**
+ * @brief Chamado pelo FreeRTOS ao detectar estouro de pilha de uma tarefa.
+ */
+void vApplicationStackOverflowHook(TaskHandle_t task, char *name)
+{
+    panic("FreeRTOS: estouro de pilha na tarefa %s", name);
+}
+
+/**
+ * @brief Função principal
+ *
+ * Inicializa o monitor serial, cria a tarefa de alertas fixada no núcleo 0 e
+ * entrega o controle ao escalonador.
+ *
+ * @return int Não retorna.
+ */
+int main()
+{
+    stack_monitor_paint(); // A pilha de main() passa a ser a das interrupções do núcleo 0
+    boot_profile_mark(BOOT_STAGE_MAIN);
+    supervisor_init();
+    stdio_init_all();
+    boot_profile_mark(BOOT_STAGE_STDIO);
+
+    xTaskCreateAffinitySet(alert_task, "alertas", ALERT_TASK_STACK_WORDS, NULL,
+                           ALERT_TASK_PRIORITY, 1 << 0, NULL);
+    vTaskStartScheduler();
+
+    return 0;
+}
@@ -0,0 +1,933 @@
+// Arquivo gerado por tests/gen_adpcm_reference.py (Python com audioop) - não edite.
+
+#define REFERENCE_SAMPLES 4000
+
+static const uint8_t firmware_adpcm[2000] = {
+    0x70, 0x77, 0x77, 0x77, 0x17, 0x01, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x22, 0x32, 0x22, 0x22,
+    0x22, 0x22, 0x01, 0x80, 0xa8, 0xdb, 0xdb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xad, 0xac, 0xac, 0xcb,
+    0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba,
+    0xbb, 0xba, 0xba, 0x9a, 0x8a, 0x08, 0x21, 0x44, 0x35, 0x44, 0x34, 0x44, 0x33, 0x35, 0x43, 0x34,
+    0x43, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x23, 0x33, 0x33, 0x24,
+    0x12, 0x12, 0x01, 0x80, 0xb9, 0xdb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xcc, 0xca, 0xbb, 0xcb, 0xac,
+    0xac, 0xbb, 0xac, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xaa, 0xab, 0xaa, 0x9a, 0x99, 0x00, 0x31,
+    0x44, 0x44, 0x34, 0x44, 0x43, 0x24, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x33, 0x34,
+    0x42, 0x22, 0x23, 0x23, 0x22, 0x12, 0x01, 0x88, 0xba, 0xcd, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xcb,
+    0xbb, 0xad, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xba, 0x9a, 0xaa, 0x98, 0x00, 0x22,
+    0x54, 0x53, 0x43, 0x34, 0x34, 0x25, 0x24, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43, 0x23, 0x33, 0x24,
+    0x22, 0x22, 0x11, 0x00, 0x88, 0xbb, 0xcd, 0xbc, 0xbd, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xac,
+    0xcb, 0xba, 0xab, 0xcb, 0xaa, 0xaa, 0x9a, 0x99, 0x08, 0x21, 0x53, 0x44, 0x53, 0x43, 0x53, 0x33,
+    0x53, 0x33, 0x34, 0x33, 0x34, 0x24, 0x23, 0x33, 0x23, 0x23, 0x12, 0x01, 0x98, 0xda, 0xdb, 0xbc,
+    0xbd, 0xbc, 0xcc, 0xca, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x08, 0x20,
+    0x53, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32, 0x33, 0x33, 0x33, 0x22, 0x12,
+    0x80, 0xb9, 0xcc, 0xbd, 0xbd, 0xbd, 0xcb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xab, 0xab,
+    0x99, 0x09, 0x20, 0x53, 0x44, 0x34, 0x35, 0x53, 0x33, 0x34, 0x24, 0x24, 0x23, 0x33, 0x33, 0x33,
+    0x22, 0x12, 0x88, 0xba, 0xcd, 0xcc, 0xbc, 0xbc, 0xcc, 0xbb, 0xdb, 0xba, 0xcb, 0xba, 0xba, 0xba,
+    0xaa, 0x99, 0x00, 0x21, 0x35, 0x45, 0x43, 0x34, 0x34, 0x34, 0x43, 0x33, 0x34, 0x32, 0x33, 0x32,
+    0x12, 0x01, 0x98, 0xda, 0xdb, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xba, 0x9a,
+    0x99, 0x10, 0x42, 0x44, 0x44, 0x43, 0x34, 0x43, 0x43, 0x33, 0x43, 0x23, 0x33, 0x22, 0x12, 0x01,
+    0x99, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xba, 0xab, 0xaa, 0x89, 0x18, 0x42,
+    0x44, 0x44, 0x43, 0x43, 0x24, 0x24, 0x33, 0x33, 0x33, 0x33, 0x23, 0x01, 0xa0, 0xda, 0xbc, 0xbe,
+    0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x88, 0x20, 0x53, 0x34, 0x45, 0x33, 0x35,
+    0x43, 0x33, 0x33, 0x24, 0x23, 0x12, 0x11, 0x98, 0xca, 0xcc, 0xdb, 0xdb, 0xca, 0xca, 0xba, 0xba,
+    0xbb, 0xbb, 0xaa, 0x89, 0x18, 0x43, 0x44, 0x35, 0x34, 0x34, 0x34, 0x24, 0x33, 0x33, 0x23, 0x13,
+    0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xcc, 0xcb, 0xca, 0xba, 0xba, 0xab, 0xab, 0x99, 0x08, 0x31, 0x45,
+    0x53, 0x34, 0x34, 0x43, 0x43, 0x23, 0x33, 0x22, 0x12, 0x81, 0xa8, 0xcc, 0xbc, 0xcd, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x09, 0x20, 0x44, 0x35, 0x35, 0x34, 0x34, 0x43, 0x32, 0x33, 0x23,
+    0x12, 0x00, 0xb9, 0xcc, 0xbd, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xba, 0x99, 0x00, 0x42, 0x44,
+    0x44, 0x43, 0x34, 0x33, 0x34, 0x32, 0x23, 0x12, 0x81, 0xa8, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xbc,
+    0xba, 0xab, 0xaa, 0x89, 0x10, 0x53, 0x63, 0x43, 0x43, 0x43, 0x33, 0x33, 0x33, 0x23, 0x01, 0xa0,
+    0xda, 0xcc, 0xbc, 0xbd, 0xcb, 0xca, 0xaa, 0xab, 0x9a, 0x89, 0x10, 0x33, 0x36, 0x35, 0x34, 0x34,
+    0x43, 0x32, 0x22, 0x22, 0x00, 0x99, 0xbc, 0xcd, 0xdb, 0xbb, 0xbc, 0xbb, 0xac, 0xaa, 0x8a, 0x08,
+    0x31, 0x54, 0x53, 0x33, 0x35, 0x33, 0x43, 0x22, 0x12, 0x01, 0xa8, 0xda, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xbb, 0xbb, 0xab, 0x99, 0x18, 0x43, 0x35, 0x35, 0x35, 0x33, 0x34, 0x33, 0x22, 0x12, 0x80, 0xba,
+    0xbe, 0xbd, 0xcc, 0xbb, 0xac, 0xbb, 0xaa, 0x9a, 0x08, 0x32, 0x54, 0x34, 0x44, 0x33, 0x24, 0x33,
+    0x32, 0x11, 0x90, 0xb9, 0xcd, 0xcc, 0xbb, 0xad, 0xbb, 0xbb, 0xab, 0x99, 0x00, 0x43, 0x54, 0x43,
+    0x34, 0x43, 0x33, 0x32, 0x22, 0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xbc, 0xcb, 0xab, 0xab, 0x9a, 0x08,
+    0x31, 0x45, 0x53, 0x43, 0x43, 0x32, 0x23, 0x22, 0x01, 0x98, 0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xba,
+    0xaa, 0x9a, 0x18, 0x41, 0x34, 0x45, 0x33, 0x34, 0x24, 0x22, 0x12, 0x00, 0xa9, 0xcc, 0xdb, 0xac,
+    0xac, 0xbb, 0xab, 0xaa, 0x88, 0x20, 0x44, 0x44, 0x43, 0x43, 0x33, 0x32, 0x22, 0x01, 0xa8, 0xcc,
+    0xbc, 0xbd, 0xbc, 0xbb, 0xac, 0x9a, 0x09, 0x10, 0x43, 0x35, 0x35, 0x43, 0x23, 0x33, 0x22, 0x81,
+    0xb8, 0xeb, 0xcc, 0xbb, 0xad, 0xbb, 0xab, 0xaa, 0x08, 0x21, 0x45, 0x34, 0x34, 0x34, 0x33, 0x33,
+    0x11, 0x80, 0xcb, 0xcc, 0xcc, 0xbb, 0xbc, 0xbb, 0xaa, 0x89, 0x20, 0x53, 0x44, 0x34, 0x43, 0x33,
+    0x23, 0x22, 0x80, 0xc9, 0xdb, 0xcc, 0xbb, 0xbc, 0xbb, 0xab, 0x89, 0x10, 0x53, 0x44, 0x34, 0x34,
+    0x42, 0x12, 0x02, 0x80, 0xa9, 0xcc, 0xbc, 0xcc, 0xba, 0xba, 0x9a, 0x89, 0x21, 0x44, 0x34, 0x35,
+    0x33, 0x24, 0x13, 0x11, 0x98, 0xdb, 0xdb, 0xcb, 0xac, 0xbb, 0xaa, 0x8a, 0x18, 0x42, 0x44, 0x34,
+    0x34, 0x33, 0x23, 0x22, 0x88, 0xca, 0xdc, 0xcb, 0xcb, 0xbb, 0xab, 0x9a, 0x08, 0x32, 0x55, 0x43,
+    0x43, 0x33, 0x23, 0x12, 0x91, 0xc9, 0xcc, 0xbc, 0xbc, 0xbb, 0xbb, 0xaa, 0x18, 0x42, 0x45, 0x43,
+    0x24, 0x33, 0x23, 0x12, 0x88, 0xcb, 0xdc, 0xcb, 0xbb, 0xac, 0x9b, 0x8a, 0x10, 0x43, 0x54, 0x33,
+    0x34, 0x33, 0x22, 0x01, 0xb8, 0xcc, 0xbd, 0xbc, 0xcb, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x53, 0x33,
+    0x33, 0x33, 0x12, 0x98, 0xbc, 0xbe, 0xbd, 0xbb, 0xac, 0x9a, 0x89, 0x21, 0x44, 0x53, 0x43, 0x33,
+    0x32, 0x11, 0x90, 0xca, 0xbd, 0xcc, 0xbb, 0xbb, 0xab, 0x09, 0x21, 0x45, 0x34, 0x44, 0x32, 0x22,
+    0x11, 0x90, 0xcb, 0xcc, 0xdb, 0xba, 0xab, 0x9b, 0x08, 0x31, 0x45, 0x53, 0x33, 0x24, 0x22, 0x01,
+    0x99, 0xdb, 0xcc, 0xbb, 0xac, 0xab, 0x99, 0x10, 0x42, 0x35, 0x44, 0x32, 0x23, 0x12, 0x80, 0xba,
+    0xbe, 0xbd, 0xcb, 0xab, 0x9a, 0x09, 0x31, 0x35, 0x45, 0x32, 0x24, 0x21, 0x00, 0xa9, 0xdb, 0xbc,
+    0xbc, 0xbb, 0xab, 0x89, 0x30, 0x54, 0x34, 0x34, 0x43, 0x12, 0x01, 0xa8, 0xdb, 0xbc, 0xbc, 0xac,
+    0x9a, 0x89, 0x20, 0x53, 0x34, 0x34, 0x43, 0x12, 0x01, 0x99, 0xbc, 0xcd, 0xca, 0xaa, 0xaa, 0x88,
+    0x21, 0x53, 0x44, 0x33, 0x33, 0x22, 0x81, 0xb9, 0xbe, 0xbd, 0xbc, 0xba, 0x9a, 0x08, 0x41, 0x34,
+    0x35, 0x34, 0x32, 0x11, 0x90, 0xca, 0xcc, 0xbc, 0xbb, 0xbb, 0x99, 0x20, 0x44, 0x44, 0x43, 0x23,
+    0x23, 0x00, 0xa9, 0xdc, 0xcb, 0xcb, 0xab, 0x9a, 0x47, 0x10, 0xb7, 0x08, 0x08, 0xf0, 0x83, 0x91,
+    0x90, 0x12, 0xf2, 0x89, 0x50, 0x0b, 0x11, 0xa1, 0x1b, 0xa3, 0x79, 0x0d, 0x20, 0x99, 0x90, 0x10,
+    0x1a, 0xc6, 0x21, 0x8a, 0x20, 0x4c, 0x8a, 0x30, 0x09, 0xbb, 0xb6, 0x10, 0x38, 0x49, 0x1f, 0x88,
+    0x11, 0x3c, 0x99, 0xa5, 0x00, 0x10, 0xab, 0xa4, 0x8a, 0x27, 0x2b, 0x9b, 0x28, 0x5d, 0xb8, 0x01,
+    0xb2, 0xa1, 0x60, 0x09, 0xb1, 0x4b, 0x89, 0x78, 0xd2, 0x91, 0xa1, 0xa1, 0x13, 0x98, 0x7c, 0x90,
+    0x98, 0x98, 0x31, 0xab, 0x04, 0x5c, 0x99, 0x11, 0xc0, 0xc7, 0x01, 0x1a, 0x90, 0x13, 0x0e, 0x91,
+    0x01, 0x92, 0x5b, 0xd0, 0x28, 0x90, 0x28, 0x89, 0xc1, 0x20, 0x39, 0x8a, 0x89, 0x82, 0xbe, 0x46,
+    0xa0, 0x6d, 0x1a, 0x88, 0x88, 0x92, 0x4c, 0x18, 0x98, 0x90, 0xa8, 0x24, 0x0b, 0x8a, 0x15, 0xb9,
+    0x38, 0x92, 0xb2, 0x01, 0x9b, 0xc7, 0x80, 0x05, 0x8f, 0x02, 0xd8, 0x84, 0x90, 0x10, 0x99, 0x14,
+    0x0b, 0x1a, 0xb4, 0x1d, 0x48, 0x9b, 0x81, 0x86, 0x88, 0x88, 0x39, 0x09, 0xb1, 0x04, 0x21, 0x99,
+    0x4f, 0x8b, 0xd3, 0xa0, 0x83, 0x82, 0x3f, 0x92, 0x0a, 0x03, 0x3e, 0x0b, 0x18, 0x90, 0x28, 0xc6,
+    0x48, 0x9a, 0xa2, 0xb1, 0x05, 0x4a, 0x0a, 0x1c, 0x81, 0xb8, 0x05, 0xb9, 0x22, 0x39, 0x1b, 0x0e,
+    0x41, 0x2c, 0xab, 0xb7, 0x03, 0x08, 0xf2, 0x93, 0x59, 0x8a, 0xb0, 0xa3, 0x84, 0x2b, 0x2a, 0x02,
+    0x1f, 0x81, 0x4b, 0x28, 0x1b, 0xc0, 0x83, 0x09, 0xca, 0xd6, 0x82, 0x80, 0x4a, 0x19, 0x80, 0xe2,
+    0x95, 0x88, 0x48, 0x0b, 0x39, 0x8a, 0x20, 0xc0, 0x3e, 0x28, 0x18, 0x3c, 0x1b, 0x19, 0x20, 0x2f,
+    0x89, 0x13, 0x2f, 0x19, 0x91, 0x80, 0x10, 0xad, 0x12, 0xa0, 0x70, 0x89, 0x0a, 0x30, 0xa8, 0x69,
+    0x8b, 0x0a, 0x87, 0x10, 0x88, 0xf2, 0xa2, 0x21, 0x9b, 0x82, 0x29, 0x0b, 0x63, 0x0b, 0x98, 0x3c,
+    0xa2, 0xc0, 0x20, 0xb1, 0xf4, 0x30, 0x0b, 0x86, 0x0b, 0x20, 0x98, 0xa9, 0xa2, 0x00, 0x4e, 0xa4,
+    0xa2, 0x90, 0x82, 0xf8, 0xb7, 0x38, 0x98, 0x10, 0x91, 0xaa, 0xe3, 0x83, 0x82, 0x81, 0xca, 0x79,
+    0x09, 0xa1, 0xb5, 0x80, 0x9b, 0x16, 0x2b, 0x08, 0x19, 0xb8, 0xb7, 0x92, 0xa3, 0x1a, 0xb0, 0xa5,
+    0x3c, 0x22, 0x3b, 0x19, 0xcd, 0x02, 0xb8, 0x15, 0xc8, 0x21, 0xe3, 0xa0, 0x58, 0x98, 0x13, 0xf0,
+    0xb4, 0x90, 0x80, 0x10, 0x04, 0x0a, 0x2a, 0x1b, 0xa0, 0xb6, 0x28, 0x8a, 0x0b, 0xc4, 0x97, 0x08,
+    0xb3, 0x10, 0x89, 0x38, 0x3c, 0x1b, 0x7a, 0xa9, 0x92, 0xa5, 0x0a, 0xb5, 0xb2, 0x28, 0x4c, 0x88,
+    0x94, 0x2d, 0x09, 0x90, 0x83, 0x1a, 0x0a, 0x34, 0xbd, 0x91, 0x12, 0x85, 0xfb, 0xa2, 0x84, 0x90,
+    0x88, 0x5c, 0x10, 0xa0, 0x0a, 0xd5, 0xb2, 0x42, 0x1c, 0x1b, 0x92, 0xb3, 0xb8, 0x85, 0xb8, 0x71,
+    0x18, 0x99, 0x49, 0x2e, 0x18, 0x19, 0x81, 0x39, 0xbd, 0x33, 0x4f, 0x89, 0x19, 0x91, 0xa8, 0x91,
+    0xa3, 0x08, 0x91, 0x97, 0x10, 0x3c, 0xab, 0x78, 0xb1, 0x09, 0xa2, 0xa5, 0x38, 0x9a, 0x5a, 0x80,
+    0xb0, 0xc6, 0x01, 0xb0, 0x84, 0x8a, 0x08, 0x79, 0x1a, 0x90, 0x89, 0x00, 0x59, 0x08, 0x2c, 0x91,
+    0x28, 0xb8, 0x02, 0x0b, 0x78, 0x38, 0xab, 0x2a, 0xe7, 0x31, 0xb0, 0x48, 0xd0, 0x98, 0x31, 0x0c,
+    0xa5, 0x89, 0x00, 0x20, 0x4b, 0x8c, 0x82, 0x29, 0x81, 0xa4, 0x7a, 0xa8, 0x90, 0x02, 0x1a, 0xb0,
+    0x19, 0x7b, 0xda, 0x03, 0x6c, 0x80, 0x98, 0x28, 0x0e, 0x21, 0x3c, 0x9a, 0x32, 0x0c, 0x29, 0x3a,
+    0x7b, 0x8a, 0x10, 0x49, 0x8a, 0xd8, 0x02, 0x48, 0x2c, 0xf3, 0x28, 0x19, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x8f, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08,
+    0x88, 0x80, 0x08, 0x88, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const int16_t firmware_pcm[4000] = {
+    0, 11, 41, 104, 240, 533, 1164, 2521, 5431, 6677, 7811, 8154,
+    9090, 9942, 10716, 11419, 12058, 12640, 13168, 13969, 14405, 15067, 15427, 15974,
+    16471, 16923, 17334, 17856, 18196, 18504, 18784, 19039, 19270, 19480, 19671, 19844,
+    19938, 19966, 19992, 19969, 19948, 19851, 19728, 19550, 19385, 19148, 18864, 18519,
+    18196, 17817, 17358, 16927, 16422, 15946, 15391, 14869, 14121, 13624, 12810, 12263,
+    11368, 10767, 10001, 9106, 8265, 7499, 6604, 5763, 4778, 3851, 3010, 2025,
+    1098, 257, -728, -1655, -2496, -3481, -4408, -5249, -6234, -7161, -8002, -8768,
+    -9663, -10504, -11270, -11966, -12780, -13546, -14242, -14875, -15450, -16122, -16574, -17149,
+    -17671, -18147, -18455, -18847, -19102, -19425, -19635, -19749, -19922, -19953, -19981, -19955,
+    -19885, -19778, -19602, -19389, -19074, -18780, -18435, -18018, -17513, -17037, -16482, -15810,
+    -15177, -14602, -13781, -13015, -12319, -11505, -10520, -9593, -8752, -7767, -6840, -5757,
+    -4738, -3811, -2728, -1709, -782, 301, 1320, 2512, 3633, 4652, 5579, 6662,
+    7681, 8608, 9449, 10434, 11361, 12202, 12968, 13863, 14704, 15251, 15947, 16580,
+    17155, 17677, 18289, 18700, 19073, 19277, 19585, 19753, 19906, 19952, 19994, 19956,
+    19853, 19633, 19433, 19146, 18801, 18384, 17879, 17403, 16725, 16092, 15352, 14656,
+    13842, 13076, 12181, 11098, 10370, 9178, 8057, 7038, 6111, 5028, 3717, 2836,
+    1394, 424, -809, -1930, -3241, -4122, -5564, -6534, -7767, -8888, -9907, -10834,
+    -11675, -12660, -13587, -14428, -15194, -16089, -16690, -17237, -17933, -18385, -18796, -19169,
+    -19509, -19693, -19861, -20014, -19968, -19926, -19812, -19570, -19286, -18941, -18524, -18019,
+    -17407, -16832, -16160, -15346, -14580, -13685, -12602, -11874, -10682, -9561, -8542, -7350,
+    -6229, -4918, -3685, -2564, -1253, -20, 1422, 2392, 3979, 5045, 6403, 7636,
+    8757, 9776, 10968, 12089, 12817, 14009, 14810, 15538, 16465, 17066, 17832, 18329,
+    18781, 19192, 19565, 19769, 19953, 20009, 19958, 19912, 19702, 19435, 19053, 18594,
+    18039, 17517, 16769, 16073, 15259, 14274, 13347, 12264, 11245, 10053, 8932, 7621,
+    6388, 5267, 3665, 2599, 1241, -346, -1412, -2770, -4357, -5423, -6781, -8368,
+    -9434, -10792, -11673, -12794, -13813, -14740, -15823, -16551, -17213, -18054, -18601, -18899,
+    -19351, -19762, -19836, -20040, -19979, -19923, -19668, -19437, -19058, -18497, -17975, -17227,
+    -16531, -15717, -14732, -13805, -12722, -11703, -10246, -9276, -7689, -6623, -5265, -3678,
+    -2186, -828, 759, 2251, 3609, 4842, 6284, 7642, 8875, 10317, 11675, 12556,
+    13677, 14696, 15888, 16689, 17417, 18079, 18680, 19227, 19525, 19796, 19878, 19952,
+    19884, 19823, 19431, 19074, 18565, 17953, 17213, 16517, 15522, 14595, 13512, 12493,
+    11036, 9678, 8445, 7003, 5645, 4058, 2566, 1208, -379, -1871, -3617, -4790,
+    -6282, -8028, -9201, -10693, -12051, -12932, -14053, -15364, -16245, -17046, -17774, -18436,
+    -19037, -19365, -19663, -19934, -20016, -19942, -19738, -19430, -19038, -18477, -17805, -16991,
+    -16225, -15131, -14112, -12920, -11799, -10197, -8705, -7347, -6114, -4352, -2710, -1218,
+    528, 2170, 3662, 5020, 6607, 8099, 9845, 11018, 12510, 13480, 14713, 15834,
+    16853, 17515, 18356, 18903, 19400, 19671, 19917, 19991, 19923, 19739, 19459, 18898,
+    18376, 17628, 16733, 15892, 14688, 13567, 12256, 11023, 9581, 7835, 6662, 4742,
+    2935, 1293, -199, -1945, -3587, -5079, -6825, -8467, -9959, -11317, -12550, -13992,
+    -14962, -16195, -16996, -18015, -18677, -19278, -19606, -19904, -19994, -19912, -19838, -19498,
+    -19067, -18450, -17710, -16815, -15732, -14713, -13521, -12079, -10721, -9134, -7642, -5896,
+    -4254, -2334, -527, 1115, 2607, 4353, 5995, 7915, 9206, 10848, 12340, 13698,
+    14931, 16052, 17071, 17998, 18599, 19146, 19643, 19914, 19996, 19922, 19718, 19287,
+    18782, 18170, 17266, 16425, 15221, 14100, 12498, 11006, 9648, 8061, 6141, 4334,
+    2692, 772, -1035, -2677, -4597, -6404, -8046, -9538, -11284, -12457, -13949, -15307,
+    -16540, -17341, -18360, -19022, -19382, -19710, -20008, -19918, -19836, -19463, -18987, -18309,
+    -17495, -16510, -15318, -14197, -12595, -11103, -9745, -7806, -5999, -4357, -2437, -630,
+    1482, 2902, 5226, 6787, 8775, 10066, 11708, 13200, 14558, 15791, 16912, 17931,
+    18593, 19194, 19741, 20039, 19949, 19867, 19494, 19018, 18340, 17526, 16541, 15349,
+    13907, 12549, 10962, 9470, 7724, 5612, 3624, 1817, 175, -2171, -3732, -5720,
+    -7527, -9639, -11059, -12866, -14039, -15531, -16501, -17734, -18535, -19263, -19660, -20020,
+    -19911, -19812, -19541, -19130, -18309, -17543, -16449, -15138, -13905, -12463, -10717, -9075,
+    -7155, -5348, -3236, -1248, 559, 2671, 4659, 6466, 8578, 10566, 11857, 13499,
+    14991, 16349, 17230, 18351, 19079, 19476, 19836, 19945, 19846, 19575, 19164, 18343,
+    17577, 16483, 15172, 13585, 12093, 10347, 8705, 6785, 4978, 2866, 878, -1446,
+    -3631, -5619, -7426, -9538, -10958, -12765, -14407, -15899, -16869, -18102, -18903, -19339,
+    -19736, -20096, -19987, -19689, -19237, -18497, -17602, -16519, -15208, -13621, -12129, -10383,
+    -8271, -6283, -4476, -2364, -376, 1948, 4133, 6121, 7928, 10040, 12028, 13319,
+    14961, 16453, 17423, 18304, 19105, 19541, 19938, 20058, 19730, 19432, 18799, 17895,
+    16812, 15501, 13914, 12422, 10676, 8564, 6576, 4769, 2657, 101, -1616, -3801,
+    -6357, -8074, -10259, -12247, -13538, -15180, -16672, -17642, -18523, -19324, -19760, -19892,
+    -20012, -19684, -19187, -18373, -17388, -16196, -14754, -13008, -11366, -9446, -7639, -5527,
+    -2971, -1254, 1557, 3447, 5851, 8036, 10024, 11831, 13473, 14965, 16323, 17556,
+    18677, 19405, 19802, 19922, 20031, 19534, 19082, 18178, 17095, 16076, 14354, 12712,
+    10792, 8985, 6873, 4885, 2561, 376, -2180, -4584, -6769, -8757, -11081, -12642,
+    -14630, -15921, -17094, -18160, -19130, -19658, -19818, -19963, -19831, -19230, -18464, -17370,
+    -16059, -14826, -13064, -10952, -8964, -7157, -4576, -2172, 13, 2569, 4973, 7158,
+    9146, 10953, 13065, 14485, 16292, 17465, 18531, 19113, 19641, 20121, 19976, 19579,
+    18978, 17993, 16801, 15359, 14001, 12062, 10255, 7674, 5957, 3146, 1256, -1836,
+    -3914, -6560, -8277, -10462, -12450, -14257, -15899, -17391, -18361, -19242, -19722, -19867,
+    -19999, -19639, -18873, -17978, -16895, -15584, -13645, -11838, -9726, -7738, -5414, -3229,
+    -673, 1731, 4542, 6432, 8836, 11021, 13009, 14816, 16458, 17524, 18882, 19410,
+    19890, 20035, 19903, 19302, 18536, 17442, 16131, 14544, 12624, 10817, 8705, 6149,
+    3745, 934, -956, -4048, -6126, -8772, -10489, -12674, -14662, -15953, -17595, -18661,
+    -19243, -19771, -19931, -19786, -19389, -18548, -17344, -15902, -14544, -12605, -10281, -8096,
+    -5540, -3136, -951, 1605, 4009, 6820, 9466, 11183, 13368, 15356, 16647, 17820,
+    18886, 19468, 19996, 19836, 19691, 19029, 17946, 16635, 15048, 13556, 11422, 8866,
+    6462, 4277, 1721, -683, -3494, -6140, -8544, -10729, -12717, -14524, -16166, -17658,
+    -18628, -19509, -19989, -19844, -19712, -19111, -18126, -16934, -15172, -13530, -11184, -8999,
+    -6443, -4039, -1228, 1418, 3822, 6633, 8523, 10927, 13112, 15100, 16907, 18080,
+    19146, 19728, 19904, 20064, 19628, 18701, 17618, 16307, 14368, 12561, 10449, 7893,
+    5489, 2678, 32, -2372, -5183, -7829, -10233, -12418, -14406, -16213, -17386, -18878,
+    -19460, -19988, -19828, -19683, -19021, -17938, -16627, -15040, -13120, -10796, -8611, -6055,
+    -2963, -54, 2592, 4996, 7807, 10453, 12170, 14355, 16343, 17634, 18807, 19446,
+    20028, 19852, 19692, 18964, 17772, 16330, 14584, 12472, 10484, 7644, 4998, 2594,
+    -217, -2863, -5955, -8864, -10754, -13158, -15343, -16763, -18054, -19227, -19866, -20060,
+    -19884, -19404, -18385, -16928, -15570, -13278, -11093, -8537, -6133, -3322, -676, 2416,
+    5325, 7971, 10375, 12560, 14548, 16355, 17997, 19063, 19645, 19821, 19981, 19253,
+    18591, 17268, 15681, 13761, 11437, 9252, 6128, 3219, 573, -2519, -4597, -7999,
+    -10286, -12364, -15010, -16727, -18288, -19140, -19914, -20148, -19935, -19353, -18120, -16999,
+    -15105, -13298, -10717, -8313, -5502, -2856, 236, 3145, 5791, 8883, 10961, 13607,
+    15324, 16885, 18305, 19596, 19830, 20043, 19461, 18933, 17491, 16133, 14194, 11870,
+    9685, 6561, 3652, 1006, -2086, -4995, -7641, -10045, -12856, -14746, -16463, -18024,
+    -19444, -19702, -19936, -19723, -19141, -17908, -16466, -14332, -12344, -9504, -6858, -4454,
+    -1019, 2183, 5092, 7738, 10142, 12953, 14843, 16560, 18121, 18973, 19747, 19981,
+    19768, 18798, 17917, 16155, 14043, 12055, 9215, 6569, 3477, 568, -2078, -5170,
+    -8079, -10725, -13129, -15314, -17302, -18593, -19296, -19935, -20129, -19601, -18480, -17169,
+    -15230, -13423, -10842, -8438, -5003, -1801, 1108, 3754, 6846, 9755, 12401, 14805,
+    16366, 17786, 19077, 19780, 19993, 19799, 18918, 17797, 15903, 14096, 11515, 9111,
+    6300, 2898, -304, -3213, -6615, -8902, -11811, -14457, -16174, -17735, -19155, -19929,
+    -20163, -19950, -18980, -17747, -16305, -14171, -11615, -9211, -6400, -2998, 204, 3113,
+    6515, 8802, 11711, 14357, 16074, 18259, 19111, 19885, 20119, 19480, 18898, 17665,
+    15903, 13791, 11235, 8143, 5234, 2588, -1191, -3707, -6909, -9818, -12464, -14868,
+    -17053, -18473, -19247, -19950, -19737, -19543, -18310, -16868, -15122, -12541, -10137, -7326,
+    -3924, -722, 2187, 5589, 8791, 11700, 13590, 15994, 17555, 18975, 19749, 19983,
+    19770, 18800, 17567, 15805, 13693, 11137, 8045, 5136, 1734, -1468, -4377, -7779,
+    -10981, -13059, -15705, -17422, -18983, -19835, -20093, -19859, -19220, -17862, -15923, -13599,
+    -11414, -8290, -5381, -1979, 1223, 4965, 7481, 10683, 13592, 15482, 17199, 18760,
+    19612, 19870, 19636, 18997, 17639, 15700, 13376, 11191, 8067, 5158, 1756, -1446,
+    -5188, -8710, -10997, -13906, -15796, -17513, -19074, -19926, -20184, -19481, -18842, -17096,
+    -14984, -12996, -10156, -6754, -3552, -643, 2759, 5961, 9703, 12219, 14506, 16584,
+    18474, 19504, 19816, 20100, 19326, 18153, 16233, 13909, 11724, 8600, 4858, 2342,
+    -1775, -4542, -8064, -11266, -14175, -16065, -17782, -19343, -19627, -19885, -19651, -18585,
+    -16839, -14727, -12171, -9079, -6170, -2768, 434, 4176, 7698, 10900, 12978, 15624,
+    17341, 18902, 19754, 20012, 19778, 18712, 16966, 14854, 12298, 9894, 6459, 3257,
+    -485, -4007, -7209, -10118, -13520, -15807, -17885, -19019, -20049, -19737, -19453, -18679,
+    -17037, -15117, -12277, -9631, -5852, -2330, 872, 4614, 8136, 10423, 13332, 15978,
+    17695, 19256, 20108, 19850, 19616, 18124, 16766, 14474, 11663, 8261, 5059, 2150,
+    -2008, -4775, -8297, -11499, -14408, -16298, -18015, -19576, -19860, -19602, -18899, -17833,
+    -15699, -13143, -10051, -7142, -3740, -538, 3204, 6726, 9928, 12837, 15483, 17887,
+    18823, 19675, 19933, 19699, 18207, 16461, 14349, 11793, 8701, 4959, 1437, -1765,
+    -5507, -9029, -12231, -15140, -17030, -18747, -19683, -19967, -19709, -18536, -17044, -14910,
+    -12354, -9262, -5520, -1998, 1204, 4946, 8468, 11670, 14579, 16469, 18186, 19747,
+    20031, 19773, 19070, 17150, 15343, 12762, 9670, 5928, 2406, -796, -4538, -8060,
+    -11262, -14171, -16817, -18534, -19470, -19754, -19496, -18793, -17301, -15167, -12611, -9519,
+    -5777, -2255, 1862, 5736, 8252, 12369, 15136, 16645, 18932, 19347, 19725, 19382,
+    18446, 17026, 14702, 11891, 8489, 5287, 1545, -2984, -6027, -9901, -12417, -15619,
+    -17697, -18831, -19861, -20173, -19321, -18030, -15918, -13362, -10270, -7361, -3203, 671,
+    4193, 7395, 11137, 13653, 16855, 18101, 19235, 20265, 19953, 19101, 17294, 14713,
+    12309, 8874, 5672, 1930, -2599, -5642, -9516, -13038, -15325, -17403, -19293, -19636,
+    -19948, -19096, -17805, -15693, -13137, -10045, -6303, -2781, 1336, 5210, 8732, 11934,
+    14843, 16733, 18450, 20011, 19727, 19469, 18296, 16376, 14052, 10617, 7415, 3673,
+    151, -3966, -7840, -11362, -14564, -16642, -18532, -19562, -19874, -19590, -18299, -16657,
+    -14311, -10876, -7674, -3932, -410, 3707, 7581, 11103, 14305, 16383, 18273, 19303,
+    20239, 19387, 18613, 16501, 13945, 10853, 7111, 3589, -528, -4402, -7924, -11126,
+    -14035, -16681, -18398, -19959, -20243, -19469, -18296, -16376, -13536, -10134, -6932, -3190,
+    1339, 4382, 8256, 11778, 14980, 17058, 18948, 19978, 19666, 19382, 17575, 15463,
+    12907, 9128, 5606, 1489, -2385, -5907, -10024, -12791, -16313, -17685, -19763, -20141,
+    -19798, -18862, -16874, -14550, -11739, -7581, -3707, -185, 3932, 7806, 11328, 14530,
+    16608, 18498, 19528, 19840, 19556, 17749, 15637, 13081, 9302, 5780, 1663, -2211,
+    -5733, -9850, -13724, -16240, -18527, -19773, -20151, -19808, -18872, -16884, -14044, -10642,
+    -7440, -2867, 1393, 5267, 8789, 11991, 14900, 17546, 19263, 20199, 19915, 19141,
+    17029, 15041, 11684, 8482, 3909, -351, -4225, -7747, -11864, -14631, -17147, -18519,
+    -19765, -20143, -19113, -17552, -14996, -11904, -8995, -4837, -963, 3566, 7826, 11700,
+    14216, 17418, 18664, 19798, 20141, 19205, 17785, 15461, 12026, 8824, 5082, 553,
+    -3707, -7581, -11103, -14305, -17214, -19104, -20134, -19822, -18970, -17679, -15098, -12006,
+    -8264, -4742, -625, 4356, 7704, 11964, 14731, 17247, 18619, 19865, 20243, 19213,
+    17028, 14472, 11380, 7638, 4116, -916, -4264, -8524, -12398, -14914, -18116, -19362,
+    -19740, -19397, -18461, -16473, -13633, -10231, -7029, -2456, 1804, 5678, 10207, 13250,
+    16017, 18533, 19905, 20320, 19186, 18156, 15971, 12847, 9105, 4576, 316, -3558,
+    -8087, -11130, -15004, -17520, -18892, -20138, -19760, -18730, -17169, -14613, -10834, -7312,
+    -3195, 1786, 5134, 9394, 13268, 15784, 18071, 19317, 19695, 19352, 17791, 15803,
+    12446, 9244, 4671, 411, -3463, -7992, -12252, -15019, -17535, -18907, -20153, -19775,
+    -18745, -16560, -13436, -10527, -6369, -1388, 1960, 6220, 11201, 14549, 16374, 19141,
+    19644, 20101, 18855, 16965, 14561, 11126, 7009, 3135, -1394, -5654, -9528, -13050,
+    -16252, -18330, -19464, -19807, -19495, -17507, -15183, -11748, -7631, -3757, 772, 5032,
+    8906, 13435, 16478, 18138, 19647, 20104, 19689, 17799, 15395, 11960, 7843, 3969,
+    -560, -4820, -9801, -13149, -16192, -17852, -19361, -19818, -19403, -17513, -15109, -11674,
+    -7557, -3683, 846, 5106, 8980, 13509, 16552, 18212, 19721, 20178, 18932, 17798,
+    14706, 11797, 7639, 2658, -690, -6169, -9852, -13200, -16243, -19010, -19513, -19970,
+    -18724, -16834, -14430, -10995, -6878, -1897, 2790, 7050, 10924, 14446, 16733, 18811,
+    19945, 19602, 18666, 16678, 13321, 10119, 5546, 1286, -3695, -8382, -11425, -15299,
+    -17815, -19187, -19602, -19224, -18194, -15383, -11981, -8779, -4206, 54, 5035, 9722,
+    12765, 16639, 18148, 19520, 19935, 18801, 17084, 14273, 10871, 6754, 1773, -2914,
+    -7174, -11048, -14570, -17772, -19018, -20152, -19809, -18248, -15692, -12600, -8858, -4329,
+    -69, 4912, 9599, 12642, 16516, 19032, 19489, 19904, 18770, 17053, 14242, 10084,
+    6210, 1681, -2579, -7560, -12247, -15290, -18057, -19566, -12704, -3879, -2693, 542,
+    15250, 535, -1376, 361, -1218, 217, 1522, -16276, 1529, -783, 5523, -210,
+    1527, -3210, 3968, 7883, 13815, -2365, -9302, -11404, -9493, 9617, -8188, -5876,
+    430, 6163, 11374, 3478, -6571, -2656, 5649, 256, -2685, 10687, -10335, -7537,
+    -4994, 6568, 262, -5471, -3734, -8471, -7036, -3121, -9053, -5818, 6929, -8707,
+    -2401, 7154, -1532, -3111, -1676, 4850, -5829, 7093, -1593, -3172, -1737, 7399,
+    3840, 4918, -1945, -8185, 2351, -7698, -6393, -2834, -3912, 2951, 277, 7571,
+    -7137, -831, -2742, -4479, 258, 4564, -7183, 3871, -435, -4350, 8702, 16,
+    1595, 3030, 4335, 7894, 344, -4558, 3465, -1928, -6830, -7721, 4436, 13122,
+    2068, 9246, 110, -3449, -4527, 375, -9431, 4926, 3015, -9145, -4408, -2973,
+    3553, -4752, -1517, -6419, -5528, 5008, 702, 2007, 5566, -1984, -8847, -824,
+    -4059, -5039, -5930, 6227, 14913, -2459, 4478, -1828, 3905, -4781, -44, -7222,
+    1914, 5473, 4395, 1454, -6569, 9611, 11923, 5617, 3706, -1505, -3084, -7390,
+    -3475, 4830, -2720, -7622, 401, 1479, -7346, 5706, 495, -4242, 64, 3979,
+    5165, -4543, 15035, -10148, 8, 3085, -10905, -3275, -963, -7269, 6108, 11319,
+    -9212, -6414, 1216, -5721, 585, 2496, 11182, 6445, -3604, 10753, 12664, -6446,
+    -8989, 2573, 4675, -1058, -2795, 5101, 795, -510, 3049, -6659, -5354, 578,
+    -2657, 4206, -251, -1061, -3270, -3939, -896, -1449, -7991, -14231, -3695, 9227,
+    10964, 3068, -12725, 14604, -4017, 6139, 3062, 264, -2279, -4591, 5920, 187,
+    -15449, 3471, 928, 7865, 5763, 30, 1767, -2970, -4405, -10931, -252, 6926,
+    -2210, -1024, -6417, -7397, 2409, 6324, 2765, -4785, -5765, 475, 4527, 2318,
+    5666, 1406, 3066, 3569, 367, -879, 4791, -2503, -1523, -2414, 6501, 7687,
+    -8493, -10805, -294, 1617, -120, -17492, 3320, 522, 3065, -3872, -1770, 3963,
+    -1248, -5985, 6937, 12148, 1094, 2529, -3997, -438, 9270, 134, -12918, -7707,
+    -9286, 3636, -8524, -13261, -8955, -10260, 5165, 3063, 1152, -585, -2164, -3599,
+    -7514, 791, -2444, -1464, 1210, -4463, 2167, 3058, 5489, 9172, 7164, 5339,
+    -2963, 7716, -2333, -3638, 4667, -7198, -5619, -12797, -3661, -4847, 546, -434,
+    -13806, -429, 8257, 3520, -3658, -2353, 5952, 7030, -5717, 6443, -4611, -3176,
+    -4481, -922, 156, -2785, -3676, 376, 9953, -1794, -3373, 9549, 863, -3874,
+    3304, -3222, 337, -7213, 3573, 5008, -1518, 9161, 1983, 3288, -7391, -3085,
+    830, -356, -1434, -8297, 1509, 2814, -745, -8295, -3393, 1064, -1367, 3789,
+    -898, 927, -6268, -5288, -2614, 4680, -4145, 1787, -5763, -10665, 2707, -10670,
+    1490, 3069, 1634, 2939, 8871, -7309, 8878, 2572, -3161, 15949, 3231, 919,
+    3021, -10356, 1804, -6092, 6830, 5093, -5961, 1217, -5309, 623, 6016, 6996,
+    -6376, -643, 4568, 2989, -7060, 4687, 3108, 10286, 1150, 4709, 5787, -3038,
+    5267, 4189, 1248, 2139, -1913, -8543, 3046, -14326, -2764, -4866, -2955, -4692,
+    -12588, 334, -4877, -140, 1295, -10, 5922, -8101, 12921, 4527, 1984, -328,
+    -2430, 14770, -1417, 685, -5048, 7112, -784, -2219, -914, 5018, 6096, -2729,
+    -18154, -3439, -5350, 3336, 1757, 6063, -5684, 5370, -4679, -764, -4323, -1088,
+    -108, 4349, -7808, 878, -3859, -5294, 3842, 7401, -8779, 2783, -3523, 2210,
+    7421, 2684, 4119, 2814, 4000, 7235, -3551, -10729, -4203, -644, 434, -4468,
+    -3577, 8580, 3369, 1790, -5388, -4083, -2897, 4653, 3673, -784, -3215, 6362,
+    -2774, -3960, -9353, -8373, 4999, 3088, 4825, 9562, 8127, 6822, 12754, -3426,
+    8136, -2375, 3358, 12044, 990, -3316, 3210, 2024, -1211, 3691, -2549, -1739,
+    3417, 12123, 3818, 4896, 3916, 1242, -6052, 811, 5268, 1216, 1952, -4075,
+    -3265, 418, 2426, -1834, 3147, -6898, -5463, 3673, -4632, -3554, 9193, 7456,
+    -3598, -2163, -858, 5074, 3996, 1055, -1619, -5671, -1988, -5336, -4728, -4175,
+    -10717, -2694, 7014, 488, 6420, 1027, 2007, -667, 3385, 2649, 1980, -7151,
+    12427, -7159, -9702, 6485, 4383, -1350, 387, 5124, 9430, 5515, -417, -5810,
+    1053, -10536, 518, -917, 5609, 4423, 7658, 6678, 2221, -5073, -8014, 5358,
+    -375, 1362, 6099, -1079, 13278, -99, 1638, 59, -9990, -13905, 1520, 7826,
+    -5551, 3135, 1556, 2991, -924, 2635, 1557, -5306, 8066, -5311, 3375, -1362,
+    8687, 2161, -3771, -536, 444, -5796, 3119, -2813, -12521, -3385, 2547, 7940,
+    1077, 7317, 4886, 7095, -271, -9096, -3164, -2086, -3066, -9306, -391, 3168,
+    2090, -6735, -3176, 2217, 9080, -2509, -930, -8108, -9413, 3639, 1902, -2835,
+    7214, 11129, 12315, -3865, 16947, -2639, -96, -7033, -4931, -6842, -5105, -368,
+    12554, 14291, 6395, 7830, 1304, 7236, -314, 2627, 3518, -534, 9043, -93,
+    -1279, 4114, -788, -1679, -7352, -6616, -589, -7883, 6825, 519, -1392, 345,
+    11399, 1350, 2655, 6214, 2979, 1999, 1108, 6781, 151, 6391, 718, 2927,
+    -421, 8710, 4795, -1137, 4256, 1315, 11121, 4595, -1337, -259, 10527, 478,
+    7004, -1301, -2379, 2523, -5500, 4208, 2903, 1717, 11425, 7510, -5542, 3144,
+    -1593, -158, 1147, -2412, 5138, 4158, -299, 2132, -1551, -882, 4597, 9753,
+    2387, -4476, -1802, -4233, -550, 1458, 8154, 7263, 1590, -9460, -1564, -8742,
+    3005, 1426, 2861, -1054, -2240, -3318, -12143, 909, 2646, 7383, 8818, 2292,
+    -3640, -2562, 8224, -7569, 2942, -10435, -1749, 12465, -4735, 2202, -12513, -6780,
+    1906, -2831, 7218, -1918, -3104, -10654, 132, -1303, -2608, -10913, -7678, 7030,
+    4928, 10661, 5450, 713, -3593, 8154, -12377, 1613, -930, 6007, -299, 5434,
+    10645, 9066, 4760, 13896, 844, -11316, -262, 9787, -9791, 15392, 5236, 2159,
+    -6235, 1395, 8332, 2026, 115, -8571, -3834, -8140, 996, -4936, -6014, -5034,
+    -2360, -4791, 6259, 1522, 2957, 6872, -3807, 6242, -2894, -8826, -9904, 4804,
+    11110, -2267, -7478, -5899, 1279, -5247, 7805, -881, -2460, 7589, 1063, -2496,
+    -7889, 2897, 4332, 3027, 4213, -3337, 9410, -6226, 80, 1991, 3728, -7326,
+    5596, 3859, -4037, -5472, -6777, -5591, -8826, 5882, -4629, 1104, 2841, -1896,
+    -6202, -7507, -6321, -5243, -8184, 1622, 317, 1503, -8205, -1679, 1880, -1355,
+    -2335, 2122, 1312, -3844, -496, 112, -3762, -3259, -3716, 2520, 1629, 7302,
+    2146, -1202, -4245, -1478, 6070, -7953, -2220, 9940, 11519, 1470, 165, 10844,
+    12279, -2078, -3989, -9200, -4463, 5586, -6161, -4582, 11211, 700, -5033, -6770,
+    -5191, -3756, -2451, 3481, -4069, 4756, -5923, -7358, -832, -2018, -5253, -351,
+    2323, 1513, 8143, 3686, -366, 10684, 9105, 1927, 3232, -327, 5066, 6046,
+    1589, 4020, 4756, 69, -1756, -96, -3618, 3244, -1658, -11464, -2328, -1142,
+    -10850, 6118, 8430, 6328, 4417, -794, -2373, 4805, -12163, -9851, -3545, 6010,
+    -9626, 5089, -4466, -9677, -1781, 8268, -3479, -1900, -6206, 320, -5612, 1938,
+    -4925, 8447, -1108, -2845, -1266, 3040, -875, 9804, 2626, 1321, 135, -11730,
+    -3834, -2399, -3704, 6975, -5947, 2739, 13793, -7743, -10820, 3170, -4460, 2477,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 31275, 28076, 21214, 6506, -25027, -29122, -32768, -29383,
+    -32460, -32768, -30225, -32537, -32768, -30857, -32594, -32768, -31333, -32638, -32768, -31690,
+    -32670, -32768, -31958, -32694, -32768, -32160, -32713, -32768, -32311, -32726, -32768, -32425,
+    -32737, -32768, -32510, -32744, -32768, -32574, -32750, -32768, -30583, -25899, -15854, 5682,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767,
+};
+
+static const uint8_t audioop_adpcm[2000] = {
+    0x70, 0x77, 0x77, 0x77, 0x17, 0x01, 0x11, 0x11, 0x11, 0x21, 0x21, 0x21, 0x22, 0x32, 0x22, 0x22,
+    0x22, 0x22, 0x01, 0x80, 0xa8, 0xdb, 0xdb, 0xcc, 0xcb, 0xbc, 0xbc, 0xbc, 0xad, 0xac, 0xac, 0xcb,
+    0xbb, 0xbc, 0xbc, 0xcb, 0xbb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xbc, 0xbb, 0xcb, 0xba,
+    0xbb, 0xba, 0xba, 0x9a, 0x8a, 0x08, 0x21, 0x44, 0x35, 0x44, 0x34, 0x44, 0x33, 0x35, 0x43, 0x34,
+    0x43, 0x43, 0x33, 0x34, 0x43, 0x43, 0x33, 0x43, 0x33, 0x43, 0x33, 0x43, 0x23, 0x33, 0x33, 0x24,
+    0x12, 0x12, 0x01, 0x80, 0xb9, 0xdb, 0xcc, 0xbc, 0xbd, 0xbc, 0xbc, 0xcc, 0xca, 0xbb, 0xcb, 0xac,
+    0xac, 0xbb, 0xac, 0xac, 0xbb, 0xbb, 0xcb, 0xbb, 0xcb, 0xaa, 0xab, 0xaa, 0x9a, 0x99, 0x00, 0x31,
+    0x44, 0x44, 0x34, 0x44, 0x43, 0x24, 0x34, 0x43, 0x43, 0x33, 0x34, 0x24, 0x24, 0x33, 0x33, 0x34,
+    0x42, 0x22, 0x23, 0x23, 0x22, 0x12, 0x01, 0x88, 0xba, 0xcd, 0xbc, 0xbd, 0xcc, 0xcb, 0xcb, 0xcb,
+    0xbb, 0xad, 0xcb, 0xba, 0xac, 0xcb, 0xba, 0xba, 0xbb, 0xac, 0xba, 0x9a, 0xaa, 0x98, 0x00, 0x22,
+    0x54, 0x53, 0x43, 0x34, 0x34, 0x25, 0x24, 0x43, 0x33, 0x34, 0x33, 0x34, 0x43, 0x23, 0x33, 0x24,
+    0x22, 0x22, 0x11, 0x00, 0x88, 0xbb, 0xcd, 0xbc, 0xbd, 0xbc, 0xbd, 0xcb, 0xcb, 0xbb, 0xbc, 0xac,
+    0xcb, 0xba, 0xab, 0xcb, 0xaa, 0xaa, 0x9a, 0x99, 0x08, 0x21, 0x53, 0x44, 0x53, 0x43, 0x53, 0x33,
+    0x53, 0x33, 0x34, 0x33, 0x34, 0x24, 0x23, 0x33, 0x23, 0x23, 0x12, 0x01, 0x98, 0xda, 0xdb, 0xbc,
+    0xbd, 0xbc, 0xcc, 0xca, 0xbb, 0xcb, 0xbb, 0xbc, 0xbb, 0xcb, 0xba, 0xba, 0xaa, 0x99, 0x08, 0x20,
+    0x53, 0x44, 0x34, 0x44, 0x43, 0x43, 0x43, 0x33, 0x43, 0x43, 0x32, 0x33, 0x33, 0x33, 0x22, 0x12,
+    0x80, 0xb9, 0xcc, 0xbd, 0xbd, 0xbd, 0xcb, 0xbc, 0xcb, 0xbb, 0xbc, 0xbb, 0xac, 0xbb, 0xab, 0xab,
+    0x99, 0x09, 0x20, 0x53, 0x44, 0x34, 0x35, 0x53, 0x33, 0x34, 0x24, 0x24, 0x23, 0x33, 0x33, 0x33,
+    0x22, 0x12, 0x88, 0xba, 0xcd, 0xcc, 0xbc, 0xbc, 0xcc, 0xbb, 0xdb, 0xba, 0xcb, 0xba, 0xba, 0xba,
+    0xaa, 0x99, 0x00, 0x21, 0x35, 0x45, 0x43, 0x34, 0x34, 0x34, 0x43, 0x33, 0x34, 0x32, 0x33, 0x32,
+    0x12, 0x01, 0x98, 0xda, 0xdb, 0xcc, 0xcb, 0xcb, 0xcb, 0xcb, 0xbb, 0xcb, 0xba, 0xbb, 0xba, 0x9a,
+    0x99, 0x10, 0x42, 0x44, 0x44, 0x43, 0x34, 0x43, 0x43, 0x33, 0x43, 0x23, 0x33, 0x22, 0x12, 0x01,
+    0x99, 0xdb, 0xcc, 0xbc, 0xcc, 0xbb, 0xcc, 0xba, 0xac, 0xbb, 0xba, 0xab, 0xaa, 0x89, 0x18, 0x42,
+    0x44, 0x44, 0x43, 0x43, 0x24, 0x24, 0x33, 0x33, 0x33, 0x33, 0x23, 0x01, 0xa0, 0xda, 0xbc, 0xbe,
+    0xbc, 0xbc, 0xbc, 0xbc, 0xbb, 0xac, 0xab, 0xaa, 0x9a, 0x88, 0x20, 0x53, 0x34, 0x45, 0x33, 0x35,
+    0x43, 0x33, 0x33, 0x24, 0x23, 0x12, 0x11, 0x98, 0xca, 0xcc, 0xdb, 0xdb, 0xca, 0xca, 0xba, 0xba,
+    0xbb, 0xbb, 0xaa, 0x89, 0x18, 0x43, 0x44, 0x35, 0x34, 0x34, 0x34, 0x24, 0x33, 0x33, 0x23, 0x13,
+    0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xcc, 0xcb, 0xca, 0xba, 0xba, 0xab, 0xab, 0x99, 0x08, 0x31, 0x45,
+    0x53, 0x34, 0x34, 0x43, 0x43, 0x23, 0x33, 0x22, 0x12, 0x81, 0xa8, 0xcc, 0xbc, 0xcd, 0xbb, 0xbc,
+    0xbc, 0xbb, 0xbb, 0xbb, 0xaa, 0x09, 0x20, 0x44, 0x35, 0x35, 0x34, 0x34, 0x43, 0x32, 0x33, 0x23,
+    0x12, 0x00, 0xb9, 0xcc, 0xbd, 0xcc, 0xcb, 0xbb, 0xbc, 0xbb, 0xbb, 0xba, 0x99, 0x00, 0x42, 0x44,
+    0x44, 0x43, 0x34, 0x33, 0x34, 0x32, 0x23, 0x12, 0x81, 0xa8, 0xcc, 0xcc, 0xdb, 0xbb, 0xbc, 0xbc,
+    0xba, 0xab, 0xaa, 0x89, 0x10, 0x53, 0x63, 0x43, 0x43, 0x43, 0x33, 0x33, 0x33, 0x23, 0x01, 0xa0,
+    0xda, 0xcc, 0xbc, 0xbd, 0xcb, 0xca, 0xaa, 0xab, 0x9a, 0x89, 0x10, 0x33, 0x36, 0x35, 0x34, 0x34,
+    0x43, 0x32, 0x22, 0x22, 0x00, 0x99, 0xbc, 0xcd, 0xdb, 0xbb, 0xbc, 0xbb, 0xac, 0xaa, 0x8a, 0x08,
+    0x31, 0x54, 0x53, 0x33, 0x35, 0x33, 0x43, 0x22, 0x12, 0x01, 0xa8, 0xda, 0xbc, 0xbd, 0xbc, 0xcb,
+    0xbb, 0xbb, 0xab, 0x99, 0x18, 0x43, 0x35, 0x35, 0x35, 0x33, 0x34, 0x33, 0x22, 0x12, 0x80, 0xba,
+    0xbe, 0xbd, 0xcc, 0xbb, 0xac, 0xbb, 0xaa, 0x9a, 0x08, 0x32, 0x54, 0x34, 0x44, 0x33, 0x24, 0x33,
+    0x32, 0x11, 0x90, 0xb9, 0xcd, 0xcc, 0xbb, 0xad, 0xbb, 0xbb, 0xab, 0x99, 0x00, 0x43, 0x54, 0x43,
+    0x34, 0x43, 0x33, 0x32, 0x22, 0x01, 0xa8, 0xdb, 0xcc, 0xbc, 0xbc, 0xcb, 0xab, 0xab, 0x9a, 0x08,
+    0x31, 0x45, 0x53, 0x43, 0x43, 0x32, 0x23, 0x22, 0x01, 0x98, 0xdb, 0xbc, 0xbd, 0xbc, 0xbc, 0xba,
+    0xaa, 0x9a, 0x18, 0x41, 0x34, 0x45, 0x33, 0x34, 0x24, 0x22, 0x12, 0x00, 0xa9, 0xcc, 0xdb, 0xac,
+    0xac, 0xbb, 0xab, 0xaa, 0x88, 0x20, 0x44, 0x44, 0x43, 0x43, 0x33, 0x32, 0x22, 0x01, 0xa8, 0xcc,
+    0xbc, 0xbd, 0xbc, 0xbb, 0xac, 0x9a, 0x09, 0x10, 0x43, 0x35, 0x35, 0x43, 0x23, 0x33, 0x22, 0x81,
+    0xb8, 0xeb, 0xcc, 0xbb, 0xad, 0xbb, 0xab, 0xaa, 0x08, 0x21, 0x45, 0x34, 0x34, 0x34, 0x33, 0x33,
+    0x11, 0x80, 0xcb, 0xcc, 0xcc, 0xbb, 0xbc, 0xbb, 0xaa, 0x89, 0x20, 0x53, 0x44, 0x34, 0x43, 0x33,
+    0x23, 0x22, 0x80, 0xc9, 0xdb, 0xcc, 0xbb, 0xbc, 0xbb, 0xab, 0x89, 0x10, 0x53, 0x44, 0x34, 0x34,
+    0x42, 0x12, 0x02, 0x80, 0xa9, 0xcc, 0xbc, 0xcc, 0xba, 0xba, 0x9a, 0x89, 0x21, 0x44, 0x34, 0x35,
+    0x33, 0x24, 0x13, 0x11, 0x98, 0xdb, 0xdb, 0xcb, 0xac, 0xbb, 0xaa, 0x8a, 0x18, 0x42, 0x44, 0x34,
+    0x34, 0x33, 0x23, 0x22, 0x88, 0xca, 0xdc, 0xcb, 0xcb, 0xbb, 0xab, 0x9a, 0x08, 0x32, 0x55, 0x43,
+    0x43, 0x33, 0x23, 0x12, 0x91, 0xc9, 0xcc, 0xbc, 0xbc, 0xbb, 0xbb, 0xaa, 0x18, 0x42, 0x45, 0x43,
+    0x24, 0x33, 0x23, 0x12, 0x88, 0xcb, 0xdc, 0xcb, 0xbb, 0xac, 0x9b, 0x8a, 0x10, 0x43, 0x54, 0x33,
+    0x34, 0x33, 0x22, 0x01, 0xb8, 0xcc, 0xbd, 0xbc, 0xcb, 0xab, 0x9a, 0x08, 0x31, 0x45, 0x53, 0x33,
+    0x33, 0x33, 0x12, 0x98, 0xbc, 0xbe, 0xbd, 0xbb, 0xac, 0x9a, 0x89, 0x21, 0x44, 0x53, 0x43, 0x33,
+    0x32, 0x11, 0x90, 0xca, 0xbd, 0xcc, 0xbb, 0xbb, 0xab, 0x09, 0x21, 0x45, 0x34, 0x44, 0x32, 0x22,
+    0x11, 0x90, 0xcb, 0xcc, 0xdb, 0xba, 0xab, 0x9b, 0x08, 0x31, 0x45, 0x53, 0x33, 0x24, 0x22, 0x01,
+    0x99, 0xdb, 0xcc, 0xbb, 0xac, 0xab, 0x99, 0x10, 0x42, 0x35, 0x44, 0x32, 0x23, 0x12, 0x80, 0xba,
+    0xbe, 0xbd, 0xcb, 0xab, 0x9a, 0x09, 0x31, 0x35, 0x45, 0x32, 0x24, 0x21, 0x00, 0xa9, 0xdb, 0xbc,
+    0xbc, 0xbb, 0xab, 0x89, 0x30, 0x54, 0x34, 0x34, 0x43, 0x12, 0x01, 0xa8, 0xdb, 0xbc, 0xbc, 0xac,
+    0x9a, 0x89, 0x20, 0x53, 0x34, 0x34, 0x43, 0x12, 0x01, 0x99, 0xbc, 0xcd, 0xca, 0xaa, 0xaa, 0x88,
+    0x21, 0x53, 0x44, 0x33, 0x33, 0x22, 0x81, 0xb9, 0xbe, 0xbd, 0xbc, 0xba, 0x9a, 0x08, 0x41, 0x34,
+    0x35, 0x34, 0x32, 0x11, 0x90, 0xca, 0xcc, 0xbc, 0xbb, 0xbb, 0x99, 0x20, 0x44, 0x44, 0x43, 0x23,
+    0x23, 0x00, 0xa9, 0xdc, 0xcb, 0xcb, 0xab, 0x9a, 0x47, 0x10, 0xb7, 0x08, 0x08, 0xf0, 0x83, 0x91,
+    0x90, 0x12, 0xf2, 0x89, 0x50, 0x0b, 0x11, 0xa1, 0x1b, 0xa3, 0x79, 0x0d, 0x20, 0x99, 0x90, 0x10,
+    0x1a, 0xc6, 0x21, 0x8a, 0x20, 0x4c, 0x8a, 0x30, 0x09, 0xbb, 0xb6, 0x10, 0x38, 0x49, 0x1f, 0x88,
+    0x11, 0x3c, 0x99, 0xa5, 0x00, 0x10, 0xab, 0xa4, 0x8a, 0x27, 0x2b, 0x9b, 0x28, 0x5d, 0xb8, 0x01,
+    0xb2, 0xa1, 0x60, 0x09, 0xb1, 0x4b, 0x89, 0x78, 0xd2, 0x91, 0xa1, 0xa1, 0x13, 0x98, 0x7c, 0x90,
+    0x98, 0x98, 0x31, 0xab, 0x04, 0x5c, 0x99, 0x11, 0xc0, 0xc7, 0x01, 0x1a, 0x90, 0x13, 0x0e, 0x91,
+    0x01, 0x92, 0x5b, 0xd0, 0x28, 0x90, 0x28, 0x89, 0xc1, 0x20, 0x39, 0x8a, 0x89, 0x82, 0xbe, 0x46,
+    0xa0, 0x6d, 0x1a, 0x88, 0x88, 0x92, 0x4c, 0x18, 0x98, 0x90, 0xa8, 0x24, 0x0b, 0x8a, 0x15, 0xb9,
+    0x38, 0x92, 0xb2, 0x01, 0x9b, 0xc7, 0x80, 0x05, 0x8f, 0x02, 0xd8, 0x84, 0x90, 0x10, 0x99, 0x14,
+    0x0b, 0x1a, 0xb4, 0x1d, 0x48, 0x9b, 0x81, 0x86, 0x88, 0x88, 0x39, 0x09, 0xb1, 0x04, 0x21, 0x99,
+    0x4f, 0x8b, 0xd3, 0xa0, 0x83, 0x82, 0x3f, 0x92, 0x0a, 0x03, 0x3e, 0x0b, 0x18, 0x90, 0x28, 0xc6,
+    0x48, 0x9a, 0xa2, 0xb1, 0x05, 0x4a, 0x0a, 0x1c, 0x81, 0xb8, 0x05, 0xb9, 0x22, 0x39, 0x1b, 0x0e,
+    0x41, 0x2c, 0xab, 0xb7, 0x03, 0x08, 0xf2, 0x93, 0x59, 0x8a, 0xb0, 0xa3, 0x84, 0x2b, 0x2a, 0x02,
+    0x1f, 0x81, 0x4b, 0x28, 0x1b, 0xc0, 0x83, 0x09, 0xca, 0xd6, 0x82, 0x80, 0x4a, 0x19, 0x80, 0xe2,
+    0x95, 0x88, 0x48, 0x0b, 0x39, 0x8a, 0x20, 0xc0, 0x3e, 0x28, 0x18, 0x3c, 0x1b, 0x19, 0x20, 0x2f,
+    0x89, 0x13, 0x2f, 0x19, 0x91, 0x80, 0x10, 0xad, 0x12, 0xa0, 0x70, 0x89, 0x0a, 0x30, 0xa8, 0x69,
+    0x8b, 0x0a, 0x87, 0x10, 0x88, 0xf2, 0xa2, 0x21, 0x9b, 0x82, 0x29, 0x0b, 0x63, 0x0b, 0x98, 0x3c,
+    0xa2, 0xc0, 0x20, 0xb1, 0xf4, 0x30, 0x0b, 0x86, 0x0b, 0x20, 0x98, 0xa9, 0xa2, 0x00, 0x4e, 0xa4,
+    0xa2, 0x90, 0x82, 0xf8, 0xb7, 0x38, 0x98, 0x10, 0x91, 0xaa, 0xe3, 0x83, 0x82, 0x81, 0xca, 0x79,
+    0x09, 0xa1, 0xb5, 0x80, 0x9b, 0x16, 0x2b, 0x08, 0x19, 0xb8, 0xb7, 0x92, 0xa3, 0x1a, 0xb0, 0xa5,
+    0x3c, 0x22, 0x3b, 0x19, 0xcd, 0x02, 0xb8, 0x15, 0xc8, 0x21, 0xe3, 0xa0, 0x58, 0x98, 0x13, 0xf0,
+    0xb4, 0x90, 0x80, 0x10, 0x04, 0x0a, 0x2a, 0x1b, 0xa0, 0xb6, 0x28, 0x8a, 0x0b, 0xc4, 0x97, 0x08,
+    0xb3, 0x10, 0x89, 0x38, 0x3c, 0x1b, 0x7a, 0xa9, 0x92, 0xa5, 0x0a, 0xb5, 0xb2, 0x28, 0x4c, 0x88,
+    0x94, 0x2d, 0x09, 0x90, 0x83, 0x1a, 0x0a, 0x34, 0xbd, 0x91, 0x12, 0x85, 0xfb, 0xa2, 0x84, 0x90,
+    0x88, 0x5c, 0x10, 0xa0, 0x0a, 0xd5, 0xb2, 0x42, 0x1c, 0x1b, 0x92, 0xb3, 0xb8, 0x85, 0xb8, 0x71,
+    0x18, 0x99, 0x49, 0x2e, 0x18, 0x19, 0x81, 0x39, 0xbd, 0x33, 0x4f, 0x89, 0x19, 0x91, 0xa8, 0x91,
+    0xa3, 0x08, 0x91, 0x97, 0x10, 0x3c, 0xab, 0x78, 0xb1, 0x09, 0xa2, 0xa5, 0x38, 0x9a, 0x5a, 0x80,
+    0xb0, 0xc6, 0x01, 0xb0, 0x84, 0x8a, 0x08, 0x79, 0x1a, 0x90, 0x89, 0x00, 0x59, 0x08, 0x2c, 0x91,
+    0x28, 0xb8, 0x02, 0x0b, 0x78, 0x38, 0xab, 0x2a, 0xe7, 0x31, 0xb0, 0x48, 0xd0, 0x98, 0x31, 0x0c,
+    0xa5, 0x89, 0x00, 0x20, 0x4b, 0x8c, 0x82, 0x29, 0x81, 0xa4, 0x7a, 0xa8, 0x90, 0x02, 0x1a, 0xb0,
+    0x19, 0x7b, 0xda, 0x03, 0x6c, 0x80, 0x98, 0x28, 0x0e, 0x21, 0x3c, 0x9a, 0x32, 0x0c, 0x29, 0x3a,
+    0x7b, 0x8a, 0x10, 0x49, 0x8a, 0xd8, 0x02, 0x48, 0x2c, 0xf3, 0x28, 0x19, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x8f, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08,
+    0x88, 0x80, 0x08, 0x88, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88,
+    0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x0d, 0x88, 0x80, 0x08, 0x88, 0x80,
+    0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x08, 0x88, 0x80, 0x77, 0x77, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const int16_t audioop_pcm[4000] = {
+    0, 11, 41, 104, 240, 533, 1164, 2521, 5431, 6677, 7811, 8154,
+    9090, 9942, 10716, 11419, 12058, 12640, 13168, 13969, 14405, 15067, 15427, 15974,
+    16471, 16923, 17334, 17856, 18196, 18504, 18784, 19039, 19270, 19480, 19671, 19844,
+    19938, 19966, 19992, 19969, 19948, 19851, 19728, 19550, 19385, 19148, 18864, 18519,
+    18196, 17817, 17358, 16927, 16422, 15946, 15391, 14869, 14121, 13624, 12810, 12263,
+    11368, 10767, 10001, 9106, 8265, 7499, 6604, 5763, 4778, 3851, 3010, 2025,
+    1098, 257, -728, -1655, -2496, -3481, -4408, -5249, -6234, -7161, -8002, -8768,
+    -9663, -10504, -11270, -11966, -12780, -13546, -14242, -14875, -15450, -16122, -16574, -17149,
+    -17671, -18147, -18455, -18847, -19102, -19425, -19635, -19749, -19922, -19953, -19981, -19955,
+    -19885, -19778, -19602, -19389, -19074, -18780, -18435, -18018, -17513, -17037, -16482, -15810,
+    -15177, -14602, -13781, -13015, -12319, -11505, -10520, -9593, -8752, -7767, -6840, -5757,
+    -4738, -3811, -2728, -1709, -782, 301, 1320, 2512, 3633, 4652, 5579, 6662,
+    7681, 8608, 9449, 10434, 11361, 12202, 12968, 13863, 14704, 15251, 15947, 16580,
+    17155, 17677, 18289, 18700, 19073, 19277, 19585, 19753, 19906, 19952, 19994, 19956,
+    19853, 19633, 19433, 19146, 18801, 18384, 17879, 17403, 16725, 16092, 15352, 14656,
+    13842, 13076, 12181, 11098, 10370, 9178, 8057, 7038, 6111, 5028, 3717, 2836,
+    1394, 424, -809, -1930, -3241, -4122, -5564, -6534, -7767, -8888, -9907, -10834,
+    -11675, -12660, -13587, -14428, -15194, -16089, -16690, -17237, -17933, -18385, -18796, -19169,
+    -19509, -19693, -19861, -20014, -19968, -19926, -19812, -19570, -19286, -18941, -18524, -18019,
+    -17407, -16832, -16160, -15346, -14580, -13685, -12602, -11874, -10682, -9561, -8542, -7350,
+    -6229, -4918, -3685, -2564, -1253, -20, 1422, 2392, 3979, 5045, 6403, 7636,
+    8757, 9776, 10968, 12089, 12817, 14009, 14810, 15538, 16465, 17066, 17832, 18329,
+    18781, 19192, 19565, 19769, 19953, 20009, 19958, 19912, 19702, 19435, 19053, 18594,
+    18039, 17517, 16769, 16073, 15259, 14274, 13347, 12264, 11245, 10053, 8932, 7621,
+    6388, 5267, 3665, 2599, 1241, -346, -1412, -2770, -4357, -5423, -6781, -8368,
+    -9434, -10792, -11673, -12794, -13813, -14740, -15823, -16551, -17213, -18054, -18601, -18899,
+    -19351, -19762, -19836, -20040, -19979, -19923, -19668, -19437, -19058, -18497, -17975, -17227,
+    -16531, -15717, -14732, -13805, -12722, -11703, -10246, -9276, -7689, -6623, -5265, -3678,
+    -2186, -828, 759, 2251, 3609, 4842, 6284, 7642, 8875, 10317, 11675, 12556,
+    13677, 14696, 15888, 16689, 17417, 18079, 18680, 19227, 19525, 19796, 19878, 19952,
+    19884, 19823, 19431, 19074, 18565, 17953, 17213, 16517, 15522, 14595, 13512, 12493,
+    11036, 9678, 8445, 7003, 5645, 4058, 2566, 1208, -379, -1871, -3617, -4790,
+    -6282, -8028, -9201, -10693, -12051, -12932, -14053, -15364, -16245, -17046, -17774, -18436,
+    -19037, -19365, -19663, -19934, -20016, -19942, -19738, -19430, -19038, -18477, -17805, -16991,
+    -16225, -15131, -14112, -12920, -11799, -10197, -8705, -7347, -6114, -4352, -2710, -1218,
+    528, 2170, 3662, 5020, 6607, 8099, 9845, 11018, 12510, 13480, 14713, 15834,
+    16853, 17515, 18356, 18903, 19400, 19671, 19917, 19991, 19923, 19739, 19459, 18898,
+    18376, 17628, 16733, 15892, 14688, 13567, 12256, 11023, 9581, 7835, 6662, 4742,
+    2935, 1293, -199, -1945, -3587, -5079, -6825, -8467, -9959, -11317, -12550, -13992,
+    -14962, -16195, -16996, -18015, -18677, -19278, -19606, -19904, -19994, -19912, -19838, -19498,
+    -19067, -18450, -17710, -16815, -15732, -14713, -13521, -12079, -10721, -9134, -7642, -5896,
+    -4254, -2334, -527, 1115, 2607, 4353, 5995, 7915, 9206, 10848, 12340, 13698,
+    14931, 16052, 17071, 17998, 18599, 19146, 19643, 19914, 19996, 19922, 19718, 19287,
+    18782, 18170, 17266, 16425, 15221, 14100, 12498, 11006, 9648, 8061, 6141, 4334,
+    2692, 772, -1035, -2677, -4597, -6404, -8046, -9538, -11284, -12457, -13949, -15307,
+    -16540, -17341, -18360, -19022, -19382, -19710, -20008, -19918, -19836, -19463, -18987, -18309,
+    -17495, -16510, -15318, -14197, -12595, -11103, -9745, -7806, -5999, -4357, -2437, -630,
+    1482, 2902, 5226, 6787, 8775, 10066, 11708, 13200, 14558, 15791, 16912, 17931,
+    18593, 19194, 19741, 20039, 19949, 19867, 19494, 19018, 18340, 17526, 16541, 15349,
+    13907, 12549, 10962, 9470, 7724, 5612, 3624, 1817, 175, -2171, -3732, -5720,
+    -7527, -9639, -11059, -12866, -14039, -15531, -16501, -17734, -18535, -19263, -19660, -20020,
+    -19911, -19812, -19541, -19130, -18309, -17543, -16449, -15138, -13905, -12463, -10717, -9075,
+    -7155, -5348, -3236, -1248, 559, 2671, 4659, 6466, 8578, 10566, 11857, 13499,
+    14991, 16349, 17230, 18351, 19079, 19476, 19836, 19945, 19846, 19575, 19164, 18343,
+    17577, 16483, 15172, 13585, 12093, 10347, 8705, 6785, 4978, 2866, 878, -1446,
+    -3631, -5619, -7426, -9538, -10958, -12765, -14407, -15899, -16869, -18102, -18903, -19339,
+    -19736, -20096, -19987, -19689, -19237, -18497, -17602, -16519, -15208, -13621, -12129, -10383,
+    -8271, -6283, -4476, -2364, -376, 1948, 4133, 6121, 7928, 10040, 12028, 13319,
+    14961, 16453, 17423, 18304, 19105, 19541, 19938, 20058, 19730, 19432, 18799, 17895,
+    16812, 15501, 13914, 12422, 10676, 8564, 6576, 4769, 2657, 101, -1616, -3801,
+    -6357, -8074, -10259, -12247, -13538, -15180, -16672, -17642, -18523, -19324, -19760, -19892,
+    -20012, -19684, -19187, -18373, -17388, -16196, -14754, -13008, -11366, -9446, -7639, -5527,
+    -2971, -1254, 1557, 3447, 5851, 8036, 10024, 11831, 13473, 14965, 16323, 17556,
+    18677, 19405, 19802, 19922, 20031, 19534, 19082, 18178, 17095, 16076, 14354, 12712,
+    10792, 8985, 6873, 4885, 2561, 376, -2180, -4584, -6769, -8757, -11081, -12642,
+    -14630, -15921, -17094, -18160, -19130, -19658, -19818, -19963, -19831, -19230, -18464, -17370,
+    -16059, -14826, -13064, -10952, -8964, -7157, -4576, -2172, 13, 2569, 4973, 7158,
+    9146, 10953, 13065, 14485, 16292, 17465, 18531, 19113, 19641, 20121, 19976, 19579,
+    18978, 17993, 16801, 15359, 14001, 12062, 10255, 7674, 5957, 3146, 1256, -1836,
+    -3914, -6560, -8277, -10462, -12450, -14257, -15899, -17391, -18361, -19242, -19722, -19867,
+    -19999, -19639, -18873, -17978, -16895, -15584, -13645, -11838, -9726, -7738, -5414, -3229,
+    -673, 1731, 4542, 6432, 8836, 11021, 13009, 14816, 16458, 17524, 18882, 19410,
+    19890, 20035, 19903, 19302, 18536, 17442, 16131, 14544, 12624, 10817, 8705, 6149,
+    3745, 934, -956, -4048, -6126, -8772, -10489, -12674, -14662, -15953, -17595, -18661,
+    -19243, -19771, -19931, -19786, -19389, -18548, -17344, -15902, -14544, -12605, -10281, -8096,
+    -5540, -3136, -951, 1605, 4009, 6820, 9466, 11183, 13368, 15356, 16647, 17820,
+    18886, 19468, 19996, 19836, 19691, 19029, 17946, 16635, 15048, 13556, 11422, 8866,
+    6462, 4277, 1721, -683, -3494, -6140, -8544, -10729, -12717, -14524, -16166, -17658,
+    -18628, -19509, -19989, -19844, -19712, -19111, -18126, -16934, -15172, -13530, -11184, -8999,
+    -6443, -4039, -1228, 1418, 3822, 6633, 8523, 10927, 13112, 15100, 16907, 18080,
+    19146, 19728, 19904, 20064, 19628, 18701, 17618, 16307, 14368, 12561, 10449, 7893,
+    5489, 2678, 32, -2372, -5183, -7829, -10233, -12418, -14406, -16213, -17386, -18878,
+    -19460, -19988, -19828, -19683, -19021, -17938, -16627, -15040, -13120, -10796, -8611, -6055,
+    -2963, -54, 2592, 4996, 7807, 10453, 12170, 14355, 16343, 17634, 18807, 19446,
+    20028, 19852, 19692, 18964, 17772, 16330, 14584, 12472, 10484, 7644, 4998, 2594,
+    -217, -2863, -5955, -8864, -10754, -13158, -15343, -16763, -18054, -19227, -19866, -20060,
+    -19884, -19404, -18385, -16928, -15570, -13278, -11093, -8537, -6133, -3322, -676, 2416,
+    5325, 7971, 10375, 12560, 14548, 16355, 17997, 19063, 19645, 19821, 19981, 19253,
+    18591, 17268, 15681, 13761, 11437, 9252, 6128, 3219, 573, -2519, -4597, -7999,
+    -10286, -12364, -15010, -16727, -18288, -19140, -19914, -20148, -19935, -19353, -18120, -16999,
+    -15105, -13298, -10717, -8313, -5502, -2856, 236, 3145, 5791, 8883, 10961, 13607,
+    15324, 16885, 18305, 19596, 19830, 20043, 19461, 18933, 17491, 16133, 14194, 11870,
+    9685, 6561, 3652, 1006, -2086, -4995, -7641, -10045, -12856, -14746, -16463, -18024,
+    -19444, -19702, -19936, -19723, -19141, -17908, -16466, -14332, -12344, -9504, -6858, -4454,
+    -1019, 2183, 5092, 7738, 10142, 12953, 14843, 16560, 18121, 18973, 19747, 19981,
+    19768, 18798, 17917, 16155, 14043, 12055, 9215, 6569, 3477, 568, -2078, -5170,
+    -8079, -10725, -13129, -15314, -17302, -18593, -19296, -19935, -20129, -19601, -18480, -17169,
+    -15230, -13423, -10842, -8438, -5003, -1801, 1108, 3754, 6846, 9755, 12401, 14805,
+    16366, 17786, 19077, 19780, 19993, 19799, 18918, 17797, 15903, 14096, 11515, 9111,
+    6300, 2898, -304, -3213, -6615, -8902, -11811, -14457, -16174, -17735, -19155, -19929,
+    -20163, -19950, -18980, -17747, -16305, -14171, -11615, -9211, -6400, -2998, 204, 3113,
+    6515, 8802, 11711, 14357, 16074, 18259, 19111, 19885, 20119, 19480, 18898, 17665,
+    15903, 13791, 11235, 8143, 5234, 2588, -1191, -3707, -6909, -9818, -12464, -14868,
+    -17053, -18473, -19247, -19950, -19737, -19543, -18310, -16868, -15122, -12541, -10137, -7326,
+    -3924, -722, 2187, 5589, 8791, 11700, 13590, 15994, 17555, 18975, 19749, 19983,
+    19770, 18800, 17567, 15805, 13693, 11137, 8045, 5136, 1734, -1468, -4377, -7779,
+    -10981, -13059, -15705, -17422, -18983, -19835, -20093, -19859, -19220, -17862, -15923, -13599,
+    -11414, -8290, -5381, -1979, 1223, 4965, 7481, 10683, 13592, 15482, 17199, 18760,
+    19612, 19870, 19636, 18997, 17639, 15700, 13376, 11191, 8067, 5158, 1756, -1446,
+    -5188, -8710, -10997, -13906, -15796, -17513, -19074, -19926, -20184, -19481, -18842, -17096,
+    -14984, -12996, -10156, -6754, -3552, -643, 2759, 5961, 9703, 12219, 14506, 16584,
+    18474, 19504, 19816, 20100, 19326, 18153, 16233, 13909, 11724, 8600, 4858, 2342,
+    -1775, -4542, -8064, -11266, -14175, -16065, -17782, -19343, -19627, -19885, -19651, -18585,
+    -16839, -14727, -12171, -9079, -6170, -2768, 434, 4176, 7698, 10900, 12978, 15624,
+    17341, 18902, 19754, 20012, 19778, 18712, 16966, 14854, 12298, 9894, 6459, 3257,
+    -485, -4007, -7209, -10118, -13520, -15807, -17885, -19019, -20049, -19737, -19453, -18679,
+    -17037, -15117, -12277, -9631, -5852, -2330, 872, 4614, 8136, 10423, 13332, 15978,
+    17695, 19256, 20108, 19850, 19616, 18124, 16766, 14474, 11663, 8261, 5059, 2150,
+    -2008, -4775, -8297, -11499, -14408, -16298, -18015, -19576, -19860, -19602, -18899, -17833,
+    -15699, -13143, -10051, -7142, -3740, -538, 3204, 6726, 9928, 12837, 15483, 17887,
+    18823, 19675, 19933, 19699, 18207, 16461, 14349, 11793, 8701, 4959, 1437, -1765,
+    -5507, -9029, -12231, -15140, -17030, -18747, -19683, -19967, -19709, -18536, -17044, -14910,
+    -12354, -9262, -5520, -1998, 1204, 4946, 8468, 11670, 14579, 16469, 18186, 19747,
+    20031, 19773, 19070, 17150, 15343, 12762, 9670, 5928, 2406, -796, -4538, -8060,
+    -11262, -14171, -16817, -18534, -19470, -19754, -19496, -18793, -17301, -15167, -12611, -9519,
+    -5777, -2255, 1862, 5736, 8252, 12369, 15136, 16645, 18932, 19347, 19725, 19382,
+    18446, 17026, 14702, 11891, 8489, 5287, 1545, -2984, -6027, -9901, -12417, -15619,
+    -17697, -18831, -19861, -20173, -19321, -18030, -15918, -13362, -10270, -7361, -3203, 671,
+    4193, 7395, 11137, 13653, 16855, 18101, 19235, 20265, 19953, 19101, 17294, 14713,
+    12309, 8874, 5672, 1930, -2599, -5642, -9516, -13038, -15325, -17403, -19293, -19636,
+    -19948, -19096, -17805, -15693, -13137, -10045, -6303, -2781, 1336, 5210, 8732, 11934,
+    14843, 16733, 18450, 20011, 19727, 19469, 18296, 16376, 14052, 10617, 7415, 3673,
+    151, -3966, -7840, -11362, -14564, -16642, -18532, -19562, -19874, -19590, -18299, -16657,
+    -14311, -10876, -7674, -3932, -410, 3707, 7581, 11103, 14305, 16383, 18273, 19303,
+    20239, 19387, 18613, 16501, 13945, 10853, 7111, 3589, -528, -4402, -7924, -11126,
+    -14035, -16681, -18398, -19959, -20243, -19469, -18296, -16376, -13536, -10134, -6932, -3190,
+    1339, 4382, 8256, 11778, 14980, 17058, 18948, 19978, 19666, 19382, 17575, 15463,
+    12907, 9128, 5606, 1489, -2385, -5907, -10024, -12791, -16313, -17685, -19763, -20141,
+    -19798, -18862, -16874, -14550, -11739, -7581, -3707, -185, 3932, 7806, 11328, 14530,
+    16608, 18498, 19528, 19840, 19556, 17749, 15637, 13081, 9302, 5780, 1663, -2211,
+    -5733, -9850, -13724, -16240, -18527, -19773, -20151, -19808, -18872, -16884, -14044, -10642,
+    -7440, -2867, 1393, 5267, 8789, 11991, 14900, 17546, 19263, 20199, 19915, 19141,
+    17029, 15041, 11684, 8482, 3909, -351, -4225, -7747, -11864, -14631, -17147, -18519,
+    -19765, -20143, -19113, -17552, -14996, -11904, -8995, -4837, -963, 3566, 7826, 11700,
+    14216, 17418, 18664, 19798, 20141, 19205, 17785, 15461, 12026, 8824, 5082, 553,
+    -3707, -7581, -11103, -14305, -17214, -19104, -20134, -19822, -18970, -17679, -15098, -12006,
+    -8264, -4742, -625, 4356, 7704, 11964, 14731, 17247, 18619, 19865, 20243, 19213,
+    17028, 14472, 11380, 7638, 4116, -916, -4264, -8524, -12398, -14914, -18116, -19362,
+    -19740, -19397, -18461, -16473, -13633, -10231, -7029, -2456, 1804, 5678, 10207, 13250,
+    16017, 18533, 19905, 20320, 19186, 18156, 15971, 12847, 9105, 4576, 316, -3558,
+    -8087, -11130, -15004, -17520, -18892, -20138, -19760, -18730, -17169, -14613, -10834, -7312,
+    -3195, 1786, 5134, 9394, 13268, 15784, 18071, 19317, 19695, 19352, 17791, 15803,
+    12446, 9244, 4671, 411, -3463, -7992, -12252, -15019, -17535, -18907, -20153, -19775,
+    -18745, -16560, -13436, -10527, -6369, -1388, 1960, 6220, 11201, 14549, 16374, 19141,
+    19644, 20101, 18855, 16965, 14561, 11126, 7009, 3135, -1394, -5654, -9528, -13050,
+    -16252, -18330, -19464, -19807, -19495, -17507, -15183, -11748, -7631, -3757, 772, 5032,
+    8906, 13435, 16478, 18138, 19647, 20104, 19689, 17799, 15395, 11960, 7843, 3969,
+    -560, -4820, -9801, -13149, -16192, -17852, -19361, -19818, -19403, -17513, -15109, -11674,
+    -7557, -3683, 846, 5106, 8980, 13509, 16552, 18212, 19721, 20178, 18932, 17798,
+    14706, 11797, 7639, 2658, -690, -6169, -9852, -13200, -16243, -19010, -19513, -19970,
+    -18724, -16834, -14430, -10995, -6878, -1897, 2790, 7050, 10924, 14446, 16733, 18811,
+    19945, 19602, 18666, 16678, 13321, 10119, 5546, 1286, -3695, -8382, -11425, -15299,
+    -17815, -19187, -19602, -19224, -18194, -15383, -11981, -8779, -4206, 54, 5035, 9722,
+    12765, 16639, 18148, 19520, 19935, 18801, 17084, 14273, 10871, 6754, 1773, -2914,
+    -7174, -11048, -14570, -17772, -19018, -20152, -19809, -18248, -15692, -12600, -8858, -4329,
+    -69, 4912, 9599, 12642, 16516, 19032, 19489, 19904, 18770, 17053, 14242, 10084,
+    6210, 1681, -2579, -7560, -12247, -15290, -18057, -19566, -12704, -3879, -2693, 542,
+    15250, 535, -1376, 361, -1218, 217, 1522, -16276, 1529, -783, 5523, -210,
+    1527, -3210, 3968, 7883, 13815, -2365, -9302, -11404, -9493, 9617, -8188, -5876,
+    430, 6163, 11374, 3478, -6571, -2656, 5649, 256, -2685, 10687, -10335, -7537,
+    -4994, 6568, 262, -5471, -3734, -8471, -7036, -3121, -9053, -5818, 6929, -8707,
+    -2401, 7154, -1532, -3111, -1676, 4850, -5829, 7093, -1593, -3172, -1737, 7399,
+    3840, 4918, -1945, -8185, 2351, -7698, -6393, -2834, -3912, 2951, 277, 7571,
+    -7137, -831, -2742, -4479, 258, 4564, -7183, 3871, -435, -4350, 8702, 16,
+    1595, 3030, 4335, 7894, 344, -4558, 3465, -1928, -6830, -7721, 4436, 13122,
+    2068, 9246, 110, -3449, -4527, 375, -9431, 4926, 3015, -9145, -4408, -2973,
+    3553, -4752, -1517, -6419, -5528, 5008, 702, 2007, 5566, -1984, -8847, -824,
+    -4059, -5039, -5930, 6227, 14913, -2459, 4478, -1828, 3905, -4781, -44, -7222,
+    1914, 5473, 4395, 1454, -6569, 9611, 11923, 5617, 3706, -1505, -3084, -7390,
+    -3475, 4830, -2720, -7622, 401, 1479, -7346, 5706, 495, -4242, 64, 3979,
+    5165, -4543, 15035, -10148, 8, 3085, -10905, -3275, -963, -7269, 6108, 11319,
+    -9212, -6414, 1216, -5721, 585, 2496, 11182, 6445, -3604, 10753, 12664, -6446,
+    -8989, 2573, 4675, -1058, -2795, 5101, 795, -510, 3049, -6659, -5354, 578,
+    -2657, 4206, -251, -1061, -3270, -3939, -896, -1449, -7991, -14231, -3695, 9227,
+    10964, 3068, -12725, 14604, -4017, 6139, 3062, 264, -2279, -4591, 5920, 187,
+    -15449, 3471, 928, 7865, 5763, 30, 1767, -2970, -4405, -10931, -252, 6926,
+    -2210, -1024, -6417, -7397, 2409, 6324, 2765, -4785, -5765, 475, 4527, 2318,
+    5666, 1406, 3066, 3569, 367, -879, 4791, -2503, -1523, -2414, 6501, 7687,
+    -8493, -10805, -294, 1617, -120, -17492, 3320, 522, 3065, -3872, -1770, 3963,
+    -1248, -5985, 6937, 12148, 1094, 2529, -3997, -438, 9270, 134, -12918, -7707,
+    -9286, 3636, -8524, -13261, -8955, -10260, 5165, 3063, 1152, -585, -2164, -3599,
+    -7514, 791, -2444, -1464, 1210, -4463, 2167, 3058, 5489, 9172, 7164, 5339,
+    -2963, 7716, -2333, -3638, 4667, -7198, -5619, -12797, -3661, -4847, 546, -434,
+    -13806, -429, 8257, 3520, -3658, -2353, 5952, 7030, -5717, 6443, -4611, -3176,
+    -4481, -922, 156, -2785, -3676, 376, 9953, -1794, -3373, 9549, 863, -3874,
+    3304, -3222, 337, -7213, 3573, 5008, -1518, 9161, 1983, 3288, -7391, -3085,
+    830, -356, -1434, -8297, 1509, 2814, -745, -8295, -3393, 1064, -1367, 3789,
+    -898, 927, -6268, -5288, -2614, 4680, -4145, 1787, -5763, -10665, 2707, -10670,
+    1490, 3069, 1634, 2939, 8871, -7309, 8878, 2572, -3161, 15949, 3231, 919,
+    3021, -10356, 1804, -6092, 6830, 5093, -5961, 1217, -5309, 623, 6016, 6996,
+    -6376, -643, 4568, 2989, -7060, 4687, 3108, 10286, 1150, 4709, 5787, -3038,
+    5267, 4189, 1248, 2139, -1913, -8543, 3046, -14326, -2764, -4866, -2955, -4692,
+    -12588, 334, -4877, -140, 1295, -10, 5922, -8101, 12921, 4527, 1984, -328,
+    -2430, 14770, -1417, 685, -5048, 7112, -784, -2219, -914, 5018, 6096, -2729,
+    -18154, -3439, -5350, 3336, 1757, 6063, -5684, 5370, -4679, -764, -4323, -1088,
+    -108, 4349, -7808, 878, -3859, -5294, 3842, 7401, -8779, 2783, -3523, 2210,
+    7421, 2684, 4119, 2814, 4000, 7235, -3551, -10729, -4203, -644, 434, -4468,
+    -3577, 8580, 3369, 1790, -5388, -4083, -2897, 4653, 3673, -784, -3215, 6362,
+    -2774, -3960, -9353, -8373, 4999, 3088, 4825, 9562, 8127, 6822, 12754, -3426,
+    8136, -2375, 3358, 12044, 990, -3316, 3210, 2024, -1211, 3691, -2549, -1739,
+    3417, 12123, 3818, 4896, 3916, 1242, -6052, 811, 5268, 1216, 1952, -4075,
+    -3265, 418, 2426, -1834, 3147, -6898, -5463, 3673, -4632, -3554, 9193, 7456,
+    -3598, -2163, -858, 5074, 3996, 1055, -1619, -5671, -1988, -5336, -4728, -4175,
+    -10717, -2694, 7014, 488, 6420, 1027, 2007, -667, 3385, 2649, 1980, -7151,
+    12427, -7159, -9702, 6485, 4383, -1350, 387, 5124, 9430, 5515, -417, -5810,
+    1053, -10536, 518, -917, 5609, 4423, 7658, 6678, 2221, -5073, -8014, 5358,
+    -375, 1362, 6099, -1079, 13278, -99, 1638, 59, -9990, -13905, 1520, 7826,
+    -5551, 3135, 1556, 2991, -924, 2635, 1557, -5306, 8066, -5311, 3375, -1362,
+    8687, 2161, -3771, -536, 444, -5796, 3119, -2813, -12521, -3385, 2547, 7940,
+    1077, 7317, 4886, 7095, -271, -9096, -3164, -2086, -3066, -9306, -391, 3168,
+    2090, -6735, -3176, 2217, 9080, -2509, -930, -8108, -9413, 3639, 1902, -2835,
+    7214, 11129, 12315, -3865, 16947, -2639, -96, -7033, -4931, -6842, -5105, -368,
+    12554, 14291, 6395, 7830, 1304, 7236, -314, 2627, 3518, -534, 9043, -93,
+    -1279, 4114, -788, -1679, -7352, -6616, -589, -7883, 6825, 519, -1392, 345,
+    11399, 1350, 2655, 6214, 2979, 1999, 1108, 6781, 151, 6391, 718, 2927,
+    -421, 8710, 4795, -1137, 4256, 1315, 11121, 4595, -1337, -259, 10527, 478,
+    7004, -1301, -2379, 2523, -5500, 4208, 2903, 1717, 11425, 7510, -5542, 3144,
+    -1593, -158, 1147, -2412, 5138, 4158, -299, 2132, -1551, -882, 4597, 9753,
+    2387, -4476, -1802, -4233, -550, 1458, 8154, 7263, 1590, -9460, -1564, -8742,
+    3005, 1426, 2861, -1054, -2240, -3318, -12143, 909, 2646, 7383, 8818, 2292,
+    -3640, -2562, 8224, -7569, 2942, -10435, -1749, 12465, -4735, 2202, -12513, -6780,
+    1906, -2831, 7218, -1918, -3104, -10654, 132, -1303, -2608, -10913, -7678, 7030,
+    4928, 10661, 5450, 713, -3593, 8154, -12377, 1613, -930, 6007, -299, 5434,
+    10645, 9066, 4760, 13896, 844, -11316, -262, 9787, -9791, 15392, 5236, 2159,
+    -6235, 1395, 8332, 2026, 115, -8571, -3834, -8140, 996, -4936, -6014, -5034,
+    -2360, -4791, 6259, 1522, 2957, 6872, -3807, 6242, -2894, -8826, -9904, 4804,
+    11110, -2267, -7478, -5899, 1279, -5247, 7805, -881, -2460, 7589, 1063, -2496,
+    -7889, 2897, 4332, 3027, 4213, -3337, 9410, -6226, 80, 1991, 3728, -7326,
+    5596, 3859, -4037, -5472, -6777, -5591, -8826, 5882, -4629, 1104, 2841, -1896,
+    -6202, -7507, -6321, -5243, -8184, 1622, 317, 1503, -8205, -1679, 1880, -1355,
+    -2335, 2122, 1312, -3844, -496, 112, -3762, -3259, -3716, 2520, 1629, 7302,
+    2146, -1202, -4245, -1478, 6070, -7953, -2220, 9940, 11519, 1470, 165, 10844,
+    12279, -2078, -3989, -9200, -4463, 5586, -6161, -4582, 11211, 700, -5033, -6770,
+    -5191, -3756, -2451, 3481, -4069, 4756, -5923, -7358, -832, -2018, -5253, -351,
+    2323, 1513, 8143, 3686, -366, 10684, 9105, 1927, 3232, -327, 5066, 6046,
+    1589, 4020, 4756, 69, -1756, -96, -3618, 3244, -1658, -11464, -2328, -1142,
+    -10850, 6118, 8430, 6328, 4417, -794, -2373, 4805, -12163, -9851, -3545, 6010,
+    -9626, 5089, -4466, -9677, -1781, 8268, -3479, -1900, -6206, 320, -5612, 1938,
+    -4925, 8447, -1108, -2845, -1266, 3040, -875, 9804, 2626, 1321, 135, -11730,
+    -3834, -2399, -3704, 6975, -5947, 2739, 13793, -7743, -10820, 3170, -4460, 2477,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 31275, 28076, 21214, 6506, -25027, -29122, -32768, -29383,
+    -32460, -32768, -30225, -32537, -32768, -30857, -32594, -32768, -31333, -32638, -32768, -31690,
+    -32670, -32768, -31958, -32694, -32768, -32160, -32713, -32768, -32311, -32726, -32768, -32425,
+    -32737, -32768, -32510, -32744, -32768, -32574, -32750, -32768, -30583, -25899, -15854, 5682,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768,
+    -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768,
+    -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768,
+    -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    30780, 26520, 17389, -2189, -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456,
+    -32558, -32768, -31031, -32610, -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032,
+    -32701, -32768, -32215, -32718, -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534,
+    -32747, -32768, -32592, -32752, -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 30780, 26520, 17389, -2189,
+    -32768, -28673, -32397, -32768, -29691, -32489, -32768, -30456, -32558, -32768, -31031, -32610,
+    -32768, -31463, -32649, -32768, -31788, -32679, -32768, -32032, -32701, -32768, -32215, -32718,
+    -32768, -32353, -32731, -32768, -32456, -32740, -32768, -32534, -32747, -32768, -32592, -32752,
+    -30567, -25883, -15838, 5698, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+    32767, 32767, 32767, 32767,
+};
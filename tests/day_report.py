@@ -0,0 +1,58 @@
+#!/usr/bin/env python3
+"""
+@file day_report.py
+@brief Simula um dia de uso típico e mede o barramento I2C e o painel.
+
+Executa a simulação por 24 horas, com quatro alertas ao longo do dia, e
+extrai do relatório o tempo com o barramento I2C ocupado e o tempo do painel
+aceso, escurecido e apagado. Falha se o barramento passar de
+BUS_BUDGET_MS por dia.
+
+Uso:
+    day_report.py <seguranca_senior_sim>
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import re
+import subprocess
+import sys
+
+DAY_MS = 24 * 3600 * 1000
+PRESSES = ['A@28800000', 'B@45000000', 'C@54000000', 'D@72000000']  # 08:00, 12:30, 15:00 e 20:00
+BUS_BUDGET_MS = 20000
+
+BUS_RE = re.compile(r'I2C: barramento ocupado ([\d.]+) ms')
+PANEL_RE = re.compile(r'Painel: aceso ([\d.]+) s, escurecido ([\d.]+) s, apagado ([\d.]+) s')
+DISPLAY_RE = re.compile(r'Display: \w+, (\d+) transferências I2C, (\d+) bytes')
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    command = [argv[1], '--duration', str(DAY_MS)]
+    for press in PRESSES:
+        command += ['--press', press]
+    report = subprocess.run(command, capture_output=True, text=True, check=True).stdout
+
+    bus_ms = float(BUS_RE.search(report).group(1))
+    lit, dim, off = (float(v) for v in PANEL_RE.search(report).groups())
+    transfers, data = (int(v) for v in DISPLAY_RE.search(report).groups())
+    day_s = DAY_MS / 1000
+
+    print('Barramento I2C ocupado: %.1f s por dia (%.4f%%), %d transferências, %d bytes'
+          % (bus_ms / 1000, bus_ms / 10 / day_s, transfers, data))
+    print('Painel: aceso %.2f%%, escurecido %.2f%%, apagado %.2f%%'
+          % (lit * 100 / day_s, dim * 100 / day_s, off * 100 / day_s))
+
+    if bus_ms > BUS_BUDGET_MS:
+        print('Barramento acima do orçamento de %d ms por dia' % BUS_BUDGET_MS)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
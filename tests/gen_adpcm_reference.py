@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+@file gen_adpcm_reference.py
+@brief Gera os vetores de referência do decodificador IMA-ADPCM com o audioop.
+
+O sinal de teste (varredura de frequência, ruído e degraus de amplitude
+máxima, que levam o preditor e o índice aos limites) é codificado de duas
+formas: pelo codificador de tools/gen_audio_clips.py e pelo lin2adpcm() do
+audioop. As duas sequências são decodificadas pelo adpcm2lin() do audioop,
+a referência independente. O audioop guarda a primeira amostra no nibble
+alto; os bytes gravados seguem a ordem do firmware (nibble baixo primeiro).
+
+O resultado, tests/adpcm_reference.h, fica no repositório: o audioop saiu do
+Python 3.13, e o teste não pode depender dele. Gere de novo, com um Python
+até 3.12, se o sinal ou o codificador de tools/gen_audio_clips.py mudar.
+
+Uso:
+    gen_adpcm_reference.py tests/adpcm_reference.h
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import math
+import os
+import random
+import struct
+import sys
+import warnings
+
+with warnings.catch_warnings():
+    warnings.simplefilter('ignore', DeprecationWarning)
+    import audioop
+
+sys.path.insert(0, os.path.join(os.path.dirname(__file__), '..', 'tools'))
+import gen_audio_clips  # noqa: E402
+
+RATE = 16000
+SAMPLES = 4000
+
+
+def signal():
+    """Amostras de 16 bits do sinal de teste, sempre as mesmas."""
+    rng = random.Random(2025)
+    samples = []
+    for n in range(SAMPLES):
+        t = n / RATE
+        if n < 2000:
+            value = 20000 * math.sin(2 * math.pi * (100 + 2000 * t) * t)  # Varredura de 100 Hz a ~4 kHz
+        elif n < 3000:
+            value = rng.gauss(0, 6000)
+        else:
+            value = 32767 if (n // 40) % 2 else -32768  # Onda quadrada no limite
+        samples.append(max(-32768, min(32767, int(value))))
+    return samples
+
+
+def swap_nibbles(data):
+    return bytes(((b & 0x0F) << 4) | (b >> 4) for b in data)
+
+
+def c_array(kind, name, values, per_line):
+    lines = ['static const %s %s[%d] = {' % (kind, name, len(values))]
+    for i in range(0, len(values), per_line):
+        lines.append('    ' + ', '.join(values[i:i + per_line]) + ',')
+    lines.append('};')
+    lines.append('')
+    return lines
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    samples = signal()
+    pcm = struct.pack('<%dh' % len(samples), *samples)
+
+    with warnings.catch_warnings():
+        warnings.simplefilter('ignore', DeprecationWarning)
+        firmware = gen_audio_clips.encode(samples)
+        reference, _ = audioop.lin2adpcm(pcm, 2, None)
+        decoded_firmware, _ = audioop.adpcm2lin(swap_nibbles(firmware), 2, None)
+        decoded_reference, _ = audioop.adpcm2lin(reference, 2, None)
+
+    out = [
+        '// Arquivo gerado por tests/gen_adpcm_reference.py (Python com audioop) - não edite.',
+        '',
+        '#define REFERENCE_SAMPLES %d' % SAMPLES,
+        '',
+    ]
+    out += c_array('uint8_t', 'firmware_adpcm', ['0x%02x' % b for b in firmware], 16)
+    out += c_array('int16_t', 'firmware_pcm', [str(v) for v in struct.unpack('<%dh' % SAMPLES,
+                                                                           decoded_firmware[:SAMPLES * 2])], 12)
+    out += c_array('uint8_t', 'audioop_adpcm', ['0x%02x' % b for b in swap_nibbles(reference)], 16)
+    out += c_array('int16_t', 'audioop_pcm', [str(v) for v in struct.unpack('<%dh' % SAMPLES,
+                                                                          decoded_reference[:SAMPLES * 2])], 12)
+
+    with open(argv[1], 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,53 @@
+/**
+ * @file test.c
+ * @brief Contagem das verificações e encerramento dos testes.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sim.h"
+#include "test.h"
+
+static unsigned checks = 0;
+static unsigned failures = 0;
+
+bool test_check(bool ok, const char *file, int line, const char *format, ...) {
+    checks++;
+    if (!ok) {
+        va_list args;
+        failures++;
+        fprintf(stderr, "%s:%d: falhou: ", file, line);
+        va_start(args, format);
+        vfprintf(stderr, format, args);
+        va_end(args);
+        fputc('\n', stderr);
+    }
+    return ok;
+}
+
+bool test_check_int(long long actual, long long expected, const char *file, int line, const char *text) {
+    return test_check(actual == expected, file, line, "%s = %lld, esperado %lld", text, actual, expected);
+}
+
+bool test_check_str(const char *actual, const char *expected, const char *file, int line, const char *text) {
+    return test_check(strcmp(actual, expected) == 0, file, line, "%s = \"%s\", esperado \"%s\"", text, actual,
+                      expected);
+}
+
+int test_result(void) {
+    printf("%u verificações, %u falhas\n", checks, failures);
+    fflush(stdout);
+    return failures ? 1 : 0;
+}
+
+// Fim da simulação de um teste: o resultado é o das verificações
+void sim_finish(int status) {
+    int result = test_result();
+    exit(status ? status : result);
+}
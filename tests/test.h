@@ -0,0 +1,50 @@
+#ifndef TEST_H
+#define TEST_H
+
+/**
+ * @file test.h
+ * @brief Verificações dos testes do firmware no computador.
+ *
+ * Cada teste é um executável ligado ao firmware e à HAL simulada (host/),
+ * executado pelo ctest. Uma verificação que falha é exibida com o arquivo e
+ * a linha, e o teste continua; o código de saída indica se alguma falhou.
+ *
+ * Os testes que precisam do relógio virtual rodam dentro de sim_run() e
+ * terminam com sim_finish(), que aqui encerra o executável com o resultado
+ * das verificações em vez de exibir os relatórios da simulação.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdbool.h>
+
+#define CHECK(cond) test_check((cond), __FILE__, __LINE__, "%s", #cond)
+#define CHECK_INT(actual, expected) test_check_int((actual), (expected), __FILE__, __LINE__, #actual)
+#define CHECK_STR(actual, expected) test_check_str((actual), (expected), __FILE__, __LINE__, #actual)
+
+/**
+ * @brief Registra uma verificação; exibe a mensagem se @p ok for falso.
+ *
+ * @return @p ok, para o teste poder desistir de um caso.
+ */
+bool test_check(bool ok, const char *file, int line, const char *format, ...) __attribute__((format(printf, 4, 5)));
+
+/**
+ * @brief Compara dois inteiros, avaliados uma única vez; exibe os dois se diferentes.
+ */
+bool test_check_int(long long actual, long long expected, const char *file, int line, const char *text);
+
+/**
+ * @brief Compara duas strings; exibe as duas se diferentes.
+ */
+bool test_check_str(const char *actual, const char *expected, const char *file, int line, const char *text);
+
+/**
+ * @brief Exibe o total de verificações e falhas.
+ *
+ * @return Código de saída do teste: 0 se nenhuma verificação falhou.
+ */
+int test_result(void);
+
+#endif // TEST_H
@@ -0,0 +1,103 @@
+/**
+ * @file test_alert_template.c
+ * @brief Campos das mensagens de alerta: divisão, preenchimento e codificação.
+ *
+ * O modelo gerado na compilação e o dividido em tempo de execução devem
+ * produzir a mesma requisição que o texto preenchido e depois codificado
+ * por url_encode().
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "alert_template.h"
+#include "callmebot_whatsapp.h"
+#include "test.h"
+
+static const struct alert_values known = {
+    .time_s = 14 * 3600 + 5 * 60 + 59,
+    .rssi = -58,
+    .attempt = 2,
+    .battery = 87,
+};
+
+static const struct alert_values unknown = {
+    .time_s = -1,
+    .rssi = 0,
+    .attempt = 1,
+    .battery = ALERT_BATTERY_UNKNOWN,
+};
+
+static void test_format(void) {
+    char text[128];
+
+    alert_template_format(MESSAGE_1, &known, text, sizeof(text));
+    CHECK_STR(text, "Estou bem, mas gostaria de conversar. Me ligue por favor? (14:05, pedido 2)");
+
+    alert_template_format(MESSAGE_INIT, &unknown, text, sizeof(text));
+    CHECK_STR(text, "Dispositivo pronto para uso! Bateria: --, sinal: -- dBm.");
+
+    struct alert_values usb = known;
+    usb.battery = ALERT_BATTERY_USB;
+    alert_template_format("{bateria} {x} {hora", &usb, text, sizeof(text));
+    CHECK_STR(text, "USB {x} {hora");
+
+    // Sem espaço, o campo é cortado, mas a saída termina sempre em '\0'
+    CHECK_INT(alert_template_format("{rssi}", &known, text, 3), 2);
+    CHECK_STR(text, "-5");
+}
+
+static void test_split(void) {
+    struct alert_segment segments[ALERT_TEMPLATE_MAX_SEGMENTS];
+    uint8_t fields;
+
+    uint count = alert_template_split("a{hora}b{rssi}", segments, ALERT_TEMPLATE_MAX_SEGMENTS, &fields);
+    CHECK_INT(count, 4);
+    CHECK_INT(fields, (1u << ALERT_FIELD_HORA) | (1u << ALERT_FIELD_RSSI));
+    CHECK_INT(segments[0].length, 1);
+    CHECK_INT(segments[1].field, ALERT_FIELD_HORA);
+    CHECK_INT(segments[3].field, ALERT_FIELD_RSSI);
+
+    // Sem segmentos livres, o campo excedente vira texto
+    count = alert_template_split("{hora}{hora}{hora}", segments, 4, &fields);
+    CHECK_INT(count, 3);
+    CHECK_INT(segments[2].field, ALERT_FIELD_TEXT);
+    CHECK_INT(segments[2].length, 6);
+}
+
+// Os dois tipos de modelo geram a codificação da mensagem já preenchida
+static void test_render(void) {
+    for (uint message = 0; message < ALERT_MESSAGE_COUNT; message++) {
+        const struct alert_template *generated = &alert_template_defaults[message];
+        struct alert_segment segments[ALERT_TEMPLATE_MAX_SEGMENTS];
+        struct alert_template runtime = {generated->source, segments, 0, 0, false};
+        char text[256], expected[512], output[512];
+
+        runtime.count = (uint8_t)alert_template_split(generated->source, segments, ALERT_TEMPLATE_MAX_SEGMENTS,
+                                                      &runtime.fields);
+        CHECK_INT(runtime.fields, generated->fields);
+
+        alert_template_format(generated->source, &known, text, sizeof(text));
+        url_encode(text, expected, sizeof(expected));
+
+        alert_template_render(generated, &known, true, output, sizeof(output));
+        CHECK_STR(output, expected);
+        alert_template_render(&runtime, &known, true, output, sizeof(output));
+        CHECK_STR(output, expected);
+        alert_template_render(generated, &known, false, output, sizeof(output));
+        CHECK_STR(output, text);
+
+        // O corte no fim do buffer não deixa um "%" pela metade
+        size_t length = alert_template_render(generated, &known, true, output, 12);
+        CHECK(length <= 11 && strchr(output + (length > 2 ? length - 2 : 0), '%') == NULL);
+    }
+}
+
+int main(void) {
+    test_format();
+    test_split();
+    test_render();
+    return test_result();
+}
@@ -0,0 +1,47 @@
+/**
+ * @file test_audio_adpcm.c
+ * @brief Decodificador IMA-ADPCM comparado, amostra a amostra, ao audioop do Python.
+ *
+ * Os vetores de adpcm_reference.h foram gerados por gen_adpcm_reference.py
+ * e ficam no repositório, pois o audioop saiu do Python 3.13: um trecho
+ * codificado por tools/gen_audio_clips.py e outro pelo próprio audioop, com
+ * as amostras decodificadas pelo audioop. O sinal leva o índice
+ * da tabela de passos e o preditor aos limites, onde as saturações do
+ * decodificador fazem diferença.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "audio_pwm.h"
+#include "test.h"
+#include "adpcm_reference.h"
+
+// Decodifica como fill_buffer() (inc/audio_pwm.c) e compara cada amostra
+static void check_decode(const char *name, const uint8_t *adpcm, const int16_t *expected) {
+    struct audio_adpcm_state state = {0, 0};
+    uint max_index = 0;
+    bool clamped = false;
+
+    for (uint32_t n = 0; n < REFERENCE_SAMPLES; n++) {
+        uint8_t byte = adpcm[n >> 1];
+        uint8_t nibble = (n & 1) ? byte >> 4 : byte & 0x0F;
+        int16_t sample = audio_adpcm_decode(&state, nibble);
+
+        if (!test_check(sample == expected[n], __FILE__, __LINE__, "%s: amostra %u = %d, audioop %d", name,
+                        (unsigned)n, sample, expected[n])) {
+            return;  // As seguintes dependem desta
+        }
+        max_index = state.index > max_index ? state.index : max_index;
+        clamped |= sample == 32767 || sample == -32768;
+    }
+
+    test_check(max_index == 88 && clamped, __FILE__, __LINE__, "%s: índice máximo %u, saturou: %d", name, max_index,
+               clamped);
+}
+
+int main(void) {
+    check_decode("gen_audio_clips.py", firmware_adpcm, firmware_pcm);
+    check_decode("lin2adpcm", audioop_adpcm, audioop_pcm);
+    return test_result();
+}
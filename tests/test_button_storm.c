@@ -0,0 +1,167 @@
+/**
+ * @file test_button_storm.c
+ * @brief Tempestade de acionamentos dos quatro botões, com bordas aleatórias.
+ *
+ * Cada botão recebe uma sequência pseudoaleatória (semente fixa) de
+ * acionamentos físicos: repique na borda de subida e na de descida, tempo
+ * pressionado e intervalo até o próximo, com os botões sobrepostos entre si.
+ * A leitura roda como no laço da interface, a cada BUTTON_POLL_MS, e os
+ * pedidos publicados são capturados no lugar de ui_post_button().
+ *
+ * Os tempos respeitam o que a leitura promete distinguir: o repique termina
+ * antes da leitura seguinte, o nível estável dura ao menos duas leituras e
+ * dois acionamentos do mesmo botão distam mais que BUTTON_DEBOUNCE_US. Assim,
+ * cada acionamento físico deve gerar exatamente um pedido, com o instante de
+ * origem dentro do acionamento.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "button_handler.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "test.h"
+
+#define STORM_SEEDS        10
+#define STORM_PRESSES      100                     // Por botão e por semente
+#define STORM_BOUNCE_US    20000                   // Duração máxima do repique
+#define STORM_BOUNCES      8                       // Transições máximas do repique
+#define STORM_STABLE_US    (2 * BUTTON_POLL_MS * 1000)
+#define STORM_MAX_EDGES    (STORM_PRESSES * 2 * (STORM_BOUNCES + 1))
+
+struct edge {
+    uint64_t at_us;
+    bool level;
+};
+
+struct storm_button {
+    uint pin;
+    uint8_t message;
+    struct edge edges[STORM_MAX_EDGES];
+    uint edge_count;
+    uint next_edge;
+    uint64_t press_us[STORM_PRESSES];  // Primeira borda de subida de cada acionamento
+    uint32_t origin_us[STORM_PRESSES * 2];
+    uint posted;
+};
+
+static struct storm_button storm[] = {
+    {BUTTON_A, 4},
+    {BUTTON_B, 3},
+    {BUTTON_C, 2},
+    {BUTTON_D, 1},
+};
+
+static uint32_t rng_state;
+static struct event_timer button_timer;
+
+static uint32_t rng(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint32_t rng_range(uint32_t min, uint32_t max) {
+    return min + rng() % (max - min + 1);
+}
+
+// Pedido da leitura dos botões: registrado no botão da mensagem
+bool ui_post_button(uint8_t message, uint32_t origin_us) {
+    for (uint i = 0; i < count_of(storm); i++) {
+        if (storm[i].message == message && storm[i].posted < count_of(storm[i].origin_us)) {
+            storm[i].origin_us[storm[i].posted++] = origin_us;
+        }
+    }
+    return true;
+}
+
+// Repique: transições em instantes aleatórios, terminando no nível final
+static uint64_t add_bounce(struct storm_button *b, uint64_t at_us, bool level) {
+    uint toggles = rng_range(0, STORM_BOUNCES / 2) * 2;
+    uint64_t end_us = at_us + rng_range(0, STORM_BOUNCE_US);
+
+    for (uint i = 0; i < toggles; i++) {
+        b->edges[b->edge_count++] = (struct edge){at_us, i % 2 == 0 ? level : !level};
+        at_us += (end_us - at_us) / (toggles - i + 1);
+    }
+    b->edges[b->edge_count++] = (struct edge){end_us > at_us ? end_us : at_us, level};
+    return end_us > at_us ? end_us : at_us;
+}
+
+static void generate(struct storm_button *b, uint64_t start_us) {
+    uint64_t at_us = start_us + rng_range(0, 500000);
+
+    b->edge_count = b->next_edge = b->posted = 0;
+    for (uint n = 0; n < STORM_PRESSES; n++) {
+        b->press_us[n] = at_us;
+        uint64_t stable_us = add_bounce(b, at_us, true);
+        uint64_t release_us = stable_us + rng_range(STORM_STABLE_US, 600000);
+        uint64_t low_us = add_bounce(b, release_us, false) + rng_range(STORM_STABLE_US, 800000);
+
+        // O próximo acionamento só depois do debounce deste, contado da leitura que o aceitou
+        uint64_t earliest = at_us + STORM_BOUNCE_US + BUTTON_POLL_MS * 1000 + BUTTON_DEBOUNCE_US + STORM_STABLE_US;
+        at_us = low_us > earliest ? low_us : earliest;
+    }
+}
+
+static void edge_handler(void *arg) {
+    struct storm_button *b = arg;
+    const struct edge *edge = &b->edges[b->next_edge++];
+
+    sim_gpio_set_input(b->pin, edge->level);
+    if (b->next_edge < b->edge_count) {
+        sim_event_at(b->edges[b->next_edge].at_us, SIM_NO_CORE, edge_handler, b);
+    }
+}
+
+static void check(const struct storm_button *b, uint32_t seed) {
+    if (!test_check(b->posted == STORM_PRESSES, __FILE__, __LINE__,
+                    "semente %u, pino %u: %u pedidos para %u acionamentos", (unsigned)seed, b->pin, b->posted,
+                    STORM_PRESSES)) {
+        return;
+    }
+
+    // O pedido sai da primeira leitura em nível alto depois do debounce, dentro do acionamento
+    for (uint n = 0; n < STORM_PRESSES; n++) {
+        uint32_t press = (uint32_t)b->press_us[n];
+        uint32_t late = b->origin_us[n] - press;
+        if (!test_check(late <= STORM_BOUNCE_US + BUTTON_POLL_MS * 1000, __FILE__, __LINE__,
+                        "semente %u, pino %u: acionamento %u aceito %u us depois da borda", (unsigned)seed, b->pin,
+                        n, (unsigned)late)) {
+            return;
+        }
+    }
+}
+
+static void test(void) {
+    event_loop_init();
+    button_handler_init();
+    event_timer_start(&button_timer, 0, BUTTON_POLL_MS, button_check_handler, NULL);
+
+    for (uint32_t seed = 1; seed <= STORM_SEEDS; seed++) {
+        uint64_t start = time_us_64() + BUTTON_DEBOUNCE_US;
+        uint64_t end = start;
+
+        rng_state = seed * 2654435761u;
+        for (uint i = 0; i < count_of(storm); i++) {
+            generate(&storm[i], start);
+            sim_event_at(storm[i].edges[0].at_us, SIM_NO_CORE, edge_handler, &storm[i]);
+            uint64_t last = storm[i].edges[storm[i].edge_count - 1].at_us;
+            end = last > end ? last : end;
+        }
+
+        while (time_us_64() < end + BUTTON_DEBOUNCE_US + BUTTON_POLL_MS * 1000) {
+            event_loop_run_once();
+        }
+        for (uint i = 0; i < count_of(storm); i++) {
+            check(&storm[i], seed);
+        }
+    }
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
@@ -0,0 +1,116 @@
+/**
+ * @file test_buzzer_led.c
+ * @brief Sequenciador dos sinais e divisor dos tons dos buzzers.
+ *
+ * O erro de frequência de buzzer_tone_config() é medido de 100 Hz a 12 kHz,
+ * Hz a Hz, nos três pontos de operação do clk_sys (inc/clock_governor.h).
+ * O sequenciador toca a mensagem 4 sobre o relógio virtual; cada borda do
+ * LED verde deve cair no instante dado pela soma das durações dos passos,
+ * sem atraso acumulado entre os ciclos.
+ *
+ * O grupo de alarmes normalmente vem do laço da interface (inc/ui_core.c);
+ * aqui ele é criado no núcleo do teste.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "buzzer_led.h"
+#include "sim.h"
+#include "test.h"
+
+#define TONE_MIN_HZ       100
+#define TONE_MAX_HZ       12000
+#define TONE_MAX_PPM      100  // Erro máximo aceito, bem abaixo do perceptível (~3000 ppm)
+#define EDGE_TOLERANCE_US 100
+
+static alarm_pool_t *pool;
+
+alarm_pool_t *ui_alarm_pool(void) {
+    return pool;
+}
+
+static void test_tone_sweep(void) {
+    const uint32_t clocks_hz[] = {48000000, 125000000, 133000000};
+
+    for (uint c = 0; c < count_of(clocks_hz); c++) {
+        uint32_t worst_ppm = 0, worst_hz = 0;
+        uint invalid = 0;
+
+        for (uint32_t hz = TONE_MIN_HZ; hz <= TONE_MAX_HZ; hz++) {
+            uint16_t div16, top;
+            if (!buzzer_tone_config(clocks_hz[c], (uint16_t)hz, &div16, &top) || div16 < 16 || top < 1) {
+                invalid++;
+                continue;
+            }
+
+            // Frequência gerada: clk_sys / (divisor * período), com o divisor em dezesseis avos
+            double actual = clocks_hz[c] * 16.0 / ((double)div16 * (top + 1u));
+            double error = actual > hz ? actual - hz : hz - actual;
+            uint32_t ppm = (uint32_t)(error * 1e6 / hz + 0.5);
+            if (ppm > worst_ppm) {
+                worst_ppm = ppm;
+                worst_hz = hz;
+            }
+        }
+
+        CHECK_INT(invalid, 0);
+        test_check(worst_ppm <= TONE_MAX_PPM, __FILE__, __LINE__, "clk_sys de %u Hz: erro de %u ppm em %u Hz",
+                   (unsigned)clocks_hz[c], (unsigned)worst_ppm, (unsigned)worst_hz);
+    }
+
+    uint16_t div16, top;
+    CHECK(!buzzer_tone_config(125000000, 0, &div16, &top));
+}
+
+static void test_sequencer(void) {
+    // Mensagem 4: 250 ms de tom e 50 ms de silêncio, duas vezes por ciclo, em seis ciclos
+    const uint32_t on_ms = 250, off_ms = 50;
+    const uint edges = 6 * 2 * 2;
+
+    pool = alarm_pool_create_with_unused_hardware_alarm(4);
+    buzzer_led_init();
+
+    uint64_t start = time_us_64();
+    buzzer_led_msg_4();
+    CHECK(buzzer_led_is_playing());
+    CHECK(gpio_get(LED_GREEN));
+
+    // Uma mensagem de prioridade menor não interrompe a que está tocando
+    buzzer_led_msg_1();
+
+    bool level = true;
+    uint seen = 0;
+    uint64_t expected = start;
+    while (buzzer_led_is_playing() && seen < edges) {
+        __wfe();
+        if (gpio_get(LED_GREEN) == level) {
+            continue;
+        }
+
+        level = !level;
+        expected += (level ? off_ms : on_ms) * 1000;
+        int64_t error = (int64_t)(time_us_64() - expected);
+        test_check(error >= -EDGE_TOLERANCE_US && error <= EDGE_TOLERANCE_US, __FILE__, __LINE__,
+                   "borda %u do LED em %lld us, esperada em %llu us", seen, (long long)(time_us_64() - start),
+                   (unsigned long long)(expected - start));
+        seen++;
+    }
+
+    CHECK_INT(seen, edges - 1);  // O último silêncio não tem borda do LED
+    while (buzzer_led_is_playing()) {
+        __wfe();
+    }
+    CHECK_INT(time_us_64() - start, 6 * 2 * (on_ms + off_ms) * 1000ull);
+    CHECK(!gpio_get(LED_GREEN));
+}
+
+static void test(void) {
+    test_tone_sweep();
+    test_sequencer();
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
@@ -0,0 +1,156 @@
+/**
+ * @file test_clock_governor.c
+ * @brief Divisores recalculados a cada troca do clk_sys pelo governador.
+ *
+ * O núcleo 1 roda o display, o sequenciador dos buzzers e o áudio, como o
+ * laço da interface, e o governador troca o clk_sys entre os três pontos
+ * (inatividade, pedido de rajada, atividade e despertar do dormant). Em cada
+ * ponto, a HAL simulada calcula com os divisores em vigor a taxa efetiva do
+ * I2C, o tom ouvido no buzzer e a taxa do temporizador de DMA do áudio: um
+ * módulo que não recalcula o seu divisor fica com a taxa escalada pela troca.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "hardware/clocks.h"
+#include "pico/multicore.h"
+#include "audio_pwm.h"
+#include "buzzer_led.h"
+#include "clock_governor.h"
+#include "display_oled.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "ssd1306_i2c.h"
+#include "test.h"
+#include "ui_core.h"
+
+#define TONE_HZ        2000
+#define SAMPLE_RATE_HZ 16000
+
+static alarm_pool_t *pool;
+static volatile bool ui_ready = false;
+
+static const struct buzzer_led_step long_tone[] = {{TONE_HZ, 0, 60000}};
+static const struct buzzer_led_pattern tone_pattern = {long_tone, 1, 1, 1};
+
+static uint8_t clip_data[AUDIO_BUFFER_SAMPLES * 2];
+static const struct audio_clip clip = {clip_data, AUDIO_BUFFER_SAMPLES * 4, SAMPLE_RATE_HZ};
+
+alarm_pool_t *ui_alarm_pool(void) {
+    return pool;
+}
+
+// Laço da interface, como em inc/ui_core.c
+static void ui_entry(void) {
+    event_loop_init();
+    pool = alarm_pool_create_with_unused_hardware_alarm(UI_ALARM_POOL_TIMERS);
+    display_init();
+    buzzer_led_init();
+    audio_pwm_init();
+    ui_ready = true;
+    event_loop_run();
+}
+
+static void play_tone(void *arg) {
+    (void)arg;
+    buzzer_led_play(&tone_pattern);
+}
+
+static void play_audio(void *arg) {
+    (void)arg;
+    audio_play(&clip);
+}
+
+static void activity(void *arg) {
+    (void)arg;
+    clock_governor_activity();
+}
+
+// Despertar do dormant: clocks_init() volta ao ponto normal sem passar pelo governador
+static void resume(void *arg) {
+    (void)arg;
+    clocks_init();
+    clock_governor_resume();
+}
+
+static void expire(void *arg) {
+    *(bool *)arg = true;
+    event_loop_wake(0);
+}
+
+static void run_for_ms(uint32_t ms) {
+    struct event_timer timer = {0};
+    bool expired = false;
+    event_timer_start(&timer, ms, 0, expire, &expired);
+    while (!expired) {
+        event_loop_run_once();
+    }
+}
+
+static void on_ui(event_handler_t handler) {
+    event_loop_post_to(1, handler, NULL);
+    run_for_ms(10);
+}
+
+// Ponto atual: clk_sys esperado e divisores de acordo com ele
+static void check_point(uint32_t mhz, bool tone, bool audio) {
+    CHECK_INT(clock_get_hz(clk_sys), mhz * 1000000);
+    CHECK_INT(sim_i2c_hz(), ssd1306_i2c_clock * 1000);
+    if (tone) {
+        uint32_t heard = sim_tone_hz(BUZZER2_PIN);
+        test_check(heard + 1 >= TONE_HZ && heard <= TONE_HZ + 1, __FILE__, __LINE__,
+                   "tom de %u Hz a %u MHz, esperado %u Hz", (unsigned)heard, (unsigned)mhz, TONE_HZ);
+    }
+    if (audio) {
+        uint32_t rate = sim_dma_timer_hz();
+        test_check(rate * 1000 >= SAMPLE_RATE_HZ * 999u && rate * 1000 <= SAMPLE_RATE_HZ * 1001u, __FILE__, __LINE__,
+                   "amostragem de %u Hz a %u MHz, esperado %u Hz", (unsigned)rate, (unsigned)mhz, SAMPLE_RATE_HZ);
+    }
+}
+
+// Percorre os pontos: normal, repouso por inatividade, rajada, repouso, atividade e despertar
+static void visit_points(bool tone, bool audio) {
+    check_point(125, tone, audio);
+
+    run_for_ms(CLOCK_GOVERNOR_IDLE_MS + 2 * CLOCK_GOVERNOR_CHECK_MS);
+    check_point(48, tone, audio);
+
+    clock_governor_boost(true);
+    run_for_ms(10);
+    check_point(133, tone, audio);
+
+    clock_governor_boost(false);
+    run_for_ms(10);
+    check_point(48, tone, audio);
+
+    on_ui(activity);
+    check_point(125, tone, audio);
+
+    run_for_ms(CLOCK_GOVERNOR_IDLE_MS + 2 * CLOCK_GOVERNOR_CHECK_MS);
+    check_point(48, tone, audio);
+    on_ui(resume);
+    check_point(125, tone, audio);
+}
+
+static void test(void) {
+    event_loop_init();
+    multicore_launch_core1(ui_entry);
+    while (!ui_ready) {
+        run_for_ms(1);
+    }
+    clock_governor_init();
+    run_for_ms(10);
+
+    // Tom do sequenciador, depois o áudio (os dois usam a fatia do buzzer 1)
+    on_ui(play_tone);
+    visit_points(true, false);
+    on_ui(play_audio);
+    visit_points(false, true);
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
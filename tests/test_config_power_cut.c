@@ -0,0 +1,141 @@
+/**
+ * @file test_config_power_cut.c
+ * @brief Queda de energia em cada operação da flash do anel da configuração.
+ *
+ * Uma sequência fixa de gravações (três chaves, valores de 20 a 127
+ * caracteres) percorre os CONFIG_STORE_SECTORS setores do anel e volta ao
+ * primeiro, passando por várias compactações. Para cada N, um processo grava
+ * a sequência sobre a flash apagada com a N-ésima operação (programação ou
+ * apagamento) interrompida pela metade, como --power-cut N da simulação, e
+ * informa pelo pipe cada gravação confirmada. Um segundo processo é a
+ * partida seguinte sobre a mesma imagem: os valores lidos devem ser os da
+ * última gravação confirmada, e uma nova gravação deve funcionar.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "config_store.h"
+#include "sim.h"
+#include "test.h"
+
+#define WRITES      240  // Gravações da sequência: o anel é percorrido mais de uma vez
+#define MAX_CUTS    2000 // Limite de segurança para o número de operações
+
+#define KEYS        3
+
+static const enum config_key keys[KEYS] = {CONFIG_PHONE, CONFIG_API_KEY, CONFIG_MESSAGE + 1};
+
+static char flash_path[] = "/tmp/test_config_power_cut_XXXXXX";
+static int report_fd = -1;             // Pipe das gravações confirmadas, no processo que grava
+static int committed = -1;             // Última gravação confirmada, na partida seguinte
+
+// Valor da gravação @p n, com tamanho variável para cruzar as páginas
+static void value_of(int n, char *value) {
+    size_t length = 20 + (size_t)n * 37 % (CONFIG_STORE_VALUE_MAX - 19);
+    int prefix = snprintf(value, CONFIG_STORE_VALUE_MAX + 1, "v%d-", n);
+    for (size_t i = (size_t)prefix; i < length; i++) {
+        value[i] = (char)('a' + (n + i) % 26);
+    }
+    value[length] = '\0';
+}
+
+static void writer(void) {
+    char value[CONFIG_STORE_VALUE_MAX + 1];
+
+    config_store_init();
+    for (int n = 0; n < WRITES; n++) {
+        value_of(n, value);
+        if (config_store_set(keys[n % KEYS], value)) {
+            if (write(report_fd, &n, sizeof(n)) != sizeof(n)) {
+                sim_finish(2);
+            }
+        }
+    }
+    sim_finish(0);
+}
+
+// Partida seguinte: cada chave com o valor da sua última gravação confirmada
+static void checker(void) {
+    char expected[CONFIG_STORE_VALUE_MAX + 1];
+
+    config_store_init();
+    for (int k = 0; k < KEYS; k++) {
+        int last = committed - ((committed - k) % KEYS + KEYS) % KEYS;  // Maior n <= committed da chave k
+        if (last >= 0) {
+            value_of(last, expected);
+            CHECK_STR(config_get(keys[k]), expected);
+        }
+    }
+
+    // O anel continua gravável
+    CHECK(config_store_set(CONFIG_PHONE, "+5500000000000"));
+    CHECK_STR(config_get(CONFIG_PHONE), "+5500000000000");
+    sim_finish(0);
+}
+
+// Executa @p entry na simulação em um processo filho; devolve o código de saída
+static int run_child(void (*entry)(void), uint32_t cut, int fd) {
+    pid_t pid = fork();
+    if (pid == 0) {
+        report_fd = fd;
+        sim_flash_power_cut(cut);
+        if (!sim_flash_open(flash_path)) {
+            exit(2);
+        }
+        sim_run(entry);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+}
+
+int main(void) {
+    int fd = mkstemp(flash_path);
+    if (fd < 0) {
+        return 2;
+    }
+    close(fd);
+
+    uint32_t cuts = 0;
+    for (uint32_t cut = 1; cut <= MAX_CUTS; cut++) {
+        int pipe_fds[2];
+        if (truncate(flash_path, 0) != 0 || pipe(pipe_fds) != 0) {
+            return 2;
+        }
+
+        fflush(stdout);
+        int status = run_child(writer, cut, pipe_fds[1]);
+        close(pipe_fds[1]);
+
+        int n, confirmed = 0;
+        committed = -1;
+        while (read(pipe_fds[0], &n, sizeof(n)) == sizeof(n)) {
+            committed = n;
+            confirmed++;
+        }
+        close(pipe_fds[0]);
+        CHECK_INT(status, 0);
+
+        // Sem queda: todas as gravações confirmadas, a sequência tem menos operações que cut
+        if (confirmed == WRITES) {
+            break;
+        }
+        cuts++;
+
+        status = run_child(checker, 0, -1);
+        test_check(status == 0, __FILE__, __LINE__, "queda na operação %u: partida seguinte falhou (%d)",
+                   (unsigned)cut, status);
+    }
+
+    printf("%u quedas de energia, uma em cada operação da flash\n", (unsigned)cuts);
+    CHECK(cuts > 0 && cuts < MAX_CUTS);
+    unlink(flash_path);
+    return test_result();
+}
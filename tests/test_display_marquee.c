@@ -0,0 +1,80 @@
+/**
+ * @file test_display_marquee.c
+ * @brief Fim da rolagem do letreiro: depois das voltas e com o painel escurecido.
+ *
+ * Um texto curto para depois de DISPLAY_MARQUEE_LOOPS voltas; um longo, que
+ * não completa as voltas antes de DISPLAY_DIM_MS, para quando o painel
+ * escurece. Parado, o letreiro mostra o início do texto e o barramento I2C
+ * fica em silêncio.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "display_oled.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "ssd1306.h"
+#include "test.h"
+
+#define SHORT_TEXT "Mensagem 4 enviada: SOCORRO! Preciso de ajuda"
+#define LONG_TEXT  "SOCORRO! Preciso de ajuda imediata! Mensagem enviada pelo dispositivo de seguranca. " \
+                   "Aguarde o contato"
+
+static uint8_t strip[DISPLAY_MARQUEE_MAX_CHARS * 8 + ssd1306_width];
+
+// Duração de uma volta do letreiro para o texto, em ms
+static uint32_t loop_ms(const char *text) {
+    int width = ssd1306_draw_string_strip(strip, DISPLAY_MARQUEE_MAX_CHARS * 8, text);
+    int steps = (width + ssd1306_width + DISPLAY_MARQUEE_STEP_PX - 1) / DISPLAY_MARQUEE_STEP_PX;
+    return (uint32_t)steps * DISPLAY_MARQUEE_STEP_MS;
+}
+
+// Página do letreiro igual às primeiras colunas do texto
+static bool shows_start(const char *text) {
+    memset(strip, 0, sizeof(strip));
+    ssd1306_draw_string_strip(strip, DISPLAY_MARQUEE_MAX_CHARS * 8, text);
+    return memcmp(sim_display_page(DISPLAY_MARQUEE_PAGE), strip, ssd1306_width) == 0;
+}
+
+// Transferências em [from_ms, to_ms) do relógio virtual
+static uint32_t transfers_between(uint32_t from_ms, uint32_t to_ms) {
+    while (time_us_64() < from_ms * 1000ull) {
+        event_loop_run_once();
+    }
+    uint32_t start = sim_display_transfers();
+    while (time_us_64() < to_ms * 1000ull) {
+        event_loop_run_once();
+    }
+    return sim_display_transfers() - start;
+}
+
+static void test(void) {
+    event_loop_init();
+    display_init();
+
+    // Texto curto: rola durante as voltas e depois para
+    uint32_t loops_ms = DISPLAY_MARQUEE_LOOPS * loop_ms(SHORT_TEXT);
+    CHECK(loops_ms + 5000 < DISPLAY_DIM_MS);
+    display_marquee_start(SHORT_TEXT, DISPLAY_MARQUEE_PAGE);
+    CHECK(transfers_between(1000, 2000) > 0);
+    CHECK_INT(transfers_between(loops_ms + 1000, DISPLAY_DIM_MS - 1000), 0);
+    CHECK(shows_start(SHORT_TEXT));
+
+    // Texto longo: as voltas não terminam antes de o painel escurecer
+    display_wake();
+    uint32_t start_ms = (uint32_t)(time_us_64() / 1000);
+    CHECK(start_ms + DISPLAY_MARQUEE_LOOPS * loop_ms(LONG_TEXT) > start_ms + DISPLAY_DIM_MS + 2000);
+    display_marquee_start(LONG_TEXT, DISPLAY_MARQUEE_PAGE);
+    CHECK(transfers_between(start_ms + DISPLAY_DIM_MS - 2000, start_ms + DISPLAY_DIM_MS - 1000) > 0);
+    CHECK_INT(transfers_between(start_ms + DISPLAY_DIM_MS + 2000, start_ms + DISPLAY_OFF_MS - 1000), 0);
+    CHECK(shows_start(LONG_TEXT));
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_freertos_latency.c
+ * @brief Latência dos alertas na variante FreeRTOS, sobre as tarefas simuladas.
+ *
+ * Executa main_freertos.c inteiro (tarefas de alertas, telemetria, entrada,
+ * interface e da flash nos dois núcleos) e pressiona os quatro botões em
+ * rodízio, cada acionamento depois da resposta do anterior, com a interface
+ * ainda ocupada com o resultado. Para cada acionamento, o pedido deve ser
+ * retirado da fila pela tarefa de alertas (TRACE_DEQUEUE) no máximo um
+ * período de leitura dos botões e um tique depois da borda, e a mensagem deve
+ * ser entregue. Os temporizadores do laço da tarefa de alertas atrasam no
+ * máximo um tique.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "FreeRTOS.h"
+#include "button_handler.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "test.h"
+#include "trace.h"
+
+#define FIRST_PRESS_MS    5000  // Mensagem inicial já entregue
+#define PRESS_INTERVAL_MS 1013  // Resposta em cerca de 400 ms; fora de fase com a leitura dos botões
+#define PRESS_COUNT       40
+#define HOLD_MS           300
+#define TICK_US           (1000000 / configTICK_RATE_HZ)
+#define LATENCY_BOUND_US  (BUTTON_POLL_MS * 1000 + TICK_US)  // Uma leitura dos botões e um tique
+
+int firmware_main(void);
+
+static const uint pins[] = {BUTTON_A, BUTTON_B, BUTTON_C, BUTTON_D};
+static uint64_t press_us[PRESS_COUNT];
+static uint32_t worst_us = 0;
+
+static void release_handler(void *arg) {
+    sim_gpio_set_input((uint)(uintptr_t)arg, false);
+}
+
+static void check_handler(void *arg);
+static void end_handler(void *arg);
+
+// Acionamento @p n; agenda a verificação, pouco antes do próximo, e o próximo
+static void press_handler(void *arg) {
+    uint n = (uint)(uintptr_t)arg;
+    uint pin = pins[n % count_of(pins)];
+    uint64_t next_us = time_us_64() + PRESS_INTERVAL_MS * 1000ull;
+
+    press_us[n] = time_us_64();
+    sim_gpio_set_input(pin, true);
+    sim_event_at(press_us[n] + HOLD_MS * 1000ull, SIM_NO_CORE, release_handler, (void *)(uintptr_t)pin);
+    sim_event_at(next_us - TICK_US, SIM_NO_CORE, check_handler, (void *)(uintptr_t)n);
+    if (n + 1 < PRESS_COUNT) {
+        sim_event_at(next_us, SIM_NO_CORE, press_handler, (void *)(uintptr_t)(n + 1));
+    } else {
+        sim_event_at(next_us, SIM_NO_CORE, end_handler, NULL);
+    }
+}
+
+// Primeira retirada da fila depois da borda, no anel do núcleo 0
+static bool dequeued_after(uint64_t edge_us, uint32_t *latency_us) {
+    const struct trace_ring *ring = &trace_rings[0];
+    bool found = false;
+
+    for (uint i = 0; i < TRACE_RING_SIZE && i < ring->head; i++) {
+        const struct trace_record *record = &ring->records[(ring->head - 1 - i) % TRACE_RING_SIZE];
+        uint32_t since_edge = record->time_us - (uint32_t)edge_us;
+        if (record->point == TRACE_DEQUEUE && since_edge < PRESS_INTERVAL_MS * 1000u) {
+            *latency_us = since_edge;
+            found = true;
+        }
+    }
+    return found;
+}
+
+// Pouco antes do próximo acionamento: este foi atendido e entregue
+static void check_handler(void *arg) {
+    uint n = (uint)(uintptr_t)arg;
+    uint32_t latency_us = 0;
+
+    if (!test_check(dequeued_after(press_us[n], &latency_us), __FILE__, __LINE__,
+                    "acionamento %u: pedido não retirado da fila", n)) {
+        return;
+    }
+    test_check(latency_us <= LATENCY_BOUND_US, __FILE__, __LINE__, "acionamento %u: retirado %u us depois da borda",
+               n, (unsigned)latency_us);
+    test_check(sim_net_response_us() > press_us[n], __FILE__, __LINE__, "acionamento %u: mensagem não entregue", n);
+    if (latency_us > worst_us) {
+        worst_us = latency_us;
+    }
+}
+
+static void end_handler(void *arg) {
+    (void)arg;
+    const struct event_loop_stats *stats = event_loop_get_stats(0);
+
+    printf("Pior atraso entre a borda e a tarefa de alertas: %u us (limite %u us)\n", (unsigned)worst_us,
+           (unsigned)LATENCY_BOUND_US);
+    test_check(stats->latency_max_us <= TICK_US, __FILE__, __LINE__, "temporizador da tarefa de alertas %u us atrasado",
+               (unsigned)stats->latency_max_us);
+    sim_finish(0);
+}
+
+static void start(void) {
+    firmware_main();
+}
+
+int main(void) {
+    sim_event_at(FIRST_PRESS_MS * 1000ull, SIM_NO_CORE, press_handler, (void *)0);
+    sim_run(start);
+}
@@ -0,0 +1,303 @@
+/**
+ * @file test_ota_download.c
+ * @brief Atualização pela rede de ponta a ponta: download, troca, teste e reversão.
+ *
+ * Cada partida roda o carregador e o firmware em um processo filho, sobre a
+ * flash persistente, como a simulação com --flash: o fim do processo é o
+ * reinício do dispositivo, e a partida seguinte continua da mesma flash. O
+ * servidor simulado entrega a imagem assinada por tools/ota_pack.py (aqui,
+ * montada com a chave de host/include/credentials.h) e o teste verifica:
+ *
+ * - a retomada pelo Range (206) depois de conexões derrubadas, sem bytes
+ *   repetidos, e o pedido de troca gravado por "ota aplicar";
+ * - o servidor que responde 200 a uma retomada: o download recomeça do zero e
+ *   termina, ou, se a conexão sempre cai, desiste depois de OTA_MAX_RETRIES;
+ * - a imagem com a etiqueta HMAC errada, recusada sem pedido de troca;
+ * - a imagem em teste que reinicia antes da aprovação, revertida pelo
+ *   carregador, e a aprovada depois de OTA_TRIAL_MS, que permanece.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "credentials.h"
+#include "hardware/flash.h"
+#include "ota_slots.h"
+#include "ota_update.h"
+#include "sha256.h"
+#include "sim.h"
+#include "test.h"
+
+#define IMAGE_SIZE   100000   // Binário da imagem nova
+#define DROP_BYTES   40000    // Bytes por conexão antes de o servidor derrubá-la
+#define COMMAND_MS   3000     // "ota <url>", com a mensagem inicial já entregue
+#define APPLY_MS     30000    // "ota aplicar", com o download encerrado
+#define NOT_APPLIED  20       // Código de saída da partida em que "ota aplicar" não reiniciou
+#define FLASH_USED   (OTA_CONTROL_OFFSET + FLASH_SECTOR_SIZE)
+
+int bootloader_main(void);
+int firmware_main(void);
+
+static char flash_path[] = "/tmp/test_ota_download_XXXXXX";
+static char image_path[] = "/tmp/test_ota_image_XXXXXX";
+static uint8_t binary[IMAGE_SIZE];
+static uint8_t old_slot[OTA_SLOT_SIZE];
+static uint8_t initial[FLASH_USED], requested[FLASH_USED];
+
+// Partida em andamento, no processo filho
+static uint32_t end_ms;      // Fim da partida (reinício), ou 0 para baixar a imagem e pedir a troca
+static void (*check)(void);  // Verificações no fim da partida, ou antes de "ota aplicar"
+
+static void console_handler(void *arg) {
+    sim_console_input(arg);
+}
+
+static void end_handler(void *arg) {
+    if (check) {
+        check();
+    }
+    sim_finish((int)(uintptr_t)arg);
+}
+
+// Com a imagem pronta, "ota aplicar" reinicia em 100 ms; senão, a partida termina depois
+static void apply_handler(void *arg) {
+    (void)arg;
+    check();
+    check = NULL;
+    sim_console_input("ota aplicar");
+    sim_event_at(time_us_64() + 2000000, 0, end_handler, (void *)(uintptr_t)NOT_APPLIED);
+}
+
+// Os instantes contam da partida do firmware: a troca dos slots pelo carregador leva segundos
+static void boot_entry(void) {
+    bootloader_main();
+
+    uint64_t start_us = time_us_64();
+    if (end_ms == 0) {
+        sim_event_at(start_us + COMMAND_MS * 1000ull, 0, console_handler, (void *)"ota servidor.local/firmware.ota");
+        sim_event_at(start_us + APPLY_MS * 1000ull, 0, apply_handler, NULL);
+    } else {
+        sim_event_at(start_us + end_ms * 1000ull, 0, end_handler, (void *)0);
+    }
+    firmware_main();
+}
+
+/**
+ * @brief Uma partida em um processo filho; devolve o código de saída.
+ *
+ * @param ms Duração da partida, ou 0 para baixar a imagem e pedir a troca.
+ * @param after Verificações no fim da partida, antes do reinício.
+ */
+static int boot(uint32_t ms, void (*after)(void)) {
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        end_ms = ms;
+        check = after;
+        if (!sim_flash_open(flash_path) || !sim_net_load_image(image_path)) {
+            exit(2);
+        }
+        sim_run(boot_entry);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+}
+
+static void write_file(const char *path, const void *data, size_t size) {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL || fwrite(data, 1, size, file) != size || fclose(file) != 0) {
+        exit(2);
+    }
+}
+
+static void read_flash(uint8_t *flash) {
+    FILE *file = fopen(flash_path, "rb");
+    if (file == NULL || fread(flash, 1, FLASH_USED, file) != FLASH_USED) {
+        exit(2);
+    }
+    fclose(file);
+}
+
+// Imagem de tools/ota_pack.py; @p corrupt altera um byte da etiqueta
+static void write_image(bool corrupt) {
+    static uint8_t image[sizeof(struct ota_image_header) + IMAGE_SIZE];
+    struct ota_image_header header = {OTA_IMAGE_MAGIC, IMAGE_SIZE, OTA_FIRMWARE_VERSION + 1, 0xFFFFFFFFu, {0}};
+    uint8_t message[offsetof(struct ota_image_header, tag) + SHA256_SIZE];
+    struct sha256 ctx;
+
+    memcpy(message, &header, offsetof(struct ota_image_header, tag));
+    sha256_init(&ctx);
+    sha256_update(&ctx, binary, IMAGE_SIZE);
+    sha256_final(&ctx, message + offsetof(struct ota_image_header, tag));
+    hmac_sha256(OTA_KEY, strlen(OTA_KEY), message, sizeof(message), header.tag);
+    if (corrupt) {
+        header.tag[7] ^= 0x20;
+    }
+
+    memcpy(image, &header, sizeof(header));
+    memcpy(image + sizeof(header), binary, IMAGE_SIZE);
+    write_file(image_path, image, sizeof(image));
+}
+
+// Servidor da atualização para a próxima partida
+static void serve(uint32_t drop, uint32_t drop_max, bool no_range) {
+    sim_net.image_drop = drop;
+    sim_net.image_drop_max = drop_max;
+    sim_net.image_no_range = no_range;
+}
+
+static const struct ota_control *control_of(const uint8_t *flash) {
+    return (const struct ota_control *)(flash + OTA_CONTROL_OFFSET);
+}
+
+// Depois de "ota aplicar": pedido de troca da imagem baixada, ainda não instalada
+static void check_requested(const char *name) {
+    uint8_t digest[SHA256_SIZE];
+    struct sha256 ctx;
+
+    read_flash(requested);
+    const struct ota_control *control = control_of(requested);
+    sha256_init(&ctx);
+    sha256_update(&ctx, binary, IMAGE_SIZE);
+    sha256_final(&ctx, digest);
+
+    test_check(control->magic == OTA_CONTROL_MAGIC, __FILE__, __LINE__, "%s: troca não pedida", name);
+    CHECK_INT(control->image_size, IMAGE_SIZE);
+    CHECK_INT(control->version, OTA_FIRMWARE_VERSION + 1);
+    CHECK(memcmp(control->digest, digest, SHA256_SIZE) == 0);
+    CHECK(memcmp(requested + OTA_DOWNLOAD_OFFSET, binary, IMAGE_SIZE) == 0);
+    CHECK(memcmp(requested + OTA_APP_OFFSET, old_slot, OTA_SLOT_SIZE) == 0);
+}
+
+static void check_not_requested(const char *name) {
+    uint8_t flash[FLASH_USED];
+
+    read_flash(flash);
+    test_check(control_of(flash)->magic == 0xFFFFFFFFu, __FILE__, __LINE__, "%s: troca pedida", name);
+    CHECK(memcmp(flash + OTA_APP_OFFSET, old_slot, OTA_SLOT_SIZE) == 0);
+}
+
+// Verificações no processo filho
+
+static void check_resumed(void) {
+    struct sim_net_image_stats stats = sim_net_image_stats();
+    CHECK(!ota_update_is_busy());
+    CHECK(stats.drops >= 2);
+    CHECK_INT(stats.requests, stats.drops + 1);
+    CHECK_INT(stats.ranges, stats.drops);  // Toda reconexão retomada pelo Range
+    CHECK_INT(stats.bytes, sizeof(struct ota_image_header) + IMAGE_SIZE);
+}
+
+static void check_restarted(void) {
+    struct sim_net_image_stats stats = sim_net_image_stats();
+    CHECK(!ota_update_is_busy());
+    CHECK_INT(stats.requests, 2);
+    CHECK_INT(stats.ranges, 0);
+    CHECK_INT(stats.bytes, DROP_BYTES + sizeof(struct ota_image_header) + IMAGE_SIZE);
+}
+
+static void check_gave_up(void) {
+    struct sim_net_image_stats stats = sim_net_image_stats();
+    CHECK(!ota_update_is_busy());
+    CHECK_INT(stats.ranges, 0);
+    CHECK_INT(stats.requests, OTA_MAX_RETRIES + 2);  // O primeiro download e um recomeço a mais que o limite
+}
+
+static void check_downloaded(void) {
+    CHECK(!ota_update_is_busy());
+    CHECK(memcmp(sim_flash + OTA_DOWNLOAD_OFFSET, binary, IMAGE_SIZE) == 0);
+}
+
+static void check_trial(void) {
+    const struct ota_control *control = ota_control_get();
+    CHECK(memcmp(sim_flash + OTA_APP_OFFSET, binary, IMAGE_SIZE) == 0);
+    CHECK(ota_control_marked(control, OTA_MARK_TRIAL));
+    CHECK(!ota_control_marked(control, OTA_MARK_CONFIRMED));
+    CHECK(ota_update_is_busy());  // Prazo da aprovação em andamento
+}
+
+static void check_reverted(void) {
+    const struct ota_control *control = ota_control_get();
+    CHECK(memcmp(sim_flash + OTA_APP_OFFSET, old_slot, OTA_SLOT_SIZE) == 0);
+    CHECK(memcmp(sim_flash + OTA_DOWNLOAD_OFFSET, binary, IMAGE_SIZE) == 0);
+    CHECK(ota_control_marked(control, OTA_MARK_REVERTED));
+    CHECK(!ota_control_marked(control, OTA_MARK_CONFIRMED));
+    CHECK(!ota_update_is_busy());
+}
+
+static void check_confirmed(void) {
+    const struct ota_control *control = ota_control_get();
+    CHECK(memcmp(sim_flash + OTA_APP_OFFSET, binary, IMAGE_SIZE) == 0);
+    CHECK(ota_control_marked(control, OTA_MARK_CONFIRMED));
+    CHECK(!ota_control_marked(control, OTA_MARK_REVERTING));
+    CHECK(!ota_update_is_busy());
+}
+
+int main(void) {
+    int fd = mkstemp(flash_path);
+    int image_fd = mkstemp(image_path);
+    if (fd < 0 || image_fd < 0) {
+        return 2;
+    }
+    close(fd);
+    close(image_fd);
+
+    // Imagem em execução no slot A e a nova, servida pela rede
+    memset(old_slot, 0xFF, sizeof(old_slot));
+    for (uint32_t i = 0; i < 3 * IMAGE_SIZE / 2; i++) {
+        old_slot[i] = (uint8_t)(i * 7 + 1);
+    }
+    for (uint32_t i = 0; i < IMAGE_SIZE; i++) {
+        binary[i] = (uint8_t)(i * 13 + i / 251);
+    }
+    memset(initial, 0xFF, sizeof(initial));
+    memcpy(initial + OTA_APP_OFFSET, old_slot, OTA_SLOT_SIZE);
+    write_image(false);
+
+    // Conexões derrubadas, retomadas pelo Range
+    write_file(flash_path, initial, sizeof(initial));
+    serve(DROP_BYTES, 0, false);
+    CHECK_INT(boot(0, check_resumed), 0);
+    check_requested("retomada pelo Range");
+
+    // Reinício antes da aprovação: a imagem em teste é revertida
+    CHECK_INT(boot(OTA_TRIAL_MS / 2, check_trial), 0);
+    CHECK_INT(boot(5000, check_reverted), 0);
+
+    // Aprovação depois do prazo: a imagem permanece
+    write_file(flash_path, requested, sizeof(requested));
+    CHECK_INT(boot(OTA_TRIAL_MS + 10000, NULL), 0);
+    CHECK_INT(boot(5000, check_confirmed), 0);
+
+    // Servidor sem Range: a retomada recebe 200 e o download recomeça do zero
+    write_file(flash_path, initial, sizeof(initial));
+    serve(DROP_BYTES, 1, true);
+    CHECK_INT(boot(0, check_restarted), 0);
+    check_requested("recomeço do zero");
+
+    // Sem Range e com a conexão sempre derrubada: desiste
+    write_file(flash_path, initial, sizeof(initial));
+    serve(DROP_BYTES, 0, true);
+    CHECK_INT(boot(0, check_gave_up), NOT_APPLIED);
+    check_not_requested("conexão sempre derrubada");
+
+    // Etiqueta HMAC errada: a imagem chega inteira ao slot B, mas a troca não é pedida
+    write_file(flash_path, initial, sizeof(initial));
+    write_image(true);
+    serve(0, 0, false);
+    CHECK_INT(boot(0, check_downloaded), NOT_APPLIED);
+    check_not_requested("assinatura inválida");
+
+    unlink(flash_path);
+    unlink(image_path);
+    return test_result();
+}
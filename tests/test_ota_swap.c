@@ -0,0 +1,231 @@
+/**
+ * @file test_ota_swap.c
+ * @brief Troca dos slots pelo carregador, com queda de energia em cada etapa.
+ *
+ * O slot A tem uma imagem de OLD_SECTORS setores e o slot B, pedida no bloco
+ * de controle, uma de NEW_SIZE bytes. Como em test_config_power_cut, para cada
+ * N um processo parte o carregador com a N-ésima operação da flash
+ * interrompida pela metade, e um segundo processo é a partida seguinte sobre
+ * a mesma imagem: a troca deve terminar com a imagem nova em A, a anterior em
+ * B e a imagem em teste. O mesmo vale para a reversão, na partida da imagem em
+ * teste sem aprovação.
+ *
+ * As duas séries rodam também com o setor 0 (e o 2) iguais nos dois slots:
+ * esses setores são pulados e nenhuma etapa deles é marcada, e uma queda
+ * depois do início da troca não pode levar o carregador a conferir de novo o
+ * slot B, que já tem parte da imagem anterior.
+ *
+ * Por fim, sem quedas: a imagem aprovada permanece, e um slot B que não
+ * confere com o resumo é recusado sem tocar no slot A.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "hardware/flash.h"
+#include "ota_slots.h"
+#include "sha256.h"
+#include "sim.h"
+#include "test.h"
+
+#define OLD_SECTORS   5                            // Imagem em A antes da troca
+#define NEW_SIZE      (4 * FLASH_SECTOR_SIZE - 100) // Imagem pedida em B
+#define SLOTS_SIZE    (OTA_CONTROL_OFFSET + FLASH_SECTOR_SIZE)
+#define BOOT_COMPLETE 10                           // Código de saída da partida sem queda
+#define MAX_CUTS      2000                         // Limite de segurança para o número de operações
+
+int bootloader_main(void);
+
+static char flash_path[] = "/tmp/test_ota_swap_XXXXXX";
+static uint8_t requested[SLOTS_SIZE];  // Flash com a troca pedida
+static uint8_t trial[SLOTS_SIZE];      // Flash depois da partida que instalou a imagem nova
+static uint8_t old_slot[OTA_SLOT_SIZE], new_slot[OTA_SLOT_SIZE];
+
+// Estado esperado depois da partida, conferido no processo filho
+static const uint8_t *expected_a, *expected_b;
+static const enum ota_mark *expected_marks;
+static void (*after_boot)(void);
+
+static bool marked(enum ota_mark mark) {
+    for (const enum ota_mark *m = expected_marks; *m != OTA_MARK_COUNT; m++) {
+        if (*m == mark) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void check_slots(void) {
+    const struct ota_control *control = ota_control_get();
+
+    CHECK(memcmp(sim_flash + OTA_APP_OFFSET, expected_a, OTA_SLOT_SIZE) == 0);
+    CHECK(memcmp(sim_flash + OTA_DOWNLOAD_OFFSET, expected_b, OTA_SLOT_SIZE) == 0);
+    for (int mark = 0; mark < OTA_MARK_COUNT; mark++) {
+        test_check(ota_control_marked(control, mark) == marked(mark), __FILE__, __LINE__, "marca %d %s", mark,
+                   marked(mark) ? "ausente" : "inesperada");
+    }
+}
+
+static void boot_entry(void) {
+    bootloader_main();
+    if (after_boot == NULL) {
+        sim_finish(BOOT_COMPLETE);
+    }
+    after_boot();
+    sim_finish(0);
+}
+
+// Uma partida em um processo filho, sobre @p flash ou (NULL) a flash da partida
+// anterior; devolve o código de saída
+static int boot(const uint8_t *flash, uint32_t cut, void (*check)(void)) {
+    if (flash) {
+        FILE *file = fopen(flash_path, "wb");
+        if (file == NULL || fwrite(flash, 1, SLOTS_SIZE, file) != SLOTS_SIZE || fclose(file) != 0) {
+            exit(2);
+        }
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        after_boot = check;
+        sim_flash_power_cut(cut);
+        if (!sim_flash_open(flash_path)) {
+            exit(2);
+        }
+        sim_run(boot_entry);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 128;
+}
+
+// Flash do arquivo depois da última partida
+static void read_flash(uint8_t *flash) {
+    FILE *file = fopen(flash_path, "rb");
+    if (file == NULL || fread(flash, 1, SLOTS_SIZE, file) != SLOTS_SIZE) {
+        exit(2);
+    }
+    fclose(file);
+}
+
+/**
+ * @brief Queda de energia em cada operação de uma partida sobre @p flash.
+ *
+ * A partida seguinte, sem queda, deve chegar a @p a e @p b nos slots, com
+ * as marcas @p marks (terminadas por OTA_MARK_COUNT).
+ */
+static void cut_series(const char *name, const uint8_t *flash, const uint8_t *a, const uint8_t *b,
+                       const enum ota_mark *marks) {
+    uint32_t cuts = 0;
+
+    expected_a = a;
+    expected_b = b;
+    expected_marks = marks;
+    for (uint32_t cut = 1; cut <= MAX_CUTS; cut++) {
+        int status = boot(flash, cut, NULL);
+        if (status == BOOT_COMPLETE) {
+            break;
+        }
+        CHECK_INT(status, 0);
+        cuts++;
+
+        status = boot(NULL, 0, check_slots) == 0 ? 0 : 1;
+        test_check(status == 0, __FILE__, __LINE__, "%s: queda na operação %u", name, (unsigned)cut);
+    }
+    printf("%s: %u quedas de energia, uma em cada operação da flash\n", name, (unsigned)cuts);
+    CHECK(cuts > 0 && cuts < MAX_CUTS);
+}
+
+// Monta a flash com a troca pedida; @p shared são setores iguais nos dois slots
+static void request_swap(const uint32_t *shared, uint count) {
+    struct ota_control control;
+    struct sha256 ctx;
+
+    memset(old_slot, 0xFF, sizeof(old_slot));
+    memset(new_slot, 0xFF, sizeof(new_slot));
+    for (uint32_t i = 0; i < OLD_SECTORS * FLASH_SECTOR_SIZE; i++) {
+        old_slot[i] = (uint8_t)(i * 7 + i / FLASH_SECTOR_SIZE);
+    }
+    for (uint32_t i = 0; i < NEW_SIZE; i++) {
+        new_slot[i] = (uint8_t)(i * 13 + 5);
+    }
+    for (uint i = 0; i < count; i++) {
+        memcpy(new_slot + shared[i] * FLASH_SECTOR_SIZE, old_slot + shared[i] * FLASH_SECTOR_SIZE, FLASH_SECTOR_SIZE);
+    }
+
+    memset(&control, 0xFF, sizeof(control));
+    control.magic = OTA_CONTROL_MAGIC;
+    control.image_size = NEW_SIZE;
+    control.version = 2;
+    sha256_init(&ctx);
+    sha256_update(&ctx, new_slot, NEW_SIZE);
+    sha256_final(&ctx, control.digest);
+
+    memset(requested, 0xFF, sizeof(requested));
+    memcpy(requested + OTA_APP_OFFSET, old_slot, OTA_SLOT_SIZE);
+    memcpy(requested + OTA_DOWNLOAD_OFFSET, new_slot, OTA_SLOT_SIZE);
+    memcpy(requested + OTA_CONTROL_OFFSET, &control, sizeof(control));
+}
+
+static const enum ota_mark installed[] = {OTA_MARK_SWAPPED, OTA_MARK_TRIAL, OTA_MARK_COUNT};
+static const enum ota_mark reverted[] = {OTA_MARK_SWAPPED, OTA_MARK_TRIAL, OTA_MARK_REVERTING, OTA_MARK_REVERTED,
+                                         OTA_MARK_COUNT};
+static const enum ota_mark approved[] = {OTA_MARK_SWAPPED, OTA_MARK_TRIAL, OTA_MARK_CONFIRMED, OTA_MARK_COUNT};
+static const enum ota_mark rejected[] = {OTA_MARK_REJECTED, OTA_MARK_COUNT};
+
+// Instalação e reversão, com queda de energia em cada etapa
+static void swap_series(const char *name, const uint32_t *shared, uint count) {
+    char title[64];
+
+    request_swap(shared, count);
+    snprintf(title, sizeof(title), "instalação, %s", name);
+    cut_series(title, requested, new_slot, old_slot, installed);
+
+    // A partida que instalou a imagem não foi seguida da aprovação
+    CHECK_INT(boot(requested, 0, NULL), BOOT_COMPLETE);
+    read_flash(trial);
+    snprintf(title, sizeof(title), "reversão, %s", name);
+    cut_series(title, trial, old_slot, new_slot, reverted);
+}
+
+int main(void) {
+    static const uint32_t shared[] = {0, 2};
+    static const uint32_t marks_offset = OTA_CONTROL_OFFSET + offsetof(struct ota_control, marks);
+
+    int fd = mkstemp(flash_path);
+    if (fd < 0) {
+        return 2;
+    }
+    close(fd);
+
+    swap_series("setores diferentes", NULL, 0);
+    swap_series("setores 0 e 2 iguais", shared, count_of(shared));
+
+    // Imagem aprovada: as partidas seguintes não mexem nos slots
+    const uint32_t set = OTA_MARK_SET;
+    memcpy(trial + marks_offset + OTA_MARK_CONFIRMED * sizeof(uint32_t), &set, sizeof(set));
+    expected_a = new_slot;
+    expected_b = old_slot;
+    expected_marks = approved;
+    CHECK_INT(boot(trial, 0, check_slots), 0);
+
+    // Slot B corrompido depois do pedido: recusado, sem troca
+    request_swap(NULL, 0);
+    requested[OTA_DOWNLOAD_OFFSET + NEW_SIZE / 2] ^= 0x01;
+    new_slot[NEW_SIZE / 2] ^= 0x01;
+    expected_a = old_slot;
+    expected_b = new_slot;
+    expected_marks = rejected;
+    CHECK_INT(boot(requested, 0, check_slots), 0);
+
+    unlink(flash_path);
+    return test_result();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file test_status_bar.c
+ * @brief Barra de status: campo de pendentes e bytes enviados ao barramento.
+ *
+ * Cada campo alterado custa os seis comandos da janela (dois bytes cada) e
+ * o byte de controle mais oito bytes por caractere; sem alteração, nenhum
+ * byte é enviado. Com alertas pendentes a barra continua sendo atualizada.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "display_oled.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "ssd1306.h"
+#include "status_bar.h"
+#include "test.h"
+
+#define PENDING_COLUMN 7  // Coluna do campo de pendentes, em caracteres
+
+// Bytes de uma atualização parcial de um campo de @p chars caracteres
+static uint64_t field_bytes(uint chars) {
+    return 6 * 2 + 1 + chars * 8;
+}
+
+// Bytes escritos no barramento em [from_ms, to_ms) do relógio virtual
+static uint64_t bytes_between(uint32_t from_ms, uint32_t to_ms) {
+    while (time_us_64() < from_ms * 1000ull) {
+        event_loop_run_once();
+    }
+    uint64_t start = sim_display_bytes();
+    while (time_us_64() < to_ms * 1000ull) {
+        event_loop_run_once();
+    }
+    return sim_display_bytes() - start;
+}
+
+static bool shows_pending(char digit) {
+    uint8_t page[ssd1306_width] = {0};
+    ssd1306_draw_char(page, PENDING_COLUMN * 8, 0, (uint8_t)digit);
+    return memcmp(sim_display_page(STATUS_BAR_PAGE) + PENDING_COLUMN * 8, page + PENDING_COLUMN * 8, 8) == 0;
+}
+
+static void test(void) {
+    event_loop_init();
+    display_init();
+    status_bar_init();
+
+    // Nada muda até o primeiro minuto ligado
+    CHECK_INT(bytes_between(1500, 30000), 0);
+    CHECK(shows_pending('0'));
+
+    // Alertas pendentes aparecem no ciclo seguinte, só com o campo alterado
+    status_bar_set_pending(2);
+    CHECK_INT(bytes_between(30000, 31500), field_bytes(1));
+    CHECK(shows_pending('2'));
+    CHECK_INT(bytes_between(31500, 45000), 0);
+
+    status_bar_set_pending(12);
+    CHECK_INT(bytes_between(45000, 46500), field_bytes(1));
+    CHECK(shows_pending('9'));
+
+    status_bar_set_pending(0);
+    CHECK_INT(bytes_between(46500, 48000), field_bytes(1));
+    CHECK(shows_pending('0'));
+
+    // O tempo ligado muda a cada minuto; o escurecimento do painel (dois comandos) vem junto
+    CHECK_INT(bytes_between(59500, 61500), field_bytes(3) + 2 * 2);
+    CHECK_INT(bytes_between(61500, 119500), 0);
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
@@ -0,0 +1,115 @@
+/**
+ * @file test_supervisor.c
+ * @brief Travamentos injetados em cada subsistema monitorado pelo supervisor.
+ *
+ * Cada subsistema é representado por uma tarefa que se apresenta na cadência
+ * da real: a leitura dos botões a cada BUTTON_POLL_MS, o laço da rede a cada
+ * SUPERVISOR_HEARTBEAT_MS e o display a cada DISPLAY_IDLE_CHECK_MS. O teste
+ * trava uma tarefa por vez e verifica, nos registradores de rascunho, que só
+ * o subsistema travado é culpado, com o atraso e a contagem de resets
+ * consecutivos; a partida seguinte é simulada como um reset do watchdog.
+ * Depois, com todos no prazo por SUPERVISOR_SETTLE_MS, a contagem volta a
+ * zero.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include "hardware/watchdog.h"
+#include "button_handler.h"
+#include "display_oled.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "supervisor.h"
+#include "test.h"
+
+// Tarefa que se apresenta ao supervisor
+struct task {
+    uint32_t period_ms;
+    struct event_timer timer;
+};
+
+static struct task tasks[SUPERVISOR_COUNT] = {
+    [SUPERVISOR_INPUT]   = {BUTTON_POLL_MS},
+    [SUPERVISOR_NETWORK] = {SUPERVISOR_HEARTBEAT_MS},
+    [SUPERVISOR_DISPLAY] = {DISPLAY_IDLE_CHECK_MS},
+};
+
+static void task_handler(void *arg) {
+    supervisor_checkin((enum supervisor_subsystem)(uintptr_t)arg);
+}
+
+static void run_for_ms(uint32_t ms) {
+    uint64_t until = time_us_64() + ms * 1000ull;
+    while (time_us_64() < until) {
+        event_loop_run_once();
+    }
+}
+
+// Partida do dispositivo, como em main(): supervisor primeiro, depois as tarefas
+static void boot(bool watchdog_reset) {
+    sim_watchdog_reset = watchdog_reset;
+    supervisor_init();
+    for (uint i = 0; i < SUPERVISOR_COUNT; i++) {
+        event_timer_start(&tasks[i].timer, tasks[i].period_ms, tasks[i].period_ms, task_handler, (void *)(uintptr_t)i);
+    }
+}
+
+// Trava a tarefa de @p subsystem e espera o supervisor parar de alimentar o watchdog
+static void hang(enum supervisor_subsystem subsystem, uint32_t expected_resets) {
+    uint64_t start = time_us_64();
+    event_timer_stop(&tasks[subsystem].timer);
+    while (watchdog_hw->scratch[0] == 0 && time_us_64() - start < SUPERVISOR_WATCHDOG_MS * 1000ull * 3) {
+        event_loop_run_once();
+    }
+    uint32_t detected_ms = (uint32_t)((time_us_64() - start) / 1000);
+
+    CHECK(watchdog_hw->scratch[0] != 0);
+    CHECK_INT(watchdog_hw->scratch[1], 1u << subsystem);
+    CHECK_INT(watchdog_hw->scratch[3], expected_resets);
+    // O atraso vai da última apresentação, no máximo um período antes do travamento
+    CHECK(watchdog_hw->scratch[2] >= detected_ms - tasks[subsystem].period_ms);
+    CHECK(watchdog_hw->scratch[2] <= detected_ms + tasks[subsystem].period_ms);
+    printf("Travamento do subsistema %u detectado em %u ms (%u ms sem apresentação)\n", (unsigned)subsystem,
+           (unsigned)detected_ms, (unsigned)watchdog_hw->scratch[2]);
+
+    // Sem alimentação o watchdog expira: a partida seguinte informa a causa
+    boot(true);
+    CHECK(supervisor_recovered());
+    supervisor_print_reset();
+}
+
+static void test(void) {
+    event_loop_init();
+    boot(false);
+    CHECK(!supervisor_recovered());
+
+    // Tudo no prazo: nenhuma falha registrada
+    run_for_ms(2 * SUPERVISOR_SETTLE_MS);
+    CHECK_INT(watchdog_hw->scratch[0], 0);
+    CHECK_INT(watchdog_hw->scratch[3], 0);
+
+    // Um travamento por subsistema, em resets consecutivos
+    hang(SUPERVISOR_INPUT, 1);
+    run_for_ms(5000);
+    hang(SUPERVISOR_DISPLAY, 2);
+    run_for_ms(5000);
+    hang(SUPERVISOR_NETWORK, 3);
+    CHECK_INT(watchdog_hw->scratch[3], 3);
+
+    // A contagem só volta a zero depois do período estável
+    run_for_ms(SUPERVISOR_SETTLE_MS - 1000);
+    CHECK_INT(watchdog_hw->scratch[3], 3);
+    run_for_ms(2000);
+    CHECK_INT(watchdog_hw->scratch[3], 0);
+    CHECK_INT(watchdog_hw->scratch[0], 0);
+
+    // Um travamento depois disso começa uma nova sequência
+    hang(SUPERVISOR_INPUT, 1);
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
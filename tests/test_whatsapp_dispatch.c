@@ -0,0 +1,149 @@
+/**
+ * @file test_whatsapp_dispatch.c
+ * @brief Entrega do resultado do CallMeBot ao laço de eventos.
+ *
+ * Mede, em uma sequência de envios, o atraso entre a resposta do servidor e
+ * a chamada do tratador do resultado e os despertares do laço do núcleo 0 por
+ * envio. Verifica também os dois caminhos de exceção: a fila de chamadas
+ * adiadas cheia no instante da resposta (entrega por finish_poll()) e a
+ * resposta do DNS que chega depois do tempo limite do envio.
+ *
+ * O Wi-Fi fica sem economia de energia, para que os pacotes cheguem no
+ * instante exato da rede simulada.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <stdio.h>
+
+#include "pico/cyw43_arch.h"
+#include "alert_template.h"
+#include "callmebot_whatsapp.h"
+#include "event_loop.h"
+#include "sim.h"
+#include "test.h"
+
+#define SENDS 20                 // Envios medidos
+#define MAX_DISPATCH_US 1000     // Atraso aceito entre a resposta e o tratador
+
+static const struct alert_values values = {-1, 0, 1, ALERT_BATTERY_UNKNOWN};
+
+static uint done_calls;
+static bool done_sent;
+static uint64_t done_us;
+static struct event_loop_stats done_stats;  // Laço do núcleo 0 na chamada do tratador
+static uint filler_posts, filler_runs;
+
+static void on_done(bool sent, void *arg) {
+    (void)arg;
+    done_calls++;
+    done_sent = sent;
+    done_us = time_us_64();
+    done_stats = *event_loop_get_stats(0);
+    event_loop_wake(0);  // O teste continua sem esperar outro evento
+}
+
+static void filler(void *arg) {
+    (void)arg;
+    filler_runs++;
+}
+
+// Ocupa toda a fila de chamadas adiadas do núcleo 0
+static void fill_queue(void *arg) {
+    (void)arg;
+    while (event_loop_post_to(0, filler, NULL)) {
+        filler_posts++;
+    }
+}
+
+static void expire(void *arg) {
+    *(bool *)arg = true;
+    event_loop_wake(0);
+}
+
+// Avança o relógio virtual, mesmo sem outros eventos pendentes
+static void run_for_ms(uint32_t ms) {
+    struct event_timer timer = {0};
+    bool expired = false;
+    event_timer_start(&timer, ms, 0, expire, &expired);
+    while (!expired) {
+        event_loop_run_once();
+    }
+}
+
+static void run_until_done(uint calls) {
+    while (done_calls < calls) {
+        event_loop_run_once();
+    }
+}
+
+static bool send(void) {
+    return send_whatsapp_message(&alert_template_defaults[4], &values, "+5500000000000", "000000", on_done, NULL);
+}
+
+static void test(void) {
+    event_loop_init();
+    cyw43_arch_init();
+    cyw43_wifi_pm(&cyw43_state, CYW43_NO_POWERSAVE_MODE);
+    cyw43_arch_enable_sta_mode();
+    cyw43_arch_wifi_connect_async("rede", "senha", CYW43_AUTH_WPA2_AES_PSK);
+    while (cyw43_tcpip_link_status(&cyw43_state, CYW43_ITF_STA) != CYW43_LINK_UP) {
+        event_loop_run_once();
+    }
+
+    // DNS mais lento que o tempo limite: o envio falha e a resposta tardia só guarda o endereço
+    sim_net.dns_ms = CALLMEBOT_TIMEOUT_MS + 5000;
+    uint64_t start = time_us_64();
+    CHECK(send());
+    run_until_done(1);
+    CHECK(!done_sent);
+    CHECK_INT(done_us - start, CALLMEBOT_TIMEOUT_MS * 1000ull);
+    run_for_ms(6000);
+    CHECK(!whatsapp_is_busy());
+    CHECK_INT(done_calls, 1);
+    CHECK_INT(sim_net_response_us(), 0);  // Nenhuma requisição saiu depois do tempo limite
+
+    // Envios seguidos, já com o endereço resolvido
+    uint64_t dispatch_total_us = 0, dispatch_max_us = 0;
+    uint32_t wakeups = 0, idle = 0;
+    for (uint n = 0; n < SENDS; n++) {
+        struct event_loop_stats before = *event_loop_get_stats(0);
+        CHECK(send());
+        run_until_done(done_calls + 1);
+        CHECK(done_sent);
+        wakeups += done_stats.wakeups - before.wakeups;
+        idle += done_stats.idle_wakeups - before.idle_wakeups;
+        uint64_t dispatch_us = done_us - sim_net_response_us();
+        dispatch_total_us += dispatch_us;
+        if (dispatch_us > dispatch_max_us) {
+            dispatch_max_us = dispatch_us;
+        }
+    }
+    printf("Entrega do resultado: média %llu us, máximo %llu us; por envio %.1f despertares, %.1f ociosos\n",
+           (unsigned long long)(dispatch_total_us / SENDS), (unsigned long long)dispatch_max_us,
+           (double)wakeups / SENDS, (double)idle / SENDS);
+    CHECK(dispatch_max_us <= MAX_DISPATCH_US);
+    CHECK(wakeups <= 2 * SENDS);  // Conexão e resposta; o trabalho roda nos callbacks do lwIP
+    CHECK(idle <= 2 * SENDS);
+
+    // Fila cheia no instante da resposta: o resultado chega pela verificação do laço
+    start = time_us_64();
+    sim_event_at(start + (sim_net.connect_ms + sim_net.response_ms) * 1000ull, SIM_NO_CORE, fill_queue, NULL);
+    CHECK(send());
+    run_until_done(done_calls + 1);
+    CHECK(done_sent);
+    CHECK_INT(sim_net_response_us(), start + (sim_net.connect_ms + sim_net.response_ms) * 1000ull);
+    CHECK(filler_posts > 0);
+    CHECK(done_us - sim_net_response_us() <= MAX_DISPATCH_US);
+    while (filler_runs < filler_posts) {
+        event_loop_run_once();
+    }
+    CHECK(!whatsapp_is_busy());
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
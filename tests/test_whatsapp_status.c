@@ -0,0 +1,65 @@
+/**
+ * @file test_whatsapp_status.c
+ * @brief Leitura do código HTTP da linha de status da resposta do CallMeBot.
+ *
+ * Respostas curtas ou malformadas devem resultar em 0, sem ler além do que
+ * chegou; a linha pode vir dividida entre buffers encadeados.
+ *
+ * @author Gabriel Mattano da Silva
+ * @date 2025
+ */
+
+#include <string.h>
+
+#include "callmebot_whatsapp.h"
+#include "sim.h"
+#include "test.h"
+
+static char data[2][64];
+
+// Resposta em um buffer, ou dividida em dois a partir de @p split (0 = sem divisão)
+static int parse(const char *text, size_t split) {
+    struct pbuf second = {0};
+    struct pbuf first = {0};
+    size_t length = strlen(text);
+
+    if (split == 0 || split >= length) {
+        split = length;
+    }
+    memcpy(data[0], text, split);
+    memcpy(data[1], text + split, length - split);
+    first.payload = data[0];
+    first.len = (u16_t)split;
+    first.tot_len = (u16_t)length;
+    if (split < length) {
+        second.payload = data[1];
+        second.len = second.tot_len = (u16_t)(length - split);
+        first.next = &second;
+    }
+    return whatsapp_parse_status(&first);
+}
+
+static void test(void) {
+    CHECK_INT(parse("HTTP/1.1 200 OK\r\n", 0), 200);
+    CHECK_INT(parse("HTTP/1.0 503 Service Unavailable\r\n", 0), 503);
+    CHECK_INT(parse("HTTP/1.1 200", 0), 200);
+    CHECK_INT(parse("HTTP/1.1 404 Not Found\r\n", 10), 404);  // Linha dividida entre buffers
+
+    // Curta demais para conter o código
+    CHECK_INT(parse("", 0), 0);
+    CHECK_INT(parse("HTTP/1.", 0), 0);
+    CHECK_INT(parse("HTTP/1.1", 0), 0);
+    CHECK_INT(parse("HTTP/1.1 ", 0), 0);
+    CHECK_INT(parse("HTTP/1.1 20", 0), 0);
+
+    // Malformada
+    CHECK_INT(parse("HTTP/1.1200 OK\r\n", 0), 0);
+    CHECK_INT(parse("HTTP/2 200 OK\r\n", 0), 0);
+    CHECK_INT(parse("<html>200</html>", 0), 0);
+
+    sim_finish(0);
+}
+
+int main(void) {
+    sim_run(test);
+}
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+@file gen_alert_templates.py
+@brief Divide as mensagens de fábrica em segmentos em tempo de compilação.
+
+Lê os textos MESSAGE_* de callmebot_whatsapp.h e os nomes dos campos
+(ALERT_TEMPLATE_FIELDS) de alert_template.h e gera um arquivo C com o modelo
+de cada mensagem: segmentos de texto fixo, já codificado no formato URL, e de
+campo. O envio copia o texto fixo direto para a requisição e só codifica os
+valores dos campos. A divisão segue alert_template_split().
+
+Uso:
+    gen_alert_templates.py <callmebot_whatsapp.h> <alert_template.h> <saida.c>
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import re
+import sys
+
+# Mesma ordem de CONFIG_MESSAGE + n (CONFIG_DEFAULTS em inc/config_store.c)
+MESSAGES = ['MESSAGE_INIT', 'MESSAGE_1', 'MESSAGE_2', 'MESSAGE_3', 'MESSAGE_4']
+ENUM_NAMES = ['ALERT_FIELD_TEXT', 'ALERT_FIELD_HORA', 'ALERT_FIELD_RSSI', 'ALERT_FIELD_TENTATIVA',
+              'ALERT_FIELD_BATERIA']
+MAX_LITERAL = 255  # struct alert_segment.length é uint8_t
+
+DEFINE_RE = re.compile(r'#define\s+(\w+)\s+"((?:[^"\\]|\\.)*)"')
+COUNT_RE = re.compile(r'#define\s+ALERT_MESSAGE_COUNT\s+(\d+)')
+FIELDS_RE = re.compile(r'#define\s+ALERT_TEMPLATE_FIELDS\s+\{([^}]*)\}')
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+UNRESERVED = set(b'ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.~')
+
+
+def unescape(text):
+    """Interpreta os escapes simples de uma string C."""
+    return re.sub(r'\\(.)', lambda m: {'n': '\n', 't': '\t'}.get(m.group(1), m.group(1)), text)
+
+
+def url_encode(data):
+    """Replica url_encode() (inc/callmebot_whatsapp.c) sobre os bytes UTF-8."""
+    out = []
+    for b in data:
+        if b in UNRESERVED:
+            out.append(chr(b))
+        elif b == ord(' '):
+            out.append('+')
+        else:
+            out.append('%%%02X' % b)
+    return ''.join(out)
+
+
+def split(text, names):
+    """Retorna a lista de (campo, texto) de uma mensagem; campo 0 é texto fixo."""
+    segments = []
+    literal = ''
+    i = 0
+    while i < len(text):
+        field = 0
+        if text[i] == '{':
+            for n, name in enumerate(names[1:], 1):
+                if text.startswith('{%s}' % name, i):
+                    field = n
+                    break
+        if field == 0:
+            literal += text[i]
+            i += 1
+            continue
+        if literal:
+            segments.append((0, literal))
+        segments.append((field, ''))
+        literal = ''
+        i += len(names[field]) + 2
+    if literal:
+        segments.append((0, literal))
+    return segments
+
+
+def main(argv):
+    if len(argv) < 4:
+        sys.stderr.write(__doc__)
+        return 1
+
+    with open(argv[1], encoding='utf-8') as f:
+        header = f.read()
+    with open(argv[2], encoding='utf-8') as f:
+        names = [unescape(s) for s in STRING_RE.findall(FIELDS_RE.search(f.read()).group(1))]
+    if len(names) != len(ENUM_NAMES):
+        sys.stderr.write('ALERT_TEMPLATE_FIELDS difere de enum alert_field\n')
+        return 1
+
+    texts = {name: unescape(value) for name, value in DEFINE_RE.findall(header)}
+    count = int(COUNT_RE.search(header).group(1))
+    if count != len(MESSAGES) or any(name not in texts for name in MESSAGES):
+        sys.stderr.write('Mensagens de fábrica não correspondem a ALERT_MESSAGE_COUNT\n')
+        return 1
+
+    out = [
+        '// Arquivo gerado por tools/gen_alert_templates.py - não edite.',
+        '',
+        '#include "alert_template.h"',
+        '',
+    ]
+    templates = []
+    for n, name in enumerate(MESSAGES):
+        segments = split(texts[name], names)
+        fields = 0
+        out.append('// %s' % texts[name])
+        out.append('static const struct alert_segment message_%d_segments[%d] = {' % (n, len(segments)))
+        for field, literal in segments:
+            if field:
+                fields |= 1 << field
+                out.append('    {%s, 0, NULL},' % ENUM_NAMES[field])
+                continue
+            encoded = url_encode(literal.encode('utf-8'))
+            if len(encoded) > MAX_LITERAL:
+                sys.stderr.write('%s: texto fixo codificado com mais de %d bytes\n' % (name, MAX_LITERAL))
+                return 1
+            out.append('    {ALERT_FIELD_TEXT, %d, "%s"},' % (len(encoded), encoded))
+        out.append('};')
+        out.append('')
+        templates.append('    {%s, message_%d_segments, %d, 0x%02x, true},' % (name, n, len(segments), fields))
+
+    out.append('const struct alert_template alert_template_defaults[ALERT_MESSAGE_COUNT] = {')
+    out.extend(templates)
+    out.append('};')
+    out.append('')
+
+    with open(argv[3], 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,133 @@
+#!/usr/bin/env python3
+"""
+@file gen_audio_clips.py
+@brief Codifica os trechos de áudio de confirmação em IMA-ADPCM durante a compilação.
+
+Cada argumento nome=arquivo.wav gera a constante audio_clip_<nome>. O WAV deve
+ser mono, PCM de 16 bits, com taxa entre 8 e 16 kHz. Um arquivo que não existe
+é um erro; nome= (sem arquivo) gera o trecho vazio, e o firmware mantém apenas
+os sinais sonoros.
+
+O codificador acompanha exatamente o estado do decodificador de audio_pwm.c
+(um único bloco, preditor e índice iniciando em zero, nibble baixo primeiro).
+
+Uso:
+    gen_audio_clips.py <saida.c> nome=[arquivo.wav] [nome=[arquivo.wav] ...]
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import os
+import struct
+import sys
+import wave
+
+STEP_TABLE = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+    50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230,
+    253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876, 963,
+    1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630, 9493, 10442,
+    11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794,
+    32767,
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def decode_nibble(state, nibble):
+    """Mesma lógica de audio_adpcm_decode(); retorna o novo estado."""
+    predictor, index = state
+    step = STEP_TABLE[index]
+    diff = step >> 3
+    if nibble & 4:
+        diff += step
+    if nibble & 2:
+        diff += step >> 1
+    if nibble & 1:
+        diff += step >> 2
+    predictor = predictor - diff if nibble & 8 else predictor + diff
+    predictor = max(-32768, min(32767, predictor))
+    index = max(0, min(88, index + INDEX_TABLE[nibble]))
+    return predictor, index
+
+
+def encode(samples):
+    """Codifica amostras de 16 bits em nibbles IMA-ADPCM."""
+    state = (0, 0)
+    nibbles = []
+    for sample in samples:
+        predictor, index = state
+        step = STEP_TABLE[index]
+        diff = sample - predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+        if diff >= step >> 1:
+            nibble |= 2
+            diff -= step >> 1
+        if diff >= step >> 2:
+            nibble |= 1
+        state = decode_nibble(state, nibble)
+        nibbles.append(nibble)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+def read_wav(path):
+    """Lê um WAV mono de 16 bits e retorna (taxa, amostras)."""
+    with wave.open(path, 'rb') as w:
+        if w.getnchannels() != 1 or w.getsampwidth() != 2:
+            raise SystemExit('%s: o áudio deve ser mono com 16 bits' % path)
+        rate = w.getframerate()
+        if not 8000 <= rate <= 16000:
+            raise SystemExit('%s: taxa de amostragem %d fora de 8-16 kHz' % (path, rate))
+        frames = w.readframes(w.getnframes())
+    return rate, struct.unpack('<%dh' % (len(frames) // 2), frames)
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    out = [
+        '// Arquivo gerado por tools/gen_audio_clips.py - não edite.',
+        '',
+        '#include "audio_clips.h"',
+        '',
+    ]
+    for arg in argv[2:]:
+        name, path = arg.split('=', 1)
+        if not path:
+            out.append('// %s: sem trecho gravado' % name)
+            out.append('const struct audio_clip audio_clip_%s = {NULL, 0, 0};' % name)
+            out.append('')
+            continue
+        if not os.path.exists(path):
+            sys.stderr.write('%s: arquivo não encontrado\n' % path)
+            return 1
+
+        rate, samples = read_wav(path)
+        data = encode(samples)
+        out.append('// %s: %d amostras a %d Hz (%d bytes)' % (os.path.basename(path), len(samples), rate, len(data)))
+        out.append('static const uint8_t %s_data[%d] = {' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            out.append('    ' + ', '.join('0x%02x' % b for b in data[i:i + 16]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('const struct audio_clip audio_clip_%s = {%s_data, %d, %d};' % (name, name, len(samples), rate))
+        out.append('')
+
+    with open(argv[1], 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+"""
+@file gen_display_screens.py
+@brief Rasteriza as telas de status do display OLED em tempo de compilação.
+
+Lê as telas descritas em display_screens.def e a fonte de ssd1306_font.h e gera
+um arquivo C com a imagem de cada tela já no formato de páginas do SSD1306,
+precedida pelo byte de controle 0x40. As imagens cobrem apenas a faixa de
+páginas usada pelas mensagens, de modo que exibir uma tela se resume a enviar
+bytes que já estão na flash, sem renderização e sem cópia para a RAM.
+
+Uso:
+    gen_display_screens.py <display_screens.def> <ssd1306_font.h> <saida.c> [pagina_inicial]
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import re
+import sys
+
+DISPLAY_WIDTH = 128  # Largura do display em pixels
+CHAR_WIDTH = 8       # Largura de cada caractere da fonte em pixels
+FIRST_PAGE = 3       # Página em que as telas começam (mesmo y usado antes em display_text)
+
+SCREEN_RE = re.compile(r'DISPLAY_SCREEN\(\s*(\w+)\s*,(.*?)\)\s*$', re.S | re.M)
+STRING_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+HEX_RE = re.compile(r'0x([0-9a-fA-F]{2})')
+
+
+def strip_comments(text):
+    """Remove comentários de bloco e de linha do arquivo de definições."""
+    text = re.sub(r'/\*.*?\*/', '', text, flags=re.S)
+    return re.sub(r'//[^\n]*', '', text)
+
+
+def load_font(path):
+    """Carrega a tabela de glifos (8 bytes por caractere) de ssd1306_font.h."""
+    with open(path, encoding='utf-8') as f:
+        body = f.read().split('{', 1)[1].split('}', 1)[0]
+    data = [int(h, 16) for h in HEX_RE.findall(body)]
+    return [data[i:i + CHAR_WIDTH] for i in range(0, len(data), CHAR_WIDTH)]
+
+
+def font_index(character):
+    """Replica ssd1306_get_font() para escolher o glifo de um caractere."""
+    c = character.upper()
+    if 'A' <= c <= 'Z':
+        return ord(c) - ord('A') + 1
+    if '0' <= c <= '9':
+        return ord(c) - ord('0') + 27
+    if c == '!':
+        return 37
+    if c == '-':
+        return 38
+    return 0
+
+
+def load_screens(path):
+    """Retorna a lista de (nome, linhas) descrita em display_screens.def."""
+    with open(path, encoding='utf-8') as f:
+        text = strip_comments(f.read())
+    return [(name, STRING_RE.findall(args)) for name, args in SCREEN_RE.findall(text)]
+
+
+def rasterize(lines, pages, font):
+    """Desenha as linhas como ssd1306_draw_string() faria, uma linha por página."""
+    image = bytearray(DISPLAY_WIDTH * pages)
+    for page, line in enumerate(lines):
+        x = 0
+        for character in line:
+            if x > DISPLAY_WIDTH - CHAR_WIDTH:
+                break  # O driver descarta caracteres além da largura do display
+            glyph = font[font_index(character)]
+            offset = page * DISPLAY_WIDTH + x
+            image[offset:offset + CHAR_WIDTH] = bytes(glyph)
+            x += CHAR_WIDTH
+    return image
+
+
+def main(argv):
+    if len(argv) < 4:
+        sys.stderr.write(__doc__)
+        return 1
+
+    first_page = int(argv[4]) if len(argv) > 4 else FIRST_PAGE
+    font = load_font(argv[2])
+    screens = load_screens(argv[1])
+    pages = max(len(lines) for _, lines in screens)
+
+    out = [
+        '// Arquivo gerado por tools/gen_display_screens.py - não edite.',
+        '',
+        '#include "display_text.h"',
+        '',
+    ]
+    for name, lines in screens:
+        image = bytes([0x40]) + rasterize(lines, pages, font)
+        out.append('// %s' % ' | '.join(line.strip() for line in lines))
+        out.append('static const uint8_t %s_image[%d] = {' % (name, len(image)))
+        for i in range(0, len(image), 16):
+            out.append('    ' + ', '.join('0x%02x' % b for b in image[i:i + 16]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('const struct display_screen %s = {' % name)
+        out.append('    .start_page = %d,' % first_page)
+        out.append('    .end_page = %d,' % (first_page + pages - 1))
+        out.append('    .image = %s_image,' % name)
+        out.append('    .image_length = sizeof(%s_image),' % name)
+        out.append('};')
+        out.append('')
+
+    with open(argv[3], 'w', encoding='utf-8') as f:
+        f.write('\n'.join(out))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
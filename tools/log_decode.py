@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""
+@file log_decode.py
+@brief Reconstrói as mensagens de LOG() a partir do ELF do firmware.
+
+O dispositivo envia cada mensagem como uma linha "#L <cabeçalho> <instante>
+<argumentos...>" em hexadecimal (ver inc/log.h). O cabeçalho traz o endereço
+da string de formato na seção ".logstr" do ELF e o número de argumentos;
+argumentos %s são endereços de strings constantes na flash, lidos das seções
+alocadas do mesmo ELF. Linhas "#D <n>" indicam mensagens descartadas com o
+anel cheio. As demais linhas (console, relatórios) são repassadas sem
+alteração.
+
+Uso:
+    log_decode.py <firmware.elf> [arquivo]
+    log_decode.py <firmware.elf> --port /dev/ttyACM0   (requer pyserial)
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import re
+import struct
+import sys
+
+SPEC = re.compile(r'%([-+ #0]*\d*(?:\.\d+)?)(?:hh|h|ll|l|z|j|t)?([diouxXcs%])')
+
+
+class Elf:
+    """Leitor mínimo de ELF32 little-endian: apenas as tabelas de seções."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise SystemExit('%s: não é um ELF32 little-endian' % path)
+
+        shoff, = struct.unpack_from('<I', self.data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from('<HHH', self.data, 0x2E)
+        headers = [struct.unpack_from('<IIIIIIIIII', self.data, shoff + i * shentsize) for i in range(shnum)]
+        names_offset = headers[shstrndx][4]
+
+        self.sections = []
+        for name, kind, flags, addr, offset, size, _, _, _, _ in headers:
+            self.sections.append({
+                'name': self._cstring(names_offset + name),
+                'type': kind, 'flags': flags, 'addr': addr, 'offset': offset, 'size': size,
+            })
+
+        self.logstr = next((s for s in self.sections if s['name'] == '.logstr'), None)
+        if self.logstr is None:
+            raise SystemExit('%s: seção .logstr não encontrada (compilado com LOG_DEFERRED=0?)' % path)
+
+    def _cstring(self, offset):
+        end = self.data.index(b'\0', offset)
+        return self.data[offset:end].decode('utf-8', 'replace')
+
+    def format(self, address):
+        """String de formato com o identificador dado."""
+        s = self.logstr
+        if not s['addr'] <= address < s['addr'] + s['size']:
+            return None
+        return self._cstring(s['offset'] + address - s['addr'])
+
+    def string(self, address):
+        """String constante de uma seção alocada com conteúdo (flash)."""
+        for s in self.sections:
+            alloc = s['flags'] & 0x2 and s['type'] != 8  # SHF_ALLOC, exceto SHT_NOBITS
+            if alloc and s['addr'] <= address < s['addr'] + s['size']:
+                return self._cstring(s['offset'] + address - s['addr'])
+        return '<0x%08x>' % address
+
+
+def render(elf, fmt, args):
+    """Aplica os argumentos de 32 bits ao formato, no estilo de printf()."""
+    args = list(args)
+
+    def convert(match):
+        flags, kind = match.groups()
+        if kind == '%':
+            return '%'
+        value = args.pop(0) if args else 0
+        if kind in 'di':
+            value = value - (1 << 32) if value & 0x80000000 else value
+            kind = 'd'
+        elif kind == 's':
+            value = elf.string(value)
+        elif kind == 'c':
+            value = chr(value & 0xFF)
+        return ('%' + flags + kind) % value
+
+    return SPEC.sub(convert, fmt)
+
+
+def decode_line(elf, line):
+    fields = line.split()
+    if fields and fields[0] == '#D' and len(fields) == 2:
+        return '[%s mensagens descartadas]\n' % fields[1]
+    if not fields or fields[0] != '#L' or len(fields) < 3:
+        return line
+
+    try:
+        words = [int(w, 16) for w in fields[1:]]
+    except ValueError:
+        return line
+    header, time_us, args = words[0], words[1], words[2:]
+    fmt = elf.format(header & 0xFFFFFF)
+    if fmt is None:
+        return '[%10.6f] <formato desconhecido 0x%06x> %s\n' % (time_us / 1e6, header & 0xFFFFFF, args)
+
+    text = render(elf, fmt, args[:header >> 24])
+    if not text.endswith('\n'):
+        text += '\n'
+    return '[%10.6f] %s' % (time_us / 1e6, text)
+
+
+def serial_lines(port):
+    import serial
+
+    with serial.Serial(port, 115200) as s:
+        while True:
+            yield s.readline().decode('utf-8', 'replace')
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write(__doc__)
+        return 1
+
+    elf = Elf(argv[1])
+    if len(argv) > 3 and argv[2] == '--port':
+        lines = serial_lines(argv[3])
+    elif len(argv) > 2:
+        lines = open(argv[2], encoding='utf-8', errors='replace')
+    else:
+        lines = sys.stdin
+
+    try:
+        for line in lines:
+            sys.stdout.write(decode_line(elf, line))
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -0,0 +1,181 @@
+#!/usr/bin/env python3
+"""
+@file lwip_advisor.py
+@brief Recomenda os tamanhos do heap e dos pools do lwIP a partir do uso medido.
+
+Lê os blocos "#lwip begin/end" enviados pelo comando "lwip" do console USB
+(ver inc/net_memory.h), de um ou mais arquivos, da entrada padrão ou da porta
+serial. Capturas de vários ensaios (uso normal, rajadas de alertas, falhas de
+rede) são combinadas: para cada pool vale o maior pico observado. O tamanho
+recomendado é o pico mais a margem; um pool que falhou não tem o pico real
+conhecido e recebe o dobro do tamanho atual, para repetir o ensaio.
+
+Ao final são exibidas as linhas para inc/lwipopts.h (e inc/lwippools.h no
+modo NO_HEAP) e a RAM liberada, que pode ir para as filas da aplicação.
+
+Uso:
+    lwip_advisor.py [--margin 25] [arquivo...]
+    lwip_advisor.py --port /dev/ttyACM0   (requer pyserial)
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import argparse
+import math
+import sys
+
+# Opção de lwipopts.h que define o número de blocos de cada pool
+POOL_OPTIONS = {
+    'RAW_PCB': 'MEMP_NUM_RAW_PCB',
+    'UDP_PCB': 'MEMP_NUM_UDP_PCB',
+    'TCP_PCB': 'MEMP_NUM_TCP_PCB',
+    'TCP_PCB_LISTEN': 'MEMP_NUM_TCP_PCB_LISTEN',
+    'TCP_SEG': 'MEMP_NUM_TCP_SEG',
+    'REASSDATA': 'MEMP_NUM_REASSDATA',
+    'FRAG_PBUF': 'MEMP_NUM_FRAG_PBUF',
+    'NETBUF': 'MEMP_NUM_NETBUF',
+    'NETCONN': 'MEMP_NUM_NETCONN',
+    'TCPIP_MSG_API': 'MEMP_NUM_TCPIP_MSG_API',
+    'TCPIP_MSG_INPKT': 'MEMP_NUM_TCPIP_MSG_INPKT',
+    'ARP_QUEUE': 'MEMP_NUM_ARP_QUEUE',
+    'IGMP_GROUP': 'MEMP_NUM_IGMP_GROUP',
+    'NETDB': 'MEMP_NUM_NETDB',
+    'PBUF': 'MEMP_NUM_PBUF',
+    'PBUF_POOL': 'PBUF_POOL_SIZE',
+}
+
+# Pools dimensionados pelo próprio lwIP a partir de outras opções
+DERIVED = {'SYS_TIMEOUT'}
+
+# Limites do lwIP (init.c): TCP_SND_QUEUELEN >= 2 * TCP_SND_BUF / TCP_MSS e TCP_SND_BUF >= 2 * TCP_MSS
+MIN_TCP_SEG = 4
+
+
+def read_dumps(lines):
+    """Lista de blocos; cada bloco mapeia o nome a (tamanho, uso, pico, total, falhas)."""
+    dumps, current = [], None
+    for line in lines:
+        line = line.strip()
+        if line == '#lwip begin':
+            current = {}
+        elif line == '#lwip end' and current is not None:
+            dumps.append(current)
+            current = None
+        elif current is not None and line[:2] in ('M ', 'P '):
+            fields = line.split()
+            if len(fields) == 7:
+                current[fields[1]] = tuple(int(n) for n in fields[2:])
+    return dumps
+
+
+def read_serial(port):
+    """Envia o comando "lwip" e lê a resposta até "#lwip end"."""
+    import serial
+
+    with serial.Serial(port, 115200, timeout=2) as s:
+        s.reset_input_buffer()
+        s.write(b'lwip\n')
+        lines = []
+        while True:
+            line = s.readline().decode('utf-8', 'replace')
+            if not line:
+                raise SystemExit('%s: sem resposta ao comando "lwip"' % port)
+            lines.append(line)
+            if line.strip() == '#lwip end':
+                return lines
+
+
+def combine(dumps):
+    """Por pool: tamanho do bloco, total configurado, maior pico e total de falhas."""
+    pools = {}
+    for dump in dumps:
+        for name, (size, _, peak, total, errors) in dump.items():
+            _, _, old_peak, old_errors = pools.get(name, (size, total, 0, 0))
+            pools[name] = (size, total, max(old_peak, peak), old_errors + errors)
+    return pools
+
+
+def recommend(name, total, peak, errors, margin):
+    if errors:
+        return total * 2
+    wanted = math.ceil(peak * (1 + margin / 100.0))
+    if name == 'heap':
+        return max(256, int(math.ceil(wanted / 64.0)) * 64)  # Múltiplo de 64 bytes
+    if name == 'TCP_SEG':
+        return max(MIN_TCP_SEG, wanted)
+    return max(1, wanted)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Tamanhos recomendados para o heap e os pools do lwIP.')
+    parser.add_argument('files', nargs='*', help='capturas com a saída do comando "lwip"')
+    parser.add_argument('--port', help='lê diretamente da porta serial')
+    parser.add_argument('--margin', type=float, default=25, help='margem sobre o pico, em %% (padrão 25)')
+    args = parser.parse_args()
+
+    lines = []
+    if args.port:
+        lines = read_serial(args.port)
+    elif args.files:
+        for path in args.files:
+            with open(path, encoding='utf-8', errors='replace') as f:
+                lines.extend(f.readlines())
+    else:
+        lines = sys.stdin.readlines()
+
+    dumps = read_dumps(lines)
+    if not dumps:
+        sys.stderr.write('Nenhum bloco "#lwip begin" encontrado.\n')
+        return 1
+
+    pools = combine(dumps)
+    print('%d capturas, margem de %g%%' % (len(dumps), args.margin))
+    print('%-16s %6s %7s %7s %7s %11s %9s' % ('pool', 'bloco', 'atual', 'pico', 'falhas', 'recomendado', 'economia'))
+
+    defines, malloc_pools, notes = [], [], []
+    saved = 0
+    for name, (size, total, peak, errors) in pools.items():
+        if name in DERIVED or (name not in POOL_OPTIONS and name != 'heap' and not name.startswith('POOL_')):
+            print('%-16s %6d %7d %7d %7d %11s %9s' % (name, size, total, peak, errors, '-', '-'))
+            continue
+
+        count = recommend(name, total, peak, errors, args.margin)
+        delta = (total - count) * size
+        saved += delta
+        print('%-16s %6d %7d %7d %7d %11d %9d' % (name, size, total, peak, errors, count, delta))
+        if errors:
+            notes.append('%s falhou %d vezes: o tamanho recomendado dobra o atual; repita o ensaio.' % (name, errors))
+
+        if name == 'heap':
+            defines.append(('MEM_SIZE', count))
+        elif name.startswith('POOL_'):
+            malloc_pools.append('LWIP_MALLOC_MEMPOOL(%d, %s)' % (count, name[5:]))
+        else:
+            defines.append((POOL_OPTIONS[name], count))
+            if name == 'TCP_SEG':
+                defines.append(('TCP_SND_QUEUELEN', count))
+                defines.append(('TCP_SND_BUF', '(%d * TCP_MSS)' % (count // 2)))
+            elif name == 'PBUF_POOL':
+                notes.append('TCP_WND não deve passar de PBUF_POOL_SIZE * PBUF_POOL_BUFSIZE.')
+
+    print()
+    print('RAM liberada: %d bytes' % saved if saved >= 0 else 'RAM adicional: %d bytes' % -saved)
+    print()
+    print('inc/lwipopts.h:')
+    for option, value in defines:
+        print('#define %-27s %s' % (option, value))
+    if malloc_pools:
+        print()
+        print('inc/lwippools.h (NO_HEAP):')
+        for line in malloc_pools:
+            print(line)
+    if notes:
+        print()
+    for note in notes:
+        print('Atenção: ' + note)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,503 @@
+#!/usr/bin/env python3
+"""
+@file mem_report.py
+@brief Relatório de memória do firmware, com limites que falham a compilação.
+
+Lê o ELF e o mapa do ligador (-Wl,-Map) e informa:
+  - a ocupação de cada região de memória (FLASH, RAM, SCRATCH_X/Y), contando
+    na flash também a imagem de inicialização das seções copiadas para a RAM;
+  - a flash e a RAM usadas por módulo (arquivo objeto; os do SDK agrupados
+    pela biblioteca e os de arquivos .a pelo nome do arquivo);
+  - os maiores objetos estáticos na RAM e o mapa da RAM, seção por seção,
+    com o espaço restante para o heap (ou livre, no modo NO_HEAP);
+  - a pilha de pior caso de cada ponto de entrada, pelo grafo de chamadas
+    que o GCC gera com -fcallgraph-info=su (um arquivo .ci por objeto).
+
+Na pilha, o custo de uma chamada indireta é o da maior função sem chamadas
+diretas de entrada (tratadores, callbacks), contando um só nível de
+indireção; as interrupções somam o maior tratador mais o quadro de exceção
+do Cortex-M0+. Funções recursivas, de quadro dinâmico ou sem informação
+(bibliotecas pré-compiladas) são listadas; --assume informa o custo destas.
+
+Sai com código 1 se algum limite (--budget, --stack ENTRADA=BYTES) for
+ultrapassado.
+
+Uso:
+    mem_report.py <firmware.elf> [--map firmware.elf.map] [--ci-dir DIR]
+                  [--stack main=2048] [--irq isr_dma_0] [--assume memcpy=16]
+                  [--budget RAM=229376] [--top 15] [--output relatorio.txt]
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+SHT_SYMTAB = 2
+STT_OBJECT = 1
+PT_LOAD = 1
+
+EXCEPTION_FRAME = 32   # R0-R3, R12, LR, PC e xPSR empilhados pelo hardware
+INDIRECT = '__indirect_call'
+
+# Regiões do memmap_default.ld do SDK, usadas quando não há mapa
+DEFAULT_REGIONS = [
+    ('FLASH', 0x10000000, 2 * 1024 * 1024, False),
+    ('RAM', 0x20000000, 256 * 1024, True),
+    ('SCRATCH_X', 0x20040000, 4 * 1024, True),
+    ('SCRATCH_Y', 0x20041000, 4 * 1024, True),
+]
+
+
+class Elf:
+    """Leitor mínimo de ELF32 little-endian: seções, segmentos e símbolos."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        if self.data[:4] != b'\x7fELF' or self.data[4] != 1 or self.data[5] != 1:
+            raise SystemExit('%s: não é um ELF32 little-endian' % path)
+
+        phoff, shoff = struct.unpack_from('<II', self.data, 0x1C)
+        phentsize, phnum, shentsize, shnum, shstrndx = struct.unpack_from('<HHHHH', self.data, 0x2A)
+
+        self.segments = []
+        for i in range(phnum):
+            kind, _, vaddr, paddr, filesz, memsz, _, _ = struct.unpack_from('<IIIIIIII', self.data, phoff + i * phentsize)
+            if kind == PT_LOAD:
+                self.segments.append((vaddr, paddr, memsz))
+
+        headers = [struct.unpack_from('<IIIIIIIIII', self.data, shoff + i * shentsize) for i in range(shnum)]
+        names_offset = headers[shstrndx][4]
+
+        self.sections = []
+        for name, kind, flags, addr, offset, size, link, _, _, entsize in headers:
+            self.sections.append({
+                'name': self._cstring(names_offset + name),
+                'type': kind, 'flags': flags, 'addr': addr, 'offset': offset,
+                'size': size, 'link': link, 'entsize': entsize,
+            })
+
+    def _cstring(self, offset):
+        end = self.data.index(b'\0', offset)
+        return self.data[offset:end].decode('utf-8', 'replace')
+
+    def load_address(self, section):
+        """Endereço de carga (LMA) de uma seção, pelo segmento que a contém."""
+        for vaddr, paddr, memsz in self.segments:
+            if vaddr <= section['addr'] < vaddr + memsz:
+                return section['addr'] - vaddr + paddr
+        return section['addr']
+
+    def symbols(self):
+        """Tabela de símbolos: (nome, endereço, tamanho, tipo)."""
+        symtab = next((s for s in self.sections if s['type'] == SHT_SYMTAB), None)
+        if symtab is None:
+            return []
+        strtab = self.sections[symtab['link']]['offset']
+        result = []
+        for offset in range(symtab['offset'], symtab['offset'] + symtab['size'], symtab['entsize']):
+            name, value, size, info, _, _ = struct.unpack_from('<IIIBBH', self.data, offset)
+            result.append((self._cstring(strtab + name), value, size, info & 0xF))
+        return result
+
+    def objects(self):
+        """Símbolos de dados: (nome, endereço, tamanho)."""
+        return [(name, value, size) for name, value, size, kind in self.symbols() if kind == STT_OBJECT and size > 0]
+
+    def symbol(self, name):
+        """Endereço de um símbolo (por exemplo, definido pelo script de ligação), ou None."""
+        return next((value for symbol, value, _, _ in self.symbols() if symbol == name), None)
+
+
+class Regions:
+    """Regiões de memória: nome, origem, tamanho e se são graváveis (RAM)."""
+
+    def __init__(self, regions):
+        self.regions = regions
+
+    def find(self, address):
+        for name, origin, length, _ in self.regions:
+            if origin <= address < origin + length:
+                return name
+        return None
+
+    def is_ram(self, name):
+        return any(r[0] == name and r[3] for r in self.regions)
+
+
+def module_name(path):
+    """Agrupa os objetos do mapa por módulo do firmware, biblioteca do SDK ou arquivo .a."""
+    archive = re.match(r'(.*?)\((.*)\)$', path)
+    if archive:
+        return os.path.basename(archive.group(1))
+
+    path = path.replace('\\', '/')
+    relative = path.split('.dir/', 1)[-1]
+    parts = relative.split('/')
+    if len(parts) <= 2:
+        return re.sub(r'(\.c|\.cpp|\.S)?\.(obj|o)$', '', parts[-1])
+
+    # Fontes de fora do projeto (SDK): pela biblioteca de lib/ ou pelo diretório
+    if 'lib' in parts[:-2]:
+        return 'sdk/' + parts[parts.index('lib') + 1]
+    return 'sdk/' + parts[-2]
+
+
+def parse_map(path, elf):
+    """Regiões e (módulo, endereço, tamanho, LMA) de cada seção de entrada do mapa."""
+    with open(path, encoding='utf-8', errors='replace') as f:
+        lines = f.read().splitlines()
+
+    regions = []
+    i = 0
+    while i < len(lines) and not lines[i].startswith('Memory Configuration'):
+        i += 1
+    for line in lines[i + 1:]:
+        if line.startswith('Linker script and memory map'):
+            break
+        fields = line.split()
+        if len(fields) >= 3 and fields[1].startswith('0x') and fields[0] != '*default*':
+            attributes = fields[3] if len(fields) > 3 else ''
+            regions.append((fields[0], int(fields[1], 16), int(fields[2], 16), 'w' in attributes))
+
+    nobits = {s['name'] for s in elf.sections if s['type'] == SHT_NOBITS}
+    entries = []
+    output = None      # (nome, VMA, LMA)
+    pending = None
+    started = False
+    for line in lines:
+        if line.startswith('Linker script and memory map'):
+            started = True
+            continue
+        if not started or not line.strip():
+            continue
+
+        if not line.startswith(' '):
+            fields = line.split()
+            output = None
+            if len(fields) >= 3 and fields[1].startswith('0x'):
+                address = int(fields[1], 16)
+                load = re.search(r'load address (0x[0-9a-fA-F]+)', line)
+                output = (fields[0], address, int(load.group(1), 16) if load else address)
+            elif len(fields) == 1 and fields[0].startswith('.'):
+                pending = ('output', fields[0])
+            continue
+
+        fields = line.split()
+        if pending and pending[0] == 'output' and fields and fields[0].startswith('0x'):
+            address = int(fields[0], 16)
+            load = re.search(r'load address (0x[0-9a-fA-F]+)', line)
+            output = (pending[1], address, int(load.group(1), 16) if load else address)
+            pending = None
+            continue
+        pending_input = pending if pending and pending[0] == 'input' else None
+        pending = None
+        if output is None or not fields or fields[0] == '*fill*':
+            continue
+
+        if pending_input and fields[0].startswith('0x'):
+            fields = [pending_input[1]] + fields
+        if len(fields) == 1 and line.startswith(' .'):
+            pending = ('input', fields[0])
+            continue
+        if len(fields) < 4 or not fields[1].startswith('0x') or not fields[2].startswith('0x'):
+            continue
+
+        address, size = int(fields[1], 16), int(fields[2], 16)
+        if size == 0 or address == 0:
+            continue
+        load = None if output[0] in nobits else address - output[1] + output[2]
+        entries.append((module_name(' '.join(fields[3:])), address, size, load))
+
+    return Regions(regions or DEFAULT_REGIONS), entries
+
+
+def region_usage(elf, regions):
+    """Bytes ocupados em cada região, pelo endereço de execução e pelo de carga."""
+    usage = {}
+    for section in elf.sections:
+        if not section['flags'] & SHF_ALLOC or section['size'] == 0:
+            continue
+        placed = set()
+        region = regions.find(section['addr'])
+        if region:
+            placed.add(region)
+        if section['type'] != SHT_NOBITS:
+            region = regions.find(elf.load_address(section))
+            if region:
+                placed.add(region)
+        for region in placed:
+            usage[region] = usage.get(region, 0) + section['size']
+    return usage
+
+
+def module_usage(entries, regions):
+    """Flash e RAM por módulo, a partir das seções de entrada do mapa."""
+    usage = {}
+    for module, address, size, load in entries:
+        flash, ram = usage.get(module, (0, 0))
+        run = regions.find(address)
+        if run and regions.is_ram(run):
+            ram += size
+        if load is not None:
+            region = regions.find(load)
+            if region and not regions.is_ram(region):
+                flash += size
+        usage[module] = (flash, ram)
+    return usage
+
+
+class CallGraph:
+    """Grafo de chamadas reunido dos arquivos .ci gerados por -fcallgraph-info=su."""
+
+    NODE = re.compile(r'node:\s*\{\s*title:\s*"([^"]*)"\s*label:\s*"([^"]*)"([^}]*)\}')
+    EDGE = re.compile(r'edge:\s*\{\s*sourcename:\s*"([^"]*)"\s*targetname:\s*"([^"]*)"')
+    FRAME = re.compile(r'\\n(\d+) bytes \(([a-z,]+)\)')
+
+    def __init__(self):
+        self.frames = {}      # função -> bytes do quadro
+        self.dynamic = set()  # quadro de tamanho não limitado (alloca, VLA)
+        self.calls = {}
+
+    def load(self, directory):
+        for root, _, files in os.walk(directory):
+            for name in files:
+                if name.endswith('.ci'):
+                    with open(os.path.join(root, name), encoding='utf-8', errors='replace') as f:
+                        self._parse(f.read())
+
+    def _parse(self, text):
+        for title, label, _ in self.NODE.findall(text):
+            frame = self.FRAME.search(label)
+            if frame:
+                self.frames[title] = int(frame.group(1))
+                if frame.group(2) == 'dynamic':
+                    self.dynamic.add(title)
+        for source, target in self.EDGE.findall(text):
+            self.calls.setdefault(source, set()).add(target)
+
+    def resolve(self, name):
+        """Título de uma função; as estáticas são "arquivo.c:nome", com o caminho passado ao GCC."""
+        if name in self.frames or name in self.calls:
+            return name
+        suffix = ('/' if ':' in name else ':') + name
+        matches = [title for title in self.frames if title.endswith(suffix)]
+        return matches[0] if len(matches) == 1 else name
+
+    def roots(self, excluded):
+        """Funções definidas sem chamadas diretas: candidatas a alvo de ponteiro."""
+        called = set()
+        for targets in self.calls.values():
+            called |= targets
+        return [f for f in self.frames if f not in called and f not in excluded]
+
+
+class StackAnalysis:
+    """Profundidade de pior caso, com memória das funções já calculadas."""
+
+    def __init__(self, graph, assumed, indirect):
+        self.graph = graph
+        self.assumed = assumed
+        self.indirect = indirect
+        self.memo = {}
+        self.unknown = set()
+        self.recursive = set()
+
+    def depth(self, function, active=()):
+        """(bytes, caminho) da chamada mais profunda a partir de function."""
+        if function == INDIRECT:
+            return self.indirect, [INDIRECT]
+        if function in self.memo:
+            return self.memo[function]
+        if function in active:
+            self.recursive.add(function)
+            return 0, [function + ' (recursão)']
+
+        if function in self.graph.frames:
+            frame = self.graph.frames[function]
+        elif function in self.assumed:
+            frame = self.assumed[function]
+        else:
+            self.unknown.add(function)
+            frame = 0
+
+        deepest, path = 0, []
+        for callee in sorted(self.graph.calls.get(function, ())):
+            size, callee_path = self.depth(callee, active + (function,))
+            if size > deepest or not path:
+                deepest, path = size, callee_path
+
+        result = (frame + deepest, [function] + path)
+        # Só memoriza resultados que não dependem da pilha de chamadas ativa
+        if not any(step.endswith('(recursão)') for step in path):
+            self.memo[function] = result
+        return result
+
+
+def parse_sizes(values, option):
+    sizes = {}
+    for value in values:
+        name, sep, size = value.partition('=')
+        if not sep and option != '--stack':
+            raise SystemExit('%s espera NOME=BYTES: %s' % (option, value))
+        sizes[name] = int(size, 0) if size else None
+    return sizes
+
+
+def report(args):
+    lines = []
+    failed = False
+    elf = Elf(args.elf)
+
+    if args.map:
+        regions, entries = parse_map(args.map, elf)
+    else:
+        regions, entries = Regions(DEFAULT_REGIONS), []
+
+    budgets = parse_sizes(args.budget, '--budget')
+    usage = region_usage(elf, regions)
+    lines.append('Regiões de memória:')
+    for name, _, length, _ in regions.regions:
+        used = usage.get(name, 0)
+        budget = budgets.get(name)
+        line = '  %-10s %8d de %8d bytes (%5.1f%%)' % (name, used, length, 100.0 * used / length if length else 0)
+        if budget is not None:
+            line += ', limite %d' % budget
+            if used > budget:
+                line += ' ULTRAPASSADO'
+                failed = True
+        lines.append(line)
+    for name in budgets:
+        if name not in usage and all(r[0] != name for r in regions.regions):
+            raise SystemExit('--budget: região desconhecida %s' % name)
+
+    if entries:
+        modules = module_usage(entries, regions)
+        ordered = sorted(modules.items(), key=lambda item: (-(item[1][0] + item[1][1]), item[0]))
+        lines.append('')
+        lines.append('Uso por módulo (bytes):')
+        lines.append('  %-32s %8s %8s' % ('módulo', 'flash', 'RAM'))
+        for module, (flash, ram) in ordered[:args.top] if args.top else ordered:
+            lines.append('  %-32s %8d %8d' % (module, flash, ram))
+
+    objects = [o for o in elf.objects() if regions.is_ram(regions.find(o[1]) or '')]
+    objects.sort(key=lambda o: (-o[2], o[0]))
+    if objects:
+        lines.append('')
+        lines.append('Maiores objetos na RAM:')
+        for name, address, size in objects[:args.top or len(objects)]:
+            lines.append('  %8d  0x%08x  %s' % (size, address, name))
+
+    # Mapa fixo: seções na RAM por endereço e o espaço entre o fim delas e as pilhas
+    layout = sorted((s for s in elf.sections if s['flags'] & SHF_ALLOC and s['size'] > 0
+                     and regions.is_ram(regions.find(s['addr']) or '')), key=lambda s: s['addr'])
+    if layout:
+        lines.append('')
+        lines.append('Mapa da RAM:')
+        for section in layout:
+            lines.append('  0x%08x-0x%08x %8d  %s' % (section['addr'], section['addr'] + section['size'],
+                                                    section['size'], section['name']))
+        heap_start, heap_end = elf.symbol('end'), elf.symbol('__StackLimit')
+        if heap_start is not None and heap_end is not None and heap_end > heap_start:
+            lines.append('  0x%08x-0x%08x %8d  %s' % (heap_start, heap_end, heap_end - heap_start,
+                                                    '(livre: sem heap)' if args.no_heap else '(heap)'))
+
+    stacks = parse_sizes(args.stack, '--stack')
+    if args.ci_dir and stacks:
+        graph = CallGraph()
+        graph.load(args.ci_dir)
+        assumed = parse_sizes(args.assume, '--assume')
+        entries_by_name = {entry: graph.resolve(entry) for entry in stacks}
+        irqs = [graph.resolve(handler) for handler in args.irq]
+
+        # Um nível de indireção: chamadas indiretas dentro dos alvos não são somadas
+        target = None
+        if INDIRECT in assumed:
+            indirect, indirect_path = assumed[INDIRECT], ['(--assume)']
+        else:
+            target = StackAnalysis(graph, assumed, 0)
+            indirect, indirect_path = 0, []
+            for root in sorted(graph.roots(set(entries_by_name.values()) | set(irqs))):
+                size, path = target.depth(root)
+                if size > indirect:
+                    indirect, indirect_path = size, path
+
+        analysis = StackAnalysis(graph, assumed, indirect)
+        irq, irq_path = 0, []
+        for handler in irqs:
+            size, path = analysis.depth(handler)
+            if size > irq:
+                irq, irq_path = size, path
+        if args.irq:
+            irq += EXCEPTION_FRAME
+
+        lines.append('')
+        lines.append('Pilha de pior caso:')
+        lines.append('  chamada indireta: %d bytes (%s)' % (indirect, ' > '.join(indirect_path) or 'nenhuma'))
+        if args.irq:
+            lines.append('  interrupções: %d bytes (%s)' % (irq, ' > '.join(irq_path)))
+        for entry, budget in stacks.items():
+            size, path = analysis.depth(entries_by_name[entry])
+            line = '  %s: %d bytes' % (entry, size + irq)
+            if budget is not None:
+                line += ', limite %d' % budget
+                if size + irq > budget:
+                    line += ' ULTRAPASSADO'
+                    failed = True
+            lines.append(line)
+            lines.append('    ' + ' > '.join(path))
+
+        flagged = sorted(f for f in graph.dynamic if f in analysis.memo)
+        if flagged:
+            lines.append('  quadro dinâmico não limitado: ' + ', '.join(flagged))
+        if analysis.recursive:
+            lines.append('  recursão (um nível contado): ' + ', '.join(sorted(analysis.recursive)))
+        unknown = sorted(analysis.unknown | (target.unknown if target else set()))
+        if unknown:
+            lines.append('  sem informação (contadas como 0, ver --assume): ' + ', '.join(unknown))
+
+    # Caminhos absolutos das funções estáticas reduzidos ao nome do arquivo
+    return [re.sub(r'[^\s>(]*/([^/\s:]+:)', r'\1', line) for line in lines], failed
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Relatório de memória e pilha do firmware.')
+    parser.add_argument('elf', help='ELF do firmware')
+    parser.add_argument('--map', help='mapa gerado pelo ligador (-Wl,-Map)')
+    parser.add_argument('--ci-dir', help='diretório com os .ci de -fcallgraph-info=su')
+    parser.add_argument('--stack', action='append', default=[], metavar='ENTRADA[=BYTES]',
+                        help='ponto de entrada analisado e, opcionalmente, o limite da sua pilha')
+    parser.add_argument('--irq', action='append', default=[], metavar='NOME',
+                        help='tratador de interrupção somado a cada ponto de entrada')
+    parser.add_argument('--assume', action='append', default=[], metavar='NOME=BYTES',
+                        help='pilha de uma função sem .ci (ou de ' + INDIRECT + ')')
+    parser.add_argument('--budget', action='append', default=[], metavar='REGIÃO=BYTES',
+                        help='limite de ocupação de uma região de memória')
+    parser.add_argument('--top', type=int, default=15, help='linhas por tabela (0: todas)')
+    parser.add_argument('--output', help='grava o relatório completo neste arquivo')
+    parser.add_argument('--no-heap', action='store_true', help='firmware compilado com NO_HEAP')
+    args = parser.parse_args()
+
+    lines, failed = report(args)
+    print('\n'.join(lines))
+
+    if args.output:
+        args.top = 0
+        full, _ = report(args)
+        with open(args.output, 'w', encoding='utf-8') as f:
+            f.write('\n'.join(full) + '\n')
+
+    if failed:
+        print('mem_report: limite de memória ultrapassado', file=sys.stderr)
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
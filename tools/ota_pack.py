@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""
+@file ota_pack.py
+@brief Empacota um firmware para a atualização pela rede (inc/ota_update.h).
+
+Lê o binário do firmware compilado com OTA_UPDATE (seguranca_senior.bin,
+ligado no slot A) e grava a imagem servida por HTTP: o cabeçalho
+struct ota_image_header seguido do binário. A etiqueta do cabeçalho é o
+HMAC-SHA256, com a chave OTA_KEY de credentials.h, dos 16 primeiros bytes
+do cabeçalho seguidos do SHA-256 do binário.
+
+Sem um binário, --size gera uma imagem de bytes aleatórios do tamanho
+pedido, para ensaiar o download na simulação (host/).
+
+Uso:
+    ota_pack.py --key CHAVE --version 2 seguranca_senior.bin imagem.ota
+    ota_pack.py --key chave_simulada --version 2 --size 400000 imagem.ota
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import argparse
+import hashlib
+import hmac
+import os
+import struct
+import sys
+
+IMAGE_MAGIC = 0x3141544F  # "OTA1"
+SLOT_SIZE = 0xF8000       # OTA_SLOT_SIZE de inc/ota_slots.h
+
+
+def pack(binary, version, key):
+    digest = hashlib.sha256(binary).digest()
+    fields = struct.pack('<IIII', IMAGE_MAGIC, len(binary), version, 0xFFFFFFFF)
+    tag = hmac.new(key.encode(), fields + digest, hashlib.sha256).digest()
+    return fields + tag + binary, digest
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Imagem assinada para a atualização pela rede.')
+    parser.add_argument('--key', required=True, help='chave OTA_KEY de credentials.h')
+    parser.add_argument('--version', type=int, required=True,
+                        help='versão da imagem, maior que OTA_FIRMWARE_VERSION do firmware em execução')
+    parser.add_argument('--size', type=int, help='sem binário: imagem de SIZE bytes aleatórios')
+    parser.add_argument('files', nargs='+', help='[binário] imagem')
+    args = parser.parse_args()
+
+    if args.size is not None and len(args.files) == 1:
+        binary = os.urandom(args.size)
+    elif args.size is None and len(args.files) == 2:
+        with open(args.files[0], 'rb') as f:
+            binary = f.read()
+    else:
+        parser.error('informe o binário e a imagem, ou --size e a imagem')
+
+    if not 0 < len(binary) <= SLOT_SIZE:
+        sys.exit(f'o binário tem {len(binary)} bytes; o slot comporta {SLOT_SIZE}')
+
+    image, digest = pack(binary, args.version, args.key)
+    with open(args.files[-1], 'wb') as f:
+        f.write(image)
+    print(f'{args.files[-1]}: versão {args.version}, {len(binary)} bytes, SHA-256 {digest.hex()}')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+@file trace_report.py
+@brief Calcula os percentis de latência de cada etapa da entrega dos alertas.
+
+Lê a saída do comando "trace" do console USB (ver inc/trace.h), de um
+arquivo, da entrada padrão ou diretamente da porta serial, e exibe para cada
+ponto de rastreio o número de amostras e os percentis p50, p90, p99 e o
+máximo, em milissegundos desde a borda do botão. Os percentis do histograma
+são o limite superior da faixa (potências de 2); quando há registros brutos
+suficientes do ponto, os valores exatos deles também são exibidos.
+
+Uso:
+    trace_report.py [arquivo]
+    trace_report.py --port /dev/ttyACM0   (requer pyserial)
+
+@author Gabriel Mattano da Silva
+@date 2025
+"""
+
+import sys
+
+PERCENTILES = (50, 90, 99)
+
+
+def read_dump(lines):
+    """Extrai histogramas, registros e perdidos do bloco #trace begin/end."""
+    histograms, records, lost = {}, {}, 0
+    inside = False
+    for line in lines:
+        line = line.strip()
+        if line == '#trace begin':
+            histograms, records, lost = {}, {}, 0
+            inside = True
+        elif line == '#trace end':
+            inside = False
+        elif inside and line:
+            fields = line.split()
+            if fields[0] == 'H':
+                histograms[fields[1]] = [int(n) for n in fields[2:]]
+            elif fields[0] == 'R':
+                records.setdefault(fields[2], []).append(int(fields[4]))
+            elif fields[0] == 'L':
+                lost = int(fields[1])
+    return histograms, records, lost
+
+
+def read_serial(port):
+    """Envia o comando "trace" e lê a resposta até "#trace end"."""
+    import serial
+
+    with serial.Serial(port, 115200, timeout=2) as s:
+        s.reset_input_buffer()
+        s.write(b'trace\n')
+        lines = []
+        while True:
+            line = s.readline().decode('utf-8', 'replace')
+            if not line:
+                raise SystemExit('%s: sem resposta ao comando "trace"' % port)
+            lines.append(line)
+            if line.strip() == '#trace end':
+                return lines
+
+
+def bucket_limit_us(bucket):
+    """Limite superior da faixa: 0 us para a faixa 0, 2^n - 1 us para a faixa n."""
+    return (1 << bucket) - 1 if bucket else 0
+
+
+def histogram_percentile(counts, percentile):
+    total = sum(counts)
+    wanted = total * percentile / 100.0
+    seen = 0
+    for bucket, n in enumerate(counts):
+        seen += n
+        if n and seen >= wanted:
+            return bucket_limit_us(bucket)
+    return bucket_limit_us(len(counts) - 1)
+
+
+def exact_percentile(values, percentile):
+    ordered = sorted(values)
+    index = min(len(ordered) - 1, int(round((len(ordered) - 1) * percentile / 100.0)))
+    return ordered[index]
+
+
+def ms(us):
+    return '%9.3f' % (us / 1000.0)
+
+
+def main(argv):
+    if len(argv) > 2 and argv[1] == '--port':
+        lines = read_serial(argv[2])
+    elif len(argv) > 1:
+        with open(argv[1], encoding='utf-8', errors='replace') as f:
+            lines = f.readlines()
+    else:
+        lines = sys.stdin.readlines()
+
+    histograms, records, lost = read_dump(lines)
+    if not histograms:
+        sys.stderr.write('Nenhum bloco "#trace begin" encontrado.\n')
+        return 1
+
+    header = '%-12s %7s' % ('etapa', 'n') + ''.join('%10s' % ('p%d' % p) for p in PERCENTILES) + '%10s' % 'max'
+    print('Histogramas (ms desde a borda, limite superior da faixa):')
+    print(header)
+    for name, counts in histograms.items():
+        total = sum(counts)
+        if not total:
+            print('%-12s %7d' % (name, 0))
+            continue
+        last = max(b for b, n in enumerate(counts) if n)
+        row = ''.join(' ' + ms(histogram_percentile(counts, p)) for p in PERCENTILES)
+        print('%-12s %7d%s %s' % (name, total, row, ms(bucket_limit_us(last))))
+
+    if records:
+        print()
+        print('Registros recentes (ms desde a borda, valores exatos):')
+        print(header)
+        for name in histograms:
+            values = records.get(name)
+            if not values:
+                continue
+            row = ''.join(' ' + ms(exact_percentile(values, p)) for p in PERCENTILES)
+            print('%-12s %7d%s %s' % (name, len(values), row, ms(max(values))))
+
+    if lost:
+        print()
+        print('Atenção: %d registros sobrescritos antes de entrar nos histogramas.' % lost)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))